@@ -98,7 +98,7 @@ typedef struct {
 	odp_atomic_u32_t exit_threads;
 
 	/* forward func, hash or lpm */
-	int (*fwd_func)(odp_packet_t pkt, int sif);
+	void (*fwd_func)(odp_packet_t pkt[], int dif[], int num, int sif);
 } global_data_t;
 
 static global_data_t *global;
@@ -233,26 +233,32 @@ static inline int l3fwd_pkt_hash(odp_packet_t pkt, int sif)
 	return dif;
 }
 
-static inline int l3fwd_pkt_lpm(odp_packet_t pkt, int sif)
+static void l3fwd_fwd_hash(odp_packet_t pkt[], int dif[], int num, int sif)
 {
-	odph_ipv4hdr_t *ip;
-	odph_ethhdr_t *eth;
-	int dif;
-	int ret;
+	int i;
 
-	ip = odp_packet_l3_ptr(pkt, NULL);
-	ipv4_dec_ttl_csum_update(ip);
-	eth = odp_packet_l2_ptr(pkt, NULL);
+	for (i = 0; i < num; i++)
+		dif[i] = l3fwd_pkt_hash(pkt[i], sif);
+}
 
-	/* network byte order maybe different from host */
-	ret = fib_tbl_lookup(odp_be_to_cpu_32(ip->dst_addr), &dif);
-	if (ret)
-		dif = sif;
+static void l3fwd_fwd_lpm(odp_packet_t pkt[], int dif[], int num, int sif)
+{
+	odph_ipv4hdr_t *ip[num];
+	odph_ethhdr_t *eth;
+	int i;
 
-	eth->dst = global->eth_dest_mac[dif];
-	eth->src = global->l3fwd_pktios[dif].mac_addr;
+	for (i = 0; i < num; i++)
+		ip[i] = odp_packet_l3_ptr(pkt[i], NULL);
 
-	return dif;
+	/* Look up all destinations at once, no route: send by src port */
+	fib_tbl_lookup_multi(ip, dif, num, sif);
+
+	for (i = 0; i < num; i++) {
+		ipv4_dec_ttl_csum_update(ip[i]);
+		eth = odp_packet_l2_ptr(pkt[i], NULL);
+		eth->dst = global->eth_dest_mac[dif[i]];
+		eth->src = global->l3fwd_pktios[dif[i]].mac_addr;
+	}
 }
 
 /**
@@ -300,9 +306,11 @@ static int run_worker(void *arg)
 	odp_pktin_queue_t input_queues[thr_arg->nb_pktio];
 	odp_pktout_queue_t output_queues[global->cmd_args.if_count];
 	odp_packet_t pkt_tbl[MAX_PKT_BURST];
+	int dif_tbl[MAX_PKT_BURST];
 	odp_packet_t *tbl;
+	int *dif;
 	int pkts, drop, sent;
-	int dst_port, dif;
+	int dst_port;
 	int i, j;
 	int pktio = 0;
 	int num_pktio = 0;
@@ -352,13 +360,13 @@ static int run_worker(void *arg)
 		if (odp_unlikely(pkts < 1))
 			continue;
 
-		dif = global->fwd_func(pkt_tbl[0], if_idx);
+		global->fwd_func(pkt_tbl, dif_tbl, pkts, if_idx);
 		tbl = &pkt_tbl[0];
+		dif = &dif_tbl[0];
 		while (pkts) {
-			dst_port = dif;
+			dst_port = dif[0];
 			for (i = 1; i < pkts; i++) {
-				dif = global->fwd_func(tbl[i], if_idx);
-				if (dif != dst_port)
+				if (dif[i] != dst_port)
 					break;
 			}
 			sent = odp_pktout_send(output_queues[dst_port], tbl, i);
@@ -368,8 +376,10 @@ static int run_worker(void *arg)
 				thr_arg->tx_drops += i - sent;
 			}
 
-			if (i < pkts)
+			if (i < pkts) {
 				tbl += i;
+				dif += i;
+			}
 
 			pkts -= i;
 		}
@@ -1076,9 +1086,9 @@ int main(int argc, char **argv)
 
 	/* Decide ip lookup method */
 	if (args->hash_mode)
-		global->fwd_func = l3fwd_pkt_hash;
+		global->fwd_func = l3fwd_fwd_hash;
 	else
-		global->fwd_func = l3fwd_pkt_lpm;
+		global->fwd_func = l3fwd_fwd_lpm;
 
 	/* Start all the available ports */
 	for (i = 0; i < args->if_count; i++) {
@@ -1152,11 +1162,8 @@ int main(int argc, char **argv)
 		printf("Error: shm free shm_fwd_db\n");
 		exit(EXIT_FAILURE);
 	}
-	shm = odp_shm_lookup("fib_lpm_sub");
-	if (shm != ODP_SHM_INVALID && odp_shm_free(shm) != 0) {
-		printf("Error: shm free fib_lpm_sub\n");
-		exit(EXIT_FAILURE);
-	}
+	if (!args->hash_mode)
+		fib_tbl_term();
 
 	if (odp_pool_destroy(pool)) {
 		printf("Error: pool destroy\n");
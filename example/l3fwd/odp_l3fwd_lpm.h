@@ -11,8 +11,10 @@
 extern "C" {
 #endif
 void fib_tbl_init(void);
+void fib_tbl_term(void);
 void fib_tbl_insert(uint32_t ip, int port, int depth);
-int fib_tbl_lookup(uint32_t ip, int *port);
+void fib_tbl_lookup_multi(odph_ipv4hdr_t *ip[], int port[], int num,
+			  int def_port);
 #ifdef __cplusplus
 }
 #endif
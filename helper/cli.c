@@ -467,6 +467,86 @@ static int cmd_odp_schedule_print(struct cli_def *cli, const char *command ODP_U
 	return CLI_OK;
 }
 
+static void cli_log_wait_hist(const uint64_t wait_hist[])
+{
+	cli_log(ODP_LOG_PRINT, "  wait time histogram (ns):\n");
+
+	for (int i = 0; i < ODP_SCHEDULE_WAIT_HIST_BUCKETS; i++) {
+		if (wait_hist[i] == 0)
+			continue;
+
+		if (i == ODP_SCHEDULE_WAIT_HIST_BUCKETS - 1)
+			cli_log(ODP_LOG_PRINT, "    >= %" PRIu64 ": %" PRIu64 "\n",
+				(uint64_t)1 << (i - 1), wait_hist[i]);
+		else
+			cli_log(ODP_LOG_PRINT, "    < %" PRIu64 ": %" PRIu64 "\n",
+				(uint64_t)1 << i, wait_hist[i]);
+	}
+}
+
+static int cmd_odp_schedule_stats_print(struct cli_def *cli, const char *command ODP_UNUSED,
+					char *argv[] ODP_UNUSED, int argc)
+{
+	if (check_num_args(cli, argc, 0))
+		return CLI_ERROR;
+
+	odp_schedule_stats_t stats;
+
+	if (odp_schedule_stats(&stats) < 0) {
+		cli_error(cli, "%% Unable to query stats.");
+		return CLI_ERROR;
+	}
+
+	cli_log(ODP_LOG_PRINT, "Scheduler statistics\n--------------------\n");
+	cli_log(ODP_LOG_PRINT, "  rounds: %" PRIu64 "\n", stats.num_rounds);
+	cli_log(ODP_LOG_PRINT, "  empty rounds: %" PRIu64 "\n", stats.num_empty);
+	cli_log(ODP_LOG_PRINT, "  events: %" PRIu64 "\n", stats.num_events);
+	cli_log_wait_hist(stats.wait_hist);
+	cli_log(ODP_LOG_PRINT, "\n");
+
+	return CLI_OK;
+}
+
+static int cmd_odp_schedule_queue_stats_print(struct cli_def *cli,
+					      const char *command ODP_UNUSED, char *argv[],
+					      int argc)
+{
+	if (check_num_args(cli, argc, 1))
+		return CLI_ERROR;
+
+	odp_queue_t hdl = odp_queue_lookup(argv[0]);
+
+	if (hdl == ODP_QUEUE_INVALID) {
+		cli_error(cli, "%% Name not found.");
+		return CLI_ERROR;
+	}
+
+	odp_schedule_queue_stats_t stats;
+
+	if (odp_schedule_queue_stats(hdl, &stats) < 0) {
+		cli_error(cli, "%% Unable to query stats.");
+		return CLI_ERROR;
+	}
+
+	cli_log(ODP_LOG_PRINT, "Scheduled queue statistics\n--------------------------\n");
+	cli_log(ODP_LOG_PRINT, "  events: %" PRIu64 "\n", stats.num_events);
+	cli_log_wait_hist(stats.wait_hist);
+	cli_log(ODP_LOG_PRINT, "\n");
+
+	return CLI_OK;
+}
+
+static int cmd_odp_schedule_stats_reset(struct cli_def *cli, const char *command ODP_UNUSED,
+					char *argv[] ODP_UNUSED, int argc)
+{
+	if (check_num_args(cli, argc, 0))
+		return CLI_ERROR;
+
+	odp_schedule_stats_reset();
+
+	return CLI_OK;
+}
+
 static int cmd_odp_shm_print(struct cli_def *cli, const char *command ODP_UNUSED, char *argv[],
 			     int argc)
 {
@@ -715,6 +795,9 @@ static struct cli_def *create_cli(cli_shm_t *shm)
 	CMD(odp_queue_print_all, NULL);
 	CMD(odp_queue_print, "<name>");
 	CMD(odp_schedule_print, NULL);
+	CMD(odp_schedule_queue_stats_print, "<name>");
+	CMD(odp_schedule_stats_print, NULL);
+	CMD(odp_schedule_stats_reset, NULL);
 	CMD(odp_shm_print_all, NULL);
 	CMD(odp_shm_print, "<name>");
 	CMD(odp_sys_config_print, NULL);
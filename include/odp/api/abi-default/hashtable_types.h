@@ -0,0 +1,33 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#ifndef ODP_ABI_HASHTABLE_TYPES_H_
+#define ODP_ABI_HASHTABLE_TYPES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @internal Dummy type for strong typing */
+typedef struct { char dummy; /**< @internal Dummy */ } _odp_abi_hashtable_t;
+
+/** @addtogroup odp_hashtable
+ *  @{
+ */
+
+typedef _odp_abi_hashtable_t *odp_hashtable_t;
+
+#define ODP_HASHTABLE_INVALID   ((odp_hashtable_t)0)
+
+#define ODP_HASHTABLE_NAME_LEN  32
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,33 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#ifndef ODP_ABI_LPM_TYPES_H_
+#define ODP_ABI_LPM_TYPES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @internal Dummy type for strong typing */
+typedef struct { char dummy; /**< @internal Dummy */ } _odp_abi_lpm_t;
+
+/** @addtogroup odp_lpm
+ *  @{
+ */
+
+typedef _odp_abi_lpm_t *odp_lpm_t;
+
+#define ODP_LPM_INVALID   ((odp_lpm_t)0)
+
+#define ODP_LPM_NAME_LEN  32
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,10 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#ifndef ODP_ABI_QSBR_H_
+#define ODP_ABI_QSBR_H_
+
+/* Empty header required due to the inline functions */
+
+#endif
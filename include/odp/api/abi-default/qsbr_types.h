@@ -0,0 +1,33 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#ifndef ODP_ABI_QSBR_TYPES_H_
+#define ODP_ABI_QSBR_TYPES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @internal Dummy type for strong typing */
+typedef struct { char dummy; /**< @internal Dummy */ } _odp_abi_qsbr_t;
+
+/** @addtogroup odp_qsbr
+ *  @{
+ */
+
+typedef _odp_abi_qsbr_t *odp_qsbr_t;
+
+#define ODP_QSBR_INVALID   ((odp_qsbr_t)0)
+
+#define ODP_QSBR_NAME_LEN  32
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
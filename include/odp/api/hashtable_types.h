@@ -0,0 +1,18 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP hash table
+ */
+
+#ifndef ODP_API_HASHTABLE_TYPES_H_
+#define ODP_API_HASHTABLE_TYPES_H_
+
+#include <odp/api/abi/hashtable_types.h>
+
+#include <odp/api/spec/hashtable_types.h>
+
+#endif
@@ -0,0 +1,18 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP longest prefix match table
+ */
+
+#ifndef ODP_API_LPM_TYPES_H_
+#define ODP_API_LPM_TYPES_H_
+
+#include <odp/api/abi/lpm_types.h>
+
+#include <odp/api/spec/lpm_types.h>
+
+#endif
@@ -0,0 +1,18 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP quiescent state based reclamation
+ */
+
+#ifndef ODP_API_QSBR_TYPES_H_
+#define ODP_API_QSBR_TYPES_H_
+
+#include <odp/api/abi/qsbr_types.h>
+
+#include <odp/api/spec/qsbr_types.h>
+
+#endif
@@ -0,0 +1,191 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP hash table
+ */
+
+#ifndef ODP_API_SPEC_HASHTABLE_H_
+#define ODP_API_SPEC_HASHTABLE_H_
+#include <odp/visibility_begin.h>
+
+#include <odp/api/hashtable_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @addtogroup odp_hashtable
+ *  Concurrent hash table for fixed size keys and values
+ *  @{
+ */
+
+/**
+ * Query hash table capabilities
+ *
+ * @param[out] capa   Pointer to capability structure for output
+ *
+ * @retval 0 on success
+ * @retval <0 on failure
+ */
+int odp_hashtable_capability(odp_hashtable_capability_t *capa);
+
+/**
+ * Initialize hash table parameters
+ *
+ * Initialize an odp_hashtable_param_t to its default values for all fields.
+ *
+ * @param param   Parameter structure to be initialized
+ */
+void odp_hashtable_param_init(odp_hashtable_param_t *param);
+
+/**
+ * Create a hash table
+ *
+ * Create a hash table, which maps fixed size keys into fixed size values. Keys and values
+ * are copied into the hash table. The table is stored into shared memory and it can be
+ * used by all ODP threads.
+ *
+ * All hash table operations are multi-thread safe. Get operations (odp_hashtable_get() and
+ * odp_hashtable_get_multi()) do not take locks and may be performed concurrently with put
+ * and remove operations. A get operation that runs concurrently with a put or remove of
+ * the same key returns either the old or the new state of the entry.
+ *
+ * It is optional to give a name. Names do not have to be unique. However,
+ * odp_hashtable_lookup() returns only a single matching hash table.
+ *
+ * @param name     Name of the hash table or NULL. Maximum string length is
+ *                 ODP_HASHTABLE_NAME_LEN, including the null character.
+ * @param param    Hash table creation parameters
+ *
+ * @return Handle of the created hash table
+ * @retval ODP_HASHTABLE_INVALID  Hash table could not be created
+ */
+odp_hashtable_t odp_hashtable_create(const char *name, const odp_hashtable_param_t *param);
+
+/**
+ * Destroy a hash table
+ *
+ * Destroy a previously created hash table. Entries remaining in the table are discarded.
+ * The hash table must not be used by any thread after this call.
+ *
+ * @param ht       The hash table to be destroyed
+ *
+ * @retval  0 Success
+ * @retval <0 Failure
+ */
+int odp_hashtable_destroy(odp_hashtable_t ht);
+
+/**
+ * Find a hash table by name
+ *
+ * @param name      Name of the hash table
+ *
+ * @return Handle of the first matching hash table
+ * @retval ODP_HASHTABLE_INVALID  Hash table could not be found
+ */
+odp_hashtable_t odp_hashtable_lookup(const char *name);
+
+/**
+ * Get printable value for a hash table handle
+ *
+ * @param ht   Handle to be converted for debugging
+ * @return uint64_t value that can be used for debugging (e.g. printed)
+ */
+uint64_t odp_hashtable_to_u64(odp_hashtable_t ht);
+
+/**
+ * Put an entry into a hash table
+ *
+ * Adds a new entry with the key and the value into the hash table. When the key exists
+ * already in the table, the value of the entry is replaced.
+ *
+ * @param ht     Hash table handle
+ * @param key    Pointer to the key ('key_size' bytes)
+ * @param value  Pointer to the value ('value_size' bytes). Ignored when 'value_size' is zero.
+ *
+ * @retval 0 on success
+ * @retval <0 on failure (e.g. the table is full)
+ */
+int odp_hashtable_put(odp_hashtable_t ht, const void *key, const void *value);
+
+/**
+ * Get a value from a hash table
+ *
+ * Searches the hash table for the key. When the key is found, its value is copied into
+ * 'value'.
+ *
+ * @param      ht     Hash table handle
+ * @param      key    Pointer to the key ('key_size' bytes)
+ * @param[out] value  Pointer to output buffer for the value ('value_size' bytes), or NULL
+ *
+ * @retval 1 Key was found
+ * @retval 0 Key was not found
+ * @retval <0 on failure
+ */
+int odp_hashtable_get(odp_hashtable_t ht, const void *key, void *value);
+
+/**
+ * Get multiple values from a hash table
+ *
+ * Otherwise like odp_hashtable_get(), but searches a burst of keys. Processing multiple keys
+ * at once allows the implementation to hide memory access latency.
+ *
+ * @param      ht     Hash table handle
+ * @param      key    Array of pointers to keys
+ * @param[out] value  Array of pointers to output buffers for values, or NULL when values are
+ *                    not needed
+ * @param[out] found  Array of results. For each key, set to 1 when the key was found and
+ *                    to 0 when not.
+ * @param      num    Number of keys. The maximum value is
+ *                    odp_hashtable_capability_t::max_get_multi.
+ *
+ * @return Number of keys found (0 ... num)
+ * @retval <0 on failure
+ */
+int odp_hashtable_get_multi(odp_hashtable_t ht, const void *const key[], void *const value[],
+			    uint8_t found[], int num);
+
+/**
+ * Remove an entry from a hash table
+ *
+ * @param ht     Hash table handle
+ * @param key    Pointer to the key ('key_size' bytes)
+ *
+ * @retval 0 on success
+ * @retval <0 on failure (e.g. the key was not found)
+ */
+int odp_hashtable_remove(odp_hashtable_t ht, const void *key);
+
+/**
+ * Number of entries in a hash table
+ *
+ * @param ht     Hash table handle
+ *
+ * @return Number of entries currently stored in the hash table
+ */
+uint32_t odp_hashtable_count(odp_hashtable_t ht);
+
+/**
+ * Print debug information about the hash table
+ *
+ * Print implementation defined information about the hash table to the ODP log. The information
+ * is intended to be used for debugging.
+ *
+ * @param ht     Hash table handle
+ */
+void odp_hashtable_print(odp_hashtable_t ht);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <odp/visibility_end.h>
+#endif
@@ -0,0 +1,104 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP hash table types
+ */
+
+#ifndef ODP_API_SPEC_HASHTABLE_TYPES_H_
+#define ODP_API_SPEC_HASHTABLE_TYPES_H_
+#include <odp/visibility_begin.h>
+
+#include <odp/api/std_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup odp_hashtable ODP HASHTABLE
+ *  @{
+ */
+
+/**
+ * @typedef odp_hashtable_t
+ * Hash table handle
+ */
+
+/**
+ * @def ODP_HASHTABLE_INVALID
+ * Invalid hash table handle
+ */
+
+/**
+ * @def ODP_HASHTABLE_NAME_LEN
+ * Maximum hash table name length, including the null character
+ */
+
+/**
+ * Hash table capabilities
+ */
+typedef struct odp_hashtable_capability_t {
+	/** Maximum number of hash tables */
+	uint32_t max_tables;
+
+	/** Maximum number of entries per hash table */
+	uint32_t max_num;
+
+	/** Maximum key size in bytes */
+	uint32_t max_key_size;
+
+	/** Maximum value size in bytes */
+	uint32_t max_value_size;
+
+	/** Maximum number of keys in a single odp_hashtable_get_multi() call */
+	uint32_t max_get_multi;
+
+} odp_hashtable_capability_t;
+
+/**
+ * Hash table parameters
+ */
+typedef struct odp_hashtable_param_t {
+	/** Number of entries
+	 *
+	 *  The hash table is able to store at least this many entries. The value must not
+	 *  exceed odp_hashtable_capability_t::max_num. The default value is 0.
+	 */
+	uint32_t num;
+
+	/** Key size in bytes
+	 *
+	 *  All keys of the hash table are of this size. The value must be between 1 and
+	 *  odp_hashtable_capability_t::max_key_size. The default value is 0.
+	 */
+	uint32_t key_size;
+
+	/** Value size in bytes
+	 *
+	 *  All values of the hash table are of this size. The value must not exceed
+	 *  odp_hashtable_capability_t::max_value_size. When zero, the hash table stores only
+	 *  keys (a set). The default value is 0.
+	 */
+	uint32_t value_size;
+
+	/** Seed value for the key hash function
+	 *
+	 *  The default value is 0.
+	 */
+	uint32_t seed;
+
+} odp_hashtable_param_t;
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <odp/visibility_end.h>
+#endif
@@ -0,0 +1,196 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP longest prefix match table
+ */
+
+#ifndef ODP_API_SPEC_LPM_H_
+#define ODP_API_SPEC_LPM_H_
+#include <odp/visibility_begin.h>
+
+#include <odp/api/lpm_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @addtogroup odp_lpm
+ *  Longest prefix match (LPM) tables for IPv4 and IPv6 routing
+ *  @{
+ */
+
+/**
+ * Query LPM table capabilities
+ *
+ * @param[out] capa   Pointer to capability structure for output
+ *
+ * @retval 0 on success
+ * @retval <0 on failure
+ */
+int odp_lpm_capability(odp_lpm_capability_t *capa);
+
+/**
+ * Initialize LPM table parameters
+ *
+ * Initialize an odp_lpm_param_t to its default values for all fields.
+ *
+ * @param param   Parameter structure to be initialized
+ */
+void odp_lpm_param_init(odp_lpm_param_t *param);
+
+/**
+ * Create an LPM table
+ *
+ * Create a longest prefix match table, which maps IP address prefixes (routes) into next hop
+ * values. The table is stored into shared memory and it can be used by all ODP threads.
+ *
+ * All LPM table operations are multi-thread safe. Match operations (odp_lpm_match() and
+ * odp_lpm_match_multi()) do not take locks and may be performed concurrently with route
+ * add and delete operations. A match operation that runs concurrently with a route update
+ * returns a result that is consistent with the table state either before or after the update.
+ *
+ * It is optional to give a name. Names do not have to be unique. However,
+ * odp_lpm_lookup() returns only a single matching table.
+ *
+ * @param name     Name of the LPM table or NULL. Maximum string length is
+ *                 ODP_LPM_NAME_LEN, including the null character.
+ * @param param    LPM table creation parameters
+ *
+ * @return Handle of the created LPM table
+ * @retval ODP_LPM_INVALID  LPM table could not be created
+ */
+odp_lpm_t odp_lpm_create(const char *name, const odp_lpm_param_t *param);
+
+/**
+ * Destroy an LPM table
+ *
+ * Destroy a previously created LPM table. Routes remaining in the table are discarded.
+ * The table must not be used by any thread after this call.
+ *
+ * @param lpm      The LPM table to be destroyed
+ *
+ * @retval  0 Success
+ * @retval <0 Failure
+ */
+int odp_lpm_destroy(odp_lpm_t lpm);
+
+/**
+ * Find an LPM table by name
+ *
+ * @param name      Name of the LPM table
+ *
+ * @return Handle of the first matching LPM table
+ * @retval ODP_LPM_INVALID  LPM table could not be found
+ */
+odp_lpm_t odp_lpm_lookup(const char *name);
+
+/**
+ * Get printable value for an LPM table handle
+ *
+ * @param lpm  Handle to be converted for debugging
+ * @return uint64_t value that can be used for debugging (e.g. printed)
+ */
+uint64_t odp_lpm_to_u64(odp_lpm_t lpm);
+
+/**
+ * Add a route into an LPM table
+ *
+ * Adds a route for the prefix into the table. Prefix bits beyond 'prefix_len' are ignored.
+ * When the same prefix exists already in the table, its next hop value is replaced.
+ *
+ * @param lpm         LPM table handle
+ * @param prefix      Pointer to the prefix address in network byte order (4 bytes for
+ *                    ODP_LPM_IPV4 and 16 bytes for ODP_LPM_IPV6 tables)
+ * @param prefix_len  Prefix length in bits (0 ... 32 for IPv4, 0 ... 128 for IPv6)
+ * @param next_hop    Next hop value (0 ... odp_lpm_capability_t::max_next_hop)
+ *
+ * @retval 0 on success
+ * @retval <0 on failure (e.g. the table is full)
+ */
+int odp_lpm_route_add(odp_lpm_t lpm, const void *prefix, uint8_t prefix_len, uint32_t next_hop);
+
+/**
+ * Delete a route from an LPM table
+ *
+ * Deletes the route of the prefix from the table. Addresses that matched the deleted route
+ * match the next longest remaining prefix after the call.
+ *
+ * @param lpm         LPM table handle
+ * @param prefix      Pointer to the prefix address in network byte order
+ * @param prefix_len  Prefix length in bits
+ *
+ * @retval 0 on success
+ * @retval <0 on failure (e.g. the route was not found)
+ */
+int odp_lpm_route_del(odp_lpm_t lpm, const void *prefix, uint8_t prefix_len);
+
+/**
+ * Find the longest matching prefix of an address
+ *
+ * Searches the table for the longest prefix that matches the address and outputs the next
+ * hop value of the route.
+ *
+ * @param      lpm       LPM table handle
+ * @param      addr      Pointer to the address in network byte order
+ * @param[out] next_hop  Pointer to output the next hop value
+ *
+ * @retval 1 A matching route was found
+ * @retval 0 No matching route
+ * @retval <0 on failure
+ */
+int odp_lpm_match(odp_lpm_t lpm, const void *addr, uint32_t *next_hop);
+
+/**
+ * Find the longest matching prefixes of multiple addresses
+ *
+ * Otherwise like odp_lpm_match(), but searches a burst of addresses (e.g. destination
+ * addresses of a burst of packets). Processing multiple addresses at once allows the
+ * implementation to hide memory access latency.
+ *
+ * @param      lpm       LPM table handle
+ * @param      addr      Array of pointers to addresses in network byte order
+ * @param[out] next_hop  Array of next hop values for output. A value is written only when
+ *                       a matching route was found.
+ * @param[out] found     Array of results. For each address, set to 1 when a matching route
+ *                       was found and to 0 when not.
+ * @param      num       Number of addresses
+ *
+ * @return Number of addresses with a matching route (0 ... num)
+ * @retval <0 on failure
+ */
+int odp_lpm_match_multi(odp_lpm_t lpm, const void *const addr[], uint32_t next_hop[],
+			uint8_t found[], int num);
+
+/**
+ * Number of routes in an LPM table
+ *
+ * @param lpm    LPM table handle
+ *
+ * @return Number of routes currently stored in the table
+ */
+uint32_t odp_lpm_route_count(odp_lpm_t lpm);
+
+/**
+ * Print debug information about the LPM table
+ *
+ * Print implementation defined information about the LPM table to the ODP log. The
+ * information is intended to be used for debugging.
+ *
+ * @param lpm    LPM table handle
+ */
+void odp_lpm_print(odp_lpm_t lpm);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <odp/visibility_end.h>
+#endif
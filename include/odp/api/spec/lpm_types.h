@@ -0,0 +1,146 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP longest prefix match table types
+ */
+
+#ifndef ODP_API_SPEC_LPM_TYPES_H_
+#define ODP_API_SPEC_LPM_TYPES_H_
+#include <odp/visibility_begin.h>
+
+#include <odp/api/qsbr_types.h>
+#include <odp/api/std_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup odp_lpm ODP LPM
+ *  @{
+ */
+
+/**
+ * @typedef odp_lpm_t
+ * Longest prefix match table handle
+ */
+
+/**
+ * @def ODP_LPM_INVALID
+ * Invalid longest prefix match table handle
+ */
+
+/**
+ * @def ODP_LPM_NAME_LEN
+ * Maximum LPM table name length, including the null character
+ */
+
+/**
+ * LPM table address type
+ */
+typedef enum odp_lpm_type_t {
+	/** IPv4 addresses (4 bytes) */
+	ODP_LPM_IPV4 = 0,
+
+	/** IPv6 addresses (16 bytes) */
+	ODP_LPM_IPV6
+
+} odp_lpm_type_t;
+
+/**
+ * LPM table capabilities per address type
+ */
+typedef struct odp_lpm_type_capability_t {
+	/** Maximum number of routes per table */
+	uint32_t max_routes;
+
+	/** Maximum number of extension tables per table
+	 *
+	 *  See odp_lpm_param_t::num_ext for details.
+	 */
+	uint32_t max_ext;
+
+} odp_lpm_type_capability_t;
+
+/**
+ * LPM table capabilities
+ */
+typedef struct odp_lpm_capability_t {
+	/** Maximum number of LPM tables */
+	uint32_t max_tables;
+
+	/** Maximum next hop value */
+	uint32_t max_next_hop;
+
+	/** IPv4 table capabilities */
+	odp_lpm_type_capability_t ipv4;
+
+	/** IPv6 table capabilities */
+	odp_lpm_type_capability_t ipv6;
+
+} odp_lpm_capability_t;
+
+/**
+ * LPM table parameters
+ */
+typedef struct odp_lpm_param_t {
+	/** Address type
+	 *
+	 *  The default value is ODP_LPM_IPV4.
+	 */
+	odp_lpm_type_t type;
+
+	/** Maximum number of routes
+	 *
+	 *  The table is able to store at least this many routes (prefixes). The value must be
+	 *  between 1 and 'max_routes' capability of the address type. The default value is 0.
+	 */
+	uint32_t max_routes;
+
+	/** Number of extension tables
+	 *
+	 *  Implementations may store prefixes longer than a fixed number of bits into
+	 *  extension tables, which are allocated from a pool of this size. The value must not
+	 *  exceed 'max_ext' capability of the address type. When zero, the implementation
+	 *  selects the number based on 'max_routes'. Route add operations may fail before
+	 *  'max_routes' routes have been added, when a large portion of the routes is long
+	 *  and the number of extension tables is too small. Without a QSBR domain (see
+	 *  'qsbr'), extension tables may stay allocated after the routes stored in them have
+	 *  been deleted, so the number should account also for route churn. The default value
+	 *  is 0.
+	 */
+	uint32_t num_ext;
+
+	/** QSBR domain for extension table reclamation
+	 *
+	 *  Route updates may leave extension tables unused. Match operations run concurrently
+	 *  with updates, so an unused table is reused only after a grace period of this
+	 *  domain has ended. Threads that call match operations must be online in
+	 *  the domain and report quiescent states outside of match calls. Route add
+	 *  operations check grace periods without waiting (see odp_qsbr_check()), so
+	 *  the calling thread reports a quiescent state when it is online in the domain.
+	 *  A route add may fail temporarily when the remaining free extension tables are
+	 *  still waiting for their grace period to end.
+	 *
+	 *  When ODP_QSBR_INVALID, extension tables are never reused for other prefixes. A
+	 *  table stays allocated after the routes under it have been deleted. It is reused
+	 *  only for new routes under the same prefix. The default value is
+	 *  ODP_QSBR_INVALID.
+	 */
+	odp_qsbr_t qsbr;
+
+} odp_lpm_param_t;
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <odp/visibility_end.h>
+#endif
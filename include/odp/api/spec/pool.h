@@ -200,6 +200,27 @@ int odp_pool_stats(odp_pool_t pool, odp_pool_stats_t *stats);
 int odp_pool_stats_selected(odp_pool_t pool, odp_pool_stats_selected_t *stats,
 			    const odp_pool_stats_opt_t *opt);
 
+/**
+ * Get selected pool statistics of a packet pool subparameter
+ *
+ * Read the selected counters of a single subparameter of a packet pool created with
+ * subparameters (odp_pool_param_t::pkt::num_subparam > 0). Index 0 refers to the main num/len
+ * specification ('pkt.num' and 'pkt.len'), and index N + 1 to subparameter 'pkt.sub[N]'. Valid
+ * index values range from 0 to 'pkt.num_subparam'. Counters of odp_pool_stats() and
+ * odp_pool_stats_selected() are sums over all subparameters. Otherwise, the function behaves
+ * as odp_pool_stats_selected().
+ *
+ * @param         pool   Packet pool handle
+ * @param         idx    Subparameter index
+ * @param[out]    stats  Output buffer for counters
+ * @param         opt    Bit field for selecting the counters to be read
+ *
+ * @retval  0 on success
+ * @retval <0 on failure
+ */
+int odp_pool_stats_subparam(odp_pool_t pool, uint32_t idx, odp_pool_stats_selected_t *stats,
+			    const odp_pool_stats_opt_t *opt);
+
 /**
  * Reset statistics for pool
  *
@@ -0,0 +1,242 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP quiescent state based reclamation
+ */
+
+#ifndef ODP_API_SPEC_QSBR_H_
+#define ODP_API_SPEC_QSBR_H_
+#include <odp/visibility_begin.h>
+
+#include <odp/api/qsbr_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @addtogroup odp_qsbr
+ *  Quiescent state based reclamation (QSBR) of shared objects
+ *
+ *  QSBR enables lock-free readers of shared data structures: readers access objects
+ *  without locks, atomic operations or reference counts, and writers free removed
+ *  objects only after all readers have stopped using them.
+ *
+ *  A thread that accesses objects protected by a QSBR domain is online in the domain.
+ *  An online thread reports periodically a quiescent state, which is a point in
+ *  the thread execution where it does not hold any references to the protected objects.
+ *  A grace period ends when every thread that was online at the start of the period has
+ *  either reported a quiescent state or gone offline. After a writer has removed an
+ *  object from a data structure, it waits for a grace period end (odp_qsbr_synchronize())
+ *  or defers the free until a grace period has ended (odp_qsbr_defer()).
+ *  @{
+ */
+
+/**
+ * Query QSBR capabilities
+ *
+ * @param[out] capa   Pointer to capability structure for output
+ *
+ * @retval 0 on success
+ * @retval <0 on failure
+ */
+int odp_qsbr_capability(odp_qsbr_capability_t *capa);
+
+/**
+ * Initialize QSBR domain parameters
+ *
+ * Initialize an odp_qsbr_param_t to its default values for all fields.
+ *
+ * @param param   Parameter structure to be initialized
+ */
+void odp_qsbr_param_init(odp_qsbr_param_t *param);
+
+/**
+ * Create a QSBR domain
+ *
+ * Create a QSBR domain, which tracks quiescent states of ODP threads. The domain is stored
+ * into shared memory and it can be used by all ODP threads. Initially, all threads are
+ * offline in the domain.
+ *
+ * It is optional to give a name. Names do not have to be unique. However,
+ * odp_qsbr_lookup() returns only a single matching domain.
+ *
+ * @param name     Name of the QSBR domain or NULL. Maximum string length is
+ *                 ODP_QSBR_NAME_LEN, including the null character.
+ * @param param    QSBR domain parameters
+ *
+ * @return Handle of the created QSBR domain
+ * @retval ODP_QSBR_INVALID  QSBR domain could not be created
+ */
+odp_qsbr_t odp_qsbr_create(const char *name, const odp_qsbr_param_t *param);
+
+/**
+ * Destroy a QSBR domain
+ *
+ * Destroy a previously created QSBR domain. All threads must be offline in the domain.
+ * Frees that are still pending in the deferred free queue are executed before the call
+ * returns.
+ *
+ * @param qsbr     The QSBR domain to be destroyed
+ *
+ * @retval  0 Success
+ * @retval <0 Failure
+ */
+int odp_qsbr_destroy(odp_qsbr_t qsbr);
+
+/**
+ * Find a QSBR domain by name
+ *
+ * @param name      Name of the QSBR domain
+ *
+ * @return Handle of the first matching QSBR domain
+ * @retval ODP_QSBR_INVALID  QSBR domain could not be found
+ */
+odp_qsbr_t odp_qsbr_lookup(const char *name);
+
+/**
+ * Get printable value for a QSBR domain handle
+ *
+ * @param qsbr  Handle to be converted for debugging
+ * @return uint64_t value that can be used for debugging (e.g. printed)
+ */
+uint64_t odp_qsbr_to_u64(odp_qsbr_t qsbr);
+
+/**
+ * Set the calling thread online in a QSBR domain
+ *
+ * The thread must be online in the domain before it accesses any objects protected by
+ * the domain. Objects that were removed before this call may not be accessed by the thread.
+ *
+ * @param qsbr     QSBR domain handle
+ *
+ * @retval 0 on success
+ * @retval <0 on failure
+ */
+int odp_qsbr_thread_online(odp_qsbr_t qsbr);
+
+/**
+ * Set the calling thread offline in a QSBR domain
+ *
+ * An offline thread does not access objects protected by the domain and grace periods
+ * do not wait for it. This is also an implicit quiescent state. A thread that blocks
+ * for long periods (e.g. waits for input or sleeps) should go offline for the duration,
+ * so that it does not delay reclamation. A thread must go offline in all domains before
+ * calling odp_term_local().
+ *
+ * @param qsbr     QSBR domain handle
+ */
+void odp_qsbr_thread_offline(odp_qsbr_t qsbr);
+
+/**
+ * Report a quiescent state
+ *
+ * Reports that the calling thread does not hold references to any objects protected by
+ * the domain. This call is intended to be used on the fast path (e.g. once per packet
+ * burst) and it does not perform any atomic read-modify-write operations. The thread
+ * must be online in the domain.
+ *
+ * @param qsbr     QSBR domain handle
+ */
+void odp_qsbr_quiescent(odp_qsbr_t qsbr);
+
+/**
+ * Start a grace period
+ *
+ * Starts a new grace period and returns a token for it. A writer calls this after it has
+ * removed objects from a shared data structure, and later checks with odp_qsbr_check()
+ * when the grace period has ended and the objects may be freed.
+ *
+ * @param qsbr     QSBR domain handle
+ *
+ * @return Grace period token
+ */
+uint64_t odp_qsbr_start(odp_qsbr_t qsbr);
+
+/**
+ * Check if a grace period has ended
+ *
+ * Checks if all threads that were online when the grace period of the token was started
+ * have since then reported a quiescent state or gone offline. The calling thread itself
+ * reports a quiescent state when it is online in the domain, and thus it must not hold
+ * references to protected objects.
+ *
+ * @param qsbr     QSBR domain handle
+ * @param token    Grace period token from odp_qsbr_start()
+ * @param wait     When false, return immediately. When true, wait until the grace
+ *                 period has ended.
+ *
+ * @retval 1 Grace period has ended
+ * @retval 0 Grace period has not ended yet
+ */
+int odp_qsbr_check(odp_qsbr_t qsbr, uint64_t token, odp_bool_t wait);
+
+/**
+ * Wait for a grace period end
+ *
+ * Starts a new grace period and waits until it has ended. Equivalent to
+ * odp_qsbr_check(qsbr, odp_qsbr_start(qsbr), true).
+ *
+ * @param qsbr     QSBR domain handle
+ */
+void odp_qsbr_synchronize(odp_qsbr_t qsbr);
+
+/**
+ * Defer a free until a grace period has ended
+ *
+ * Starts a new grace period and stores the pointer into the deferred free queue of
+ * the domain. The free function is called with the pointer from a later reclaim call
+ * (odp_qsbr_reclaim(), odp_qsbr_defer() or odp_qsbr_destroy()), after the grace period
+ * has ended. When the queue is full, this call first tries to reclaim some entries
+ * without waiting.
+ *
+ * Free functions are called while the queue is locked and they must not call QSBR
+ * functions on the same domain.
+ *
+ * @param qsbr     QSBR domain handle
+ * @param free_fn  Free function
+ * @param ptr      Pointer to be passed to the free function
+ *
+ * @retval 0 on success
+ * @retval <0 on failure (e.g. the queue is full)
+ */
+int odp_qsbr_defer(odp_qsbr_t qsbr, odp_qsbr_free_fn_t free_fn, void *ptr);
+
+/**
+ * Reclaim deferred frees
+ *
+ * Calls the free functions of deferred free queue entries, whose grace period has ended.
+ * Entries are processed in the order they were deferred. Does not wait for grace periods
+ * to end. The calling thread itself reports a quiescent state when it is online in
+ * the domain.
+ *
+ * @param qsbr     QSBR domain handle
+ * @param max_num  Maximum number of entries to reclaim
+ *
+ * @return Number of entries reclaimed (0 ... max_num)
+ */
+uint32_t odp_qsbr_reclaim(odp_qsbr_t qsbr, uint32_t max_num);
+
+/**
+ * Print debug information about the QSBR domain
+ *
+ * Print implementation defined information about the QSBR domain to the ODP log.
+ * The information is intended to be used for debugging.
+ *
+ * @param qsbr    QSBR domain handle
+ */
+void odp_qsbr_print(odp_qsbr_t qsbr);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <odp/visibility_end.h>
+#endif
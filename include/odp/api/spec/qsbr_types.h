@@ -0,0 +1,99 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP quiescent state based reclamation types
+ */
+
+#ifndef ODP_API_SPEC_QSBR_TYPES_H_
+#define ODP_API_SPEC_QSBR_TYPES_H_
+#include <odp/visibility_begin.h>
+
+#include <odp/api/std_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup odp_qsbr ODP QSBR
+ *  @{
+ */
+
+/**
+ * @typedef odp_qsbr_t
+ * QSBR domain handle
+ */
+
+/**
+ * @def ODP_QSBR_INVALID
+ * Invalid QSBR domain handle
+ */
+
+/**
+ * @def ODP_QSBR_NAME_LEN
+ * Maximum QSBR domain name length, including the null character
+ */
+
+/**
+ * Deferred free function
+ *
+ * Called by odp_qsbr_reclaim() (and other calls that reclaim memory) for a pointer that was
+ * passed to odp_qsbr_defer(), after a grace period has ended.
+ *
+ * @param ptr   Pointer that was passed to odp_qsbr_defer()
+ */
+typedef void (*odp_qsbr_free_fn_t)(void *ptr);
+
+/**
+ * QSBR capabilities
+ */
+typedef struct odp_qsbr_capability_t {
+	/** Maximum number of QSBR domains */
+	uint32_t max_domains;
+
+	/** Maximum size of the deferred free queue per domain
+	 *
+	 *  See odp_qsbr_param_t::num_defer for details.
+	 */
+	uint32_t max_defer;
+
+} odp_qsbr_capability_t;
+
+/**
+ * QSBR domain parameters
+ */
+typedef struct odp_qsbr_param_t {
+	/** Size of the deferred free queue
+	 *
+	 *  Maximum number of pointers that may wait for a grace period end in
+	 *  odp_qsbr_defer() queue at a time. The value must not exceed 'max_defer'
+	 *  capability. When zero, odp_qsbr_defer() cannot be used with the domain.
+	 *  The default value is 0.
+	 */
+	uint32_t num_defer;
+
+	/** Report quiescent states from the scheduler
+	 *
+	 *  When true, an odp_schedule() call (or any other schedule call that may return
+	 *  events) reports a quiescent state on behalf of the calling thread, when the thread
+	 *  is online in the domain. The application must then not keep references to objects
+	 *  protected by the domain over schedule calls. When false, threads report quiescent
+	 *  states only with odp_qsbr_quiescent() calls. The default value is false.
+	 */
+	odp_bool_t sched_quiescent;
+
+} odp_qsbr_param_t;
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <odp/visibility_end.h>
+#endif
@@ -597,6 +597,59 @@ void odp_schedule_order_wait(void);
  */
 void odp_schedule_print(void);
 
+/**
+ * Read scheduler statistics
+ *
+ * Read scheduler statistics summed over all threads. Statistics are counted
+ * since ODP initialization or the previous odp_schedule_stats_reset() call.
+ * Values are read while other threads may be updating them, so a read
+ * is not an atomic snapshot of all counters.
+ *
+ * @param[out] stats   Pointer to statistics output structure
+ *
+ * @retval 0 on success
+ * @retval <0 on failure, e.g. when statistics are not supported
+ *
+ * @see odp_schedule_capability()
+ */
+int odp_schedule_stats(odp_schedule_stats_t *stats);
+
+/**
+ * Read scheduler statistics of a thread
+ *
+ * Same as odp_schedule_stats(), but reads statistics of a single thread.
+ *
+ * @param      thr     Thread ID (see odp_thread_id())
+ * @param[out] stats   Pointer to statistics output structure
+ *
+ * @retval 0 on success
+ * @retval <0 on failure
+ */
+int odp_schedule_thread_stats(int thr, odp_schedule_stats_t *stats);
+
+/**
+ * Read scheduled queue statistics
+ *
+ * Read statistics of events scheduled from the queue. Statistics are counted
+ * since queue creation or the previous odp_schedule_stats_reset() call.
+ *
+ * @param      queue   Scheduled queue handle
+ * @param[out] stats   Pointer to statistics output structure
+ *
+ * @retval 0 on success
+ * @retval <0 on failure
+ */
+int odp_schedule_queue_stats(odp_queue_t queue, odp_schedule_queue_stats_t *stats);
+
+/**
+ * Reset scheduler statistics
+ *
+ * Reset all scheduler, thread and queue statistics to zero. Statistics updates
+ * that are concurrent to the reset may be lost or retained. This function does
+ * nothing if statistics are not supported.
+ */
+void odp_schedule_stats_reset(void);
+
 /**
  * @}
  */
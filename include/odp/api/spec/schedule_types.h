@@ -271,6 +271,11 @@ typedef struct odp_schedule_capability_t {
 	 *  does nothing. */
 	odp_support_t order_wait;
 
+	/** Scheduler statistics support. If not supported,
+	 *  odp_schedule_stats(), odp_schedule_thread_stats() and
+	 *  odp_schedule_queue_stats() return failure. */
+	odp_support_t stats;
+
 	/** Event aggregator capabilities for scheduled queues */
 	odp_event_aggr_capability_t aggr;
 
@@ -711,6 +716,54 @@ typedef struct odp_schedule_group_info_t {
 
 } odp_schedule_group_info_t;
 
+/**
+ * Number of buckets in scheduler wait time histograms
+ *
+ * Bucket 0 counts events that waited less than 1 nanosecond. Bucket N
+ * (N > 0) counts events that waited [2^(N-1), 2^N) nanoseconds. The last
+ * bucket counts also all events that waited longer than that.
+ */
+#define ODP_SCHEDULE_WAIT_HIST_BUCKETS 32
+
+/**
+ * Scheduler statistics
+ *
+ * Event wait time is measured from the moment an event was enqueued into a
+ * scheduled queue until the moment it was handed out by the scheduler. Events
+ * received directly from packet input queues do not have an enqueue time and
+ * are counted only in 'num_events'.
+ */
+typedef struct odp_schedule_stats_t {
+	/** Number of schedule rounds, i.e. internal scheduling attempts */
+	uint64_t num_rounds;
+
+	/** Number of schedule rounds that did not return any events */
+	uint64_t num_empty;
+
+	/** Number of events returned by the scheduler */
+	uint64_t num_events;
+
+	/** Event wait time histogram
+	 *
+	 *  See ODP_SCHEDULE_WAIT_HIST_BUCKETS for bucket boundaries. */
+	uint64_t wait_hist[ODP_SCHEDULE_WAIT_HIST_BUCKETS];
+
+} odp_schedule_stats_t;
+
+/**
+ * Scheduled queue statistics
+ */
+typedef struct odp_schedule_queue_stats_t {
+	/** Number of events scheduled from the queue */
+	uint64_t num_events;
+
+	/** Event wait time histogram
+	 *
+	 *  See ODP_SCHEDULE_WAIT_HIST_BUCKETS for bucket boundaries. */
+	uint64_t wait_hist[ODP_SCHEDULE_WAIT_HIST_BUCKETS];
+
+} odp_schedule_queue_stats_t;
+
 /**
  * @}
  */
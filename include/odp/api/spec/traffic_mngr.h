@@ -619,6 +619,24 @@ typedef struct {
 	 */
 	odp_packet_ref_types_t packet_ref;
 
+	/** TM queue flow queuing capabilities
+	 *
+	 *  Flow queuing mode splits a TM queue into a number of sub-flows that
+	 *  are served fairly and protected with active queue management. See
+	 *  odp_tm_queue_params_t::fq for details. */
+	struct {
+		/** Flow queuing mode is supported on TM queues */
+		odp_bool_t supported;
+
+		/** Maximum number of sub-flows per TM queue */
+		uint32_t max_flows;
+
+		/** Maximum number of packets that can be held in the sub-flows
+		 *  of a TM queue */
+		uint32_t max_pkts;
+
+	} tm_queue_fq;
+
 } odp_tm_capabilities_t;
 
 /** Per Level Requirements
@@ -718,6 +736,10 @@ typedef struct {
 	 * expected to use threshold profile support */
 	odp_bool_t tm_queue_threshold_needed;
 
+	/** tm_queue_fq_needed indicates that the tm_queues are expected to
+	 * use flow queuing mode (see odp_tm_queue_params_t::fq). */
+	odp_bool_t tm_queue_fq_needed;
+
 	/** vlan_marking_needed indicates that the ODP application expects
 	 * to use some form of VLAN egress marking using the
 	 * odp_tm_vlan_marking() function.  See also comments for
@@ -1841,6 +1863,52 @@ typedef struct {
 	 * synchronization context. Default value of this flag is true.
 	 */
 	odp_bool_t ordered_enqueue;
+
+	/** Flow queuing mode parameters
+	 *
+	 * In flow queuing mode, packets waiting in the tm_queue are hashed into
+	 * a number of sub-flows by packet flow hash (see odp_packet_flow_hash()).
+	 * When a packet does not have a flow hash, the implementation may
+	 * calculate one from packet headers or treat all such packets as a
+	 * single flow. Sub-flows are served in deficit round robin (DRR) order,
+	 * which prevents a single heavy flow from increasing the latency of the
+	 * other flows of the same tm_queue. Each sub-flow is also managed with
+	 * CoDel active queue management: packets are dropped at dequeue when
+	 * the queuing delay of the sub-flow has stayed above 'target_ns' for at
+	 * least 'interval_ns'. Packets dropped by flow queuing are counted as
+	 * discards in odp_tm_queue_stats_t.
+	 *
+	 * Flow queuing mode is supported when
+	 * odp_tm_capabilities_t::tm_queue_fq.supported is true. */
+	struct {
+		/** Enable flow queuing mode. The default value is false. */
+		odp_bool_t enable;
+
+		/** Number of sub-flows. The value must not exceed
+		 *  odp_tm_capabilities_t::tm_queue_fq.max_flows. The default
+		 *  value is 1024. */
+		uint32_t num_flows;
+
+		/** Maximum number of packets held in all sub-flows of the
+		 *  tm_queue. When the limit is reached, packets are dropped from
+		 *  the head of the longest sub-flow. The value must not exceed
+		 *  odp_tm_capabilities_t::tm_queue_fq.max_pkts. The default value
+		 *  is 1024. */
+		uint32_t max_pkts;
+
+		/** DRR quantum in bytes. A sub-flow may send this many bytes
+		 *  during its turn. The default value is 1514. */
+		uint32_t quantum;
+
+		/** CoDel target queuing delay in nanoseconds. The default value
+		 *  is 5 ms. */
+		uint64_t target_ns;
+
+		/** CoDel interval in nanoseconds. The default value is 100 ms. */
+		uint64_t interval_ns;
+
+	} fq;
+
 } odp_tm_queue_params_t;
 
 /**
@@ -61,5 +61,8 @@
 #include <odp/api/stash.h>
 #include <odp/api/reassembly.h>
 #include <odp/api/dma.h>
+#include <odp/api/hashtable.h>
+#include <odp/api/lpm.h>
+#include <odp/api/qsbr.h>
 
 #endif
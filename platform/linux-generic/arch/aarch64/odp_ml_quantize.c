@@ -0,0 +1,181 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/*
+ * NEON versions of ML quantization and fp16 conversion functions
+ *
+ * Advanced SIMD, including conversions between single and half precision, is mandatory in
+ * AArch64, so no runtime detection is needed. Rounding and clamping are done in the same order
+ * and with the same rounding mode as in the generic code, so results are identical. Clamping
+ * uses the maxNum/minNum instructions, which return the numeric operand when the other one is
+ * NaN. So NaN inputs are clamped to the minimum value, like in the generic code.
+ */
+
+#include <odp_ml_quantize_internal.h>
+
+#include <arm_neon.h>
+#include <stdint.h>
+
+/* nearbyintf(fp32 / scale) + zerop, clamped to [min, max] */
+static inline int32x4_t quant(const float *fp32, float32x4_t scale, float32x4_t zerop,
+			      float32x4_t min, float32x4_t max)
+{
+	float32x4_t v = vdivq_f32(vld1q_f32(fp32), scale);
+
+	v = vrndiq_f32(v);
+	v = vaddq_f32(v, zerop);
+	v = vmaxnmq_f32(v, min);
+	v = vminnmq_f32(v, max);
+
+	return vcvtq_s32_f32(v);
+}
+
+/* Quantize 8 elements into 16 bit integers */
+static inline int16x8_t quant8(const float *fp32, float32x4_t scale, float32x4_t zerop,
+			       float32x4_t min, float32x4_t max)
+{
+	int32x4_t lo = quant(fp32, scale, zerop, min, max);
+	int32x4_t hi = quant(fp32 + 4, scale, zerop, min, max);
+
+	return vcombine_s16(vmovn_s32(lo), vmovn_s32(hi));
+}
+
+/* (fp32)(v - zerop) * scale */
+static inline void dequant(float *fp32, int32x4_t v, int32x4_t zerop, float32x4_t scale)
+{
+	v = vsubq_s32(v, zerop);
+	vst1q_f32(fp32, vmulq_f32(vcvtq_f32_s32(v), scale));
+}
+
+uint32_t _odp_ml_fp32_to_uint8_arch(uint8_t *u8, const float *fp32, uint32_t num, float scale,
+				    uint8_t zerop)
+{
+	const float32x4_t s = vdupq_n_f32(scale), z = vdupq_n_f32((float)zerop);
+	const float32x4_t min = vdupq_n_f32(0.f), max = vdupq_n_f32(255.f);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8)
+		vst1_u8(&u8[i], vqmovun_s16(quant8(&fp32[i], s, z, min, max)));
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_from_uint8_arch(float *fp32, const uint8_t *u8, uint32_t num, float scale,
+				      uint8_t zerop)
+{
+	const float32x4_t s = vdupq_n_f32(scale);
+	const int32x4_t z = vdupq_n_s32(zerop);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8) {
+		uint16x8_t h = vmovl_u8(vld1_u8(&u8[i]));
+
+		dequant(&fp32[i], vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(h))), z, s);
+		dequant(&fp32[i + 4], vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(h))), z, s);
+	}
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_to_int8_arch(int8_t *i8, const float *fp32, uint32_t num, float scale,
+				   int8_t zerop)
+{
+	const float32x4_t s = vdupq_n_f32(scale), z = vdupq_n_f32((float)zerop);
+	const float32x4_t min = vdupq_n_f32(-127.f), max = vdupq_n_f32(127.f);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8)
+		vst1_s8(&i8[i], vqmovn_s16(quant8(&fp32[i], s, z, min, max)));
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_from_int8_arch(float *fp32, const int8_t *i8, uint32_t num, float scale,
+				     int8_t zerop)
+{
+	const float32x4_t s = vdupq_n_f32(scale);
+	const int32x4_t z = vdupq_n_s32(zerop);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8) {
+		int16x8_t h = vmovl_s8(vld1_s8(&i8[i]));
+
+		dequant(&fp32[i], vmovl_s16(vget_low_s16(h)), z, s);
+		dequant(&fp32[i + 4], vmovl_s16(vget_high_s16(h)), z, s);
+	}
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_to_uint16_arch(uint16_t *u16, const float *fp32, uint32_t num, float scale,
+				     uint16_t zerop)
+{
+	const float32x4_t s = vdupq_n_f32(scale), z = vdupq_n_f32((float)zerop);
+	const float32x4_t min = vdupq_n_f32(0.f), max = vdupq_n_f32(65535.f);
+	uint32_t i;
+
+	for (i = 0; i + 4 <= num; i += 4)
+		vst1_u16(&u16[i], vqmovun_s32(quant(&fp32[i], s, z, min, max)));
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_from_uint16_arch(float *fp32, const uint16_t *u16, uint32_t num,
+				       float scale, uint16_t zerop)
+{
+	const float32x4_t s = vdupq_n_f32(scale);
+	const int32x4_t z = vdupq_n_s32(zerop);
+	uint32_t i;
+
+	for (i = 0; i + 4 <= num; i += 4)
+		dequant(&fp32[i], vreinterpretq_s32_u32(vmovl_u16(vld1_u16(&u16[i]))), z, s);
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_to_int16_arch(int16_t *i16, const float *fp32, uint32_t num, float scale,
+				    int16_t zerop)
+{
+	const float32x4_t s = vdupq_n_f32(scale), z = vdupq_n_f32((float)zerop);
+	const float32x4_t min = vdupq_n_f32(-32767.f), max = vdupq_n_f32(32767.f);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8)
+		vst1q_s16(&i16[i], quant8(&fp32[i], s, z, min, max));
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_from_int16_arch(float *fp32, const int16_t *i16, uint32_t num, float scale,
+				      int16_t zerop)
+{
+	const float32x4_t s = vdupq_n_f32(scale);
+	const int32x4_t z = vdupq_n_s32(zerop);
+	uint32_t i;
+
+	for (i = 0; i + 4 <= num; i += 4)
+		dequant(&fp32[i], vmovl_s16(vld1_s16(&i16[i])), z, s);
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_to_fp16_arch(uint16_t *fp16, const float *fp32, uint32_t num)
+{
+	uint32_t i;
+
+	for (i = 0; i + 4 <= num; i += 4)
+		vst1_u16(&fp16[i], vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(&fp32[i]))));
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_from_fp16_arch(float *fp32, const uint16_t *fp16, uint32_t num)
+{
+	uint32_t i;
+
+	for (i = 0; i + 4 <= num; i += 4)
+		vst1q_f32(&fp32[i], vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(&fp16[i]))));
+
+	return i;
+}
@@ -0,0 +1,79 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#include <odp/api/hints.h>
+
+#include <odp_ml_quantize_internal.h>
+
+#include <stdint.h>
+
+/* No architecture specific conversions, all elements are converted by the generic code */
+
+uint32_t _odp_ml_fp32_to_uint8_arch(uint8_t *u8 ODP_UNUSED, const float *fp32 ODP_UNUSED,
+				    uint32_t num ODP_UNUSED, float scale ODP_UNUSED,
+				    uint8_t zerop ODP_UNUSED)
+{
+	return 0;
+}
+
+uint32_t _odp_ml_fp32_from_uint8_arch(float *fp32 ODP_UNUSED, const uint8_t *u8 ODP_UNUSED,
+				      uint32_t num ODP_UNUSED, float scale ODP_UNUSED,
+				      uint8_t zerop ODP_UNUSED)
+{
+	return 0;
+}
+
+uint32_t _odp_ml_fp32_to_int8_arch(int8_t *i8 ODP_UNUSED, const float *fp32 ODP_UNUSED,
+				   uint32_t num ODP_UNUSED, float scale ODP_UNUSED,
+				   int8_t zerop ODP_UNUSED)
+{
+	return 0;
+}
+
+uint32_t _odp_ml_fp32_from_int8_arch(float *fp32 ODP_UNUSED, const int8_t *i8 ODP_UNUSED,
+				     uint32_t num ODP_UNUSED, float scale ODP_UNUSED,
+				     int8_t zerop ODP_UNUSED)
+{
+	return 0;
+}
+
+uint32_t _odp_ml_fp32_to_uint16_arch(uint16_t *u16 ODP_UNUSED, const float *fp32 ODP_UNUSED,
+				     uint32_t num ODP_UNUSED, float scale ODP_UNUSED,
+				     uint16_t zerop ODP_UNUSED)
+{
+	return 0;
+}
+
+uint32_t _odp_ml_fp32_from_uint16_arch(float *fp32 ODP_UNUSED, const uint16_t *u16 ODP_UNUSED,
+				       uint32_t num ODP_UNUSED, float scale ODP_UNUSED,
+				       uint16_t zerop ODP_UNUSED)
+{
+	return 0;
+}
+
+uint32_t _odp_ml_fp32_to_int16_arch(int16_t *i16 ODP_UNUSED, const float *fp32 ODP_UNUSED,
+				    uint32_t num ODP_UNUSED, float scale ODP_UNUSED,
+				    int16_t zerop ODP_UNUSED)
+{
+	return 0;
+}
+
+uint32_t _odp_ml_fp32_from_int16_arch(float *fp32 ODP_UNUSED, const int16_t *i16 ODP_UNUSED,
+				      uint32_t num ODP_UNUSED, float scale ODP_UNUSED,
+				      int16_t zerop ODP_UNUSED)
+{
+	return 0;
+}
+
+uint32_t _odp_ml_fp32_to_fp16_arch(uint16_t *fp16 ODP_UNUSED, const float *fp32 ODP_UNUSED,
+				   uint32_t num ODP_UNUSED)
+{
+	return 0;
+}
+
+uint32_t _odp_ml_fp32_from_fp16_arch(float *fp32 ODP_UNUSED, const uint16_t *fp16 ODP_UNUSED,
+				     uint32_t num ODP_UNUSED)
+{
+	return 0;
+}
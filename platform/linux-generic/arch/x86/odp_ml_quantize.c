@@ -0,0 +1,503 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/*
+ * AVX2/F16C and AVX-512F versions of ML quantization and fp16 conversion functions
+ *
+ * Functions are compiled with target attributes and selected at runtime, so that the library
+ * does not need to be built for a specific CPU. Rounding and clamping are done in the same
+ * order and with the same rounding mode as in the generic code, so results are identical.
+ */
+
+#include <odp_ml_quantize_internal.h>
+
+#include <immintrin.h>
+#include <stdint.h>
+
+#define AVX2 __attribute__((target("avx2,f16c")))
+#define AVX512 __attribute__((target("avx512f")))
+
+static inline int has_avx2(void)
+{
+	return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c");
+}
+
+static inline int has_avx512(void)
+{
+	return __builtin_cpu_supports("avx512f");
+}
+
+/* nearbyintf(fp32 / scale) + zerop, clamped to [min, max] */
+static inline AVX2 __m256i quant_avx2(const float *fp32, __m256 scale, __m256 zerop, __m256 min,
+				      __m256 max)
+{
+	__m256 v = _mm256_div_ps(_mm256_loadu_ps(fp32), scale);
+
+	v = _mm256_round_ps(v, _MM_FROUND_CUR_DIRECTION);
+	v = _mm256_add_ps(v, zerop);
+	v = _mm256_max_ps(v, min);
+	v = _mm256_min_ps(v, max);
+
+	return _mm256_cvtps_epi32(v);
+}
+
+/* (fp32)(v - zerop) * scale */
+static inline AVX2 void dequant_avx2(float *fp32, __m256i v, __m256i zerop, __m256 scale)
+{
+	v = _mm256_sub_epi32(v, zerop);
+	_mm256_storeu_ps(fp32, _mm256_mul_ps(_mm256_cvtepi32_ps(v), scale));
+}
+
+static inline AVX512 __m512i quant_avx512(const float *fp32, __m512 scale, __m512 zerop,
+					  __m512 min, __m512 max)
+{
+	__m512 v = _mm512_div_ps(_mm512_loadu_ps(fp32), scale);
+
+	v = _mm512_roundscale_ps(v, _MM_FROUND_CUR_DIRECTION);
+	v = _mm512_add_ps(v, zerop);
+	v = _mm512_max_ps(v, min);
+	v = _mm512_min_ps(v, max);
+
+	return _mm512_cvtps_epi32(v);
+}
+
+static inline AVX512 void dequant_avx512(float *fp32, __m512i v, __m512i zerop, __m512 scale)
+{
+	v = _mm512_sub_epi32(v, zerop);
+	_mm512_storeu_ps(fp32, _mm512_mul_ps(_mm512_cvtepi32_ps(v), scale));
+}
+
+static AVX2 uint32_t to_uint8_avx2(uint8_t *u8, const float *fp32, uint32_t num, float scale,
+				   uint8_t zerop)
+{
+	const __m256 s = _mm256_set1_ps(scale), z = _mm256_set1_ps((float)zerop);
+	const __m256 min = _mm256_set1_ps(0.f), max = _mm256_set1_ps(255.f);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8) {
+		__m256i v = quant_avx2(&fp32[i], s, z, min, max);
+		__m128i w = _mm_packs_epi32(_mm256_castsi256_si128(v),
+					    _mm256_extracti128_si256(v, 1));
+
+		_mm_storel_epi64((__m128i *)&u8[i], _mm_packus_epi16(w, w));
+	}
+
+	return i;
+}
+
+static AVX512 uint32_t to_uint8_avx512(uint8_t *u8, const float *fp32, uint32_t num, float scale,
+				       uint8_t zerop)
+{
+	const __m512 s = _mm512_set1_ps(scale), z = _mm512_set1_ps((float)zerop);
+	const __m512 min = _mm512_set1_ps(0.f), max = _mm512_set1_ps(255.f);
+	uint32_t i;
+
+	for (i = 0; i + 16 <= num; i += 16) {
+		__m512i v = quant_avx512(&fp32[i], s, z, min, max);
+
+		_mm_storeu_si128((__m128i *)&u8[i], _mm512_cvtepi32_epi8(v));
+	}
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_to_uint8_arch(uint8_t *u8, const float *fp32, uint32_t num, float scale,
+				    uint8_t zerop)
+{
+	if (has_avx512())
+		return to_uint8_avx512(u8, fp32, num, scale, zerop);
+
+	if (has_avx2())
+		return to_uint8_avx2(u8, fp32, num, scale, zerop);
+
+	return 0;
+}
+
+static AVX2 uint32_t from_uint8_avx2(float *fp32, const uint8_t *u8, uint32_t num, float scale,
+				     uint8_t zerop)
+{
+	const __m256 s = _mm256_set1_ps(scale);
+	const __m256i z = _mm256_set1_epi32(zerop);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8) {
+		__m128i b = _mm_loadl_epi64((const __m128i *)&u8[i]);
+
+		dequant_avx2(&fp32[i], _mm256_cvtepu8_epi32(b), z, s);
+	}
+
+	return i;
+}
+
+static AVX512 uint32_t from_uint8_avx512(float *fp32, const uint8_t *u8, uint32_t num,
+					 float scale, uint8_t zerop)
+{
+	const __m512 s = _mm512_set1_ps(scale);
+	const __m512i z = _mm512_set1_epi32(zerop);
+	uint32_t i;
+
+	for (i = 0; i + 16 <= num; i += 16) {
+		__m128i b = _mm_loadu_si128((const __m128i *)&u8[i]);
+
+		dequant_avx512(&fp32[i], _mm512_cvtepu8_epi32(b), z, s);
+	}
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_from_uint8_arch(float *fp32, const uint8_t *u8, uint32_t num, float scale,
+				      uint8_t zerop)
+{
+	if (has_avx512())
+		return from_uint8_avx512(fp32, u8, num, scale, zerop);
+
+	if (has_avx2())
+		return from_uint8_avx2(fp32, u8, num, scale, zerop);
+
+	return 0;
+}
+
+static AVX2 uint32_t to_int8_avx2(int8_t *i8, const float *fp32, uint32_t num, float scale,
+				  int8_t zerop)
+{
+	const __m256 s = _mm256_set1_ps(scale), z = _mm256_set1_ps((float)zerop);
+	const __m256 min = _mm256_set1_ps(-127.f), max = _mm256_set1_ps(127.f);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8) {
+		__m256i v = quant_avx2(&fp32[i], s, z, min, max);
+		__m128i w = _mm_packs_epi32(_mm256_castsi256_si128(v),
+					    _mm256_extracti128_si256(v, 1));
+
+		_mm_storel_epi64((__m128i *)&i8[i], _mm_packs_epi16(w, w));
+	}
+
+	return i;
+}
+
+static AVX512 uint32_t to_int8_avx512(int8_t *i8, const float *fp32, uint32_t num, float scale,
+				      int8_t zerop)
+{
+	const __m512 s = _mm512_set1_ps(scale), z = _mm512_set1_ps((float)zerop);
+	const __m512 min = _mm512_set1_ps(-127.f), max = _mm512_set1_ps(127.f);
+	uint32_t i;
+
+	for (i = 0; i + 16 <= num; i += 16) {
+		__m512i v = quant_avx512(&fp32[i], s, z, min, max);
+
+		_mm_storeu_si128((__m128i *)&i8[i], _mm512_cvtepi32_epi8(v));
+	}
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_to_int8_arch(int8_t *i8, const float *fp32, uint32_t num, float scale,
+				   int8_t zerop)
+{
+	if (has_avx512())
+		return to_int8_avx512(i8, fp32, num, scale, zerop);
+
+	if (has_avx2())
+		return to_int8_avx2(i8, fp32, num, scale, zerop);
+
+	return 0;
+}
+
+static AVX2 uint32_t from_int8_avx2(float *fp32, const int8_t *i8, uint32_t num, float scale,
+				    int8_t zerop)
+{
+	const __m256 s = _mm256_set1_ps(scale);
+	const __m256i z = _mm256_set1_epi32(zerop);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8) {
+		__m128i b = _mm_loadl_epi64((const __m128i *)&i8[i]);
+
+		dequant_avx2(&fp32[i], _mm256_cvtepi8_epi32(b), z, s);
+	}
+
+	return i;
+}
+
+static AVX512 uint32_t from_int8_avx512(float *fp32, const int8_t *i8, uint32_t num, float scale,
+					int8_t zerop)
+{
+	const __m512 s = _mm512_set1_ps(scale);
+	const __m512i z = _mm512_set1_epi32(zerop);
+	uint32_t i;
+
+	for (i = 0; i + 16 <= num; i += 16) {
+		__m128i b = _mm_loadu_si128((const __m128i *)&i8[i]);
+
+		dequant_avx512(&fp32[i], _mm512_cvtepi8_epi32(b), z, s);
+	}
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_from_int8_arch(float *fp32, const int8_t *i8, uint32_t num, float scale,
+				     int8_t zerop)
+{
+	if (has_avx512())
+		return from_int8_avx512(fp32, i8, num, scale, zerop);
+
+	if (has_avx2())
+		return from_int8_avx2(fp32, i8, num, scale, zerop);
+
+	return 0;
+}
+
+static AVX2 uint32_t to_uint16_avx2(uint16_t *u16, const float *fp32, uint32_t num, float scale,
+				    uint16_t zerop)
+{
+	const __m256 s = _mm256_set1_ps(scale), z = _mm256_set1_ps((float)zerop);
+	const __m256 min = _mm256_set1_ps(0.f), max = _mm256_set1_ps(65535.f);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8) {
+		__m256i v = quant_avx2(&fp32[i], s, z, min, max);
+
+		_mm_storeu_si128((__m128i *)&u16[i],
+				 _mm_packus_epi32(_mm256_castsi256_si128(v),
+						  _mm256_extracti128_si256(v, 1)));
+	}
+
+	return i;
+}
+
+static AVX512 uint32_t to_uint16_avx512(uint16_t *u16, const float *fp32, uint32_t num,
+					float scale, uint16_t zerop)
+{
+	const __m512 s = _mm512_set1_ps(scale), z = _mm512_set1_ps((float)zerop);
+	const __m512 min = _mm512_set1_ps(0.f), max = _mm512_set1_ps(65535.f);
+	uint32_t i;
+
+	for (i = 0; i + 16 <= num; i += 16) {
+		__m512i v = quant_avx512(&fp32[i], s, z, min, max);
+
+		_mm256_storeu_si256((__m256i *)&u16[i], _mm512_cvtepi32_epi16(v));
+	}
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_to_uint16_arch(uint16_t *u16, const float *fp32, uint32_t num, float scale,
+				     uint16_t zerop)
+{
+	if (has_avx512())
+		return to_uint16_avx512(u16, fp32, num, scale, zerop);
+
+	if (has_avx2())
+		return to_uint16_avx2(u16, fp32, num, scale, zerop);
+
+	return 0;
+}
+
+static AVX2 uint32_t from_uint16_avx2(float *fp32, const uint16_t *u16, uint32_t num,
+				      float scale, uint16_t zerop)
+{
+	const __m256 s = _mm256_set1_ps(scale);
+	const __m256i z = _mm256_set1_epi32(zerop);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8) {
+		__m128i h = _mm_loadu_si128((const __m128i *)&u16[i]);
+
+		dequant_avx2(&fp32[i], _mm256_cvtepu16_epi32(h), z, s);
+	}
+
+	return i;
+}
+
+static AVX512 uint32_t from_uint16_avx512(float *fp32, const uint16_t *u16, uint32_t num,
+					  float scale, uint16_t zerop)
+{
+	const __m512 s = _mm512_set1_ps(scale);
+	const __m512i z = _mm512_set1_epi32(zerop);
+	uint32_t i;
+
+	for (i = 0; i + 16 <= num; i += 16) {
+		__m256i h = _mm256_loadu_si256((const __m256i *)&u16[i]);
+
+		dequant_avx512(&fp32[i], _mm512_cvtepu16_epi32(h), z, s);
+	}
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_from_uint16_arch(float *fp32, const uint16_t *u16, uint32_t num,
+				       float scale, uint16_t zerop)
+{
+	if (has_avx512())
+		return from_uint16_avx512(fp32, u16, num, scale, zerop);
+
+	if (has_avx2())
+		return from_uint16_avx2(fp32, u16, num, scale, zerop);
+
+	return 0;
+}
+
+static AVX2 uint32_t to_int16_avx2(int16_t *i16, const float *fp32, uint32_t num, float scale,
+				   int16_t zerop)
+{
+	const __m256 s = _mm256_set1_ps(scale), z = _mm256_set1_ps((float)zerop);
+	const __m256 min = _mm256_set1_ps(-32767.f), max = _mm256_set1_ps(32767.f);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8) {
+		__m256i v = quant_avx2(&fp32[i], s, z, min, max);
+
+		_mm_storeu_si128((__m128i *)&i16[i],
+				 _mm_packs_epi32(_mm256_castsi256_si128(v),
+						 _mm256_extracti128_si256(v, 1)));
+	}
+
+	return i;
+}
+
+static AVX512 uint32_t to_int16_avx512(int16_t *i16, const float *fp32, uint32_t num,
+				       float scale, int16_t zerop)
+{
+	const __m512 s = _mm512_set1_ps(scale), z = _mm512_set1_ps((float)zerop);
+	const __m512 min = _mm512_set1_ps(-32767.f), max = _mm512_set1_ps(32767.f);
+	uint32_t i;
+
+	for (i = 0; i + 16 <= num; i += 16) {
+		__m512i v = quant_avx512(&fp32[i], s, z, min, max);
+
+		_mm256_storeu_si256((__m256i *)&i16[i], _mm512_cvtepi32_epi16(v));
+	}
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_to_int16_arch(int16_t *i16, const float *fp32, uint32_t num, float scale,
+				    int16_t zerop)
+{
+	if (has_avx512())
+		return to_int16_avx512(i16, fp32, num, scale, zerop);
+
+	if (has_avx2())
+		return to_int16_avx2(i16, fp32, num, scale, zerop);
+
+	return 0;
+}
+
+static AVX2 uint32_t from_int16_avx2(float *fp32, const int16_t *i16, uint32_t num, float scale,
+				     int16_t zerop)
+{
+	const __m256 s = _mm256_set1_ps(scale);
+	const __m256i z = _mm256_set1_epi32(zerop);
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8) {
+		__m128i h = _mm_loadu_si128((const __m128i *)&i16[i]);
+
+		dequant_avx2(&fp32[i], _mm256_cvtepi16_epi32(h), z, s);
+	}
+
+	return i;
+}
+
+static AVX512 uint32_t from_int16_avx512(float *fp32, const int16_t *i16, uint32_t num,
+					 float scale, int16_t zerop)
+{
+	const __m512 s = _mm512_set1_ps(scale);
+	const __m512i z = _mm512_set1_epi32(zerop);
+	uint32_t i;
+
+	for (i = 0; i + 16 <= num; i += 16) {
+		__m256i h = _mm256_loadu_si256((const __m256i *)&i16[i]);
+
+		dequant_avx512(&fp32[i], _mm512_cvtepi16_epi32(h), z, s);
+	}
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_from_int16_arch(float *fp32, const int16_t *i16, uint32_t num, float scale,
+				      int16_t zerop)
+{
+	if (has_avx512())
+		return from_int16_avx512(fp32, i16, num, scale, zerop);
+
+	if (has_avx2())
+		return from_int16_avx2(fp32, i16, num, scale, zerop);
+
+	return 0;
+}
+
+static AVX2 uint32_t to_fp16_avx2(uint16_t *fp16, const float *fp32, uint32_t num)
+{
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8) {
+		__m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(&fp32[i]), _MM_FROUND_TO_NEAREST_INT);
+
+		_mm_storeu_si128((__m128i *)&fp16[i], h);
+	}
+
+	return i;
+}
+
+static AVX512 uint32_t to_fp16_avx512(uint16_t *fp16, const float *fp32, uint32_t num)
+{
+	uint32_t i;
+
+	for (i = 0; i + 16 <= num; i += 16) {
+		__m256i h = _mm512_cvtps_ph(_mm512_loadu_ps(&fp32[i]), _MM_FROUND_TO_NEAREST_INT);
+
+		_mm256_storeu_si256((__m256i *)&fp16[i], h);
+	}
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_to_fp16_arch(uint16_t *fp16, const float *fp32, uint32_t num)
+{
+	if (has_avx512())
+		return to_fp16_avx512(fp16, fp32, num);
+
+	if (has_avx2())
+		return to_fp16_avx2(fp16, fp32, num);
+
+	return 0;
+}
+
+static AVX2 uint32_t from_fp16_avx2(float *fp32, const uint16_t *fp16, uint32_t num)
+{
+	uint32_t i;
+
+	for (i = 0; i + 8 <= num; i += 8) {
+		__m128i h = _mm_loadu_si128((const __m128i *)&fp16[i]);
+
+		_mm256_storeu_ps(&fp32[i], _mm256_cvtph_ps(h));
+	}
+
+	return i;
+}
+
+static AVX512 uint32_t from_fp16_avx512(float *fp32, const uint16_t *fp16, uint32_t num)
+{
+	uint32_t i;
+
+	for (i = 0; i + 16 <= num; i += 16) {
+		__m256i h = _mm256_loadu_si256((const __m256i *)&fp16[i]);
+
+		_mm512_storeu_ps(&fp32[i], _mm512_cvtph_ps(h));
+	}
+
+	return i;
+}
+
+uint32_t _odp_ml_fp32_from_fp16_arch(float *fp32, const uint16_t *fp16, uint32_t num)
+{
+	if (has_avx512())
+		return from_fp16_avx512(fp32, fp16, num);
+
+	if (has_avx2())
+		return from_fp16_avx2(fp32, fp16, num);
+
+	return 0;
+}
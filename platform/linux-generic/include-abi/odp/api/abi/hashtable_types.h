@@ -0,0 +1,36 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ */
+
+#ifndef ODP_API_ABI_HASHTABLE_TYPES_H_
+#define ODP_API_ABI_HASHTABLE_TYPES_H_
+
+#include <odp/api/plat/strong_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @addtogroup odp_hashtable
+ *  @{
+ */
+
+typedef ODP_HANDLE_T(odp_hashtable_t);
+
+#define ODP_HASHTABLE_INVALID _odp_cast_scalar(odp_hashtable_t, 0)
+
+#define ODP_HASHTABLE_NAME_LEN  32
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
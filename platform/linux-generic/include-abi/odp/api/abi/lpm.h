@@ -0,0 +1,14 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ */
+
+#ifndef ODP_API_ABI_LPM_H_
+#define ODP_API_ABI_LPM_H_
+
+/* Empty placeholder header for inline functions */
+
+#endif
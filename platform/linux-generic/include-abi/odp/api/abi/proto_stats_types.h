@@ -28,6 +28,8 @@ typedef ODP_HANDLE_T(odp_proto_stats_t);
 
 #define ODP_PROTO_STATS_INVALID _odp_cast_scalar(odp_proto_stats_t, 0)
 
+#define ODP_PROTO_STATS_NAME_LEN 64
+
 /**
  * @}
  */
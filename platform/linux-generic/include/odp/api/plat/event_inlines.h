@@ -8,6 +8,7 @@
 
 #include <odp/api/buffer_types.h>
 #include <odp/api/event_types.h>
+#include <odp/api/hints.h>
 #include <odp/api/packet_types.h>
 #include <odp/api/pool_types.h>
 #include <odp/api/timer_types.h>
@@ -17,6 +18,7 @@
 #include <odp/api/plat/event_inline_types.h>
 #include <odp/api/plat/event_vector_inline_types.h>
 #include <odp/api/plat/packet_inline_types.h>
+#include <odp/api/plat/pool_inline_types.h>
 #include <odp/api/plat/timer_inline_types.h>
 
 #ifdef __cplusplus
@@ -61,6 +63,17 @@ static inline odp_event_subtype_t __odp_event_subtype_get(odp_event_t event)
 	return (odp_event_subtype_t)type;
 }
 
+static inline odp_pool_t __odp_event_pool_get(odp_event_t event)
+{
+	odp_pool_t pool = _odp_event_hdr_field(event, odp_pool_t, pool);
+
+	/* Event may be stored in a packet length class of the pool */
+	if (odp_unlikely(_odp_event_hdr_field(event, uint8_t, class_idx)))
+		return _odp_pool_get(pool, odp_pool_t, parent);
+
+	return pool;
+}
+
 _ODP_INLINE odp_event_type_t odp_event_type(odp_event_t event)
 {
 	return __odp_event_type_get(event);
@@ -91,7 +104,7 @@ _ODP_INLINE odp_pool_t odp_event_pool(odp_event_t event)
 	case ODP_EVENT_PACKET:
 	case ODP_EVENT_VECTOR:
 	case ODP_EVENT_PACKET_VECTOR:
-		return _odp_event_hdr_field(event, odp_pool_t, pool);
+		return __odp_event_pool_get(event);
 	default:
 		return ODP_POOL_INVALID;
 	}
@@ -46,25 +46,50 @@ typedef enum {
 	_ODP_EV_MAX
 } _odp_ev_id_t;
 
+/* Event validation levels (_ODP_EVENT_VALIDATION) */
+#define _ODP_EV_VALIDATION_NONE    0
+#define _ODP_EV_VALIDATION_WARN    1
+#define _ODP_EV_VALIDATION_ABORT   2
+#define _ODP_EV_VALIDATION_RUNTIME 3
+
 /* Implementation internal event validation functions */
 #if _ODP_EVENT_VALIDATION
 
-int _odp_event_validate(odp_event_t event, _odp_ev_id_t id);
+int _odp_event_validate_fn(odp_event_t event, _odp_ev_id_t id);
+
+int _odp_event_validate_multi_fn(const odp_event_t event[], int num, _odp_ev_id_t id);
+
+int _odp_buffer_validate_fn(odp_buffer_t buf, _odp_ev_id_t ev_id);
 
-int _odp_event_validate_multi(const odp_event_t event[], int num, _odp_ev_id_t id);
+int _odp_buffer_validate_multi_fn(const odp_buffer_t buf[], int num, _odp_ev_id_t ev_id);
 
-int _odp_buffer_validate(odp_buffer_t buf, _odp_ev_id_t ev_id);
+int _odp_packet_validate_fn(odp_packet_t pkt, _odp_ev_id_t ev_id);
+
+int _odp_packet_validate_multi_fn(const odp_packet_t pkt[], int num, _odp_ev_id_t ev_id);
+
+#endif
 
-int _odp_buffer_validate_multi(const odp_buffer_t buf[], int num, _odp_ev_id_t ev_id);
+#if _ODP_EVENT_VALIDATION == _ODP_EV_VALIDATION_RUNTIME
 
-int _odp_packet_validate(odp_packet_t pkt, _odp_ev_id_t ev_id);
+/* Non-zero when validation is turned on. Written only on startup and from a signal handler, so
+ * that validation calls are skipped with a single well predicted branch when it is off. */
+extern int _odp_event_validation_on;
 
-int _odp_packet_validate_multi(const odp_packet_t pkt[], int num, _odp_ev_id_t ev_id);
+#define _ODP_EV_VALIDATION_ON() \
+	odp_unlikely(__atomic_load_n(&_odp_event_validation_on, __ATOMIC_RELAXED))
 
 #else
 
+#define _ODP_EV_VALIDATION_ON() _ODP_EVENT_VALIDATION
+
+#endif
+
 static inline int _odp_event_validate(odp_event_t event ODP_UNUSED, _odp_ev_id_t ev_id ODP_UNUSED)
 {
+#if _ODP_EVENT_VALIDATION
+	if (_ODP_EV_VALIDATION_ON())
+		return _odp_event_validate_fn(event, ev_id);
+#endif
 	return 0;
 }
 
@@ -72,11 +97,19 @@ static inline int _odp_event_validate_multi(const odp_event_t event[] ODP_UNUSED
 					    int num ODP_UNUSED,
 					    _odp_ev_id_t ev_id ODP_UNUSED)
 {
+#if _ODP_EVENT_VALIDATION
+	if (_ODP_EV_VALIDATION_ON())
+		return _odp_event_validate_multi_fn(event, num, ev_id);
+#endif
 	return 0;
 }
 
 static inline int _odp_buffer_validate(odp_buffer_t buf ODP_UNUSED, _odp_ev_id_t ev_id ODP_UNUSED)
 {
+#if _ODP_EVENT_VALIDATION
+	if (_ODP_EV_VALIDATION_ON())
+		return _odp_buffer_validate_fn(buf, ev_id);
+#endif
 	return 0;
 }
 
@@ -84,11 +117,19 @@ static inline int _odp_buffer_validate_multi(const odp_buffer_t buf[] ODP_UNUSED
 					     int num ODP_UNUSED,
 					     _odp_ev_id_t ev_id ODP_UNUSED)
 {
+#if _ODP_EVENT_VALIDATION
+	if (_ODP_EV_VALIDATION_ON())
+		return _odp_buffer_validate_multi_fn(buf, num, ev_id);
+#endif
 	return 0;
 }
 
 static inline int _odp_packet_validate(odp_packet_t pkt ODP_UNUSED, _odp_ev_id_t ev_id ODP_UNUSED)
 {
+#if _ODP_EVENT_VALIDATION
+	if (_ODP_EV_VALIDATION_ON())
+		return _odp_packet_validate_fn(pkt, ev_id);
+#endif
 	return 0;
 }
 
@@ -96,11 +137,13 @@ static inline int _odp_packet_validate_multi(const odp_packet_t pkt[] ODP_UNUSED
 					     int num ODP_UNUSED,
 					     _odp_ev_id_t ev_id ODP_UNUSED)
 {
+#if _ODP_EVENT_VALIDATION
+	if (_ODP_EV_VALIDATION_ON())
+		return _odp_packet_validate_multi_fn(pkt, num, ev_id);
+#endif
 	return 0;
 }
 
-#endif /* _ODP_EVENT_VALIDATION */
-
 #ifdef __cplusplus
 }
 #endif
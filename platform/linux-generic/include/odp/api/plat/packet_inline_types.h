@@ -51,6 +51,7 @@ typedef struct _odp_packet_inline_offset_t {
 	uint16_t cls_mark;
 	uint16_t ipsec_ctx;
 	uint16_t crypto_op;
+	uint16_t class_idx;
 
 } _odp_packet_inline_offset_t;
 
@@ -117,7 +118,12 @@ typedef union {
 	uint32_t all_flags;
 
 	struct {
-		uint32_t reserved1:      3;
+		uint32_t proto_stats:    1; /* Proto stats update requested */
+
+	/*
+	 * Reassembly status (odp_packet_reass_status_t)
+	 */
+		uint32_t reass:          2;
 
 	/*
 	 * Sharing flags
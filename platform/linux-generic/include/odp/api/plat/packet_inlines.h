@@ -149,7 +149,13 @@ _ODP_INLINE uint32_t odp_packet_tailroom(odp_packet_t pkt)
 
 _ODP_INLINE odp_pool_t odp_packet_pool(odp_packet_t pkt)
 {
-	return _odp_pkt_get(pkt, odp_pool_t, pool);
+	odp_pool_t pool = _odp_pkt_get(pkt, odp_pool_t, pool);
+
+	/* Packet may be stored in a packet length class of the pool */
+	if (odp_unlikely(_odp_pkt_get(pkt, uint8_t, class_idx)))
+		return _odp_pool_get(pool, odp_pool_t, parent);
+
+	return pool;
 }
 
 _ODP_INLINE odp_pktio_t odp_packet_input(odp_packet_t pkt)
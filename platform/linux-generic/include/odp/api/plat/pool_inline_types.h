@@ -31,6 +31,7 @@ typedef struct _odp_pool_inline_offset_t {
 	uint16_t trailer_size;
 	uint16_t ext_head_offset;
 	uint16_t ext_pkt_buf_size;
+	uint16_t parent;
 
 } _odp_pool_inline_offset_t;
 
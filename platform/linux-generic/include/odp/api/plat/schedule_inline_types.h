@@ -54,6 +54,10 @@ typedef struct {
 	void (*schedule_order_lock_wait)(uint32_t lock_index);
 	void (*schedule_order_wait)(void);
 	void (*schedule_print)(void);
+	int (*schedule_stats)(odp_schedule_stats_t *stats);
+	int (*schedule_thread_stats)(int thr, odp_schedule_stats_t *stats);
+	int (*schedule_queue_stats)(odp_queue_t queue, odp_schedule_queue_stats_t *stats);
+	void (*schedule_stats_reset)(void);
 
 } _odp_schedule_api_fn_t;
 
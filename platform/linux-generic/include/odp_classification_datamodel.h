@@ -25,6 +25,7 @@ extern "C" {
 #include <odp_packet_internal.h>
 #include <odp_packet_io_internal.h>
 #include <odp_queue_if.h>
+#include <odp_stat_shard_internal.h>
 
 #include <protocols/ip.h>
 
@@ -120,6 +121,18 @@ typedef struct pmr_term_value {
 
 } pmr_term_value_t;
 
+/* CoS statistics shard. Queue counters are allocated only for the queues of the CoS. */
+typedef struct {
+	odp_atomic_u64_t discards;
+	odp_atomic_u64_t packets;
+
+	struct {
+		odp_atomic_u64_t discards;
+		odp_atomic_u64_t packets;
+	} queue[];
+
+} cos_stats_t;
+
 /*
 Class Of Service
 */
@@ -146,10 +159,10 @@ typedef struct ODP_ALIGNED_CACHE cos_s {
 	odp_spinlock_t lock;		/* cos lock */
 	odp_queue_param_t queue_param;
 	char name[ODP_COS_NAME_LEN];	/* name */
-	struct {
-		odp_atomic_u64_t discards;
-		odp_atomic_u64_t packets;
-	} stats, queue_stats[CLS_COS_QUEUE_MAX];
+	/* Statistics counters sharded per thread */
+	cos_stats_t *stats;
+	size_t stats_shard_size;
+	odp_shm_t stats_shm;
 } cos_t;
 
 /* Pattern Matching Rule */
@@ -33,6 +33,7 @@ extern "C" {
 #include <odp_packet_io_internal.h>
 #include <odp_queue_basic_internal.h>
 #include <odp_classification_datamodel.h>
+#include <odp_stat_shard_internal.h>
 
 #include <stdint.h>
 
@@ -43,6 +44,12 @@ static inline cos_t *_odp_cos_entry_from_idx(uint32_t ndx)
 	return &_odp_cls_global->cos_tbl.cos_entry[ndx];
 }
 
+/* Calling thread's statistics shard of a CoS */
+static inline cos_stats_t *_odp_cos_stats(const cos_t *cos)
+{
+	return _odp_stat_shard(cos->stats, cos->stats_shard_size);
+}
+
 static inline int _odp_cos_queue_idx(const cos_t *cos, odp_queue_t queue)
 {
 	uint32_t i, tbl_idx;
@@ -67,6 +74,7 @@ static inline int _odp_cos_queue_idx(const cos_t *cos, odp_queue_t queue)
 static inline void _odp_cos_queue_stats_add(cos_t *cos, odp_queue_t queue,
 					    uint64_t packets, uint64_t discards)
 {
+	cos_stats_t *stats;
 	int queue_idx = _odp_cos_queue_idx(cos, queue);
 
 	if (odp_unlikely(queue_idx < 0)) {
@@ -74,10 +82,12 @@ static inline void _odp_cos_queue_stats_add(cos_t *cos, odp_queue_t queue,
 		return;
 	}
 
+	stats = _odp_cos_stats(cos);
+
 	if (packets)
-		odp_atomic_add_u64(&cos->queue_stats[queue_idx].packets, packets);
+		odp_atomic_add_u64(&stats->queue[queue_idx].packets, packets);
 	if (discards)
-		odp_atomic_add_u64(&cos->queue_stats[queue_idx].discards, discards);
+		odp_atomic_add_u64(&stats->queue[queue_idx].discards, discards);
 }
 
 static inline void _odp_cos_vector_enq(odp_queue_t queue, odp_event_t events[], uint32_t num,
@@ -82,6 +82,34 @@ extern "C" {
  */
 #define CONFIG_MAX_STASHES 2048
 
+/*
+ * Maximum number of hash tables
+ */
+#define CONFIG_MAX_HASHTABLES 64
+
+/*
+ * Maximum number of LPM tables
+ */
+#define CONFIG_MAX_LPM_TABLES 16
+
+/*
+ * Maximum number of QSBR domains
+ */
+#define CONFIG_MAX_QSBR 16
+
+/*
+ * Maximum number of proto stats objects
+ */
+#define CONFIG_MAX_PROTO_STATS 4096
+
+/*
+ * Number of counter shards per proto stats object
+ *
+ * Threads update counters of the shard selected by thread ID. Counter values
+ * are sums over all shards.
+ */
+#define CONFIG_PROTO_STATS_SHARDS 16
+
 /*
  * Maximum buffer alignment
  *
@@ -140,6 +168,25 @@ extern "C" {
 				   CONFIG_PACKET_HEADROOM + \
 				   CONFIG_PACKET_TAILROOM)
 
+/*
+ * Minimum packet segment length of a packet length class
+ *
+ * Packet pools created with subparameters store each packet length class in
+ * segments sized for the class. This defines the minimum segment length of
+ * those classes in bytes.
+ */
+#define CONFIG_PACKET_CLASS_SEG_LEN_MIN 128
+
+/*
+ * Pools reserved for packet length classes
+ *
+ * The first packet length class of a packet pool created with subparameters
+ * is stored in the pool itself, and each subparameter class in an additional
+ * pool. This many pools are reserved for those additional pools. Must be at
+ * least ODP_POOL_MAX_SUBPARAMS.
+ */
+#define CONFIG_PACKET_CLASS_POOLS 14
+
 /*
  * Number of shared memory blocks reserved for implementation internal use.
  *
@@ -182,6 +229,13 @@ extern "C" {
 /* Maximum event vector size */
 #define CONFIG_EVENT_VECTOR_MAX_SIZE 256
 
+/* Maximum packet and event vector aggregation timeout in nanoseconds */
+#define CONFIG_VECTOR_MAX_TMO_NS 1000000000
+
+/* Minimum event aggregator timeout in nanoseconds. Scheduler checks event aggregators of
+ * scheduled queues for timeouts at half of this interval. */
+#define CONFIG_EVENT_AGGR_MIN_TMO_NS 10000
+
 /* Enable pool statistics collection */
 #define CONFIG_POOL_STATISTICS 1
 
@@ -218,6 +272,14 @@ extern "C" {
  * disable padding. */
 #define CONFIG_CACHE_PAD_LINES 1
 
+/*
+ * Number of shards in sharded statistics counters
+ *
+ * Threads are mapped to shards by thread ID, so with at most this many threads
+ * each thread updates its own shard. Must be a power of two.
+ */
+#define CONFIG_STAT_SHARDS 32
+
 #ifdef __cplusplus
 }
 #endif
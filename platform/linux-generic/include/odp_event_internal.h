@@ -15,6 +15,8 @@
 extern "C" {
 #endif
 
+#include <odp/autoheader_internal.h>
+
 #include <odp/api/debug.h>
 #include <odp/api/event.h>
 #include <odp/api/pool_types.h>
@@ -66,6 +68,15 @@ typedef struct _odp_event_hdr_t {
 	/* Event flow id */
 	uint8_t   flow_id;
 
+	/* Packet length class of the pool. Non-zero when the event is not stored in the pool
+	 * visible to application. */
+	uint8_t   class_idx;
+
+#if _ODP_SCHED_STATS
+	/* Scheduled queue enqueue time in nanoseconds */
+	uint64_t  sched_ts;
+#endif
+
 } _odp_event_hdr_t;
 
 static inline odp_event_t _odp_event_from_hdr(_odp_event_hdr_t *hdr)
@@ -0,0 +1,77 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP Traffic Manager - flow queuing with CoDel (FQ-CoDel) packet store
+ */
+
+#ifndef _ODP_INT_FQ_CODEL_H_
+#define _ODP_INT_FQ_CODEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <odp/api/packet.h>
+
+#include <stdint.h>
+
+typedef uint64_t _odp_int_fq_codel_t;
+
+#define _ODP_INT_FQ_CODEL_INVALID  0
+
+/* Maximum number of packets that _odp_fq_codel_dequeue() drops per call */
+#define _ODP_INT_FQ_CODEL_MAX_DROPS  16
+
+/* Limits for the number of sub-flows and queued packets */
+#define _ODP_INT_FQ_CODEL_MAX_FLOWS  (64 * 1024)
+#define _ODP_INT_FQ_CODEL_MAX_PKTS   (64 * 1024)
+
+/* Create a flow queue with 'num_flows' DRR sub-flows, which can hold up to
+ * 'max_pkts' packets in total. Times ('target' and 'interval') are in the
+ * same unit as the 'now' arguments of enqueue and dequeue calls.
+ */
+_odp_int_fq_codel_t _odp_fq_codel_create(uint32_t num_flows,
+					 uint32_t max_pkts,
+					 uint32_t quantum,
+					 uint64_t target,
+					 uint64_t interval);
+
+/* Enqueue a packet into the sub-flow selected by 'flow_hash'. When the
+ * queue is full, a packet is dropped from the head of the longest sub-flow
+ * and returned in 'drop_pkt'. Returns 1 when a packet was dropped, 0 when
+ * not, or <0 on failure.
+ */
+int _odp_fq_codel_enqueue(_odp_int_fq_codel_t fq_codel,
+			  odp_packet_t        pkt,
+			  uint32_t            flow_hash,
+			  uint64_t            now,
+			  odp_packet_t       *drop_pkt);
+
+/* Dequeue the next packet in DRR order. Packets that CoDel decided to drop
+ * are returned in 'drop_pkts' (up to _ODP_INT_FQ_CODEL_MAX_DROPS) and their
+ * count in 'num_drops'. Returns 1 when a packet was dequeued and 0 when the
+ * queue is empty.
+ */
+int _odp_fq_codel_dequeue(_odp_int_fq_codel_t fq_codel,
+			  uint64_t            now,
+			  odp_packet_t       *pkt,
+			  odp_packet_t        drop_pkts[],
+			  uint32_t           *num_drops);
+
+/* Number of packets currently queued */
+uint32_t _odp_fq_codel_count(_odp_int_fq_codel_t fq_codel);
+
+void _odp_fq_codel_stats_print(_odp_int_fq_codel_t fq_codel);
+
+/* Destroy the flow queue. Packets still in the queue are freed. */
+void _odp_fq_codel_destroy(_odp_int_fq_codel_t fq_codel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,42 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP packet input software generic receive offload (GRO)
+ */
+
+#ifndef ODP_GRO_INTERNAL_H_
+#define ODP_GRO_INTERNAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <odp/api/packet.h>
+
+#include <stdint.h>
+
+/* Maximum number of TCP segments coalesced into a single packet */
+#define _ODP_GRO_MAX_SEGS 64
+
+/*
+ * Coalesce TCP segments of received packets
+ *
+ * Consecutive in-order TCP segments of the same flow are merged into the first
+ * segment of the flow, which stays in its original position in the table. IP
+ * and TCP headers of merged packets are updated to match the new length, and
+ * packet payload offset is set to the start of the TCP payload. At most
+ * 'max_segs' segments are merged into a single packet.
+ *
+ * Returns the number of packets in the table.
+ */
+int _odp_gro_pktin(odp_packet_t pkt[], int num, uint32_t max_segs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -108,6 +108,18 @@ int _odp_dma_term_global(void);
 int _odp_ml_init_global(void);
 int _odp_ml_term_global(void);
 
+int _odp_hashtable_init_global(void);
+int _odp_hashtable_term_global(void);
+
+int _odp_lpm_init_global(void);
+int _odp_lpm_term_global(void);
+
+int _odp_qsbr_init_global(void);
+int _odp_qsbr_term_global(void);
+
+int _odp_proto_stats_init_global(void);
+int _odp_proto_stats_term_global(void);
+
 #ifdef __cplusplus
 }
 #endif
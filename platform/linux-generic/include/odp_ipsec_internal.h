@@ -375,6 +375,25 @@ int _odp_ipsec_sa_replay_precheck(ipsec_sa_t *ipsec_sa, uint64_t seq,
 int _odp_ipsec_sa_replay_update(ipsec_sa_t *ipsec_sa, uint64_t seq,
 				odp_ipsec_op_status_t *status);
 
+/* Run check on sequence numbers of multiple packets of the same SA and update
+ * window if necessary. Packets are checked in the given order, but the window
+ * is locked (or updated atomically) only once for the whole burst.
+ *
+ * @return Number of packets that fall out of window
+ */
+int _odp_ipsec_sa_replay_update_multi(ipsec_sa_t *ipsec_sa, const uint64_t seq[],
+				      odp_ipsec_op_status_t *status[], int num);
+
+/**
+ * Allocate a sequence number for an outgoing packet.
+ */
+uint64_t _odp_ipsec_sa_alloc_seq_no(ipsec_sa_t *ipsec_sa);
+
+/**
+ * Set the next outbound sequence number of an SA.
+ */
+void _odp_ipsec_sa_seq_no_set(ipsec_sa_t *ipsec_sa, uint64_t seq);
+
 /**
   * Allocate an IPv4 ID for an outgoing packet.
   */
@@ -388,6 +407,18 @@ uint16_t _odp_ipsec_sa_alloc_ipv4_id(ipsec_sa_t *ipsec_sa);
  */
 int _odp_ipsec_try_inline(odp_packet_t *pkt);
 
+/**
+ * Try inline IPsec processing of a burst of packets.
+ *
+ * Packets are processed together, so that SA lookups, crypto operations and
+ * anti-replay window updates are done per burst. Processed packets are marked
+ * in 'done' and need to be enqueued to their destination queue, other packets
+ * are left for normal packet input processing. Packet handles may change.
+ *
+ * @return Number of packets processed by IPsec
+ */
+int _odp_ipsec_try_inline_multi(odp_packet_t pkt[], int num, uint8_t done[]);
+
 /**
  * Populate number of packets and bytes of data successfully processed by the SA
  * in the odp_ipsec_stats_t structure passed.
@@ -12,6 +12,8 @@
 #ifndef ODP_MACROS_INTERNAL_H_
 #define ODP_MACROS_INTERNAL_H_
 
+#include <odp/autoheader_internal.h>
+
 #include <odp/api/align.h>
 #include <odp/api/debug.h>
 
@@ -113,10 +115,11 @@ __extension__ ({			\
 
 /*
  * Check that the offset of 'field' in struct 'type' falls within the 'block':th
- * 64 byte block of the struct. Only do the check in 64-bit compilations.
+ * 64 byte block of the struct. Only do the check in 64-bit compilations. Scheduler
+ * statistics extend the common event header, so the check is skipped in that case.
  */
 #define _ODP_STATIC_ASSERT_64B_BLOCK(block, type, field)				\
-	ODP_STATIC_ASSERT((sizeof(void *) != 8) ||					\
+	ODP_STATIC_ASSERT((sizeof(void *) != 8) || _ODP_SCHED_STATS ||			\
 			  (offsetof(type, field) / 64 + 1 == (block)),	\
 			  #type "::" #field " not in 64B block " #block)
 
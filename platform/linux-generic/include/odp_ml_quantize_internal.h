@@ -0,0 +1,46 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#ifndef ODP_ML_QUANTIZE_INTERNAL_H_
+#define ODP_ML_QUANTIZE_INTERNAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/*
+ * Architecture specific conversion functions
+ *
+ * Each function converts elements from the beginning of the array and returns the number of
+ * elements converted, which may be less than 'num' (e.g. zero when vector instructions are not
+ * available). Caller converts the remaining elements. Results must be identical to the generic
+ * scalar implementation.
+ */
+
+uint32_t _odp_ml_fp32_to_uint8_arch(uint8_t *u8, const float *fp32, uint32_t num, float scale,
+				    uint8_t zerop);
+uint32_t _odp_ml_fp32_from_uint8_arch(float *fp32, const uint8_t *u8, uint32_t num, float scale,
+				      uint8_t zerop);
+uint32_t _odp_ml_fp32_to_int8_arch(int8_t *i8, const float *fp32, uint32_t num, float scale,
+				   int8_t zerop);
+uint32_t _odp_ml_fp32_from_int8_arch(float *fp32, const int8_t *i8, uint32_t num, float scale,
+				     int8_t zerop);
+uint32_t _odp_ml_fp32_to_uint16_arch(uint16_t *u16, const float *fp32, uint32_t num, float scale,
+				     uint16_t zerop);
+uint32_t _odp_ml_fp32_from_uint16_arch(float *fp32, const uint16_t *u16, uint32_t num,
+				       float scale, uint16_t zerop);
+uint32_t _odp_ml_fp32_to_int16_arch(int16_t *i16, const float *fp32, uint32_t num, float scale,
+				    int16_t zerop);
+uint32_t _odp_ml_fp32_from_int16_arch(float *fp32, const int16_t *i16, uint32_t num, float scale,
+				      int16_t zerop);
+uint32_t _odp_ml_fp32_to_fp16_arch(uint16_t *fp16, const float *fp32, uint32_t num);
+uint32_t _odp_ml_fp32_from_fp16_arch(float *fp32, const uint16_t *fp16, uint32_t num);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -147,8 +147,8 @@ typedef struct ODP_ALIGNED_CACHE odp_packet_hdr_t {
 	/* LSO profile index */
 	uint8_t lso_profile_idx;
 
-	/* Unused field. Used only for optimizing metadata copying */
-	uint8_t unused;
+	/* Number of fragments in a reassembled packet */
+	uint8_t reass_frags;
 
 	/* Packet aging drop timeout before enqueue. Once enqueued holds the maximum age (time of
 	 * request + requested drop timeout). */
@@ -160,6 +160,12 @@ typedef struct ODP_ALIGNED_CACHE odp_packet_hdr_t {
 	/* Pktio where packet is used as a memory source */
 	uint8_t ms_pktio_idx;
 
+	/* Proto stats object index */
+	uint16_t proto_stats_idx;
+
+	/* Proto stats octet count adjustments */
+	int32_t proto_stats_adj[2];
+
 	union {
 		/* Result for crypto packet op */
 		odp_crypto_packet_result_t crypto_op_result;
@@ -169,6 +175,24 @@ typedef struct ODP_ALIGNED_CACHE odp_packet_hdr_t {
 
 		/* Result for comp packet op */
 		odp_comp_packet_result_t comp_op_result;
+
+		/* Fragment state while held in the inline reassembly table */
+		struct {
+			/* Next fragment of the same datagram, in offset order */
+			struct odp_packet_hdr_t *next;
+
+			/* Reception time of the first fragment */
+			uint64_t start_ns;
+
+			/* Fragment payload offset and length */
+			uint32_t offset;
+			uint32_t len;
+
+			/* L3 offset and length of L2 and L3 headers (incl. IPv6 fragment header) */
+			uint16_t l3_offset;
+			uint16_t hdr_len;
+
+		} reass;
 	};
 
 	/* Packet data storage */
@@ -354,13 +378,18 @@ static inline void _odp_packet_copy_md(odp_packet_hdr_t *restrict dst_hdr,
 	    src_hdr->p.flags.payload_off ||
 	    src_hdr->p.flags.lso ||
 	    src_hdr->p.flags.tx_aging ||
-	    src_hdr->p.flags.tx_compl_poll) {
+	    src_hdr->p.flags.tx_compl_poll ||
+	    src_hdr->p.flags.proto_stats ||
+	    src_hdr->p.flags.reass) {
 		_ODP_STATIC_ASSERT_64B_BLOCK(3, odp_packet_hdr_t, cls_mark);
 		_ODP_STATIC_ASSERT_64B_BLOCK(3, odp_packet_hdr_t, payload_offset);
 		_ODP_STATIC_ASSERT_64B_BLOCK(3, odp_packet_hdr_t, lso_max_payload);
 		_ODP_STATIC_ASSERT_64B_BLOCK(3, odp_packet_hdr_t, tx_aging_ns);
 		_ODP_STATIC_ASSERT_64B_BLOCK(3, odp_packet_hdr_t, tx_compl_id);
 		_ODP_STATIC_ASSERT_64B_BLOCK(3, odp_packet_hdr_t, lso_profile_idx);
+		_ODP_STATIC_ASSERT_64B_BLOCK(3, odp_packet_hdr_t, reass_frags);
+		_ODP_STATIC_ASSERT_64B_BLOCK(3, odp_packet_hdr_t, proto_stats_idx);
+		_ODP_STATIC_ASSERT_64B_BLOCK(3, odp_packet_hdr_t, proto_stats_adj);
 
 		dst_hdr->timestamp       = src_hdr->timestamp;
 		dst_hdr->cls_mark        = src_hdr->cls_mark;
@@ -369,7 +398,10 @@ static inline void _odp_packet_copy_md(odp_packet_hdr_t *restrict dst_hdr,
 		dst_hdr->tx_aging_ns     = src_hdr->tx_aging_ns;
 		dst_hdr->tx_compl_id     = src_hdr->tx_compl_id;
 		dst_hdr->lso_profile_idx = src_hdr->lso_profile_idx;
-		dst_hdr->unused          = src_hdr->unused; /* not copying this is slower */
+		dst_hdr->reass_frags     = src_hdr->reass_frags;
+		dst_hdr->proto_stats_idx = src_hdr->proto_stats_idx;
+		dst_hdr->proto_stats_adj[0] = src_hdr->proto_stats_adj[0];
+		dst_hdr->proto_stats_adj[1] = src_hdr->proto_stats_adj[1];
 	}
 
 	dst_hdr->p = src_hdr->p;
@@ -524,6 +556,11 @@ int _odp_packet_l4_chksum(odp_packet_hdr_t *pkt_hdr,
 
 int _odp_packet_unshare(odp_packet_t *pkt);
 
+/* Create a reference to 'len' bytes of packet data starting from 'offset'.
+ * Only the segments covering the range are referenced. Fails if 'pkt' is
+ * itself a reference. */
+odp_packet_t _odp_packet_ref_part(odp_packet_t pkt, uint32_t offset, uint32_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,6 +32,7 @@ extern "C" {
 #include <odp_macros_internal.h>
 #include <odp_packet_io_stats_common.h>
 #include <odp_queue_if.h>
+#include <odp_stat_shard_internal.h>
 
 #include <inttypes.h>
 #include <linux/if_ether.h>
@@ -61,6 +62,7 @@ ODP_STATIC_ASSERT(PKTIO_LSO_PROFILES < UINT8_MAX, "PKTIO_LSO_PROFILES_ERROR");
 
 /* Forward declaration */
 struct pktio_if_ops;
+struct _odp_reass_tbl_t;
 
 #if defined(_ODP_PKTIO_XDP) && ODP_CACHE_LINE_SIZE == 128
 #define PKTIO_PRIVATE_SIZE 33792
@@ -70,6 +72,29 @@ struct pktio_if_ops;
 #define PKTIO_PRIVATE_SIZE 9216
 #endif
 
+/* Vector configuration of a packet input queue */
+typedef struct {
+	odp_pool_t pool;
+	odp_queue_t aggr_queue;
+	odp_event_type_t type;
+	uint32_t max_size;
+	uint64_t max_tmo_ns;
+
+	/* Packet vector under construction when timeout is used */
+	odp_ticketlock_t lock;
+	odp_packet_vector_t pktv;
+	uint32_t num;
+	uint64_t tmo_ns;
+} pktin_vector_t;
+
+/* Statistics counters shard */
+typedef struct ODP_ALIGNED_CACHE {
+	odp_atomic_u64_t in_discards;
+	odp_atomic_u64_t in_errors;
+	odp_atomic_u64_t out_discards;
+
+} pktio_stats_extra_t;
+
 typedef struct ODP_ALIGNED_CACHE {
 	const struct pktio_if_ops *ops; /**< Implementation specific methods */
 	/* These two locks together lock the whole pktio device */
@@ -93,10 +118,20 @@ typedef struct ODP_ALIGNED_CACHE {
 				uint8_t tx_compl : 1;
 				/* Packet aging */
 				uint8_t tx_aging : 1;
+				/* Inline IP reassembly */
+				uint8_t reass : 1;
+				/* Software GRO */
+				uint8_t gro : 1;
+				/* Proto stats */
+				uint8_t proto_stats : 1;
 			};
 		};
 	} enabled;
 
+	/* Driver output copies packet data without modifying it, so
+	 * packets referencing other packets can be sent as is */
+	uint8_t tx_ref;
+
 	odp_pktio_t handle;		/**< pktio handle */
 	unsigned char pkt_priv[PKTIO_PRIVATE_SIZE] ODP_ALIGNED_CACHE;
 	enum {
@@ -121,12 +156,8 @@ typedef struct ODP_ALIGNED_CACHE {
 	classifier_t cls;		/**< classifier linked with this pktio*/
 	/* Driver level statistics counters */
 	odp_pktio_stats_t stats;
-	/* Statistics counters used also outside drivers */
-	struct {
-		odp_atomic_u64_t in_discards;
-		odp_atomic_u64_t in_errors;
-		odp_atomic_u64_t out_discards;
-	} stats_extra;
+	/* Statistics counters used also outside drivers, sharded per thread */
+	pktio_stats_extra_t stats_extra[CONFIG_STAT_SHARDS];
 	/* Latest Tx timestamp */
 	odp_atomic_u64_t tx_ts;
 	pktio_stats_type_t stats_type;
@@ -146,6 +177,9 @@ typedef struct ODP_ALIGNED_CACHE {
 	/* Status map for Tx completion identifiers */
 	odp_atomic_u32_t *tx_compl_status;
 
+	/* Inline IP reassembly table */
+	struct _odp_reass_tbl_t *reass_tbl;
+
 	/* Storage for queue handles
 	 * Multi-queue support is pktio driver specific */
 	uint32_t num_in_queue;
@@ -154,12 +188,7 @@ typedef struct ODP_ALIGNED_CACHE {
 	struct {
 		odp_queue_t        queue;
 		odp_pktin_queue_t  pktin;
-		struct {
-			odp_pool_t pool;
-			odp_queue_t aggr_queue;
-			odp_event_type_t type;
-			uint32_t max_size;
-		} vector;
+		pktin_vector_t     vector;
 	} in_queue[ODP_PKTIN_MAX_QUEUES];
 
 	struct {
@@ -186,6 +215,8 @@ typedef struct {
 		uint16_t pktin_frame_offset;
 		/* Pool size for potential completion events */
 		uint32_t tx_compl_pool_size;
+		/* Maximum number of TCP segments per GRO packet, 0 disables GRO */
+		uint32_t gro_max_segs;
 	} config;
 
 	pktio_entry_t entries[CONFIG_PKTIO_ENTRIES];
@@ -292,6 +323,11 @@ static inline int _odp_pktio_tx_aging_enabled(pktio_entry_t *entry)
 	return entry->enabled.tx_aging;
 }
 
+static inline int _odp_pktio_proto_stats_enabled(const pktio_entry_t *entry)
+{
+	return entry->enabled.proto_stats;
+}
+
 static inline void _odp_pktio_tx_ts_set(pktio_entry_t *entry)
 {
 	odp_time_t ts_val = odp_time_global();
@@ -342,9 +378,11 @@ odp_lso_profile_t _odp_lso_prof_from_idx(uint8_t idx);
 int _odp_lso_num_packets(odp_packet_t packet, const odp_packet_lso_opt_t *lso_opt,
 			 uint32_t *len_out, uint32_t *left_over_out);
 
+/* Payload of the resulting packets references the original packet data when
+ * 'use_ref' is set, otherwise payload is copied */
 int _odp_lso_create_packets(odp_packet_t packet, const odp_packet_lso_opt_t *lso_opt,
 			    uint32_t payload_len, uint32_t left_over_len,
-			    odp_packet_t pkt_out[], int num_pkt);
+			    odp_packet_t pkt_out[], int num_pkt, int use_ref);
 
 void _odp_pktio_process_tx_compl(const pktio_entry_t *entry, const odp_packet_t packets[],
 				 int num);
@@ -28,6 +28,10 @@ extern "C" {
 
 #define _ODP_POOL_MEM_SRC_DATA_SIZE 128
 
+/* Maximum number of packet length classes in a packet pool (main specification and
+ * subparameters) */
+#define _ODP_POOL_MAX_CLASSES (ODP_POOL_MAX_SUBPARAMS + 1)
+
 typedef struct ODP_ALIGNED_CACHE pool_cache_t {
 	/* Number of buffers in cache */
 	odp_atomic_u32_t cache_num;
@@ -60,6 +64,11 @@ typedef struct pool_t {
 	uint8_t          memset_mark;
 	uint8_t          type;
 	uint8_t          pool_ext;
+	/* Number of packet length classes in the pool set, zero when created without
+	 * subparameters */
+	uint8_t          num_class;
+	/* Index of the class within the pool set */
+	uint8_t          class_idx;
 	pool_ring_t     *ring;
 	uint32_t         ring_mask;
 	uint32_t         cache_size;
@@ -82,6 +91,15 @@ typedef struct pool_t {
 	uint8_t         *max_addr;
 	uint32_t         ext_head_offset;
 	uint32_t         skipped_blocks;
+
+	/* Pool handle visible to application. Pool itself, or the first pool of a pool set
+	 * when this pool stores a packet length class. */
+	odp_pool_t       parent;
+
+	/* Pools of all packet length classes in increasing segment length order (on the
+	 * first pool of a pool set) */
+	struct pool_t   *class_pool[_ODP_POOL_MAX_CLASSES];
+
 	odp_pool_param_t params;
 	odp_pool_ext_param_t ext_param;
 
@@ -111,6 +129,9 @@ typedef struct pool_t {
 	uint32_t         num_populated;
 	odp_pool_type_t  type_2; /* Pool type from application PoV */
 	uint8_t          mem_from_huge_pages;
+	uint32_t         init_threads;
+	uint64_t         shm_time_ns;
+	uint64_t         init_time_ns;
 	char             name[ODP_POOL_NAME_LEN];
 
 } pool_t;
@@ -119,6 +140,9 @@ typedef struct pool_global_t {
 	pool_t    pool[CONFIG_POOLS];
 	odp_shm_t shm;
 
+	/* Number of reserved pools used by packet length classes */
+	odp_atomic_u32_t num_class_pools;
+
 	struct {
 		uint32_t pkt_max_len;
 		uint32_t pkt_max_num;
@@ -126,6 +150,7 @@ typedef struct pool_global_t {
 		uint32_t burst_size;
 		uint32_t pkt_base_align;
 		uint32_t buf_min_align;
+		uint32_t init_threads;
 	} config;
 
 } pool_global_t;
@@ -0,0 +1,61 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP proto stats - packet output interface
+ */
+
+#ifndef ODP_PROTO_STATS_INTERNAL_H_
+#define ODP_PROTO_STATS_INTERNAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <odp/api/packet.h>
+#include <odp/api/proto_stats.h>
+
+#include <odp/api/plat/strong_types.h>
+
+#include <stdint.h>
+
+/* Proto stats update of an output packet */
+typedef struct {
+	/* Proto stats object index */
+	uint16_t idx;
+
+	/* Packet index in the output burst */
+	uint16_t pkt_idx;
+
+	/* Octet counts including adjustments */
+	uint32_t oct_count0;
+	uint32_t oct_count1;
+
+} _odp_proto_stats_tx_t;
+
+static inline odp_proto_stats_t _odp_proto_stats_from_idx(uint32_t idx)
+{
+	return _odp_cast_scalar(odp_proto_stats_t, idx + 1);
+}
+
+static inline uint32_t _odp_proto_stats_to_idx(odp_proto_stats_t stat)
+{
+	return _odp_typeval(stat) - 1;
+}
+
+/* Collect proto stats updates of packets before they are passed to a pktio driver. Returns
+ * number of updates written into 'info'. */
+int _odp_proto_stats_tx_prepare(const odp_packet_t packets[], int num,
+				_odp_proto_stats_tx_t info[]);
+
+/* Update counters of the first 'num_sent' packets */
+void _odp_proto_stats_tx_finish(const _odp_proto_stats_tx_t info[], int num, int num_sent);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,47 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP quiescent state based reclamation - scheduler interface
+ */
+
+#ifndef ODP_QSBR_INTERNAL_H_
+#define ODP_QSBR_INTERNAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <odp/api/hints.h>
+
+#include <odp_config_internal.h>
+
+#include <stdint.h>
+
+/* Domains with scheduler reported quiescent states, in which this thread is online */
+typedef struct {
+	uint32_t num_sched;
+	void *sched[CONFIG_MAX_QSBR];
+
+} _odp_qsbr_local_t;
+
+extern __thread _odp_qsbr_local_t _odp_qsbr_local;
+
+void _odp_qsbr_sched_quiescent_all(void);
+
+/* Called by schedulers in the beginning of every schedule call, after the previous
+ * scheduling context has been released */
+static inline void _odp_qsbr_sched_quiescent(void)
+{
+	if (odp_unlikely(_odp_qsbr_local.num_sched))
+		_odp_qsbr_sched_quiescent_all();
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -18,6 +18,7 @@ extern "C" {
 #include <odp_buffer_internal.h>
 #include <odp/api/packet_io.h>
 #include <odp/api/align.h>
+#include <odp/api/atomic.h>
 #include <odp/api/hints.h>
 #include <odp/api/ticketlock.h>
 #include <odp_config_internal.h>
@@ -39,7 +40,12 @@ typedef struct ODP_ALIGNED_CACHE event_aggr_s {
 	uint32_t max_size;
 	odp_event_type_t event_type;
 
+	/* Aggregation timeout, 0 when events may wait indefinitely */
+	uint64_t max_tmo_ns;
+
 	odp_ticketlock_t lock;
+	/* Global time (ns) when pending events must be delivered */
+	uint64_t tmo_ns;
 	odp_event_t event_tbl[CONFIG_EVENT_VECTOR_MAX_SIZE];
 	uint16_t num_events;
 
@@ -97,6 +103,15 @@ typedef struct queue_global_t {
 		uint32_t default_queue_size;
 	} config;
 
+	/* Event aggregators of scheduled queues with a timeout */
+	struct {
+		odp_ticketlock_t lock;
+		odp_atomic_u32_t num;
+		/* Global time (ns) of the next timeout check */
+		odp_atomic_u64_t next_ns;
+		queue_entry_t *aggr_queue[CONFIG_MAX_EVENT_AGGR];
+	} aggr_tmo;
+
 } queue_global_t;
 
 extern queue_global_t *_odp_queue_glb;
@@ -142,6 +157,19 @@ odp_event_vector_t _odp_event_vector_create(odp_queue_t aggr_handle, odp_packet_
 /* Functions for SPSC queue */
 int _odp_event_aggr_enq(queue_entry_t *aggr_queue, _odp_event_hdr_t *event_hdr[], uint32_t num);
 
+/* Dequeue pending events of a timed out aggregator. Called when a plain queue is empty. */
+int _odp_event_aggr_deq_tmo(queue_entry_t *base_queue, _odp_event_hdr_t *event_hdr[]);
+
+/* Enqueue pending events of timed out aggregators of scheduled queues */
+void _odp_event_aggr_tmo_scan(void);
+
+/* Timeout check for schedulers */
+static inline void _odp_event_aggr_tmo_run(void)
+{
+	if (odp_unlikely(odp_atomic_load_u32(&_odp_queue_glb->aggr_tmo.num)))
+		_odp_event_aggr_tmo_scan();
+}
+
 #ifdef __cplusplus
 }
 #endif
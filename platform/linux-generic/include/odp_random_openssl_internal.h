@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: BSD-3-Clause
- * Copyright (c) 2020 Nokia
+ * Copyright (c) 2020-2026 Nokia
  */
 
 #ifndef ODP_RANDOM_OPENSSL_INTERNAL_H_
@@ -12,7 +12,8 @@ extern "C" {
 #include <stdint.h>
 
 int32_t _odp_random_openssl_data(uint8_t *buf, uint32_t len);
-int _odp_random_openssl_init_local(void);
+int32_t _odp_random_openssl_drbg_data(uint8_t *buf, uint32_t len);
+int _odp_random_openssl_init_local(int use_drbg, uint64_t reseed);
 int _odp_random_openssl_term_local(void);
 
 #ifdef __cplusplus
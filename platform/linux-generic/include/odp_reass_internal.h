@@ -0,0 +1,55 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP packet input inline IP reassembly
+ */
+
+#ifndef ODP_REASS_INTERNAL_H_
+#define ODP_REASS_INTERNAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <odp/api/packet.h>
+#include <odp/api/reassembly.h>
+#include <odp/api/time.h>
+
+#include <odp_packet_io_internal.h>
+
+#include <stdint.h>
+
+/* Maximum number of fragments per reassembled packet */
+#define _ODP_REASS_MAX_FRAGS 32
+
+/* Maximum time a fragment may wait for the other fragments */
+#define _ODP_REASS_MAX_WAIT_NS (10 * ODP_TIME_SEC_IN_NS)
+
+/* Fill in reassembly capability of a pktio with software reassembly */
+void _odp_reass_capability(odp_reass_capability_t *capa);
+
+/* Create/destroy reassembly table of a pktio. Destroy frees all held fragments. */
+int _odp_reass_create(pktio_entry_t *entry);
+void _odp_reass_destroy(pktio_entry_t *entry);
+
+/*
+ * Reassemble IP fragments of received packets
+ *
+ * Fragments are removed from the packet table and held until all fragments of
+ * the datagram have been received. Reassembled packets and incomplete
+ * reassembly results are returned in place of the fragments. Results of
+ * expired reassemblies are appended to the table, up to 'max' packets.
+ *
+ * Returns the number of packets in the table.
+ */
+int _odp_reass_pktin(pktio_entry_t *entry, odp_packet_t pkt[], int num, int max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
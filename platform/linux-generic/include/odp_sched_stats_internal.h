@@ -0,0 +1,63 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP scheduler statistics - queue interface
+ */
+
+#ifndef ODP_SCHED_STATS_INTERNAL_H_
+#define ODP_SCHED_STATS_INTERNAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <odp/autoheader_internal.h>
+
+#include <odp/api/schedule_types.h>
+
+#include <odp/api/plat/time_inlines.h>
+
+#include <odp_event_internal.h>
+
+#include <stdint.h>
+
+/* Wait time histogram bucket of a time difference in nanoseconds */
+static inline uint32_t _odp_sched_stats_bucket(uint64_t ns)
+{
+	uint32_t bucket;
+
+	if (ns == 0)
+		return 0;
+
+	bucket = 64 - __builtin_clzll(ns);
+
+	if (bucket >= ODP_SCHEDULE_WAIT_HIST_BUCKETS)
+		bucket = ODP_SCHEDULE_WAIT_HIST_BUCKETS - 1;
+
+	return bucket;
+}
+
+/* Record enqueue time of events into a scheduled queue. Compiles to nothing when scheduler
+ * statistics are disabled. */
+static inline void _odp_sched_stats_stamp(_odp_event_hdr_t *event_hdr[], int num)
+{
+#if _ODP_SCHED_STATS
+	const uint64_t now = odp_time_global_ns();
+
+	for (int i = 0; i < num; i++)
+		event_hdr[i]->sched_ts = now;
+#else
+	(void)event_hdr;
+	(void)num;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -11,8 +11,11 @@ extern "C" {
 #endif
 
 #include <odp/api/packet_io.h>
+
+#include <odp_packet_internal.h>
 #include <protocols/eth.h>
 
+#include <linux/virtio_net.h>
 #include <string.h>
 
 #define _ODP_SOCKET_MTU_MIN (68 + _ODP_ETHHDR_LEN)
@@ -65,6 +68,91 @@ int _odp_link_status_fd(int fd, const char *name);
  */
 int _odp_link_info_fd(int fd, const char *name, odp_pktio_link_info_t *info);
 
+/**
+ * Enable virtio-net headers on a packet socket
+ *
+ * Must be called before packet mmap rings are set up. Returns 1 when enabled
+ * and 0 when the kernel does not support virtio-net headers.
+ */
+int _odp_sock_vnet_hdr_enable(int fd);
+
+/**
+ * Fill virtio-net header of an output packet
+ *
+ * When L4 checksum insertion is needed for the packet, pseudo header checksum
+ * is written into the checksum field in 'data' and the kernel is requested to
+ * complete the checksum. L4 protocol and offset are taken from packet parse
+ * results, and pseudo header length from the L3 header. 'data' points to the
+ * first 'len' bytes of the packet. Returns 0 on success, 1 when the L4 protocol
+ * or offset is not known and the checksum needs to be inserted with
+ * _odp_sock_chksum_sw(), and -1 when the headers are not within 'data'.
+ */
+int _odp_sock_vnet_hdr_tx(const odp_pktout_config_opt_t *pktout_cfg,
+			  const odp_packet_hdr_t *pkt_hdr, struct virtio_net_hdr *vnet_hdr,
+			  uint8_t *data, uint32_t len);
+
+/**
+ * Insert L4 checksum of an output packet in software
+ *
+ * Parses the packet from L3 up to L4 and inserts TCP/UDP checksum when
+ * requested by the packet or the pktout configuration. Packet parse results
+ * and flags are restored afterwards.
+ */
+void _odp_sock_chksum_sw(const odp_pktout_config_opt_t *pktout_cfg, odp_packet_t pkt);
+
+/**
+ * Complete L4 checksum of a received packet
+ *
+ * Packets sent locally with checksum offload are received with NEEDS_CSUM
+ * flag set, and their checksum field contains only the pseudo header checksum.
+ * The checksum is calculated over the packet data from the checksum start
+ * offset, which is adjusted by 'offset'.
+ */
+void _odp_sock_vnet_hdr_csum_complete(odp_packet_t pkt, const struct virtio_net_hdr *vnet_hdr,
+				      uint32_t offset);
+
+static inline int _odp_sock_vnet_hdr_chksum_ok(const struct virtio_net_hdr *vnet_hdr)
+{
+	return vnet_hdr->flags & (VIRTIO_NET_HDR_F_DATA_VALID | VIRTIO_NET_HDR_F_NEEDS_CSUM);
+}
+
+/**
+ * Pktin options for parsing a packet received with a virtio-net header
+ *
+ * L4 checksum is not checked in software when the kernel has already
+ * validated it, or when the packet was generated locally and the checksum
+ * has not been calculated yet.
+ */
+static inline odp_pktin_config_opt_t
+_odp_sock_vnet_hdr_rx_opt(const struct virtio_net_hdr *vnet_hdr, odp_pktin_config_opt_t opt)
+{
+	if (_odp_sock_vnet_hdr_chksum_ok(vnet_hdr)) {
+		opt.bit.udp_chksum = 0;
+		opt.bit.tcp_chksum = 0;
+		opt.bit.sctp_chksum = 0;
+	}
+
+	return opt;
+}
+
+/**
+ * Update L4 checksum status of a parsed packet from its virtio-net header
+ */
+static inline void _odp_sock_vnet_hdr_rx(odp_packet_hdr_t *pkt_hdr,
+					 const struct virtio_net_hdr *vnet_hdr,
+					 odp_pktin_config_opt_t opt)
+{
+	const packet_parser_t *prs = &pkt_hdr->p;
+
+	if (!_odp_sock_vnet_hdr_chksum_ok(vnet_hdr) || prs->input_flags.ipfrag)
+		return;
+
+	if ((opt.bit.udp_chksum && prs->input_flags.udp) ||
+	    (opt.bit.tcp_chksum && prs->input_flags.tcp) ||
+	    (opt.bit.sctp_chksum && prs->input_flags.sctp))
+		pkt_hdr->p.input_flags.l4_chksum_done = 1;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,120 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @file
+ *
+ * ODP sharded statistics counters
+ *
+ * Statistics counters that are updated per packet by many threads are split into
+ * CONFIG_STAT_SHARDS cache line aligned shards. A thread updates only the shard selected
+ * by its thread ID, which keeps counter cache lines local to the thread. Counter values
+ * are summed over all shards only when statistics are read.
+ *
+ * Users define a cache line aligned shard struct of odp_atomic_u64_t counters and store an
+ * array of CONFIG_STAT_SHARDS of those, e.g.:
+ *
+ *   typedef struct ODP_ALIGNED_CACHE {
+ *           odp_atomic_u64_t packets;
+ *           odp_atomic_u64_t discards;
+ *   } foo_stats_t;
+ *
+ *   foo_stats_t stats[CONFIG_STAT_SHARDS];
+ *
+ *   _ODP_STAT_ADD(stats, packets, num);
+ *   packets = _ODP_STAT_SUM(stats, packets);
+ *
+ * When the shard size is known only at run time, the shard array is reserved with
+ * _odp_stat_shards_reserve(). Shards are then located with _odp_stat_shard() and counters
+ * summed with _odp_stat_sum(). Shards of these arrays must consist only of
+ * odp_atomic_u64_t counters.
+ */
+
+#ifndef ODP_STAT_SHARD_INTERNAL_H_
+#define ODP_STAT_SHARD_INTERNAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <odp/api/atomic.h>
+#include <odp/api/debug.h>
+#include <odp/api/shared_memory.h>
+
+#include <odp/api/plat/atomic_inlines.h>
+#include <odp/api/plat/thread_inlines.h>
+
+#include <odp_config_internal.h>
+#include <odp_macros_internal.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+ODP_STATIC_ASSERT(_ODP_CHECK_IS_POWER2(CONFIG_STAT_SHARDS), "STAT_SHARDS_NOT_POWER_OF_TWO");
+
+/* Shard index of the calling thread */
+static inline uint32_t _odp_stat_shard_idx(void)
+{
+	return (uint32_t)odp_thread_id() & (CONFIG_STAT_SHARDS - 1);
+}
+
+/* Calling thread's shard of shard array 'base' */
+static inline void *_odp_stat_shard(void *base, size_t shard_size)
+{
+	return (uint8_t *)base + _odp_stat_shard_idx() * shard_size;
+}
+
+/* Sum of a counter over all shards. 'shard_size' is the size of the shard struct. */
+static inline uint64_t _odp_stat_sum(odp_atomic_u64_t *ctr, size_t shard_size)
+{
+	uint64_t sum = 0;
+
+	for (uint32_t i = 0; i < CONFIG_STAT_SHARDS; i++)
+		sum += odp_atomic_load_u64((odp_atomic_u64_t *)(uintptr_t)
+					   ((uint8_t *)ctr + i * shard_size));
+
+	return sum;
+}
+
+/* Set a counter to 'val' in all shards */
+static inline void _odp_stat_init(odp_atomic_u64_t *ctr, size_t shard_size, uint64_t val)
+{
+	for (uint32_t i = 0; i < CONFIG_STAT_SHARDS; i++)
+		odp_atomic_init_u64((odp_atomic_u64_t *)(uintptr_t)((uint8_t *)ctr + i * shard_size),
+				    val);
+}
+
+/* Add 'val' to 'field' in the calling thread's shard of shard array 'shard' */
+#define _ODP_STAT_ADD(shard, field, val) \
+	odp_atomic_add_u64(&(shard)[_odp_stat_shard_idx()].field, (val))
+
+/* Increment 'field' in the calling thread's shard of shard array 'shard' */
+#define _ODP_STAT_INC(shard, field) \
+	odp_atomic_inc_u64(&(shard)[_odp_stat_shard_idx()].field)
+
+/* Sum of 'field' over all shards of shard array 'shard' */
+#define _ODP_STAT_SUM(shard, field) \
+	_odp_stat_sum(&(shard)[0].field, sizeof((shard)[0]))
+
+/* Initialize 'field' to zero in all shards of shard array 'shard' */
+#define _ODP_STAT_INIT(shard, field) \
+	_odp_stat_init(&(shard)[0].field, sizeof((shard)[0]), 0)
+
+/* Reserve a shard array of at least 'size' bytes per shard and initialize all counters to
+ * zero. Shard size is rounded up to a multiple of cache line size and stored into
+ * 'shard_size'. Returns pointer to the first shard, or NULL on failure. */
+void *_odp_stat_shards_reserve(const char *name, size_t size, size_t *shard_size,
+			       odp_shm_t *shm);
+
+/* Initialize all counters of a shard array to zero */
+void _odp_stat_shards_reset(void *base, size_t shard_size);
+
+/* Free a shard array */
+int _odp_stat_shards_free(odp_shm_t shm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -47,7 +47,8 @@ typedef struct ODP_ALIGNED_CACHE odp_timeout_hdr_t {
 
 } odp_timeout_hdr_t;
 
-ODP_STATIC_ASSERT(sizeof(odp_timeout_hdr_t) <= ODP_CACHE_LINE_SIZE,
+/* Scheduler statistics extend the common event header */
+ODP_STATIC_ASSERT(sizeof(odp_timeout_hdr_t) <= ODP_CACHE_LINE_SIZE * (1 + _ODP_SCHED_STATS),
 		  "TIMEOUT_HDR_SIZE_ERROR");
 
 /* A larger decrement value should be used after receiving events compared to
@@ -16,7 +16,10 @@ typedef uint64_t _odp_timer_wheel_t;
 
 #define _ODP_INT_TIMER_WHEEL_INVALID  0
 
+/* Time values passed to the timer wheel functions are in time source units.
+ * 'time_res' is the number of these units per second. */
 _odp_timer_wheel_t _odp_timer_wheel_create(uint32_t max_concurrent_timers,
+					   uint64_t time_res,
 					   void    *tm_system);
 
 void _odp_timer_wheel_start(_odp_timer_wheel_t timer_wheel,
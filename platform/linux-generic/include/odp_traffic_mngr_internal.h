@@ -23,6 +23,7 @@ extern "C" {
 #include <odp_name_table_internal.h>
 #include <odp_timer_wheel_internal.h>
 #include <odp_pkt_queue_internal.h>
+#include <odp_fq_codel_internal.h>
 #include <odp_sorted_list_internal.h>
 #include <odp_debug_internal.h>
 #include <odp_buffer_internal.h>
@@ -175,21 +176,22 @@ typedef struct {
 typedef struct {
 	/* The original commit rate and peak rate are in units of bits per
 	 * second.  These values are converted into the number of bytes per
-	 * clock cycle using a fixed point integer format with 26 bits of
+	 * time source tick using a fixed point integer format with 32 bits of
 	 * fractional part, before being stored into the following fields:
-	 * commit_rate and peak_rate.  So a raw uint64_t value of 2^33 stored
-	 * in either of these fields would represent 2^33 >> 26 = 128 bytes
-	 * per clock cycle.
-	 * Similarly the original commit_burst and peak_burst parameters -
-	 * which are in units of bits are converted to a byte count using a
-	 * fixed point integer format with 26 bits of fractional part, */
+	 * commit_rate and peak_rate.  So a raw uint64_t value of 2^39 stored
+	 * in either of these fields would represent 2^39 >> 32 = 128 bytes
+	 * per tick.
+	 * The original commit_burst and peak_burst parameters - which are in
+	 * units of bits are converted to a byte count using a fixed point
+	 * integer format with 26 bits of fractional part. Time deltas are in
+	 * time source ticks. */
 	uint64_t        commit_rate;
 	uint64_t        peak_rate;
 	int64_t         max_commit;
 	int64_t         max_peak;
 	uint64_t        max_commit_time_delta;
 	uint64_t        max_peak_time_delta;
-	uint32_t        min_time_delta;
+	uint64_t        min_time_delta;
 	_odp_int_name_t name_tbl_id;
 	odp_tm_shaper_t shaper_profile;
 	uint32_t        ref_cnt;   /* num of tm_queues, tm_nodes using this. */
@@ -218,10 +220,9 @@ struct tm_shaper_obj_s {
 	 * bytes in a 64-bit fixed point format where the decimal point is at
 	 * bit 26.  (aka int64_26).  In other words, the number of bytes that
 	 * commit_cnt represents is "commit_cnt / 2**26".  The commit_rate and
-	 * peak_rate are in units of bytes per nanoseccond, again using a 26-bit
-	 * fixed point integer.  Alternatively, ignoring the fixed point,
-	 * the number of bytes that x nanosecconds represents is equal to
-	 * "(rate * nanosecconds) / 2**26". */
+	 * peak_rate are in units of bytes per time source tick, using a 32-bit
+	 * fixed point integer.  So the number of token counter units that x
+	 * ticks represents is equal to "(rate * ticks) / 2**6". */
 	int64_t commit_cnt; /* Note token counters can go slightly negative */
 	int64_t peak_cnt; /* Note token counters can go slightly negative */
 
@@ -266,6 +267,10 @@ struct tm_queue_obj_s {
 	uint32_t pkts_dequeued_cnt;
 	uint32_t pkts_consumed_cnt;
 	_odp_int_pkt_queue_t _odp_int_pkt_queue;
+	/* Valid when the queue is in flow queuing mode. Packets waiting
+	 * behind the head pkt are then kept here instead of in the
+	 * _odp_int_pkt_queue. */
+	_odp_int_fq_codel_t fq_codel;
 	tm_wred_node_t tm_wred_node;
 	odp_packet_t pkt;
 	odp_packet_t sent_pkt;
@@ -401,7 +406,7 @@ struct tm_system_s {
 
 	tm_random_data_t tm_random_data;
 	odp_pktout_queue_t pktout;
-	uint64_t   current_time;
+	uint64_t   current_time; /* In time source ticks */
 	uint8_t    tm_idx;
 	uint8_t    first_enq;
 	odp_atomic_u32_t is_idle;
@@ -48,6 +48,7 @@ AS_VAR_APPEND([PLAT_DEP_LIBS], ["${ATOMIC_LIBS} ${AARCH64CRYPTO_LIBS} ${LIBCONFI
 AS_VAR_APPEND([PLAT_CFG_TEXT], ["
 	with_target:            ${with_target}
 	event_validation:       ${enable_event_validation}
+	sched_stats:            ${enable_sched_stats}
 	openssl:                ${with_openssl}
 	openssl_rand:           ${openssl_rand}
 	crypto:                 ${with_crypto}
@@ -80,6 +81,8 @@ AC_CONFIG_FILES([platform/linux-generic/Makefile
 		 platform/linux-generic/test/example/ping/Makefile
 		 platform/linux-generic/test/example/simple_pipeline/Makefile
 		 platform/linux-generic/test/example/switch/Makefile
+		 platform/linux-generic/test/validation/api/event_validation/Makefile
+		 platform/linux-generic/test/validation/api/pcapng/Makefile
 		 platform/linux-generic/test/validation/api/shmem/Makefile
 		 platform/linux-generic/test/validation/api/pktio/Makefile
 		 platform/linux-generic/test/validation/api/ml/Makefile
@@ -8,7 +8,7 @@
 AC_DEFUN([ODP_EVENT_VALIDATION], [dnl
 AC_ARG_ENABLE([event-validation],
 	      [AS_HELP_STRING([--enable-event-validation],
-			      [enable event validation (warn/abort)
+			      [enable event validation (warn/abort/runtime)
 			      [default=disabled] (linux-generic)])],
 	      [], [AS_IF([test "x$enable_debug" = "xfull"],
 	      		 [enable_event_validation=yes], [enable_event_validation=no])])
@@ -21,7 +21,8 @@ validation_level=0
 AS_IF([test "x$enable_event_validation" = "xwarn"], [validation_level=1])
 AS_IF([test "x$enable_event_validation" = "xyes" -o "x$enable_event_validation" = "xabort"],
       [validation_level=2])
+AS_IF([test "x$enable_event_validation" = "xruntime"], [validation_level=3])
 
 AC_DEFINE_UNQUOTED([_ODP_EVENT_VALIDATION], [$validation_level],
-		   [Define to 1 or 2 to enable event validation])
+		   [Define to 1, 2 or 3 to enable event validation])
 ]) # ODP_EVENT_VALIDATION
@@ -12,4 +12,14 @@ AC_ARG_ENABLE([scheduler-default],
 	      [], [enable_scheduler_default=basic])
 AC_DEFINE_UNQUOTED([_ODP_SCHEDULE_DEFAULT], ["$enable_scheduler_default"],
 		   [Define to name default scheduler])
+
+AC_ARG_ENABLE([sched-stats],
+	      [AS_HELP_STRING([--enable-sched-stats],
+			      [enable scheduler statistics and event wait time histograms
+			      [default=disabled] (linux-generic)])],
+	      [], [enable_sched_stats=no])
+sched_stats=0
+AS_IF([test "x$enable_sched_stats" = "xyes"], [sched_stats=1])
+AC_DEFINE_UNQUOTED([_ODP_SCHED_STATS], [$sched_stats],
+		   [Define to 1 to enable scheduler statistics])
 ]) # ODP_SCHEDULER
@@ -238,6 +238,7 @@ odp_cos_t odp_cls_cos_create(const char *name, const odp_cls_cos_param_t *param_
 	uint32_t tbl_index;
 	odp_cls_cos_param_t param = *param_in;
 	odp_bool_t event_aggr_enabled;
+	char stats_name[ODP_SHM_NAME_LEN];
 
 	if (param.action == ODP_COS_ACTION_DROP) {
 		param.num_queue = 1;
@@ -307,6 +308,19 @@ odp_cos_t odp_cls_cos_create(const char *name, const odp_cls_cos_param_t *param_
 
 			cos->num_queue = param.num_queue;
 
+			/* Statistics counters of the CoS and its queues */
+			snprintf(stats_name, sizeof(stats_name), "_odp_cos_stats_%u", i);
+			cos->stats = _odp_stat_shards_reserve(stats_name,
+							      sizeof(cos_stats_t) +
+							      param.num_queue *
+							      sizeof(cos->stats->queue[0]),
+							      &cos->stats_shard_size,
+							      &cos->stats_shm);
+			if (cos->stats == NULL) {
+				UNLOCK(&cos->lock);
+				return ODP_COS_INVALID;
+			}
+
 			if (param.num_queue > 1) {
 				cos->queue_param = param.queue_param;
 				cos->queue_group = true;
@@ -323,6 +337,7 @@ odp_cos_t odp_cls_cos_create(const char *name, const odp_cls_cos_param_t *param_
 					if (queue == ODP_QUEUE_INVALID) {
 						/* unwind the queues */
 						_cls_queue_unwind(tbl_index, j);
+						(void)_odp_stat_shards_free(cos->stats_shm);
 						UNLOCK(&cos->lock);
 						return ODP_COS_INVALID;
 					}
@@ -335,15 +350,6 @@ odp_cos_t odp_cls_cos_create(const char *name, const odp_cls_cos_param_t *param_
 				cos->queue = param.queue;
 			}
 
-			odp_atomic_init_u64(&cos->stats.discards, 0);
-			odp_atomic_init_u64(&cos->stats.packets, 0);
-
-			/* Initialize statistics counters */
-			for (j = 0; j < cos->num_queue; j++) {
-				odp_atomic_init_u64(&cos->queue_stats[j].discards, 0);
-				odp_atomic_init_u64(&cos->queue_stats[j].packets, 0);
-			}
-
 			cos->action = param.action;
 			cos->pool = param.pool;
 			cos->headroom = 0;
@@ -497,6 +503,10 @@ int odp_cos_destroy(odp_cos_t cos_id)
 		_cls_queue_unwind(cos->index * CLS_COS_QUEUE_MAX, cos->num_queue);
 
 	cos->valid = 0;
+
+	if (_odp_stat_shards_free(cos->stats_shm))
+		return -1;
+
 	return 0;
 }
 
@@ -1644,7 +1654,7 @@ static cos_t *match_pmr_cos(cos_t *cos, const uint8_t *pkt_addr, odp_packet_hdr_
 				pmr_debug_print(pmr, cos);
 
 				if (cos->stats_enable)
-					odp_atomic_inc_u64(&cos->stats.packets);
+					odp_atomic_inc_u64(&_odp_cos_stats(cos)->packets);
 
 				break;
 			}
@@ -1720,7 +1730,7 @@ static inline cos_t *cls_select_cos(pktio_entry_t *entry,
 
 done:
 	if (cos && cos->stats_enable)
-		odp_atomic_inc_u64(&cos->stats.packets);
+		odp_atomic_inc_u64(&_odp_cos_stats(cos)->packets);
 
 	return cos;
 }
@@ -1863,8 +1873,8 @@ int odp_cls_cos_stats(odp_cos_t hdl, odp_cls_cos_stats_t *stats)
 	}
 
 	memset(stats, 0, sizeof(*stats));
-	stats->discards = odp_atomic_load_u64(&cos->stats.discards);
-	stats->packets = odp_atomic_load_u64(&cos->stats.packets);
+	stats->discards = _odp_stat_sum(&cos->stats->discards, cos->stats_shard_size);
+	stats->packets = _odp_stat_sum(&cos->stats->packets, cos->stats_shard_size);
 
 	return 0;
 }
@@ -1892,8 +1902,10 @@ int odp_cls_queue_stats(odp_cos_t hdl, odp_queue_t queue,
 	}
 
 	memset(stats, 0, sizeof(odp_cls_queue_stats_t));
-	stats->discards = odp_atomic_load_u64(&cos->queue_stats[queue_idx].discards);
-	stats->packets = odp_atomic_load_u64(&cos->queue_stats[queue_idx].packets);
+	stats->discards = _odp_stat_sum(&cos->stats->queue[queue_idx].discards,
+					cos->stats_shard_size);
+	stats->packets = _odp_stat_sum(&cos->stats->queue[queue_idx].packets,
+				       cos->stats_shard_size);
 
 	return 0;
 }
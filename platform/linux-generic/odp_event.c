@@ -216,10 +216,10 @@ void odp_event_free_sp(const odp_event_t event[], int num)
 		return;
 
 	if (ODP_DEBUG) {
-		const odp_pool_t pool = _odp_event_pool(event[0]);
+		const odp_pool_t pool = odp_event_pool(event[0]);
 
 		for (int i = 1; i < num; i++)
-			_ODP_ASSERT(_odp_event_pool(event[i]) == pool);
+			_ODP_ASSERT(odp_event_pool(event[i]) == pool);
 	}
 
 	event_free_sp(event, num, odp_event_type(event[0]), _ODP_EV_EVENT_FREE_SP);
@@ -17,6 +17,7 @@ _odp_event_inline_offset ODP_ALIGNED_CACHE = {
 	.subtype    = offsetof(_odp_event_hdr_t, subtype),
 	.flow_id    = offsetof(_odp_event_hdr_t, flow_id),
 	.pool       = offsetof(_odp_event_hdr_t, pool),
+	.class_idx  = offsetof(_odp_event_hdr_t, class_idx),
 };
 
 #include <odp/visibility_end.h>
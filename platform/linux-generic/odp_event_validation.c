@@ -2,6 +2,8 @@
  * Copyright (c) 2023-2025 Nokia
  */
 
+#include <odp_posix_extensions.h>
+
 #include <odp/api/atomic.h>
 #include <odp/api/buffer.h>
 #include <odp/api/debug.h>
@@ -21,18 +23,28 @@
 #include <odp_string_internal.h>
 
 #include <inttypes.h>
+#include <signal.h>
+#include <stdint.h>
 #include <string.h>
 
-#define EVENT_VALIDATION_NONE  0
-#define EVENT_VALIDATION_WARN  1
-#define EVENT_VALIDATION_ABORT 2
-
 #define EVENT_DATA_PRINT_MAX_LEN 128
 
 typedef struct {
 	odp_atomic_u64_t err_count[_ODP_EV_MAX];
 	odp_shm_t shm;
 
+	/* Validation mode (warn/abort) when validation is on */
+	int mode;
+
+	/* Validate every Nth event */
+	uint32_t sample;
+
+	/* Signal that toggles validation on/off, or 0 */
+	int signal;
+
+	/* Signal action replaced by the toggle handler */
+	struct sigaction old_action;
+
 } event_validation_global_t;
 
 typedef struct {
@@ -43,6 +55,26 @@ static event_validation_global_t *_odp_ev_glb;
 
 #if _ODP_EVENT_VALIDATION
 
+/* Per thread sample counter */
+static __thread uint32_t sample_count;
+
+#if _ODP_EVENT_VALIDATION == _ODP_EV_VALIDATION_RUNTIME
+
+#include <odp/visibility_begin.h>
+
+int _odp_event_validation_on;
+
+#include <odp/visibility_end.h>
+
+static void toggle_signal_handler(int signum ODP_UNUSED)
+{
+	int on = __atomic_load_n(&_odp_event_validation_on, __ATOMIC_RELAXED);
+
+	__atomic_store_n(&_odp_event_validation_on, !on, __ATOMIC_RELAXED);
+}
+
+#endif
+
 /* Table for mapping function IDs to API function names */
 static const _odp_ev_info_t ev_info_tbl[] = {
 	[_ODP_EV_BUFFER_FREE]       = {.str = "odp_buffer_free()"},
@@ -129,7 +161,7 @@ static inline int validate_event_endmark(odp_event_t event, _odp_ev_id_t id, odp
 
 	print_event_data(event, type);
 
-	if (_ODP_EVENT_VALIDATION == EVENT_VALIDATION_ABORT)
+	if (_odp_ev_glb->mode == _ODP_EV_VALIDATION_ABORT)
 		_ODP_ABORT("Abort due to event %p endmark mismatch\n", event);
 
 	/* Fix endmark value */
@@ -138,13 +170,36 @@ static inline int validate_event_endmark(odp_event_t event, _odp_ev_id_t id, odp
 	return -1;
 }
 
+/* Returns non-zero when an event should be skipped due to sampling. Explicit validity checks
+ * are never skipped. */
+static inline int sample_skip(_odp_ev_id_t id)
+{
+	const uint32_t sample = _odp_ev_glb->sample;
+
+	if (odp_likely(sample == 1) || id == _ODP_EV_BUFFER_IS_VALID ||
+	    id == _ODP_EV_EVENT_IS_VALID || id == _ODP_EV_PACKET_IS_VALID)
+		return 0;
+
+	if (++sample_count < sample)
+		return 1;
+
+	sample_count = 0;
+	return 0;
+}
+
 static inline int buffer_validate(odp_buffer_t buf, _odp_ev_id_t id)
 {
+	if (sample_skip(id))
+		return 0;
+
 	return validate_event_endmark(odp_buffer_to_event(buf), id, ODP_EVENT_BUFFER);
 }
 
 static inline int packet_validate(odp_packet_t pkt, _odp_ev_id_t id)
 {
+	if (sample_skip(id))
+		return 0;
+
 	return validate_event_endmark(odp_packet_to_event(pkt), id, ODP_EVENT_PACKET);
 }
 
@@ -160,13 +215,13 @@ static inline int event_validate(odp_event_t event, int id)
 /* Enable usage from API inline files */
 #include <odp/visibility_begin.h>
 
-int _odp_buffer_validate(odp_buffer_t buf, _odp_ev_id_t id)
+int _odp_buffer_validate_fn(odp_buffer_t buf, _odp_ev_id_t id)
 {
 	return buffer_validate(buf, id);
 }
 
-int _odp_buffer_validate_multi(const odp_buffer_t buf[], int num,
-			       _odp_ev_id_t id)
+int _odp_buffer_validate_multi_fn(const odp_buffer_t buf[], int num,
+				  _odp_ev_id_t id)
 {
 	for (int i = 0; i < num; i++) {
 		if (odp_unlikely(buffer_validate(buf[i], id)))
@@ -175,13 +230,13 @@ int _odp_buffer_validate_multi(const odp_buffer_t buf[], int num,
 	return 0;
 }
 
-int _odp_packet_validate(odp_packet_t pkt, _odp_ev_id_t id)
+int _odp_packet_validate_fn(odp_packet_t pkt, _odp_ev_id_t id)
 {
 	return packet_validate(pkt, id);
 }
 
-int _odp_packet_validate_multi(const odp_packet_t pkt[], int num,
-			       _odp_ev_id_t id)
+int _odp_packet_validate_multi_fn(const odp_packet_t pkt[], int num,
+				  _odp_ev_id_t id)
 {
 	for (int i = 0; i < num; i++) {
 		if (odp_unlikely(packet_validate(pkt[i], id)))
@@ -190,13 +245,13 @@ int _odp_packet_validate_multi(const odp_packet_t pkt[], int num,
 	return 0;
 }
 
-int _odp_event_validate(odp_event_t event, _odp_ev_id_t id)
+int _odp_event_validate_fn(odp_event_t event, _odp_ev_id_t id)
 {
 	return event_validate(event, id);
 }
 
-int _odp_event_validate_multi(const odp_event_t event[], int num,
-			      _odp_ev_id_t id)
+int _odp_event_validate_multi_fn(const odp_event_t event[], int num,
+				 _odp_ev_id_t id)
 {
 	for (int i = 0; i < num; i++) {
 		if (odp_unlikely(event_validate(event[i], id)))
@@ -209,15 +264,78 @@ int _odp_event_validate_multi(const odp_event_t event[], int num,
 
 #endif /* _ODP_EVENT_VALIDATION */
 
+static const char *mode_str(int mode)
+{
+	return mode == _ODP_EV_VALIDATION_NONE ? "none" :
+	       mode == _ODP_EV_VALIDATION_WARN ? "warn" :
+	       mode == _ODP_EV_VALIDATION_ABORT ? "abort" : "runtime";
+}
+
+static int read_config_file(event_validation_global_t *glb)
+{
+	const char *conf_str;
+	int val = 0;
+
+	_ODP_PRINT("Event validation config:\n");
+
+	conf_str = "event_validation.mode";
+	if (!_odp_libconfig_lookup_int(conf_str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", conf_str);
+		return -1;
+	}
+
+	if (val < _ODP_EV_VALIDATION_NONE || val > _ODP_EV_VALIDATION_ABORT) {
+		_ODP_ERR("Bad value %s = %i\n", conf_str, val);
+		return -1;
+	}
+
+	/* Mode is selectable only in runtime builds */
+	if (_ODP_EVENT_VALIDATION == _ODP_EV_VALIDATION_RUNTIME)
+		glb->mode = val;
+
+	_ODP_PRINT("  %s: %i\n", conf_str, val);
+
+	conf_str = "event_validation.sample";
+	if (!_odp_libconfig_lookup_int(conf_str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", conf_str);
+		return -1;
+	}
+
+	if (val < 1) {
+		_ODP_ERR("Bad value %s = %i\n", conf_str, val);
+		return -1;
+	}
+
+	glb->sample = val;
+	_ODP_PRINT("  %s: %i\n", conf_str, val);
+
+	conf_str = "event_validation.signal";
+	if (!_odp_libconfig_lookup_int(conf_str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", conf_str);
+		return -1;
+	}
+
+	if (val < 0 || val >= NSIG) {
+		_ODP_ERR("Bad value %s = %i\n", conf_str, val);
+		return -1;
+	}
+
+	/* Signal control is available only in runtime builds */
+	if (_ODP_EVENT_VALIDATION == _ODP_EV_VALIDATION_RUNTIME)
+		glb->signal = val;
+
+	_ODP_PRINT("  %s: %i\n\n", conf_str, val);
+
+	return 0;
+}
+
 int _odp_event_validation_init_global(void)
 {
 	odp_shm_t shm;
 
-	_ODP_PRINT("\nEvent validation mode: %s\n\n",
-		   _ODP_EVENT_VALIDATION == EVENT_VALIDATION_NONE ? "none" :
-		   _ODP_EVENT_VALIDATION == EVENT_VALIDATION_WARN ? "warn" : "abort");
+	_ODP_PRINT("\nEvent validation mode: %s\n\n", mode_str(_ODP_EVENT_VALIDATION));
 
-	if (_ODP_EVENT_VALIDATION == EVENT_VALIDATION_NONE)
+	if (_ODP_EVENT_VALIDATION == _ODP_EV_VALIDATION_NONE)
 		return 0;
 
 	shm = odp_shm_reserve("_odp_event_validation_global",
@@ -232,10 +350,41 @@ int _odp_event_validation_init_global(void)
 
 	memset(_odp_ev_glb, 0, sizeof(event_validation_global_t));
 	_odp_ev_glb->shm = shm;
+	_odp_ev_glb->mode = _ODP_EVENT_VALIDATION;
 
 	for (int i = 0; i < _ODP_EV_MAX; i++)
 		odp_atomic_init_u64(&_odp_ev_glb->err_count[i], 0);
 
+	if (read_config_file(_odp_ev_glb)) {
+		odp_shm_free(shm);
+		_odp_ev_glb = NULL;
+		return -1;
+	}
+
+#if _ODP_EVENT_VALIDATION == _ODP_EV_VALIDATION_RUNTIME
+	_odp_event_validation_on = _odp_ev_glb->mode != _ODP_EV_VALIDATION_NONE;
+
+	/* Signal toggles validation on in warn mode, if it was off at startup */
+	if (_odp_ev_glb->mode == _ODP_EV_VALIDATION_NONE)
+		_odp_ev_glb->mode = _ODP_EV_VALIDATION_WARN;
+
+	if (_odp_ev_glb->signal) {
+		struct sigaction action;
+
+		memset(&action, 0, sizeof(action));
+		action.sa_handler = toggle_signal_handler;
+		sigemptyset(&action.sa_mask);
+		action.sa_flags = SA_RESTART;
+
+		if (sigaction(_odp_ev_glb->signal, &action, &_odp_ev_glb->old_action)) {
+			_ODP_ERR("Signal %i handler install failed\n", _odp_ev_glb->signal);
+			odp_shm_free(shm);
+			_odp_ev_glb = NULL;
+			return -1;
+		}
+	}
+#endif
+
 	return 0;
 }
 
@@ -243,12 +392,20 @@ int _odp_event_validation_term_global(void)
 {
 	int ret;
 
-	if (_ODP_EVENT_VALIDATION == EVENT_VALIDATION_NONE)
+	if (_ODP_EVENT_VALIDATION == _ODP_EV_VALIDATION_NONE)
 		return 0;
 
 	if (_odp_ev_glb == NULL)
 		return 0;
 
+#if _ODP_EVENT_VALIDATION == _ODP_EV_VALIDATION_RUNTIME
+	if (_odp_ev_glb->signal &&
+	    sigaction(_odp_ev_glb->signal, &_odp_ev_glb->old_action, NULL))
+		_ODP_ERR("Signal %i handler restore failed\n", _odp_ev_glb->signal);
+
+	_odp_event_validation_on = 0;
+#endif
+
 	ret = odp_shm_free(_odp_ev_glb->shm);
 	if (ret) {
 		_ODP_ERR("SHM free failed: %d\n", ret);
@@ -0,0 +1,562 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/* Flow queuing with CoDel active queue management, following RFC 8289
+ * (CoDel) and RFC 8290 (FQ-CoDel). Packets are hashed into sub-flows, which
+ * are served in deficit round robin order. New (sparse) flows get priority
+ * over old (backlogged) flows. CoDel drop decisions are done at dequeue time
+ * based on the sojourn time of the packet in its sub-flow.
+ *
+ * Backlogged sub-flows are kept in a binary max-heap ordered by backlog, so
+ * that the fattest flow is found in constant time when the queue overflows.
+ * Heap maintenance costs O(log N) per enqueue and dequeue, where N is the
+ * number of backlogged flows.
+ *
+ * The flow queue is accessed only by the TM service thread and thus needs no
+ * synchronization.
+ */
+
+#include <odp/api/packet.h>
+
+#include <odp_debug_internal.h>
+#include <odp_fq_codel_internal.h>
+#include <odp_macros_internal.h>
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NULL_IDX UINT32_MAX
+
+/* The sub-flow list a flow is currently linked into */
+#define FLOW_LIST_NONE 0
+#define FLOW_LIST_NEW  1
+#define FLOW_LIST_OLD  2
+
+typedef struct {
+	odp_packet_t pkt;
+	uint64_t     enq_time;
+	uint32_t     next;
+	uint32_t     len;
+} fq_slot_t;
+
+typedef struct {
+	uint32_t head;
+	uint32_t tail;
+	uint32_t next_flow;
+	uint32_t backlog;
+	uint32_t heap_pos;
+	int32_t  deficit;
+
+	/* CoDel state */
+	uint32_t count;
+	uint32_t lastcount;
+	uint64_t first_above_time;
+	uint64_t drop_next;
+	uint8_t  dropping;
+	uint8_t  list;
+} fq_flow_t;
+
+typedef struct {
+	uint32_t head;
+	uint32_t tail;
+} fq_flow_list_t;
+
+typedef struct {
+	fq_flow_list_t new_flows;
+	fq_flow_list_t old_flows;
+	uint32_t num_flows;
+	uint32_t max_pkts;
+	uint32_t num_pkts;
+	uint32_t quantum;
+	uint32_t max_pkt_len;
+	uint32_t free_slot;
+	uint32_t heap_size;
+	uint64_t target;
+	uint64_t interval;
+	uint64_t total_enqueues;
+	uint64_t total_dequeues;
+	uint64_t codel_drops;
+	uint64_t overlimit_drops;
+	fq_flow_t *flows;
+	fq_slot_t *slots;
+	/* Backlogged flow indexes in max-heap order */
+	uint32_t *heap;
+} fq_codel_t;
+
+static inline fq_codel_t *fq_codel_get(_odp_int_fq_codel_t fq_codel)
+{
+	return (fq_codel_t *)(uintptr_t)fq_codel;
+}
+
+static void flow_list_push(fq_codel_t *fq, fq_flow_list_t *list,
+			   uint32_t flow_idx, uint8_t list_id)
+{
+	fq_flow_t *flow = &fq->flows[flow_idx];
+
+	flow->next_flow = NULL_IDX;
+	flow->list = list_id;
+
+	if (list->tail == NULL_IDX)
+		list->head = flow_idx;
+	else
+		fq->flows[list->tail].next_flow = flow_idx;
+
+	list->tail = flow_idx;
+}
+
+static uint32_t flow_list_pop(fq_codel_t *fq, fq_flow_list_t *list)
+{
+	uint32_t flow_idx = list->head;
+	fq_flow_t *flow = &fq->flows[flow_idx];
+
+	list->head = flow->next_flow;
+	if (list->head == NULL_IDX)
+		list->tail = NULL_IDX;
+
+	flow->next_flow = NULL_IDX;
+	flow->list = FLOW_LIST_NONE;
+	return flow_idx;
+}
+
+static inline uint32_t slot_alloc(fq_codel_t *fq)
+{
+	uint32_t idx = fq->free_slot;
+
+	fq->free_slot = fq->slots[idx].next;
+	return idx;
+}
+
+static inline void slot_free(fq_codel_t *fq, uint32_t idx)
+{
+	fq->slots[idx].pkt = ODP_PACKET_INVALID;
+	fq->slots[idx].next = fq->free_slot;
+	fq->free_slot = idx;
+}
+
+static inline void heap_swap(fq_codel_t *fq, uint32_t a, uint32_t b)
+{
+	uint32_t flow_a = fq->heap[a];
+	uint32_t flow_b = fq->heap[b];
+
+	fq->heap[a] = flow_b;
+	fq->heap[b] = flow_a;
+	fq->flows[flow_b].heap_pos = a;
+	fq->flows[flow_a].heap_pos = b;
+}
+
+static inline uint32_t heap_backlog(fq_codel_t *fq, uint32_t pos)
+{
+	return fq->flows[fq->heap[pos]].backlog;
+}
+
+static void heap_sift_up(fq_codel_t *fq, uint32_t pos)
+{
+	while (pos) {
+		uint32_t parent = (pos - 1) / 2;
+
+		if (heap_backlog(fq, parent) >= heap_backlog(fq, pos))
+			break;
+
+		heap_swap(fq, parent, pos);
+		pos = parent;
+	}
+}
+
+static void heap_sift_down(fq_codel_t *fq, uint32_t pos)
+{
+	while (1) {
+		uint32_t largest = 2 * pos + 1;
+
+		if (largest >= fq->heap_size)
+			break;
+
+		if (largest + 1 < fq->heap_size &&
+		    heap_backlog(fq, largest + 1) > heap_backlog(fq, largest))
+			largest++;
+
+		if (heap_backlog(fq, largest) <= heap_backlog(fq, pos))
+			break;
+
+		heap_swap(fq, largest, pos);
+		pos = largest;
+	}
+}
+
+static void heap_insert(fq_codel_t *fq, uint32_t flow_idx)
+{
+	uint32_t pos = fq->heap_size++;
+
+	fq->heap[pos] = flow_idx;
+	fq->flows[flow_idx].heap_pos = pos;
+	heap_sift_up(fq, pos);
+}
+
+static void heap_remove(fq_codel_t *fq, fq_flow_t *flow)
+{
+	uint32_t pos = flow->heap_pos;
+	uint32_t last = --fq->heap_size;
+
+	flow->heap_pos = NULL_IDX;
+
+	if (pos == last)
+		return;
+
+	fq->heap[pos] = fq->heap[last];
+	fq->flows[fq->heap[pos]].heap_pos = pos;
+	heap_sift_down(fq, pos);
+	heap_sift_up(fq, pos);
+}
+
+/* Remove the head packet of a flow. The flow must not be empty. */
+static fq_slot_t *flow_pkt_remove(fq_codel_t *fq, fq_flow_t *flow,
+				  uint32_t *slot_idx)
+{
+	uint32_t idx = flow->head;
+	fq_slot_t *slot = &fq->slots[idx];
+
+	flow->head = slot->next;
+	if (flow->head == NULL_IDX)
+		flow->tail = NULL_IDX;
+
+	flow->backlog -= slot->len;
+
+	if (flow->head == NULL_IDX)
+		heap_remove(fq, flow);
+	else
+		heap_sift_down(fq, flow->heap_pos);
+
+	fq->num_pkts--;
+	*slot_idx = idx;
+	return slot;
+}
+
+/* Integer square root */
+static uint32_t isqrt(uint32_t val)
+{
+	uint32_t res = 0;
+	uint32_t bit = UINT32_C(1) << 30;
+
+	while (bit > val)
+		bit >>= 2;
+
+	while (bit) {
+		if (val >= res + bit) {
+			val -= res + bit;
+			res = (res >> 1) + bit;
+		} else {
+			res >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return res;
+}
+
+static inline uint64_t control_law(fq_codel_t *fq, uint64_t t, uint32_t count)
+{
+	return t + fq->interval / isqrt(count);
+}
+
+/* CoDel dodequeue(): returns the head packet slot of the flow (or NULL) and
+ * whether it is OK to drop it based on the sojourn time. */
+static fq_slot_t *codel_dodequeue(fq_codel_t *fq, fq_flow_t *flow, uint64_t now,
+				  uint32_t *slot_idx, int *ok_to_drop)
+{
+	fq_slot_t *slot;
+	uint64_t sojourn;
+
+	*ok_to_drop = 0;
+
+	if (flow->head == NULL_IDX) {
+		flow->first_above_time = 0;
+		return NULL;
+	}
+
+	slot = flow_pkt_remove(fq, flow, slot_idx);
+	sojourn = now > slot->enq_time ? now - slot->enq_time : 0;
+
+	if (sojourn < fq->target || flow->backlog <= fq->max_pkt_len) {
+		flow->first_above_time = 0;
+	} else if (flow->first_above_time == 0) {
+		flow->first_above_time = now + fq->interval;
+	} else if (now >= flow->first_above_time) {
+		*ok_to_drop = 1;
+	}
+
+	return slot;
+}
+
+static inline void codel_drop(fq_codel_t *fq, fq_slot_t *slot, uint32_t slot_idx,
+			      odp_packet_t drop_pkts[], uint32_t *num_drops)
+{
+	drop_pkts[(*num_drops)++] = slot->pkt;
+	slot_free(fq, slot_idx);
+	fq->codel_drops++;
+}
+
+/* CoDel dequeue for a single sub-flow */
+static fq_slot_t *codel_dequeue(fq_codel_t *fq, fq_flow_t *flow, uint64_t now,
+				uint32_t *slot_idx, odp_packet_t drop_pkts[],
+				uint32_t *num_drops)
+{
+	fq_slot_t *slot;
+	uint32_t delta;
+	int ok_to_drop;
+
+	slot = codel_dodequeue(fq, flow, now, slot_idx, &ok_to_drop);
+
+	if (flow->dropping) {
+		if (!ok_to_drop) {
+			flow->dropping = 0;
+		} else {
+			while (slot && flow->dropping && now >= flow->drop_next &&
+			       *num_drops < _ODP_INT_FQ_CODEL_MAX_DROPS) {
+				codel_drop(fq, slot, *slot_idx, drop_pkts, num_drops);
+				flow->count++;
+				slot = codel_dodequeue(fq, flow, now, slot_idx, &ok_to_drop);
+				if (!ok_to_drop)
+					flow->dropping = 0;
+				else
+					flow->drop_next = control_law(fq, flow->drop_next,
+								      flow->count);
+			}
+		}
+	} else if (slot && ok_to_drop && *num_drops < _ODP_INT_FQ_CODEL_MAX_DROPS) {
+		codel_drop(fq, slot, *slot_idx, drop_pkts, num_drops);
+		slot = codel_dodequeue(fq, flow, now, slot_idx, &ok_to_drop);
+		flow->dropping = 1;
+
+		/* Start from the previous drop rate, if dropping state was
+		 * exited only recently. */
+		delta = flow->count - flow->lastcount;
+		if (delta > 1 && (int64_t)(now - flow->drop_next) < (int64_t)(16 * fq->interval))
+			flow->count = delta;
+		else
+			flow->count = 1;
+
+		flow->drop_next = control_law(fq, now, flow->count);
+		flow->lastcount = flow->count;
+	}
+
+	return slot;
+}
+
+_odp_int_fq_codel_t _odp_fq_codel_create(uint32_t num_flows,
+					 uint32_t max_pkts,
+					 uint32_t quantum,
+					 uint64_t target,
+					 uint64_t interval)
+{
+	fq_codel_t *fq;
+	uint32_t i;
+
+	if (num_flows == 0 || num_flows > _ODP_INT_FQ_CODEL_MAX_FLOWS ||
+	    max_pkts == 0 || max_pkts > _ODP_INT_FQ_CODEL_MAX_PKTS ||
+	    quantum == 0 || interval == 0) {
+		_ODP_ERR("Bad FQ-CoDel parameters\n");
+		return _ODP_INT_FQ_CODEL_INVALID;
+	}
+
+	fq = malloc(sizeof(fq_codel_t));
+	if (!fq)
+		return _ODP_INT_FQ_CODEL_INVALID;
+
+	memset(fq, 0, sizeof(fq_codel_t));
+	fq->flows = malloc(num_flows * sizeof(fq_flow_t));
+	fq->slots = malloc(max_pkts * sizeof(fq_slot_t));
+	fq->heap = malloc(num_flows * sizeof(uint32_t));
+	if (!fq->flows || !fq->slots || !fq->heap) {
+		free(fq->flows);
+		free(fq->slots);
+		free(fq->heap);
+		free(fq);
+		return _ODP_INT_FQ_CODEL_INVALID;
+	}
+
+	memset(fq->flows, 0, num_flows * sizeof(fq_flow_t));
+	for (i = 0; i < num_flows; i++) {
+		fq->flows[i].head = NULL_IDX;
+		fq->flows[i].tail = NULL_IDX;
+		fq->flows[i].next_flow = NULL_IDX;
+		fq->flows[i].heap_pos = NULL_IDX;
+	}
+
+	for (i = 0; i < max_pkts; i++) {
+		fq->slots[i].pkt = ODP_PACKET_INVALID;
+		fq->slots[i].next = (i + 1 < max_pkts) ? i + 1 : NULL_IDX;
+	}
+
+	fq->new_flows.head = NULL_IDX;
+	fq->new_flows.tail = NULL_IDX;
+	fq->old_flows.head = NULL_IDX;
+	fq->old_flows.tail = NULL_IDX;
+	fq->num_flows = num_flows;
+	fq->max_pkts = max_pkts;
+	fq->quantum = quantum;
+	fq->target = target;
+	fq->interval = interval;
+	fq->free_slot = 0;
+
+	return (_odp_int_fq_codel_t)(uintptr_t)fq;
+}
+
+/* Drop the head packet of the sub-flow with the largest backlog */
+static odp_packet_t fq_drop_from_fattest(fq_codel_t *fq)
+{
+	fq_flow_t *flow;
+	fq_slot_t *slot;
+	uint32_t slot_idx;
+	odp_packet_t pkt;
+
+	/* Heap root is the flow with the largest backlog */
+	flow = &fq->flows[fq->heap[0]];
+	slot = flow_pkt_remove(fq, flow, &slot_idx);
+	pkt = slot->pkt;
+	slot_free(fq, slot_idx);
+	fq->overlimit_drops++;
+
+	return pkt;
+}
+
+int _odp_fq_codel_enqueue(_odp_int_fq_codel_t fq_codel, odp_packet_t pkt,
+			  uint32_t flow_hash, uint64_t now,
+			  odp_packet_t *drop_pkt)
+{
+	fq_codel_t *fq = fq_codel_get(fq_codel);
+	uint32_t flow_idx, slot_idx;
+	fq_flow_t *flow;
+	fq_slot_t *slot;
+	int dropped = 0;
+
+	if (odp_unlikely(pkt == ODP_PACKET_INVALID))
+		return -1;
+
+	if (fq->num_pkts == fq->max_pkts) {
+		*drop_pkt = fq_drop_from_fattest(fq);
+		dropped = 1;
+	}
+
+	flow_idx = flow_hash % fq->num_flows;
+	flow = &fq->flows[flow_idx];
+
+	slot_idx = slot_alloc(fq);
+	slot = &fq->slots[slot_idx];
+	slot->pkt = pkt;
+	slot->enq_time = now;
+	slot->len = odp_packet_len(pkt);
+	slot->next = NULL_IDX;
+
+	if (flow->tail == NULL_IDX)
+		flow->head = slot_idx;
+	else
+		fq->slots[flow->tail].next = slot_idx;
+
+	flow->tail = slot_idx;
+	flow->backlog += slot->len;
+
+	if (flow->heap_pos == NULL_IDX)
+		heap_insert(fq, flow_idx);
+	else
+		heap_sift_up(fq, flow->heap_pos);
+
+	fq->num_pkts++;
+	fq->total_enqueues++;
+
+	if (slot->len > fq->max_pkt_len)
+		fq->max_pkt_len = slot->len;
+
+	if (flow->list == FLOW_LIST_NONE) {
+		flow->deficit = fq->quantum;
+		flow_list_push(fq, &fq->new_flows, flow_idx, FLOW_LIST_NEW);
+	}
+
+	return dropped;
+}
+
+int _odp_fq_codel_dequeue(_odp_int_fq_codel_t fq_codel, uint64_t now,
+			  odp_packet_t *pkt, odp_packet_t drop_pkts[],
+			  uint32_t *num_drops)
+{
+	fq_codel_t *fq = fq_codel_get(fq_codel);
+	fq_flow_list_t *list;
+	fq_flow_t *flow;
+	fq_slot_t *slot;
+	uint32_t flow_idx, slot_idx;
+
+	*num_drops = 0;
+
+	while (1) {
+		if (fq->new_flows.head != NULL_IDX)
+			list = &fq->new_flows;
+		else if (fq->old_flows.head != NULL_IDX)
+			list = &fq->old_flows;
+		else
+			return 0;
+
+		flow_idx = list->head;
+		flow = &fq->flows[flow_idx];
+
+		if (flow->deficit <= 0) {
+			flow->deficit += fq->quantum;
+			flow_list_pop(fq, list);
+			flow_list_push(fq, &fq->old_flows, flow_idx, FLOW_LIST_OLD);
+			continue;
+		}
+
+		slot = codel_dequeue(fq, flow, now, &slot_idx, drop_pkts, num_drops);
+
+		if (slot == NULL) {
+			/* Flow is empty. A new flow is moved to the end of old
+			 * flows to prevent it from regaining the priority of a
+			 * new flow immediately. */
+			flow_list_pop(fq, list);
+			if (list == &fq->new_flows && fq->old_flows.head != NULL_IDX)
+				flow_list_push(fq, &fq->old_flows, flow_idx, FLOW_LIST_OLD);
+			continue;
+		}
+
+		flow->deficit -= slot->len;
+		*pkt = slot->pkt;
+		slot_free(fq, slot_idx);
+		fq->total_dequeues++;
+		return 1;
+	}
+}
+
+uint32_t _odp_fq_codel_count(_odp_int_fq_codel_t fq_codel)
+{
+	return fq_codel_get(fq_codel)->num_pkts;
+}
+
+void _odp_fq_codel_stats_print(_odp_int_fq_codel_t fq_codel)
+{
+	fq_codel_t *fq = fq_codel_get(fq_codel);
+
+	_ODP_PRINT("  fq_codel_stats - fq_codel=0x%" PRIX64 "\n", fq_codel);
+	_ODP_PRINT("    num_flows=%" PRIu32 " max_pkts=%" PRIu32 " quantum=%" PRIu32
+		   " queued pkts=%" PRIu32 "\n", fq->num_flows, fq->max_pkts,
+		   fq->quantum, fq->num_pkts);
+	_ODP_PRINT("    total enqueues=%" PRIu64 " total dequeues=%" PRIu64
+		   " codel drops=%" PRIu64 " overlimit drops=%" PRIu64 "\n",
+		   fq->total_enqueues, fq->total_dequeues, fq->codel_drops,
+		   fq->overlimit_drops);
+}
+
+void _odp_fq_codel_destroy(_odp_int_fq_codel_t fq_codel)
+{
+	fq_codel_t *fq = fq_codel_get(fq_codel);
+	uint32_t i;
+
+	for (i = 0; i < fq->max_pkts; i++) {
+		if (fq->slots[i].pkt != ODP_PACKET_INVALID)
+			odp_packet_free(fq->slots[i].pkt);
+	}
+
+	free(fq->flows);
+	free(fq->slots);
+	free(fq->heap);
+	free(fq);
+}
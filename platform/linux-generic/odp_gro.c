@@ -0,0 +1,408 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#include <odp/api/align.h>
+#include <odp/api/byteorder.h>
+#include <odp/api/hints.h>
+#include <odp/api/packet.h>
+
+#include <odp/api/plat/byteorder_inlines.h>
+#include <odp/api/plat/packet_inlines.h>
+
+#include <odp_chksum_internal.h>
+#include <odp_gro_internal.h>
+#include <odp_packet_internal.h>
+#include <protocols/ip.h>
+#include <protocols/tcp.h>
+
+#include <stdint.h>
+#include <string.h>
+
+/* Maximum number of flows coalesced concurrently within a receive burst */
+#define GRO_MAX_FLOWS 8
+
+/* Maximum IP datagram length */
+#define GRO_MAX_IP_LEN 0xffff
+
+/* Offset of source and destination addresses in IP headers */
+#define IPV4_ADDR_OFFSET ODP_OFFSETOF(_odp_ipv4hdr_t, src_addr)
+#define IPV6_ADDR_OFFSET ODP_OFFSETOF(_odp_ipv6hdr_t, src_addr)
+
+/* TCP flags byte offset and flag values. Only ACK and PSH are allowed in
+ * coalesced segments. */
+#define TCP_FLAGS_OFFSET 13
+#define TCP_FLAG_PSH     0x08
+#define TCP_FLAG_ACK     0x10
+
+/* Segment classification */
+#define SEG_OTHER    0 /* Not TCP */
+#define SEG_UNKNOWN  1 /* TCP, but headers could not be inspected */
+#define SEG_TCP      2 /* TCP, but not eligible for coalescing */
+#define SEG_MERGE    3 /* TCP, eligible for coalescing */
+
+/* Parsed TCP segment */
+typedef struct {
+	uint8_t *data;
+	uint32_t l3_offset;
+	uint32_t l4_offset;
+	/* TCP header length */
+	uint32_t hdr_len;
+	/* TCP header and payload length */
+	uint32_t l4_len;
+	uint32_t seq;
+	uint8_t ipv6;
+	uint8_t psh;
+} gro_seg_t;
+
+/* Flow being coalesced */
+typedef struct {
+	/* First segment, which collects payload of the other segments */
+	odp_packet_t pkt;
+	/* Index of the first segment in the packet table */
+	int idx;
+	uint32_t l3_offset;
+	uint32_t l4_offset;
+	uint32_t hdr_len;
+	uint32_t l4_len;
+	uint32_t next_seq;
+	/* Payload length of the first segment */
+	uint32_t mss;
+	uint32_t num_segs;
+	/* Partial checksum of IP addresses */
+	uint64_t addr_sum;
+	/* Partial checksum of all payload bytes */
+	uint64_t payload_sum;
+	odp_u16be_t window;
+	uint8_t ipv6;
+	uint8_t psh;
+} gro_flow_t;
+
+static inline _odp_tcphdr_t *seg_tcp(const gro_seg_t *seg)
+{
+	return (_odp_tcphdr_t *)(uintptr_t)(seg->data + seg->l4_offset);
+}
+
+static int seg_parse(odp_packet_t pkt, gro_seg_t *seg)
+{
+	odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt);
+	const _odp_tcphdr_t *tcp;
+	uint32_t ip_len, ip_hdr_len;
+	uint8_t flags;
+
+	if (!pkt_hdr->p.input_flags.tcp)
+		return SEG_OTHER;
+
+	seg->data = odp_packet_data(pkt);
+	seg->l3_offset = pkt_hdr->p.l3_offset;
+	seg->l4_offset = pkt_hdr->p.l4_offset;
+	seg->ipv6 = pkt_hdr->p.input_flags.ipv6;
+
+	if (odp_unlikely(seg->l4_offset + _ODP_TCPHDR_LEN > pkt_hdr->seg_len))
+		return SEG_UNKNOWN;
+
+	tcp = seg_tcp(seg);
+	seg->hdr_len = tcp->hl * 4;
+
+	if (odp_unlikely(seg->hdr_len < _ODP_TCPHDR_LEN ||
+			 seg->l4_offset + seg->hdr_len > pkt_hdr->seg_len))
+		return SEG_UNKNOWN;
+
+	if (pkt_hdr->p.input_flags.ipfrag || pkt_hdr->p.input_flags.ipopt ||
+	    pkt_hdr->p.flags.all.error)
+		return SEG_TCP;
+
+	ip_hdr_len = seg->l4_offset - seg->l3_offset;
+
+	if (seg->ipv6) {
+		const _odp_ipv6hdr_t *ip = (const void *)(seg->data + seg->l3_offset);
+
+		ip_len = _ODP_IPV6HDR_LEN + odp_be_to_cpu_16(ip->payload_len);
+		if (ip_hdr_len != _ODP_IPV6HDR_LEN)
+			return SEG_TCP;
+	} else {
+		const _odp_ipv4hdr_t *ip = (const void *)(seg->data + seg->l3_offset);
+
+		ip_len = odp_be_to_cpu_16(ip->tot_len);
+		if (ip_hdr_len != _ODP_IPV4HDR_IHL(ip->ver_ihl) * 4)
+			return SEG_TCP;
+	}
+
+	/* Frames with link layer padding are not coalesced */
+	if (seg->l3_offset + ip_len != pkt_hdr->frame_len)
+		return SEG_TCP;
+
+	/* Payload must start in the first segment */
+	if (seg->l4_offset + seg->hdr_len >= pkt_hdr->seg_len)
+		return SEG_TCP;
+
+	seg->l4_len = ip_len - ip_hdr_len;
+	if (seg->l4_len <= seg->hdr_len)
+		return SEG_TCP;
+
+	flags = ((const uint8_t *)tcp)[TCP_FLAGS_OFFSET];
+	if ((flags & ~TCP_FLAG_PSH) != TCP_FLAG_ACK)
+		return SEG_TCP;
+
+	seg->psh = !!(flags & TCP_FLAG_PSH);
+	seg->seq = odp_be_to_cpu_32(tcp->seq_no);
+
+	return SEG_MERGE;
+}
+
+static inline uint64_t addr_sum(const gro_seg_t *seg)
+{
+	if (seg->ipv6)
+		return chksum_partial(seg->data + seg->l3_offset + IPV6_ADDR_OFFSET,
+				      2 * _ODP_IPV6ADDR_LEN, 0);
+
+	return chksum_partial(seg->data + seg->l3_offset + IPV4_ADDR_OFFSET,
+			      2 * _ODP_IPV4ADDR_LEN, 0);
+}
+
+/* Pseudo header sum without IP addresses */
+static inline uint64_t pseudo_sum(uint32_t l4_len)
+{
+	uint64_t sum = odp_cpu_to_be_16(l4_len);
+
+#if ODP_BYTE_ORDER == ODP_BIG_ENDIAN
+	sum += _ODP_IPPROTO_TCP;
+#else
+	sum += _ODP_IPPROTO_TCP << 8;
+#endif
+	return sum;
+}
+
+/* Sum of segment payload bytes, derived from the TCP checksum of the segment */
+static inline uint16_t payload_sum(const gro_flow_t *flow, const gro_seg_t *seg)
+{
+	uint64_t sum = flow->addr_sum + pseudo_sum(seg->l4_len) +
+		       chksum_partial(seg_tcp(seg), seg->hdr_len, 0);
+
+	return ~chksum_finalize(sum);
+}
+
+static inline int same_flow(const gro_flow_t *flow, const gro_seg_t *seg)
+{
+	const uint8_t *data = odp_packet_data(flow->pkt);
+	uint32_t addr_offset, addr_len;
+
+	if (flow->ipv6 != seg->ipv6)
+		return 0;
+
+	if (seg->ipv6) {
+		addr_offset = IPV6_ADDR_OFFSET;
+		addr_len = 2 * _ODP_IPV6ADDR_LEN;
+	} else {
+		addr_offset = IPV4_ADDR_OFFSET;
+		addr_len = 2 * _ODP_IPV4ADDR_LEN;
+	}
+
+	/* IP addresses and TCP ports */
+	return !memcmp(data + flow->l3_offset + addr_offset,
+		       seg->data + seg->l3_offset + addr_offset, addr_len) &&
+	       !memcmp(data + flow->l4_offset, seg->data + seg->l4_offset, 4);
+}
+
+static inline int can_merge(const gro_flow_t *flow, const gro_seg_t *seg, uint32_t max_segs)
+{
+	const uint8_t *data = odp_packet_data(flow->pkt);
+	const _odp_tcphdr_t *tcp = (const void *)(data + flow->l4_offset);
+	const _odp_tcphdr_t *seg_th = seg_tcp(seg);
+	uint32_t payload_len = seg->l4_len - seg->hdr_len;
+
+	if (seg->seq != flow->next_seq || payload_len > flow->mss ||
+	    flow->num_segs >= max_segs ||
+	    flow->l4_offset + flow->l4_len + payload_len - flow->l3_offset > GRO_MAX_IP_LEN)
+		return 0;
+
+	if (seg->l3_offset != flow->l3_offset || seg->l4_offset != flow->l4_offset ||
+	    seg->hdr_len != flow->hdr_len)
+		return 0;
+
+	/* Link layer headers */
+	if (memcmp(data, seg->data, flow->l3_offset))
+		return 0;
+
+	if (seg->ipv6) {
+		const _odp_ipv6hdr_t *ip = (const void *)(data + flow->l3_offset);
+		const _odp_ipv6hdr_t *seg_ip = (const void *)(seg->data + seg->l3_offset);
+
+		if (ip->ver_tc_flow != seg_ip->ver_tc_flow || ip->hop_limit != seg_ip->hop_limit)
+			return 0;
+	} else {
+		const _odp_ipv4hdr_t *ip = (const void *)(data + flow->l3_offset);
+		const _odp_ipv4hdr_t *seg_ip = (const void *)(seg->data + seg->l3_offset);
+
+		if (ip->tos != seg_ip->tos || ip->ttl != seg_ip->ttl)
+			return 0;
+	}
+
+	/* Acknowledgment number and TCP options */
+	return tcp->ack_no == seg_th->ack_no &&
+	       !memcmp((const uint8_t *)tcp + _ODP_TCPHDR_LEN,
+		       (const uint8_t *)seg_th + _ODP_TCPHDR_LEN,
+		       seg->hdr_len - _ODP_TCPHDR_LEN);
+}
+
+static inline void flow_open(gro_flow_t *flow, odp_packet_t pkt, int idx, const gro_seg_t *seg)
+{
+	flow->pkt = pkt;
+	flow->idx = idx;
+	flow->l3_offset = seg->l3_offset;
+	flow->l4_offset = seg->l4_offset;
+	flow->hdr_len = seg->hdr_len;
+	flow->l4_len = seg->l4_len;
+	flow->mss = seg->l4_len - seg->hdr_len;
+	flow->next_seq = seg->seq + flow->mss;
+	flow->num_segs = 1;
+	flow->ipv6 = seg->ipv6;
+	flow->psh = seg->psh;
+	flow->window = seg_tcp(seg)->window;
+	flow->addr_sum = addr_sum(seg);
+	flow->payload_sum = payload_sum(flow, seg);
+}
+
+static inline uint16_t swap16(uint16_t val)
+{
+	return (uint16_t)(val << 8 | val >> 8);
+}
+
+static inline int flow_merge(gro_flow_t *flow, odp_packet_t pkt, const gro_seg_t *seg)
+{
+	uint32_t payload_len = seg->l4_len - seg->hdr_len;
+	uint32_t payload_offset = seg->l4_offset + seg->hdr_len;
+	uint16_t sum = payload_sum(flow, seg);
+	odp_u16be_t window = seg_tcp(seg)->window;
+	odp_packet_t head = flow->pkt;
+
+	odp_packet_pull_head(pkt, payload_offset);
+
+	if (odp_unlikely(odp_packet_concat(&head, pkt) < 0)) {
+		odp_packet_push_head(pkt, payload_offset);
+		return -1;
+	}
+
+	/* Payload at an odd offset is summed in swapped byte order */
+	if ((flow->l4_len - flow->hdr_len) & 1)
+		sum = swap16(sum);
+
+	flow->pkt = head;
+	flow->l4_len += payload_len;
+	flow->next_seq += payload_len;
+	flow->num_segs++;
+	flow->payload_sum += sum;
+	flow->psh |= seg->psh;
+	flow->window = window;
+
+	return 0;
+}
+
+/* Update IP and TCP headers of a coalesced packet */
+static void flow_close(gro_flow_t *flow, odp_packet_t pkt[])
+{
+	odp_packet_t head = flow->pkt;
+	odp_packet_hdr_t *pkt_hdr = packet_hdr(head);
+	uint8_t *data = odp_packet_data(head);
+	_odp_tcphdr_t *tcp = (_odp_tcphdr_t *)(uintptr_t)(data + flow->l4_offset);
+	uint64_t sum;
+
+	pkt[flow->idx] = head;
+
+	if (flow->num_segs == 1)
+		return;
+
+	if (flow->ipv6) {
+		_odp_ipv6hdr_t *ip = (_odp_ipv6hdr_t *)(uintptr_t)(data + flow->l3_offset);
+
+		ip->payload_len = odp_cpu_to_be_16(flow->l4_len);
+	} else {
+		_odp_ipv4hdr_t *ip = (_odp_ipv4hdr_t *)(uintptr_t)(data + flow->l3_offset);
+		uint32_t ip_hdr_len = flow->l4_offset - flow->l3_offset;
+
+		ip->tot_len = odp_cpu_to_be_16(ip_hdr_len + flow->l4_len);
+		ip->chksum = 0;
+		ip->chksum = ~chksum_finalize(chksum_partial(ip, ip_hdr_len, 0));
+	}
+
+	if (flow->psh)
+		((uint8_t *)tcp)[TCP_FLAGS_OFFSET] |= TCP_FLAG_PSH;
+
+	tcp->window = flow->window;
+	tcp->cksm = 0;
+	sum = flow->addr_sum + pseudo_sum(flow->l4_len) + flow->payload_sum +
+	      chksum_partial(tcp, flow->hdr_len, 0);
+	tcp->cksm = ~chksum_finalize(sum);
+
+	/* Payload offset and segment size for resegmentation at packet output */
+	pkt_hdr->p.flags.payload_off = 1;
+	pkt_hdr->payload_offset = flow->l4_offset + flow->hdr_len;
+	pkt_hdr->lso_max_payload = flow->mss;
+}
+
+int _odp_gro_pktin(odp_packet_t pkt[], int num, uint32_t max_segs)
+{
+	gro_flow_t flow_tbl[GRO_MAX_FLOWS];
+	gro_seg_t seg = {0};
+	int num_flows = 0;
+	int next_evict = 0;
+	int i, f, type;
+	int out = 0;
+
+	for (i = 0; i < num; i++) {
+		type = seg_parse(pkt[i], &seg);
+
+		if (type == SEG_OTHER) {
+			pkt[out++] = pkt[i];
+			continue;
+		}
+
+		if (odp_unlikely(type == SEG_UNKNOWN)) {
+			/* Flow unknown, stop coalescing to maintain packet order */
+			for (f = 0; f < num_flows; f++)
+				flow_close(&flow_tbl[f], pkt);
+			num_flows = 0;
+			pkt[out++] = pkt[i];
+			continue;
+		}
+
+		for (f = 0; f < num_flows; f++)
+			if (same_flow(&flow_tbl[f], &seg))
+				break;
+
+		if (f < num_flows && type == SEG_MERGE &&
+		    can_merge(&flow_tbl[f], &seg, max_segs) &&
+		    flow_merge(&flow_tbl[f], pkt[i], &seg) == 0) {
+			/* Short segment or PSH ends the coalesced packet */
+			if (seg.psh || seg.l4_len - seg.hdr_len < flow_tbl[f].mss) {
+				flow_close(&flow_tbl[f], pkt);
+				flow_tbl[f] = flow_tbl[--num_flows];
+			}
+			continue;
+		}
+
+		if (f < num_flows) {
+			flow_close(&flow_tbl[f], pkt);
+			flow_tbl[f] = flow_tbl[--num_flows];
+		}
+
+		if (type == SEG_MERGE && !seg.psh) {
+			if (num_flows == GRO_MAX_FLOWS) {
+				f = next_evict;
+				next_evict = (next_evict + 1) % GRO_MAX_FLOWS;
+				flow_close(&flow_tbl[f], pkt);
+			} else {
+				f = num_flows++;
+			}
+
+			flow_open(&flow_tbl[f], pkt[i], out, &seg);
+		}
+
+		pkt[out++] = pkt[i];
+	}
+
+	for (f = 0; f < num_flows; f++)
+		flow_close(&flow_tbl[f], pkt);
+
+	return out;
+}
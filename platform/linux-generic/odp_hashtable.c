@@ -0,0 +1,725 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#include <odp/api/align.h>
+#include <odp/api/atomic.h>
+#include <odp/api/cpu.h>
+#include <odp/api/hash.h>
+#include <odp/api/hashtable.h>
+#include <odp/api/shared_memory.h>
+#include <odp/api/std_types.h>
+#include <odp/api/sync.h>
+#include <odp/api/ticketlock.h>
+
+#include <odp/api/plat/atomic_inlines.h>
+#include <odp/api/plat/cpu_inlines.h>
+#include <odp/api/plat/hash_inlines.h>
+#include <odp/api/plat/strong_types.h>
+#include <odp/api/plat/sync_inlines.h>
+
+#include <odp_config_internal.h>
+#include <odp_debug_internal.h>
+#include <odp_global_data.h>
+#include <odp_init_internal.h>
+#include <odp_macros_internal.h>
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Bucketized cuckoo hash table. Each key has two candidate buckets. A bucket
+ * stores hash signatures and entry indexes of up to BUCKET_SIZE keys. Keys and
+ * values are stored in a separate entry array.
+ *
+ * Writers are serialized with a lock. Readers do not take locks, but read
+ * the table inside a sequence counter protected section. Writers increment
+ * the counter when moving or removing entries, or when modifying values of
+ * existing entries. Readers retry when the counter changed during the read.
+ */
+
+#define BUCKET_SIZE      8
+#define MAX_NUM          (16 * 1024 * 1024)
+#define MAX_KEY_SIZE     256
+#define MAX_VALUE_SIZE   1024
+#define MAX_GET_MULTI    64
+
+/* Maximum number of buckets visited when searching for a cuckoo path */
+#define MAX_PATH_NODES   256
+
+typedef struct ODP_ALIGNED_CACHE {
+	uint32_t sig[BUCKET_SIZE];
+
+	/* Entry index + 1, or zero when the slot is free */
+	odp_atomic_u32_t idx[BUCKET_SIZE];
+
+} bucket_t;
+
+ODP_STATIC_ASSERT(sizeof(bucket_t) == 64, "BUCKET_T_SIZE_ERROR");
+
+typedef struct ODP_ALIGNED_CACHE hashtable_t {
+	/* Sequence counter for lock-free readers. Odd value indicates that
+	 * a writer is modifying the table. */
+	odp_atomic_u32_t seq;
+
+	uint32_t bucket_mask;
+	uint32_t key_size;
+	uint32_t value_size;
+	uint32_t value_offset;
+	uint32_t entry_size;
+	uint32_t seed;
+	bucket_t *bucket;
+	uint8_t  *entry;
+
+	/* Writer lock and data */
+	odp_ticketlock_t ODP_ALIGNED_CACHE lock;
+	uint32_t num;
+	uint32_t count;
+	uint32_t num_free;
+	uint32_t *free_idx;
+	uint32_t num_buckets;
+	int      index;
+	odp_shm_t shm;
+	char     name[ODP_HASHTABLE_NAME_LEN];
+
+} hashtable_t;
+
+typedef struct {
+	uint32_t bkt;
+	int32_t  prev;
+	uint32_t slot;
+
+} path_node_t;
+
+typedef struct hashtable_global_t {
+	odp_ticketlock_t lock;
+	odp_shm_t        shm;
+	hashtable_t      *table[CONFIG_MAX_HASHTABLES];
+
+} hashtable_global_t;
+
+static hashtable_global_t *hashtable_global;
+
+static inline hashtable_t *hashtable_entry(odp_hashtable_t ht)
+{
+	return (hashtable_t *)(uintptr_t)ht;
+}
+
+static inline odp_hashtable_t hashtable_handle(hashtable_t *ht)
+{
+	return (odp_hashtable_t)(uintptr_t)ht;
+}
+
+int _odp_hashtable_init_global(void)
+{
+	odp_shm_t shm;
+
+	shm = odp_shm_reserve("_odp_hashtable_global", sizeof(hashtable_global_t),
+			      ODP_CACHE_LINE_SIZE, 0);
+
+	hashtable_global = odp_shm_addr(shm);
+
+	if (hashtable_global == NULL) {
+		_ODP_ERR("SHM reserve of hash table global data failed\n");
+		return -1;
+	}
+
+	memset(hashtable_global, 0, sizeof(hashtable_global_t));
+	hashtable_global->shm = shm;
+	odp_ticketlock_init(&hashtable_global->lock);
+
+	return 0;
+}
+
+int _odp_hashtable_term_global(void)
+{
+	if (hashtable_global == NULL)
+		return 0;
+
+	for (int i = 0; i < CONFIG_MAX_HASHTABLES; i++) {
+		if (hashtable_global->table[i])
+			_ODP_ERR("Hash table not destroyed: %s\n",
+				 hashtable_global->table[i]->name);
+	}
+
+	if (odp_shm_free(hashtable_global->shm)) {
+		_ODP_ERR("SHM free failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+int odp_hashtable_capability(odp_hashtable_capability_t *capa)
+{
+	memset(capa, 0, sizeof(odp_hashtable_capability_t));
+
+	capa->max_tables     = CONFIG_MAX_HASHTABLES;
+	capa->max_num        = MAX_NUM;
+	capa->max_key_size   = MAX_KEY_SIZE;
+	capa->max_value_size = MAX_VALUE_SIZE;
+	capa->max_get_multi  = MAX_GET_MULTI;
+
+	return 0;
+}
+
+void odp_hashtable_param_init(odp_hashtable_param_t *param)
+{
+	memset(param, 0, sizeof(odp_hashtable_param_t));
+}
+
+static int reserve_index(hashtable_t *ht)
+{
+	int index = -1;
+
+	odp_ticketlock_lock(&hashtable_global->lock);
+
+	for (int i = 0; i < CONFIG_MAX_HASHTABLES; i++) {
+		if (hashtable_global->table[i] == NULL) {
+			index = i;
+			hashtable_global->table[i] = ht;
+			break;
+		}
+	}
+
+	odp_ticketlock_unlock(&hashtable_global->lock);
+
+	return index;
+}
+
+static void free_index(int i)
+{
+	odp_ticketlock_lock(&hashtable_global->lock);
+	hashtable_global->table[i] = NULL;
+	odp_ticketlock_unlock(&hashtable_global->lock);
+}
+
+odp_hashtable_t odp_hashtable_create(const char *name, const odp_hashtable_param_t *param)
+{
+	hashtable_t *ht;
+	odp_shm_t shm;
+	uint64_t bucket_offset, entry_offset, free_offset, shm_size;
+	uint32_t num_buckets, entry_size, value_offset;
+	uint32_t shm_flags = 0;
+
+	if (name && strlen(name) >= ODP_HASHTABLE_NAME_LEN) {
+		_ODP_ERR("Too long name: %s\n", name);
+		return ODP_HASHTABLE_INVALID;
+	}
+
+	if (param->num == 0 || param->num > MAX_NUM) {
+		_ODP_ERR("Bad number of entries: %" PRIu32 "\n", param->num);
+		return ODP_HASHTABLE_INVALID;
+	}
+
+	if (param->key_size == 0 || param->key_size > MAX_KEY_SIZE) {
+		_ODP_ERR("Bad key size: %" PRIu32 "\n", param->key_size);
+		return ODP_HASHTABLE_INVALID;
+	}
+
+	if (param->value_size > MAX_VALUE_SIZE) {
+		_ODP_ERR("Bad value size: %" PRIu32 "\n", param->value_size);
+		return ODP_HASHTABLE_INVALID;
+	}
+
+	/* Reserve bucket slots for 25% more entries than requested to keep the
+	 * load factor at a level where cuckoo insertions rarely fail. */
+	num_buckets = (param->num + (param->num / 4) + BUCKET_SIZE - 1) / BUCKET_SIZE;
+	num_buckets = _ODP_ROUNDUP_POWER2_U32(_ODP_MAX(num_buckets, 2u));
+
+	value_offset = _ODP_ROUNDUP_ALIGN(param->key_size, sizeof(uint64_t));
+	entry_size = _ODP_ROUNDUP_ALIGN(value_offset + param->value_size, sizeof(uint64_t));
+
+	bucket_offset = _ODP_ROUNDUP_CACHE_LINE(sizeof(hashtable_t));
+	entry_offset = bucket_offset + (uint64_t)num_buckets * sizeof(bucket_t);
+	free_offset = _ODP_ROUNDUP_CACHE_LINE(entry_offset + (uint64_t)param->num * entry_size);
+	shm_size = free_offset + (uint64_t)param->num * sizeof(uint32_t);
+
+	if (odp_global_ro.shm_single_va)
+		shm_flags |= ODP_SHM_SINGLE_VA;
+
+	shm = odp_shm_reserve("_odp_hashtable", shm_size, ODP_CACHE_LINE_SIZE, shm_flags);
+	if (shm == ODP_SHM_INVALID) {
+		_ODP_ERR("SHM reserve failed\n");
+		return ODP_HASHTABLE_INVALID;
+	}
+
+	ht = odp_shm_addr(shm);
+	memset(ht, 0, sizeof(hashtable_t));
+
+	if (name)
+		strcpy(ht->name, name);
+
+	odp_atomic_init_u32(&ht->seq, 0);
+	odp_ticketlock_init(&ht->lock);
+	ht->shm          = shm;
+	ht->num          = param->num;
+	ht->num_buckets  = num_buckets;
+	ht->bucket_mask  = num_buckets - 1;
+	ht->key_size     = param->key_size;
+	ht->value_size   = param->value_size;
+	ht->value_offset = value_offset;
+	ht->entry_size   = entry_size;
+	ht->seed         = param->seed;
+	ht->bucket       = (bucket_t *)(uintptr_t)((uint8_t *)ht + bucket_offset);
+	ht->entry        = (uint8_t *)ht + entry_offset;
+	ht->free_idx     = (uint32_t *)(uintptr_t)((uint8_t *)ht + free_offset);
+
+	memset(ht->bucket, 0, (uint64_t)num_buckets * sizeof(bucket_t));
+
+	for (uint32_t i = 0; i < param->num; i++)
+		ht->free_idx[i] = param->num - 1 - i;
+
+	ht->num_free = param->num;
+
+	ht->index = reserve_index(ht);
+	if (ht->index < 0) {
+		_ODP_ERR("Maximum number of hash tables created\n");
+		odp_shm_free(shm);
+		return ODP_HASHTABLE_INVALID;
+	}
+
+	return hashtable_handle(ht);
+}
+
+int odp_hashtable_destroy(odp_hashtable_t hashtable)
+{
+	hashtable_t *ht = hashtable_entry(hashtable);
+
+	if (hashtable == ODP_HASHTABLE_INVALID) {
+		_ODP_ERR("Bad hash table handle\n");
+		return -1;
+	}
+
+	free_index(ht->index);
+
+	if (odp_shm_free(ht->shm)) {
+		_ODP_ERR("SHM free failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+odp_hashtable_t odp_hashtable_lookup(const char *name)
+{
+	hashtable_t *ht;
+
+	if (name == NULL)
+		return ODP_HASHTABLE_INVALID;
+
+	odp_ticketlock_lock(&hashtable_global->lock);
+
+	for (int i = 0; i < CONFIG_MAX_HASHTABLES; i++) {
+		ht = hashtable_global->table[i];
+
+		if (ht && strcmp(ht->name, name) == 0) {
+			odp_ticketlock_unlock(&hashtable_global->lock);
+			return hashtable_handle(ht);
+		}
+	}
+
+	odp_ticketlock_unlock(&hashtable_global->lock);
+
+	return ODP_HASHTABLE_INVALID;
+}
+
+uint64_t odp_hashtable_to_u64(odp_hashtable_t ht)
+{
+	return _odp_pri(ht);
+}
+
+static inline uint32_t key_hash(hashtable_t *ht, const void *key)
+{
+	return odp_hash_crc32c(key, ht->key_size, ht->seed);
+}
+
+static inline uint32_t prim_bucket(hashtable_t *ht, uint32_t sig)
+{
+	return sig & ht->bucket_mask;
+}
+
+/* Alternative bucket of a key in bucket 'bkt'. The function is its own inverse
+ * and the result always differs from 'bkt'. */
+static inline uint32_t alt_bucket(hashtable_t *ht, uint32_t bkt, uint32_t sig)
+{
+	uint32_t tag = ((sig >> 16) * 0x5bd1e995) | 1;
+
+	return (bkt ^ tag) & ht->bucket_mask;
+}
+
+static inline uint8_t *entry_key(hashtable_t *ht, uint32_t idx)
+{
+	return &ht->entry[(uint64_t)idx * ht->entry_size];
+}
+
+static inline uint8_t *entry_value(hashtable_t *ht, uint32_t idx)
+{
+	return entry_key(ht, idx) + ht->value_offset;
+}
+
+static inline uint32_t read_begin(hashtable_t *ht)
+{
+	uint32_t seq;
+
+	while (odp_unlikely((seq = odp_atomic_load_acq_u32(&ht->seq)) & 1))
+		odp_cpu_pause();
+
+	return seq;
+}
+
+static inline int read_retry(hashtable_t *ht, uint32_t seq)
+{
+	odp_mb_acquire();
+
+	return odp_atomic_load_u32(&ht->seq) != seq;
+}
+
+static inline void write_begin(hashtable_t *ht)
+{
+	odp_atomic_store_u32(&ht->seq, odp_atomic_load_u32(&ht->seq) + 1);
+	odp_mb_release();
+}
+
+static inline void write_end(hashtable_t *ht)
+{
+	odp_atomic_store_rel_u32(&ht->seq, odp_atomic_load_u32(&ht->seq) + 1);
+}
+
+/* Returns entry index + 1 of a matching key in the bucket, or 0 */
+static inline uint32_t bucket_search(hashtable_t *ht, bucket_t *bucket, uint32_t sig,
+				     const void *key)
+{
+	uint32_t idx;
+
+	for (int i = 0; i < BUCKET_SIZE; i++) {
+		if (bucket->sig[i] != sig)
+			continue;
+
+		idx = odp_atomic_load_acq_u32(&bucket->idx[i]);
+
+		if (idx && memcmp(entry_key(ht, idx - 1), key, ht->key_size) == 0)
+			return idx;
+	}
+
+	return 0;
+}
+
+static inline int key_search(hashtable_t *ht, const void *key, uint32_t sig, uint32_t *bkt_out,
+			     int *slot_out)
+{
+	uint32_t bkt[2];
+	bucket_t *bucket;
+	uint32_t idx;
+
+	bkt[0] = prim_bucket(ht, sig);
+	bkt[1] = alt_bucket(ht, bkt[0], sig);
+
+	for (int b = 0; b < 2; b++) {
+		bucket = &ht->bucket[bkt[b]];
+
+		for (int i = 0; i < BUCKET_SIZE; i++) {
+			idx = odp_atomic_load_u32(&bucket->idx[i]);
+
+			if (idx && bucket->sig[i] == sig &&
+			    memcmp(entry_key(ht, idx - 1), key, ht->key_size) == 0) {
+				*bkt_out = bkt[b];
+				*slot_out = i;
+				return idx;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static inline int free_slot(bucket_t *bucket)
+{
+	for (int i = 0; i < BUCKET_SIZE; i++)
+		if (odp_atomic_load_u32(&bucket->idx[i]) == 0)
+			return i;
+
+	return -1;
+}
+
+/* Check if bucket 'bkt' is already on the path from node 'cur' to a root node */
+static inline int on_path(const path_node_t node[], int cur, uint32_t bkt)
+{
+	for (; cur >= 0; cur = node[cur].prev)
+		if (node[cur].bkt == bkt)
+			return 1;
+
+	return 0;
+}
+
+static inline void slot_set(bucket_t *bucket, int slot, uint32_t sig, uint32_t idx)
+{
+	bucket->sig[slot] = sig;
+	odp_atomic_store_rel_u32(&bucket->idx[slot], idx);
+}
+
+/* Make room for a new key by moving existing keys into their alternative
+ * buckets. Breadth first search finds the shortest path of moves. Returns the
+ * freed slot of the first (prim or alt) bucket, or -1 when no path found. */
+static int cuckoo_move(hashtable_t *ht, uint32_t bkt0, uint32_t bkt1, uint32_t *bkt_out)
+{
+	path_node_t node[MAX_PATH_NODES];
+	bucket_t *bucket, *dst;
+	int head = 0, tail = 0;
+	int slot, cur;
+
+	node[tail++] = (path_node_t){ .bkt = bkt0, .prev = -1, .slot = 0 };
+	node[tail++] = (path_node_t){ .bkt = bkt1, .prev = -1, .slot = 0 };
+
+	while (head < tail) {
+		bucket = &ht->bucket[node[head].bkt];
+		slot = free_slot(bucket);
+
+		if (slot >= 0)
+			break;
+
+		for (int i = 0; i < BUCKET_SIZE && tail < MAX_PATH_NODES; i++) {
+			uint32_t alt = alt_bucket(ht, node[head].bkt, bucket->sig[i]);
+
+			/* A bucket is visited only once per path, so that each
+			 * entry is moved at most once */
+			if (on_path(node, head, alt))
+				continue;
+
+			node[tail].bkt = alt;
+			node[tail].prev = head;
+			node[tail].slot = i;
+			tail++;
+		}
+
+		head++;
+	}
+
+	if (head == tail)
+		return -1;
+
+	/* Move entries along the path starting from the free slot */
+	cur = head;
+
+	write_begin(ht);
+
+	while (node[cur].prev >= 0) {
+		path_node_t *prev = &node[node[cur].prev];
+
+		bucket = &ht->bucket[prev->bkt];
+		dst = &ht->bucket[node[cur].bkt];
+
+		slot_set(dst, slot, bucket->sig[node[cur].slot],
+			 odp_atomic_load_u32(&bucket->idx[node[cur].slot]));
+		odp_atomic_store_u32(&bucket->idx[node[cur].slot], 0);
+
+		slot = node[cur].slot;
+		cur = node[cur].prev;
+	}
+
+	write_end(ht);
+
+	*bkt_out = node[cur].bkt;
+
+	return slot;
+}
+
+int odp_hashtable_put(odp_hashtable_t hashtable, const void *key, const void *value)
+{
+	hashtable_t *ht = hashtable_entry(hashtable);
+	uint32_t sig, bkt, idx;
+	uint32_t bkt0, bkt1;
+	int slot;
+
+	sig = key_hash(ht, key);
+
+	odp_ticketlock_lock(&ht->lock);
+
+	idx = key_search(ht, key, sig, &bkt, &slot);
+
+	if (idx) {
+		/* Replace the value of an existing entry */
+		if (ht->value_size) {
+			write_begin(ht);
+			memcpy(entry_value(ht, idx - 1), value, ht->value_size);
+			write_end(ht);
+		}
+
+		odp_ticketlock_unlock(&ht->lock);
+		return 0;
+	}
+
+	if (ht->num_free == 0) {
+		odp_ticketlock_unlock(&ht->lock);
+		return -1;
+	}
+
+	bkt0 = prim_bucket(ht, sig);
+	bkt1 = alt_bucket(ht, bkt0, sig);
+
+	bkt = bkt0;
+	slot = free_slot(&ht->bucket[bkt0]);
+
+	if (slot < 0) {
+		bkt = bkt1;
+		slot = free_slot(&ht->bucket[bkt1]);
+	}
+
+	if (slot < 0)
+		slot = cuckoo_move(ht, bkt0, bkt1, &bkt);
+
+	if (slot < 0) {
+		odp_ticketlock_unlock(&ht->lock);
+		return -1;
+	}
+
+	/* The entry is not visible to readers before its index is stored into
+	 * the bucket. Entries are reused only after a remove operation, which
+	 * invalidates concurrent reads. */
+	idx = ht->free_idx[--ht->num_free];
+	memcpy(entry_key(ht, idx), key, ht->key_size);
+	if (ht->value_size)
+		memcpy(entry_value(ht, idx), value, ht->value_size);
+
+	slot_set(&ht->bucket[bkt], slot, sig, idx + 1);
+	ht->count++;
+
+	odp_ticketlock_unlock(&ht->lock);
+
+	return 0;
+}
+
+int odp_hashtable_get(odp_hashtable_t hashtable, const void *key, void *value)
+{
+	hashtable_t *ht = hashtable_entry(hashtable);
+	uint32_t sig, bkt0, bkt1, idx, seq;
+
+	sig = key_hash(ht, key);
+	bkt0 = prim_bucket(ht, sig);
+	bkt1 = alt_bucket(ht, bkt0, sig);
+
+	do {
+		seq = read_begin(ht);
+
+		idx = bucket_search(ht, &ht->bucket[bkt0], sig, key);
+		if (idx == 0)
+			idx = bucket_search(ht, &ht->bucket[bkt1], sig, key);
+
+		if (idx && value && ht->value_size)
+			memcpy(value, entry_value(ht, idx - 1), ht->value_size);
+
+	} while (odp_unlikely(read_retry(ht, seq)));
+
+	return idx ? 1 : 0;
+}
+
+int odp_hashtable_get_multi(odp_hashtable_t hashtable, const void *const key[],
+			    void *const value[], uint8_t found[], int num)
+{
+	hashtable_t *ht = hashtable_entry(hashtable);
+	uint32_t sig[MAX_GET_MULTI], bkt0[MAX_GET_MULTI], bkt1[MAX_GET_MULTI];
+	uint32_t idx, seq;
+	int num_found;
+
+	if (odp_unlikely(num > MAX_GET_MULTI)) {
+		_ODP_ERR("Too many keys: %i\n", num);
+		return -1;
+	}
+
+	/* Calculate hashes and prefetch both candidate buckets of all keys
+	 * before searching */
+	for (int i = 0; i < num; i++) {
+		sig[i] = key_hash(ht, key[i]);
+		bkt0[i] = prim_bucket(ht, sig[i]);
+		bkt1[i] = alt_bucket(ht, bkt0[i], sig[i]);
+		odp_prefetch(&ht->bucket[bkt0[i]]);
+		odp_prefetch(&ht->bucket[bkt1[i]]);
+	}
+
+	do {
+		seq = read_begin(ht);
+		num_found = 0;
+
+		for (int i = 0; i < num; i++) {
+			idx = bucket_search(ht, &ht->bucket[bkt0[i]], sig[i], key[i]);
+			if (idx == 0)
+				idx = bucket_search(ht, &ht->bucket[bkt1[i]], sig[i], key[i]);
+
+			found[i] = idx ? 1 : 0;
+
+			if (idx == 0)
+				continue;
+
+			num_found++;
+
+			if (value && ht->value_size)
+				memcpy(value[i], entry_value(ht, idx - 1), ht->value_size);
+		}
+
+	} while (odp_unlikely(read_retry(ht, seq)));
+
+	return num_found;
+}
+
+int odp_hashtable_remove(odp_hashtable_t hashtable, const void *key)
+{
+	hashtable_t *ht = hashtable_entry(hashtable);
+	uint32_t sig, bkt, idx;
+	int slot;
+
+	sig = key_hash(ht, key);
+
+	odp_ticketlock_lock(&ht->lock);
+
+	idx = key_search(ht, key, sig, &bkt, &slot);
+
+	if (idx == 0) {
+		odp_ticketlock_unlock(&ht->lock);
+		return -1;
+	}
+
+	/* Concurrent readers may still access the entry. The sequence counter
+	 * update forces them to retry before the entry is reused. */
+	write_begin(ht);
+	odp_atomic_store_u32(&ht->bucket[bkt].idx[slot], 0);
+	write_end(ht);
+
+	ht->free_idx[ht->num_free++] = idx - 1;
+	ht->count--;
+
+	odp_ticketlock_unlock(&ht->lock);
+
+	return 0;
+}
+
+uint32_t odp_hashtable_count(odp_hashtable_t hashtable)
+{
+	hashtable_t *ht = hashtable_entry(hashtable);
+
+	return ht->count;
+}
+
+void odp_hashtable_print(odp_hashtable_t hashtable)
+{
+	hashtable_t *ht = hashtable_entry(hashtable);
+
+	if (hashtable == ODP_HASHTABLE_INVALID) {
+		_ODP_ERR("Bad hash table handle\n");
+		return;
+	}
+
+	_ODP_PRINT("\nHash table info\n");
+	_ODP_PRINT("---------------\n");
+	_ODP_PRINT("  handle          0x%" PRIx64 "\n", odp_hashtable_to_u64(hashtable));
+	_ODP_PRINT("  name            %s\n", ht->name);
+	_ODP_PRINT("  index           %i\n", ht->index);
+	_ODP_PRINT("  num             %u\n", ht->num);
+	_ODP_PRINT("  count           %u\n", ht->count);
+	_ODP_PRINT("  key size        %u\n", ht->key_size);
+	_ODP_PRINT("  value size      %u\n", ht->value_size);
+	_ODP_PRINT("  buckets         %u\n", ht->num_buckets);
+	_ODP_PRINT("  bucket slots    %u\n", ht->num_buckets * BUCKET_SIZE);
+	_ODP_PRINT("  seq             %u\n", odp_atomic_load_u32(&ht->seq));
+	_ODP_PRINT("\n");
+}
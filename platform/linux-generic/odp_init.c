@@ -51,6 +51,10 @@ enum init_stage {
 	IPSEC_INIT,
 	DMA_INIT,
 	ML_INIT,
+	HASHTABLE_INIT,
+	LPM_INIT,
+	QSBR_INIT,
+	PROTO_STATS_INIT,
 	ALL_INIT      /* All init stages completed */
 };
 
@@ -146,6 +150,34 @@ static int term_global(enum init_stage stage)
 
 	switch (stage) {
 	case ALL_INIT:
+	case PROTO_STATS_INIT:
+		if (_odp_proto_stats_term_global()) {
+			_ODP_ERR("ODP proto stats term failed.\n");
+			rc = -1;
+		}
+		/* Fall through */
+
+	case QSBR_INIT:
+		if (_odp_qsbr_term_global()) {
+			_ODP_ERR("ODP QSBR term failed.\n");
+			rc = -1;
+		}
+		/* Fall through */
+
+	case LPM_INIT:
+		if (_odp_lpm_term_global()) {
+			_ODP_ERR("ODP LPM term failed.\n");
+			rc = -1;
+		}
+		/* Fall through */
+
+	case HASHTABLE_INIT:
+		if (_odp_hashtable_term_global()) {
+			_ODP_ERR("ODP hash table term failed.\n");
+			rc = -1;
+		}
+		/* Fall through */
+
 	case ML_INIT:
 		if (_odp_ml_term_global()) {
 			_ODP_ERR("ODP ML term failed.\n");
@@ -536,6 +568,30 @@ int odp_init_global(odp_instance_t *instance,
 	}
 	stage = ML_INIT;
 
+	if (_odp_hashtable_init_global()) {
+		_ODP_ERR("ODP hash table init failed.\n");
+		goto init_failed;
+	}
+	stage = HASHTABLE_INIT;
+
+	if (_odp_lpm_init_global()) {
+		_ODP_ERR("ODP LPM init failed.\n");
+		goto init_failed;
+	}
+	stage = LPM_INIT;
+
+	if (_odp_qsbr_init_global()) {
+		_ODP_ERR("ODP QSBR init failed.\n");
+		goto init_failed;
+	}
+	stage = QSBR_INIT;
+
+	if (_odp_proto_stats_init_global()) {
+		_ODP_ERR("ODP proto stats init failed.\n");
+		goto init_failed;
+	}
+	stage = PROTO_STATS_INIT;
+
 	*instance = (odp_instance_t)odp_global_ro.main_pid;
 
 	return 0;
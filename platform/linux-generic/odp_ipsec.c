@@ -681,18 +681,26 @@ static int ipsec_in_esp(odp_packet_t *pkt,
 	ipsec_offset = state->ip_offset + state->ip_hdr_len;
 
 	if (_ODP_IPPROTO_UDP == state->ip_next_hdr) {
-		_odp_udphdr_t udp;
+		/* Read UDP and ESP headers with a single copy */
+		struct {
+			_odp_udphdr_t udp;
+			_odp_esphdr_t esp;
+		} hdr;
 		uint16_t ip_data_len = state->ip_tot_len -
 				       state->ip_hdr_len;
 
-		if (odp_unlikely(odp_packet_copy_to_mem(*pkt, ipsec_offset,
-							_ODP_UDPHDR_LEN, &udp))) {
+		ODP_STATIC_ASSERT(sizeof(hdr) == _ODP_UDPHDR_LEN + _ODP_ESPHDR_LEN,
+				  "UDP and ESP headers are not packed");
+
+		if (odp_unlikely(ip_data_len < sizeof(hdr) ||
+				 odp_packet_copy_to_mem(*pkt, ipsec_offset,
+							sizeof(hdr), &hdr))) {
 			status->error.proto = 1;
 			return -1;
 		}
 
-		if (udp.dst_port != odp_cpu_to_be_16(_ODP_UDP_IPSEC_PORT) ||
-		    udp.length != odp_cpu_to_be_16(ip_data_len)) {
+		if (hdr.udp.dst_port != odp_cpu_to_be_16(_ODP_UDP_IPSEC_PORT) ||
+		    hdr.udp.length != odp_cpu_to_be_16(ip_data_len)) {
 			status->error.proto = 1;
 			return -1;
 		}
@@ -700,10 +708,9 @@ static int ipsec_in_esp(odp_packet_t *pkt,
 		ipsec_offset += _ODP_UDPHDR_LEN;
 		state->ip_hdr_len += _ODP_UDPHDR_LEN;
 		udp_encap = true;
-	}
-
-	if (odp_packet_copy_to_mem(*pkt, ipsec_offset,
-				   sizeof(esp), &esp) < 0) {
+		esp = hdr.esp;
+	} else if (odp_packet_copy_to_mem(*pkt, ipsec_offset,
+					  sizeof(esp), &esp) < 0) {
 		status->error.alg = 1;
 		return -1;
 	}
@@ -1357,7 +1364,7 @@ exit:
 static inline
 uint64_t ipsec_seq_no(ipsec_sa_t *ipsec_sa)
 {
-	return odp_atomic_fetch_add_u64(&ipsec_sa->hot.out.seq, 1);
+	return _odp_ipsec_sa_alloc_seq_no(ipsec_sa);
 }
 
 /* Helper for calculating encode length using data length and block size */
@@ -1749,8 +1756,10 @@ static int ipsec_out_esp(odp_packet_t *pkt,
 		return -1;
 	}
 
+	/* Room for the ESN high order bits used in ICV computation is
+	 * reserved together with the trailer */
 	pkt_len = odp_packet_len(*pkt);
-	new_len = state->ip_offset + state->ip_tot_len;
+	new_len = state->ip_offset + state->ip_tot_len + ipsec_get_seqh_len(ipsec_sa);
 	if (pkt_len >= new_len) {
 		if (odp_packet_trunc_tail(pkt, pkt_len - new_len,
 					  NULL, NULL) < 0) {
@@ -1773,51 +1782,65 @@ static int ipsec_out_esp(odp_packet_t *pkt,
 				 encrypt_len -
 				 _ODP_ESPTRL_LEN;
 
+	/* Write UDP and ESP headers and ESP IV with a single copy. For CBC
+	 * IV generation the ESP IV field is zeroed here and encrypted later
+	 * using the cipher IV. */
+	uint8_t hdr[_ODP_UDPHDR_LEN + _ODP_ESPHDR_LEN + IPSEC_MAX_IV_LEN];
+	uint32_t hdr_offset = 0;
+
 	if (ipsec_sa->udp_encap) {
-		odp_packet_copy_from_mem(*pkt, ipsec_offset, _ODP_UDPHDR_LEN,
-					 &udphdr);
-		ipsec_offset += _ODP_UDPHDR_LEN;
-		hdr_len -= _ODP_UDPHDR_LEN;
+		memcpy(hdr, &udphdr, _ODP_UDPHDR_LEN);
+		hdr_offset = _ODP_UDPHDR_LEN;
 		state->ip_hdr_len += _ODP_UDPHDR_LEN;
 	}
 
-	odp_packet_copy_from_mem(*pkt,
-				 ipsec_offset, _ODP_ESPHDR_LEN,
-				 &esp);
-	if (!ipsec_sa->use_cbc_iv) {
+	memcpy(hdr + hdr_offset, &esp, _ODP_ESPHDR_LEN);
+	hdr_offset += _ODP_ESPHDR_LEN;
+
+	if (ipsec_sa->use_cbc_iv)
+		memset(hdr + hdr_offset, 0, ipsec_sa->esp_iv_len);
+	else
 		/* copy the relevant part of cipher IV to ESP IV */
-		odp_packet_copy_from_mem(*pkt,
-					 ipsec_offset + _ODP_ESPHDR_LEN,
-					 ipsec_sa->esp_iv_len,
-					 state->iv + ipsec_sa->salt_length);
+		memcpy(hdr + hdr_offset, state->iv + ipsec_sa->salt_length,
+		       ipsec_sa->esp_iv_len);
+	hdr_offset += ipsec_sa->esp_iv_len;
+
+	odp_packet_copy_from_mem(*pkt, ipsec_offset, hdr_offset, hdr);
+
+	if (ipsec_sa->udp_encap) {
+		ipsec_offset += _ODP_UDPHDR_LEN;
+		hdr_len -= _ODP_UDPHDR_LEN;
 	}
+
 	/* 0xa5 is a good value to fill data instead of generating random data
 	 * to create TFC padding */
-	_odp_packet_set_data(*pkt, esptrl_offset - esptrl.pad_len - tfc_len,
-			     0xa5, tfc_len);
-	odp_packet_copy_from_mem(*pkt,
-				 esptrl_offset - esptrl.pad_len,
-				 esptrl.pad_len, ipsec_padding);
-	odp_packet_copy_from_mem(*pkt,
-				 esptrl_offset, _ODP_ESPTRL_LEN,
-				 &esptrl);
+	if (odp_unlikely(tfc_len))
+		_odp_packet_set_data(*pkt, esptrl_offset - esptrl.pad_len - tfc_len,
+				     0xa5, tfc_len);
 
-	/* Outbound ICV computation includes ESN higher 32 bits as part of ESP
+	/* Write padding, ESP trailer and ESN high order bits with a single
+	 * copy, so that the tail segment is looked up only once even for
+	 * long segmented packets.
+	 *
+	 * Outbound ICV computation includes ESN higher 32 bits as part of ESP
 	 * implicit trailer for individual algo's.
 	 */
+	uint8_t trl[sizeof(ipsec_padding) + _ODP_ESPTRL_LEN + IPSEC_SEQ_HI_LEN];
+	uint32_t trl_offset = esptrl.pad_len;
+
+	memcpy(trl, ipsec_padding, esptrl.pad_len);
+	memcpy(trl + trl_offset, &esptrl, _ODP_ESPTRL_LEN);
+	trl_offset += _ODP_ESPTRL_LEN;
+
 	if (ipsec_sa->insert_seq_hi) {
 		uint32_t outb_seqh = odp_cpu_to_be_32(seq_no >> 32);
 
-		if (odp_packet_extend_tail(pkt, IPSEC_SEQ_HI_LEN, NULL, NULL) < 0) {
-			status->error.alg = 1;
-			_ODP_ERR("odp_packet_extend_tail failed\n");
-			return -1;
-		}
-		odp_packet_copy_from_mem(*pkt,
-					 esptrl_offset + _ODP_ESPTRL_LEN,
-					 IPSEC_SEQ_HI_LEN, &outb_seqh);
+		memcpy(trl + trl_offset, &outb_seqh, IPSEC_SEQ_HI_LEN);
+		trl_offset += IPSEC_SEQ_HI_LEN;
 	}
 
+	odp_packet_copy_from_mem(*pkt, esptrl_offset - esptrl.pad_len, trl_offset, trl);
+
 	if (odp_unlikely(state->ip_tot_len <
 			 state->ip_hdr_len + hdr_len + ipsec_sa->icv_len)) {
 		status->error.proto = 1;
@@ -1850,10 +1873,6 @@ static int ipsec_out_esp(odp_packet_t *pkt,
 		_ODP_ASSERT(ipsec_sa->esp_iv_len == CBC_IV_LEN);
 		param->cipher_range.offset -= CBC_IV_LEN;
 		param->cipher_range.length += CBC_IV_LEN;
-		_odp_packet_set_data(*pkt,
-				     ipsec_offset + _ODP_ESPHDR_LEN,
-				     0,
-				     CBC_IV_LEN);
 	}
 
 	param->session = ipsec_sa->session;
@@ -2379,41 +2398,93 @@ static inline void finish_packet_proc(odp_packet_t pkt, ipsec_op_t *op, odp_queu
 	}
 }
 
-static void ipsec_in_finalize(odp_packet_t pkt_in[], ipsec_op_t ops[], int num, odp_bool_t is_enq)
+/*
+ * Run anti-replay check and window update for all packets of a burst that
+ * passed crypto processing. Packets of the same SA are handled together so
+ * that the SA window is locked or updated only once per burst and SA, which
+ * keeps the SA cache line from bouncing between threads on every packet.
+ */
+static void ipsec_in_replay_burst(ipsec_op_t ops[], int num, odp_bool_t is_enq)
+{
+	uint64_t seq[MAX_BURST];
+	odp_ipsec_op_status_t *status[MAX_BURST];
+	uint32_t pending = 0;
+
+	ODP_STATIC_ASSERT(MAX_BURST <= 32, "MAX_BURST does not fit in pending mask");
+
+	for (int i = 0; i < num; i++)
+		if (!ops[i].status.error.all && ops[i].sa->antireplay)
+			pending |= 1U << i;
+
+	if (!pending)
+		return;
+
+	/* The whole burst belongs to the same ordered context */
+	if (is_enq)
+		wait_for_order(ipsec_global->inbound_ordering_mode);
+
+	while (pending) {
+		int first = __builtin_ctz(pending);
+		ipsec_sa_t *sa = ops[first].sa;
+		int n = 0;
+
+		for (int i = first; i < num; i++) {
+			if (!(pending & (1U << i)) || ops[i].sa != sa)
+				continue;
+
+			seq[n] = ops[i].state.in.seq_no;
+			status[n] = &ops[i].status;
+			n++;
+			pending &= ~(1U << i);
+		}
+
+		_odp_ipsec_sa_replay_update_multi(sa, seq, status, n);
+	}
+}
+
+/* Check crypto results, anti-replay windows and remove IPsec headers and trailers of a burst of
+ * inbound packets */
+static void ipsec_in_finalize_pkts(odp_packet_t pkt_in[], ipsec_op_t ops[], int num,
+				   odp_bool_t is_enq)
 {
 	for (int i = 0; i < num; i++) {
 		ipsec_op_t *op = &ops[i];
-		odp_packet_t *pkt = &pkt_in[i];
-		odp_queue_t q = ODP_QUEUE_INVALID;
 
-		if (odp_unlikely(op->status.error.all))
-			goto finish;
+		if (odp_likely(!op->status.error.all))
+			ipsec_in_check_crypto_result(pkt_in[i], &op->status);
+	}
 
-		if (odp_unlikely(ipsec_in_check_crypto_result(*pkt, &op->status)))
-			goto finish;
+	ipsec_in_replay_burst(ops, num, is_enq);
 
-		if (op->sa->antireplay) {
-			if (is_enq)
-				wait_for_order(ipsec_global->inbound_ordering_mode);
+	for (int i = 0; i < num; i++) {
+		ipsec_op_t *op = &ops[i];
+		odp_packet_t *pkt = &pkt_in[i];
 
-			if (odp_unlikely(_odp_ipsec_sa_replay_update(op->sa, op->state.in.seq_no,
-								     &op->status) < 0))
-				goto finish;
-		}
+		if (odp_unlikely(op->status.error.all))
+			continue;
 
 		if (odp_unlikely(ipsec_in_finalize_packet(pkt, &op->state, op->sa,
 							  &op->status))) {
 			update_post_lifetime_stats(op->sa, &op->state);
-			goto finish;
+			continue;
 		}
 
 		ipsec_in_parse_decap_packet(*pkt, &op->state, op->sa);
+	}
+}
+
+static void ipsec_in_finalize(odp_packet_t pkt_in[], ipsec_op_t ops[], int num, odp_bool_t is_enq)
+{
+	ipsec_in_finalize_pkts(pkt_in, ops, num, is_enq);
+
+	for (int i = 0; i < num; i++) {
+		ipsec_op_t *op = &ops[i];
+		odp_queue_t q = ODP_QUEUE_INVALID;
 
-finish:
 		if (is_enq)
 			q = NULL != op->sa ? op->sa->queue : ipsec_config->inbound.default_queue;
 
-		finish_packet_proc(*pkt, op, q);
+		finish_packet_proc(pkt_in[i], op, q);
 	}
 }
 
@@ -2587,13 +2658,34 @@ int odp_ipsec_out_enq(const odp_packet_t pkt_in[], int num_in, const odp_ipsec_o
 	return max_out;
 }
 
+static void ipsec_in_inline_result(odp_packet_t pkt, ipsec_sa_t *ipsec_sa,
+				   const odp_ipsec_op_status_t *status, uint32_t orig_ip_len)
+{
+	odp_ipsec_packet_result_t *result;
+	odp_packet_hdr_t *pkt_hdr;
+
+	packet_subtype_set(pkt, ODP_EVENT_PACKET_IPSEC);
+	result = ipsec_pkt_result(pkt);
+	memset(result, 0, sizeof(*result));
+	result->status = *status;
+	result->orig_ip_len = orig_ip_len;
+	result->sa = ipsec_sa->ipsec_sa_hdl;
+	result->flag.inline_mode = 1;
+
+	pkt_hdr = packet_hdr(pkt);
+	pkt_hdr->dst_queue = ipsec_sa->queue;
+	/* Distinguish inline IPsec packets from classifier packets */
+	pkt_hdr->cos = CLS_COS_IDX_NONE;
+
+	/* Last thing */
+	_odp_ipsec_sa_unuse(ipsec_sa);
+}
+
 int _odp_ipsec_try_inline(odp_packet_t *pkt)
 {
 	odp_ipsec_op_status_t status;
 	ipsec_sa_t *ipsec_sa;
 	uint32_t orig_ip_len = 0;
-	odp_ipsec_packet_result_t *result;
-	odp_packet_hdr_t *pkt_hdr;
 
 	if (odp_global_ro.disable.ipsec)
 		return -1;
@@ -2609,23 +2701,54 @@ int _odp_ipsec_try_inline(odp_packet_t *pkt)
 	if (NULL == ipsec_sa)
 		return -1;
 
-	packet_subtype_set(*pkt, ODP_EVENT_PACKET_IPSEC);
-	result = ipsec_pkt_result(*pkt);
-	memset(result, 0, sizeof(*result));
-	result->status = status;
-	result->orig_ip_len = orig_ip_len;
-	result->sa = ipsec_sa->ipsec_sa_hdl;
-	result->flag.inline_mode = 1;
+	ipsec_in_inline_result(*pkt, ipsec_sa, &status, orig_ip_len);
 
-	pkt_hdr = packet_hdr(*pkt);
-	pkt_hdr->dst_queue = ipsec_sa->queue;
-	/* Distinguish inline IPsec packets from classifier packets */
-	pkt_hdr->cos = CLS_COS_IDX_NONE;
+	return 0;
+}
 
-	/* Last thing */
-	_odp_ipsec_sa_unuse(ipsec_sa);
+int _odp_ipsec_try_inline_multi(odp_packet_t pkt[], int num, uint8_t done[])
+{
+	odp_packet_t crypto_pkts[MAX_BURST];
+	odp_crypto_packet_op_param_t crypto_param[MAX_BURST];
+	ipsec_op_t ops[MAX_BURST], *crypto_ops[MAX_BURST];
+	odp_ipsec_in_param_t param;
+	int num_done = 0;
 
-	return 0;
+	memset(done, 0, num);
+
+	if (odp_global_ro.disable.ipsec)
+		return 0;
+
+	/* SA lookup for all packets */
+	memset(&param, 0, sizeof(param));
+
+	for (int i = 0; i < num; i += MAX_BURST) {
+		int num_prep = _ODP_MIN(num - i, MAX_BURST), num_crypto;
+
+		/* Packets left over from a failed unshare are routed back */
+		ipsec_in_prepare(&pkt[i], &pkt[i], &num_prep, &param, ops, crypto_pkts,
+				 crypto_param, crypto_ops, &num_crypto);
+		ipsec_do_crypto_burst(crypto_pkts, crypto_param, crypto_ops, num_crypto);
+		ipsec_in_finalize_pkts(&pkt[i], ops, num_prep, false);
+
+		for (int j = 0; j < num_prep; j++) {
+			ipsec_op_t *op = &ops[j];
+
+			/* Route packet back in case of lookup failure or early error before
+			 * lookup */
+			if (NULL == op->sa)
+				continue;
+
+			if (ipsec_config->stats_en)
+				ipsec_sa_err_stats_update(op->sa, &op->status);
+
+			ipsec_in_inline_result(pkt[i + j], op->sa, &op->status, op->orig_ip_len);
+			done[i + j] = 1;
+			num_done++;
+		}
+	}
+
+	return num_done;
 }
 
 static inline int ipsec_out_inline_check_out_hdrs(odp_packet_t pkt,
@@ -2833,7 +2956,7 @@ int odp_ipsec_test_sa_update(odp_ipsec_sa_t sa,
 
 	switch (sa_op) {
 	case ODP_IPSEC_TEST_SA_UPDATE_SEQ_NUM:
-		odp_atomic_store_u64(&ipsec_sa->hot.out.seq, sa_param->seq_num);
+		_odp_ipsec_sa_seq_no_set(ipsec_sa, sa_param->seq_num);
 		break;
 	default:
 		return -1;
@@ -16,6 +16,7 @@
 #include <odp_init_internal.h>
 #include <odp_debug_internal.h>
 #include <odp_ipsec_internal.h>
+#include <odp_libconfig_internal.h>
 #include <odp_macros_internal.h>
 #include <ring/odp_ring_mpmc_u32_internal.h>
 #include <odp_global_data.h>
@@ -90,6 +91,12 @@ typedef struct sa_thread_local_s {
 	 * counter(s).
 	 */
 	odp_ipsec_op_status_t lifetime_status;
+	/*
+	 * Current block of outbound sequence numbers reserved for this
+	 * thread when sequence number blocks are enabled.
+	 */
+	uint64_t seq_next;
+	uint64_t seq_end;
 } sa_thread_local_t;
 
 typedef struct ODP_ALIGNED_CACHE ipsec_thread_local_s {
@@ -109,6 +116,8 @@ typedef struct ipsec_sa_table_t {
 		odp_spinlock_t lock;
 	} sa_freelist;
 	uint32_t max_num_sa;
+	/* Number of outbound sequence numbers reserved at a time per thread */
+	uint32_t out_seq_block_size;
 	odp_shm_t shm;
 	ipsec_thread_local_t per_thread[];
 } ipsec_sa_table_t;
@@ -152,9 +161,47 @@ static void init_sa_thread_local(ipsec_sa_t *sa)
 		odp_atomic_init_u32(&sa_tl->packet_quota, 0);
 		odp_atomic_init_u32(&sa_tl->byte_quota, 0);
 		sa_tl->lifetime_status.all = 0;
+		sa_tl->seq_next = 0;
+		sa_tl->seq_end = 0;
 	}
 }
 
+static int read_config_file(ipsec_sa_table_t *tbl)
+{
+	const char *str = "ipsec.outbound_seq_block_size";
+	int val;
+
+	if (!_odp_libconfig_lookup_int(str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+
+	if (val < 0) {
+		_ODP_ERR("Bad value %s = %i\n", str, val);
+		return -1;
+	}
+
+	tbl->out_seq_block_size = val;
+	_ODP_PRINT("  %s: %i\n", str, val);
+
+	if (tbl->out_seq_block_size <= 1)
+		return 0;
+
+	/* Blocks would hand out sequence numbers out of packet order */
+	str = "ipsec.ordering.async_outbound";
+	if (!_odp_libconfig_lookup_int(str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+
+	if (val) {
+		_ODP_PRINT("  sequence number blocks disabled due to %s: %i\n", str, val);
+		tbl->out_seq_block_size = 0;
+	}
+
+	return 0;
+}
+
 int _odp_ipsec_sad_init_global(void)
 {
 	odp_crypto_capability_t crypto_capa;
@@ -191,6 +238,11 @@ int _odp_ipsec_sad_init_global(void)
 	ipsec_sa_tbl->shm = shm;
 	ipsec_sa_tbl->max_num_sa = max_num_sa;
 
+	if (read_config_file(ipsec_sa_tbl)) {
+		odp_shm_free(shm);
+		return -1;
+	}
+
 	ring_mpmc_u32_init(&ipsec_sa_tbl->hot.ipv4_id_ring);
 	for (i = 0; i < thread_count_max; i++) {
 		/*
@@ -1003,18 +1055,35 @@ int _odp_ipsec_sa_replay_precheck(ipsec_sa_t *ipsec_sa, uint64_t seq,
 	return 0;
 }
 
-static inline int ipsec_wslarge_replay_update(ipsec_sa_t *ipsec_sa, uint64_t seq,
-					      odp_ipsec_op_status_t *status)
+/* Clear 'num' window buckets starting after bucket 'first', wrapping around
+ * the end of the bucket array. Done in at most two contiguous ranges so that
+ * the compiler can use wide stores. */
+static inline void ipsec_ar_buckets_clear(uint64_t bucket_arr[], uint64_t num_buckets,
+					  uint64_t first, uint64_t num)
 {
-	uint64_t bucket, wintop_bucket, new_bucket;
-	uint64_t bkt_diff, bkt_cnt;
-	uint64_t bit = 0, top_seq;
+	uint64_t start = (first + 1) % num_buckets;
+	uint64_t num_tail = num_buckets - start;
 
-	odp_spinlock_lock(&ipsec_sa->hot.in.lock);
+	if (num <= num_tail) {
+		memset(&bucket_arr[start], 0, num * sizeof(uint64_t));
+		return;
+	}
+
+	memset(&bucket_arr[start], 0, num_tail * sizeof(uint64_t));
+	memset(bucket_arr, 0, (num - num_tail) * sizeof(uint64_t));
+}
+
+/* Check and update the window of a large window SA. Called with the window
+ * lock held. */
+static inline int ipsec_wslarge_replay_check(ipsec_sa_t *ipsec_sa, uint64_t seq)
+{
+	uint64_t bucket, wintop_bucket, bkt_diff, bit, top_seq;
+	uint64_t *bucket_arr = ipsec_sa->hot.in.bucket_arr;
+	uint64_t num_buckets = ipsec_sa->in.ar.num_buckets;
 
 	top_seq = odp_atomic_load_u64(&ipsec_sa->hot.in.wintop_seq);
 	if ((seq + ipsec_sa->in.ar.win_size) <= top_seq)
-		goto ar_err;
+		return -1;
 
 	bucket = (seq >> IPSEC_AR_WIN_BUCKET_BITS);
 
@@ -1024,35 +1093,69 @@ static inline int ipsec_wslarge_replay_update(ipsec_sa_t *ipsec_sa, uint64_t seq
 		bkt_diff = bucket - wintop_bucket;
 
 		/* Seq is way after the range of AR window size */
-		if (bkt_diff > ipsec_sa->in.ar.num_buckets)
-			bkt_diff = ipsec_sa->in.ar.num_buckets;
+		if (bkt_diff > num_buckets)
+			bkt_diff = num_buckets;
 
-		for (bkt_cnt = 0; bkt_cnt < bkt_diff; bkt_cnt++) {
-			new_bucket = (bkt_cnt + wintop_bucket + 1) %
-				     ipsec_sa->in.ar.num_buckets;
-			ipsec_sa->hot.in.bucket_arr[new_bucket] = 0;
-		}
+		if (bkt_diff)
+			ipsec_ar_buckets_clear(bucket_arr, num_buckets,
+					       wintop_bucket % num_buckets, bkt_diff);
 
 		/* AR window top sequence number */
 		odp_atomic_store_u64(&ipsec_sa->hot.in.wintop_seq, seq);
 	}
 
-	bucket %= ipsec_sa->in.ar.num_buckets;
+	bucket %= num_buckets;
 	bit = (uint64_t)1 << (seq & IPSEC_AR_WIN_BITLOC_MASK);
 
 	/* Already seen the packet, discard it */
-	if (ipsec_sa->hot.in.bucket_arr[bucket] & bit)
-		goto ar_err;
+	if (bucket_arr[bucket] & bit)
+		return -1;
 
 	/* Packet is new, mark it as seen */
-	ipsec_sa->hot.in.bucket_arr[bucket] |= bit;
-	odp_spinlock_unlock(&ipsec_sa->hot.in.lock);
+	bucket_arr[bucket] |= bit;
 
 	return 0;
-ar_err:
-	status->error.antireplay = 1;
+}
+
+static inline int ipsec_wslarge_replay_update(ipsec_sa_t *ipsec_sa, uint64_t seq,
+					      odp_ipsec_op_status_t *status)
+{
+	int ret;
+
+	odp_spinlock_lock(&ipsec_sa->hot.in.lock);
+	ret = ipsec_wslarge_replay_check(ipsec_sa, seq);
 	odp_spinlock_unlock(&ipsec_sa->hot.in.lock);
-	return -1;
+
+	if (ret)
+		status->error.antireplay = 1;
+
+	return ret;
+}
+
+/* Check and update a 32 packet window state. The state holds the window top
+ * sequence number in the low and the window bitmap in the high 32 bits. */
+static inline int ipsec_ws32_replay_check(uint64_t *state, uint32_t seq)
+{
+	uint32_t max_seq = *state & 0xffffffff;
+	uint32_t mask = *state >> 32;
+
+	if (seq + IPSEC_AR_WIN_SIZE_MIN <= max_seq) {
+		return -1;
+	} else if (seq >= max_seq + IPSEC_AR_WIN_SIZE_MIN) {
+		mask = 1;
+		max_seq = seq;
+	} else if (seq > max_seq) {
+		mask <<= seq - max_seq;
+		mask |= 1;
+		max_seq = seq;
+	} else if (mask & (1U << (max_seq - seq))) {
+		return -1;
+	} else {
+		mask |= (1U << (max_seq - seq));
+	}
+
+	*state = (((uint64_t)mask) << 32) | max_seq;
+	return 0;
 }
 
 static inline int ipsec_ws32_replay_update(ipsec_sa_t *ipsec_sa, uint32_t seq,
@@ -1063,40 +1166,31 @@ static inline int ipsec_ws32_replay_update(ipsec_sa_t *ipsec_sa, uint32_t seq,
 
 	state = odp_atomic_load_u64(&ipsec_sa->hot.in.wintop_seq);
 	while (0 == cas) {
-		uint32_t max_seq = state & 0xffffffff;
-		uint32_t mask = state >> 32;
+		new_state = state;
 
-		if (seq + IPSEC_AR_WIN_SIZE_MIN <= max_seq) {
+		if (ipsec_ws32_replay_check(&new_state, seq)) {
 			status->error.antireplay = 1;
 			return -1;
-		} else if (seq >= max_seq + IPSEC_AR_WIN_SIZE_MIN) {
-			mask = 1;
-			max_seq = seq;
-		} else if (seq > max_seq) {
-			mask <<= seq - max_seq;
-			mask |= 1;
-			max_seq = seq;
-		} else if (mask & (1U << (max_seq - seq))) {
-			status->error.antireplay = 1;
-			return -1;
-		} else {
-			mask |= (1U << (max_seq - seq));
 		}
 
-		new_state = (((uint64_t)mask) << 32) | max_seq;
 		cas = odp_atomic_cas_acq_rel_u64(&ipsec_sa->hot.in.wintop_seq,
 						 &state, new_state);
 	}
 	return 0;
 }
 
+static inline odp_bool_t ipsec_sa_replay_ws32(ipsec_sa_t *ipsec_sa)
+{
+	return !ipsec_sa->esn && ipsec_sa->in.ar.win_size == IPSEC_AR_WIN_SIZE_MIN;
+}
+
 int _odp_ipsec_sa_replay_update(ipsec_sa_t *ipsec_sa, uint64_t seq,
 				odp_ipsec_op_status_t *status)
 {
 	int ret;
 
 	/* Window update for ws equal to 32 */
-	if ((!ipsec_sa->esn) && (ipsec_sa->in.ar.win_size == IPSEC_AR_WIN_SIZE_MIN))
+	if (ipsec_sa_replay_ws32(ipsec_sa))
 		ret = ipsec_ws32_replay_update(ipsec_sa, (seq & 0xffffffff), status);
 	else
 		ret = ipsec_wslarge_replay_update(ipsec_sa, seq, status);
@@ -1104,6 +1198,97 @@ int _odp_ipsec_sa_replay_update(ipsec_sa_t *ipsec_sa, uint64_t seq,
 	return ret;
 }
 
+int _odp_ipsec_sa_replay_update_multi(ipsec_sa_t *ipsec_sa, const uint64_t seq[],
+				      odp_ipsec_op_status_t *status[], int num)
+{
+	int num_err = 0;
+
+	if (ipsec_sa_replay_ws32(ipsec_sa)) {
+		uint64_t state, new_state;
+		uint32_t err_mask;
+		int cas = 0;
+
+		_ODP_ASSERT(num <= 32);
+
+		/* Apply the whole burst to a local copy of the window and
+		 * publish it with a single CAS. */
+		state = odp_atomic_load_u64(&ipsec_sa->hot.in.wintop_seq);
+		do {
+			new_state = state;
+			err_mask = 0;
+
+			for (int i = 0; i < num; i++)
+				if (ipsec_ws32_replay_check(&new_state, seq[i] & 0xffffffff))
+					err_mask |= 1U << i;
+
+			if (new_state == state)
+				break;
+
+			cas = odp_atomic_cas_acq_rel_u64(&ipsec_sa->hot.in.wintop_seq,
+							 &state, new_state);
+		} while (0 == cas);
+
+		for (int i = 0; i < num; i++) {
+			if (err_mask & (1U << i)) {
+				status[i]->error.antireplay = 1;
+				num_err++;
+			}
+		}
+
+		return num_err;
+	}
+
+	odp_spinlock_lock(&ipsec_sa->hot.in.lock);
+
+	for (int i = 0; i < num; i++) {
+		if (ipsec_wslarge_replay_check(ipsec_sa, seq[i])) {
+			status[i]->error.antireplay = 1;
+			num_err++;
+		}
+	}
+
+	odp_spinlock_unlock(&ipsec_sa->hot.in.lock);
+
+	return num_err;
+}
+
+uint64_t _odp_ipsec_sa_alloc_seq_no(ipsec_sa_t *ipsec_sa)
+{
+	uint32_t block_size = ipsec_sa_tbl->out_seq_block_size;
+	sa_thread_local_t *sa_tl;
+
+	if (odp_likely(block_size <= 1))
+		return odp_atomic_fetch_add_u64(&ipsec_sa->hot.out.seq, 1);
+
+	/*
+	 * Reserve sequence numbers from the shared counter a block at a
+	 * time. Unused numbers of a block are never handed out, which only
+	 * shows up as gaps in the sequence number space.
+	 */
+	sa_tl = ipsec_sa_thread_local(ipsec_sa);
+	if (odp_unlikely(sa_tl->seq_next == sa_tl->seq_end)) {
+		sa_tl->seq_next = odp_atomic_fetch_add_u64(&ipsec_sa->hot.out.seq, block_size);
+		sa_tl->seq_end = sa_tl->seq_next + block_size;
+	}
+
+	return sa_tl->seq_next++;
+}
+
+void _odp_ipsec_sa_seq_no_set(ipsec_sa_t *ipsec_sa, uint64_t seq)
+{
+	int thread_count_max = odp_thread_count_max();
+
+	odp_atomic_store_u64(&ipsec_sa->hot.out.seq, seq);
+
+	/* Drop sequence number blocks reserved before the update */
+	for (int n = 0; n < thread_count_max; n++) {
+		sa_thread_local_t *sa_tl = &ipsec_sa_tbl->per_thread[n].sa[ipsec_sa->ipsec_sa_idx];
+
+		sa_tl->seq_next = 0;
+		sa_tl->seq_end = 0;
+	}
+}
+
 uint16_t _odp_ipsec_sa_alloc_ipv4_id(ipsec_sa_t *ipsec_sa)
 {
 	(void)ipsec_sa;
@@ -1171,6 +1356,33 @@ void _odp_ipsec_sa_stats_pkts(ipsec_sa_t *sa, odp_ipsec_stats_t *stats)
 	return;
 }
 
+/* Last outbound sequence number used */
+static uint64_t ipsec_sa_last_seq_no(ipsec_sa_t *ipsec_sa)
+{
+	uint64_t last = (uint64_t)odp_atomic_load_u64(&ipsec_sa->hot.out.seq) - 1;
+	int thread_count_max = odp_thread_count_max();
+	odp_bool_t block_used = false;
+	uint64_t block_last = 0;
+
+	if (ipsec_sa_tbl->out_seq_block_size <= 1)
+		return last;
+
+	/* Blocks are reserved in increasing order, so the highest number used
+	 * from any of the blocks is the last one used. */
+	for (int n = 0; n < thread_count_max; n++) {
+		sa_thread_local_t *sa_tl = &ipsec_sa_tbl->per_thread[n].sa[ipsec_sa->ipsec_sa_idx];
+
+		if (sa_tl->seq_end == 0)
+			continue;
+
+		if (!block_used || sa_tl->seq_next - 1 > block_last)
+			block_last = sa_tl->seq_next - 1;
+		block_used = true;
+	}
+
+	return block_used ? block_last : last;
+}
+
 static void ipsec_out_sa_info(ipsec_sa_t *ipsec_sa, odp_ipsec_sa_info_t *sa_info)
 {
 	odp_ipsec_tunnel_param_t *tun_param = &sa_info->param.outbound.tunnel;
@@ -1187,8 +1399,7 @@ static void ipsec_out_sa_info(ipsec_sa_t *ipsec_sa, odp_ipsec_sa_info_t *sa_info
 	sa_info->param.outbound.frag_mode = ipsec_sa->out.frag_mode;
 	sa_info->param.outbound.mtu = ipsec_sa->sa_info.out.mtu;
 
-	sa_info->outbound.seq_num =
-		(uint64_t)odp_atomic_load_u64(&ipsec_sa->hot.out.seq) -	1;
+	sa_info->outbound.seq_num = ipsec_sa_last_seq_no(ipsec_sa);
 
 	if (ipsec_sa->mode == ODP_IPSEC_MODE_TUNNEL) {
 		uint8_t *src, *dst;
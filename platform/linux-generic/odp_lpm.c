@@ -0,0 +1,821 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#include <odp/api/align.h>
+#include <odp/api/atomic.h>
+#include <odp/api/hash.h>
+#include <odp/api/hints.h>
+#include <odp/api/lpm.h>
+#include <odp/api/qsbr.h>
+#include <odp/api/shared_memory.h>
+#include <odp/api/std_types.h>
+#include <odp/api/ticketlock.h>
+
+#include <odp/api/plat/atomic_inlines.h>
+#include <odp/api/plat/hash_inlines.h>
+#include <odp/api/plat/strong_types.h>
+
+#include <odp_config_internal.h>
+#include <odp_debug_internal.h>
+#include <odp_global_data.h>
+#include <odp_init_internal.h>
+#include <odp_macros_internal.h>
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Multi-stride trie. The first level is indexed directly with the first 24 (IPv4) or
+ * 16 (IPv6) address bits. Longer prefixes are stored into 256 entry extension tables,
+ * each of which is indexed with the next 8 address bits. For IPv4 this is the DIR-24-8
+ * scheme: most lookups need a single memory access and the rest two.
+ *
+ * A table entry is a 32-bit word, which contains either a next hop value and the prefix
+ * length of the route it belongs to, or an index to an extension table. Entries are
+ * written with single atomic stores, so readers do not need locks. A new extension table
+ * is filled completely before its index is published with a release store.
+ *
+ * When the table has a QSBR domain, extension tables that become uniform after an update
+ * are collapsed into the parent entry and recycled in FIFO order. A reader may still hold
+ * the old entry, so a freed table is reused only after a grace period started after the
+ * free has ended. Without a QSBR domain, tables are not collapsed, since there is no way
+ * to know when readers have stopped using them.
+ *
+ * Routes are stored also into a rule hash table. Rules are needed to find the next
+ * longest prefix when a route is deleted.
+ */
+
+#define ENTRY_VALID       0x80000000u
+#define ENTRY_EXT         0x40000000u
+#define ENTRY_DEPTH_SHIFT 22
+#define ENTRY_DEPTH_MASK  0xffu
+#define ENTRY_VALUE_MASK  0x3fffffu
+
+#define EXT_BITS          8
+#define EXT_SIZE          (1u << EXT_BITS)
+
+#define MAX_ROUTES        (16 * 1024 * 1024)
+#define MAX_EXT           (ENTRY_VALUE_MASK + 1)
+#define MAX_NEXT_HOP      ENTRY_VALUE_MASK
+#define MAX_ADDR_LEN      16
+
+/* Number of addresses processed in parallel in odp_lpm_match_multi() */
+#define MATCH_BURST       32
+
+typedef struct {
+	uint8_t  addr[MAX_ADDR_LEN];
+	uint8_t  depth;
+	uint8_t  used;
+	uint32_t next_hop;
+
+} rule_t;
+
+typedef struct ODP_ALIGNED_CACHE lpm_t {
+	/* Read only data used by match operations */
+	odp_atomic_u32_t *tbl;
+	odp_atomic_u32_t *ext;
+	uint32_t first_bits;
+	uint32_t first_bytes;
+	uint32_t addr_len;
+
+	/* Writer lock and data */
+	odp_ticketlock_t ODP_ALIGNED_CACHE lock;
+	odp_lpm_type_t type;
+	uint32_t max_depth;
+	uint32_t max_routes;
+	uint32_t num_routes;
+	uint32_t num_ext;
+	uint32_t num_ext_free;
+	uint32_t ext_head;
+	uint32_t ext_tail;
+	uint32_t *ext_free;
+	/* Grace period tokens of freed extension tables (zero: no grace period) */
+	uint64_t *ext_token;
+	odp_qsbr_t qsbr;
+	rule_t   *rule;
+	uint32_t rule_mask;
+	int      index;
+	odp_shm_t shm;
+	char     name[ODP_LPM_NAME_LEN];
+
+} lpm_t;
+
+typedef struct lpm_global_t {
+	odp_ticketlock_t lock;
+	odp_shm_t        shm;
+	lpm_t            *table[CONFIG_MAX_LPM_TABLES];
+
+} lpm_global_t;
+
+static lpm_global_t *lpm_global;
+
+static inline lpm_t *lpm_entry(odp_lpm_t lpm)
+{
+	return (lpm_t *)(uintptr_t)lpm;
+}
+
+static inline odp_lpm_t lpm_handle(lpm_t *lpm)
+{
+	return (odp_lpm_t)(uintptr_t)lpm;
+}
+
+int _odp_lpm_init_global(void)
+{
+	odp_shm_t shm;
+
+	shm = odp_shm_reserve("_odp_lpm_global", sizeof(lpm_global_t),
+			      ODP_CACHE_LINE_SIZE, 0);
+
+	lpm_global = odp_shm_addr(shm);
+
+	if (lpm_global == NULL) {
+		_ODP_ERR("SHM reserve of LPM global data failed\n");
+		return -1;
+	}
+
+	memset(lpm_global, 0, sizeof(lpm_global_t));
+	lpm_global->shm = shm;
+	odp_ticketlock_init(&lpm_global->lock);
+
+	return 0;
+}
+
+int _odp_lpm_term_global(void)
+{
+	if (lpm_global == NULL)
+		return 0;
+
+	for (int i = 0; i < CONFIG_MAX_LPM_TABLES; i++) {
+		if (lpm_global->table[i])
+			_ODP_ERR("LPM table not destroyed: %s\n", lpm_global->table[i]->name);
+	}
+
+	if (odp_shm_free(lpm_global->shm)) {
+		_ODP_ERR("SHM free failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+int odp_lpm_capability(odp_lpm_capability_t *capa)
+{
+	memset(capa, 0, sizeof(odp_lpm_capability_t));
+
+	capa->max_tables      = CONFIG_MAX_LPM_TABLES;
+	capa->max_next_hop    = MAX_NEXT_HOP;
+	capa->ipv4.max_routes = MAX_ROUTES;
+	capa->ipv4.max_ext    = MAX_EXT;
+	capa->ipv6.max_routes = MAX_ROUTES;
+	capa->ipv6.max_ext    = MAX_EXT;
+
+	return 0;
+}
+
+void odp_lpm_param_init(odp_lpm_param_t *param)
+{
+	memset(param, 0, sizeof(odp_lpm_param_t));
+	param->type = ODP_LPM_IPV4;
+	param->qsbr = ODP_QSBR_INVALID;
+}
+
+static int reserve_index(lpm_t *lpm)
+{
+	int index = -1;
+
+	odp_ticketlock_lock(&lpm_global->lock);
+
+	for (int i = 0; i < CONFIG_MAX_LPM_TABLES; i++) {
+		if (lpm_global->table[i] == NULL) {
+			index = i;
+			lpm_global->table[i] = lpm;
+			break;
+		}
+	}
+
+	odp_ticketlock_unlock(&lpm_global->lock);
+
+	return index;
+}
+
+static void free_index(int i)
+{
+	odp_ticketlock_lock(&lpm_global->lock);
+	lpm_global->table[i] = NULL;
+	odp_ticketlock_unlock(&lpm_global->lock);
+}
+
+odp_lpm_t odp_lpm_create(const char *name, const odp_lpm_param_t *param)
+{
+	lpm_t *lpm;
+	odp_shm_t shm;
+	uint64_t tbl_offset, ext_offset, free_offset, token_offset, rule_offset, shm_size;
+	uint32_t first_bits, num_ext, num_rules;
+	uint32_t shm_flags = 0;
+
+	if (name && strlen(name) >= ODP_LPM_NAME_LEN) {
+		_ODP_ERR("Too long name: %s\n", name);
+		return ODP_LPM_INVALID;
+	}
+
+	if (param->type != ODP_LPM_IPV4 && param->type != ODP_LPM_IPV6) {
+		_ODP_ERR("Bad table type: %i\n", param->type);
+		return ODP_LPM_INVALID;
+	}
+
+	if (param->max_routes == 0 || param->max_routes > MAX_ROUTES) {
+		_ODP_ERR("Bad number of routes: %" PRIu32 "\n", param->max_routes);
+		return ODP_LPM_INVALID;
+	}
+
+	if (param->num_ext > MAX_EXT) {
+		_ODP_ERR("Bad number of extension tables: %" PRIu32 "\n", param->num_ext);
+		return ODP_LPM_INVALID;
+	}
+
+	first_bits = param->type == ODP_LPM_IPV4 ? 24 : 16;
+	num_ext = param->num_ext;
+
+	/* By default, expect that only a small portion of IPv4 routes are longer than
+	 * 24 bits. IPv6 routes are typically longer than 16 bits and may need multiple
+	 * extension tables each. */
+	if (num_ext == 0) {
+		if (param->type == ODP_LPM_IPV4) {
+			num_ext = (param->max_routes / 16) + 64;
+		} else {
+			num_ext = _ODP_MIN((uint64_t)param->max_routes * 2 + 64, (uint64_t)MAX_EXT);
+
+			/* Each new /24 or longer prefix under an unused /16 needs at least one
+			 * table, which is not reclaimed without a QSBR domain. The default is
+			 * sized for a stable set of routes, not for churn across prefixes. */
+			if (param->qsbr == ODP_QSBR_INVALID)
+				_ODP_WARN("LPM table %s: %" PRIu32 " extension tables are not "
+					  "reclaimed without QSBR domain, set num_ext for tables "
+					  "with route churn\n", name ? name : "", num_ext);
+		}
+	}
+
+	/* Keep the rule hash table load below 50% */
+	num_rules = _ODP_ROUNDUP_POWER2_U32(_ODP_MAX(2 * param->max_routes, 64u));
+
+	tbl_offset = _ODP_ROUNDUP_CACHE_LINE(sizeof(lpm_t));
+	ext_offset = tbl_offset + (1ull << first_bits) * sizeof(odp_atomic_u32_t);
+	free_offset = ext_offset + (uint64_t)num_ext * EXT_SIZE * sizeof(odp_atomic_u32_t);
+	token_offset = _ODP_ROUNDUP_CACHE_LINE(free_offset + (uint64_t)num_ext * sizeof(uint32_t));
+	rule_offset = _ODP_ROUNDUP_CACHE_LINE(token_offset + (uint64_t)num_ext * sizeof(uint64_t));
+	shm_size = rule_offset + (uint64_t)num_rules * sizeof(rule_t);
+
+	if (odp_global_ro.shm_single_va)
+		shm_flags |= ODP_SHM_SINGLE_VA;
+
+	shm = odp_shm_reserve("_odp_lpm", shm_size, ODP_CACHE_LINE_SIZE, shm_flags);
+	if (shm == ODP_SHM_INVALID) {
+		_ODP_ERR("SHM reserve failed\n");
+		return ODP_LPM_INVALID;
+	}
+
+	lpm = odp_shm_addr(shm);
+	memset(lpm, 0, sizeof(lpm_t));
+
+	if (name)
+		strcpy(lpm->name, name);
+
+	odp_ticketlock_init(&lpm->lock);
+	lpm->shm          = shm;
+	lpm->type         = param->type;
+	lpm->first_bits   = first_bits;
+	lpm->first_bytes  = first_bits / 8;
+	lpm->addr_len     = param->type == ODP_LPM_IPV4 ? 4 : 16;
+	lpm->max_depth    = 8 * lpm->addr_len;
+	lpm->max_routes   = param->max_routes;
+	lpm->num_ext      = num_ext;
+	lpm->num_ext_free = num_ext;
+	lpm->rule_mask    = num_rules - 1;
+	lpm->tbl          = (odp_atomic_u32_t *)(uintptr_t)((uint8_t *)lpm + tbl_offset);
+	lpm->ext          = (odp_atomic_u32_t *)(uintptr_t)((uint8_t *)lpm + ext_offset);
+	lpm->ext_free     = (uint32_t *)(uintptr_t)((uint8_t *)lpm + free_offset);
+	lpm->ext_token    = (uint64_t *)(uintptr_t)((uint8_t *)lpm + token_offset);
+	lpm->qsbr         = param->qsbr;
+	lpm->rule         = (rule_t *)(uintptr_t)((uint8_t *)lpm + rule_offset);
+
+	/* Zero entries are invalid (no route) */
+	memset(lpm->tbl, 0, (1ull << first_bits) * sizeof(odp_atomic_u32_t));
+	memset(lpm->rule, 0, (uint64_t)num_rules * sizeof(rule_t));
+
+	for (uint32_t i = 0; i < num_ext; i++) {
+		lpm->ext_free[i]  = i;
+		lpm->ext_token[i] = 0;
+	}
+
+	lpm->index = reserve_index(lpm);
+	if (lpm->index < 0) {
+		_ODP_ERR("Maximum number of LPM tables created\n");
+		odp_shm_free(shm);
+		return ODP_LPM_INVALID;
+	}
+
+	return lpm_handle(lpm);
+}
+
+int odp_lpm_destroy(odp_lpm_t lpm_hdl)
+{
+	lpm_t *lpm = lpm_entry(lpm_hdl);
+
+	if (lpm_hdl == ODP_LPM_INVALID) {
+		_ODP_ERR("Bad LPM table handle\n");
+		return -1;
+	}
+
+	free_index(lpm->index);
+
+	if (odp_shm_free(lpm->shm)) {
+		_ODP_ERR("SHM free failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+odp_lpm_t odp_lpm_lookup(const char *name)
+{
+	lpm_t *lpm;
+
+	if (name == NULL)
+		return ODP_LPM_INVALID;
+
+	odp_ticketlock_lock(&lpm_global->lock);
+
+	for (int i = 0; i < CONFIG_MAX_LPM_TABLES; i++) {
+		lpm = lpm_global->table[i];
+
+		if (lpm && strcmp(lpm->name, name) == 0) {
+			odp_ticketlock_unlock(&lpm_global->lock);
+			return lpm_handle(lpm);
+		}
+	}
+
+	odp_ticketlock_unlock(&lpm_global->lock);
+
+	return ODP_LPM_INVALID;
+}
+
+uint64_t odp_lpm_to_u64(odp_lpm_t lpm)
+{
+	return _odp_pri(lpm);
+}
+
+static inline uint32_t entry_make(uint32_t depth, uint32_t next_hop)
+{
+	return ENTRY_VALID | (depth << ENTRY_DEPTH_SHIFT) | next_hop;
+}
+
+static inline uint32_t entry_depth(uint32_t entry)
+{
+	return (entry >> ENTRY_DEPTH_SHIFT) & ENTRY_DEPTH_MASK;
+}
+
+static inline odp_atomic_u32_t *ext_table(lpm_t *lpm, uint32_t entry)
+{
+	return &lpm->ext[(entry & ENTRY_VALUE_MASK) * EXT_SIZE];
+}
+
+static inline uint32_t first_index(lpm_t *lpm, const uint8_t *addr)
+{
+	if (lpm->first_bytes == 3)
+		return ((uint32_t)addr[0] << 16) | ((uint32_t)addr[1] << 8) | addr[2];
+
+	return ((uint32_t)addr[0] << 8) | addr[1];
+}
+
+/* Resolve the rest of the trie, when 'entry' points to an extension table */
+static inline int match_ext(lpm_t *lpm, const uint8_t *addr, uint32_t entry, uint32_t *next_hop)
+{
+	uint32_t byte = lpm->first_bytes;
+
+	while (odp_unlikely(entry & ENTRY_EXT)) {
+		entry = odp_atomic_load_acq_u32(&ext_table(lpm, entry)[addr[byte]]);
+		byte++;
+	}
+
+	if (odp_likely(entry & ENTRY_VALID)) {
+		*next_hop = entry & ENTRY_VALUE_MASK;
+		return 1;
+	}
+
+	return 0;
+}
+
+int odp_lpm_match(odp_lpm_t lpm_hdl, const void *addr, uint32_t *next_hop)
+{
+	lpm_t *lpm = lpm_entry(lpm_hdl);
+	uint32_t entry;
+
+	entry = odp_atomic_load_acq_u32(&lpm->tbl[first_index(lpm, addr)]);
+
+	return match_ext(lpm, addr, entry, next_hop);
+}
+
+int odp_lpm_match_multi(odp_lpm_t lpm_hdl, const void *const addr[], uint32_t next_hop[],
+			uint8_t found[], int num)
+{
+	lpm_t *lpm = lpm_entry(lpm_hdl);
+	uint32_t idx[MATCH_BURST];
+	uint32_t entry[MATCH_BURST];
+	const uint8_t *a;
+	int num_found = 0;
+
+	for (int i = 0; i < num; i += MATCH_BURST) {
+		int burst = _ODP_MIN(num - i, MATCH_BURST);
+
+		/* Prefetch first level entries of all addresses */
+		for (int j = 0; j < burst; j++) {
+			idx[j] = first_index(lpm, addr[i + j]);
+			odp_prefetch(&lpm->tbl[idx[j]]);
+		}
+
+		/* Prefetch extension table entries */
+		for (int j = 0; j < burst; j++) {
+			entry[j] = odp_atomic_load_acq_u32(&lpm->tbl[idx[j]]);
+
+			if (odp_unlikely(entry[j] & ENTRY_EXT)) {
+				a = addr[i + j];
+				odp_prefetch(&ext_table(lpm, entry[j])[a[lpm->first_bytes]]);
+			}
+		}
+
+		for (int j = 0; j < burst; j++) {
+			found[i + j] = match_ext(lpm, addr[i + j], entry[j], &next_hop[i + j]);
+			num_found += found[i + j];
+		}
+	}
+
+	return num_found;
+}
+
+static inline uint32_t rule_hash(lpm_t *lpm, const uint8_t *addr, uint32_t depth)
+{
+	return odp_hash_crc32c(addr, lpm->addr_len, depth) & lpm->rule_mask;
+}
+
+static void prefix_mask(lpm_t *lpm, uint8_t *out, const uint8_t *addr, uint32_t depth)
+{
+	uint32_t i;
+
+	for (i = 0; i < lpm->addr_len; i++) {
+		if (depth >= 8)
+			out[i] = addr[i];
+		else if (depth)
+			out[i] = addr[i] & (uint8_t)(0xff << (8 - depth));
+		else
+			out[i] = 0;
+
+		depth = depth >= 8 ? depth - 8 : 0;
+	}
+
+	for (; i < MAX_ADDR_LEN; i++)
+		out[i] = 0;
+}
+
+/* Find the rule of a masked prefix */
+static rule_t *rule_find(lpm_t *lpm, const uint8_t *addr, uint32_t depth)
+{
+	uint32_t i = rule_hash(lpm, addr, depth);
+	rule_t *rule;
+
+	while (1) {
+		rule = &lpm->rule[i];
+
+		if (!rule->used)
+			return NULL;
+
+		if (rule->depth == depth && memcmp(rule->addr, addr, lpm->addr_len) == 0)
+			return rule;
+
+		i = (i + 1) & lpm->rule_mask;
+	}
+}
+
+static rule_t *rule_insert(lpm_t *lpm, const uint8_t *addr, uint32_t depth, uint32_t next_hop)
+{
+	uint32_t i = rule_hash(lpm, addr, depth);
+
+	while (lpm->rule[i].used)
+		i = (i + 1) & lpm->rule_mask;
+
+	memcpy(lpm->rule[i].addr, addr, MAX_ADDR_LEN);
+	lpm->rule[i].depth    = depth;
+	lpm->rule[i].next_hop = next_hop;
+	lpm->rule[i].used     = 1;
+	lpm->num_routes++;
+
+	return &lpm->rule[i];
+}
+
+/* Linear probing removal with backward shift. Rules that cannot be found from their home
+ * slot anymore are moved into the freed slot. */
+static void rule_remove(lpm_t *lpm, rule_t *rule)
+{
+	uint32_t mask = lpm->rule_mask;
+	uint32_t i = rule - lpm->rule;
+	uint32_t j = i;
+	uint32_t home;
+
+	while (1) {
+		j = (j + 1) & mask;
+
+		if (!lpm->rule[j].used)
+			break;
+
+		home = rule_hash(lpm, lpm->rule[j].addr, lpm->rule[j].depth);
+
+		/* Move when home slot is cyclically outside of (i, j] */
+		if (((j - home) & mask) >= ((j - i) & mask)) {
+			lpm->rule[i] = lpm->rule[j];
+			i = j;
+		}
+	}
+
+	lpm->rule[i].used = 0;
+	lpm->num_routes--;
+}
+
+/* Find the longest rule that covers the prefix, excluding the prefix itself */
+static rule_t *rule_find_parent(lpm_t *lpm, const uint8_t *addr, uint32_t depth)
+{
+	uint8_t masked[MAX_ADDR_LEN];
+	rule_t *rule;
+
+	while (depth > 0) {
+		depth--;
+		prefix_mask(lpm, masked, addr, depth);
+
+		rule = rule_find(lpm, masked, depth);
+		if (rule)
+			return rule;
+	}
+
+	return NULL;
+}
+
+static int ext_alloc(lpm_t *lpm, uint32_t *ext_idx)
+{
+	uint64_t token;
+
+	if (lpm->num_ext_free == 0)
+		return -1;
+
+	/* Oldest free table may still be in use by readers */
+	token = lpm->ext_token[lpm->ext_head];
+	if (token && !odp_qsbr_check(lpm->qsbr, token, false)) {
+		_ODP_DBG("Extension tables waiting for grace period\n");
+		return -1;
+	}
+
+	*ext_idx = lpm->ext_free[lpm->ext_head];
+	lpm->ext_head = (lpm->ext_head + 1) % lpm->num_ext;
+	lpm->num_ext_free--;
+
+	return 0;
+}
+
+static void ext_free(lpm_t *lpm, uint32_t ext_idx)
+{
+	/* The table has been unlinked. Readers that loaded the old entry before this may still
+	 * access the table until the grace period has ended. */
+	lpm->ext_token[lpm->ext_tail] = odp_qsbr_start(lpm->qsbr);
+	lpm->ext_free[lpm->ext_tail] = ext_idx;
+	lpm->ext_tail = (lpm->ext_tail + 1) % lpm->num_ext;
+	lpm->num_ext_free++;
+}
+
+/* Replace an extension table with a single entry, when all its entries are equal */
+static void ext_collapse(lpm_t *lpm, odp_atomic_u32_t *entry)
+{
+	uint32_t e = odp_atomic_load_u32(entry);
+	odp_atomic_u32_t *ext;
+	uint32_t first;
+
+	/* Unused tables cannot be recycled safely without a QSBR domain */
+	if (lpm->qsbr == ODP_QSBR_INVALID || !(e & ENTRY_EXT))
+		return;
+
+	ext = ext_table(lpm, e);
+	first = odp_atomic_load_u32(&ext[0]);
+
+	if (first & ENTRY_EXT)
+		return;
+
+	for (uint32_t i = 1; i < EXT_SIZE; i++) {
+		if (odp_atomic_load_u32(&ext[i]) != first)
+			return;
+	}
+
+	odp_atomic_store_rel_u32(entry, first);
+	ext_free(lpm, e & ENTRY_VALUE_MASK);
+}
+
+/* Update a single entry, and all entries of extension tables below it. When adding, entries
+ * of shorter or equal prefixes are replaced. When deleting, entries of the deleted prefix
+ * are replaced. */
+static void entry_update(lpm_t *lpm, odp_atomic_u32_t *entry, uint32_t depth, uint32_t new,
+			 int del)
+{
+	uint32_t e = odp_atomic_load_u32(entry);
+
+	if (e & ENTRY_EXT) {
+		odp_atomic_u32_t *ext = ext_table(lpm, e);
+
+		for (uint32_t i = 0; i < EXT_SIZE; i++)
+			entry_update(lpm, &ext[i], depth, new, del);
+
+		ext_collapse(lpm, entry);
+		return;
+	}
+
+	if (del) {
+		if ((e & ENTRY_VALID) && entry_depth(e) == depth)
+			odp_atomic_store_rel_u32(entry, new);
+	} else {
+		if (!(e & ENTRY_VALID) || entry_depth(e) <= depth)
+			odp_atomic_store_rel_u32(entry, new);
+	}
+}
+
+/* Update all entries covered by the prefix at a trie level */
+static int range_update(lpm_t *lpm, odp_atomic_u32_t *tbl, uint32_t level, const uint8_t *addr,
+			uint32_t depth, uint32_t new, int del)
+{
+	uint32_t start, bits, idx, e, ext_idx;
+	odp_atomic_u32_t *ext;
+	int ret;
+
+	if (level == 0) {
+		start = 0;
+		bits  = lpm->first_bits;
+		idx   = first_index(lpm, addr);
+	} else {
+		start = lpm->first_bits + (level - 1) * EXT_BITS;
+		bits  = EXT_BITS;
+		idx   = addr[lpm->first_bytes + level - 1];
+	}
+
+	if (depth <= start + bits) {
+		uint32_t num = 1u << (start + bits - depth);
+		uint32_t first = idx & ~(num - 1);
+
+		for (uint32_t i = first; i < first + num; i++)
+			entry_update(lpm, &tbl[i], depth, new, del);
+
+		return 0;
+	}
+
+	e = odp_atomic_load_u32(&tbl[idx]);
+
+	if (!(e & ENTRY_EXT)) {
+		/* Nothing to delete under a leaf entry */
+		if (del)
+			return 0;
+
+		if (ext_alloc(lpm, &ext_idx)) {
+			_ODP_DBG("Out of extension tables\n");
+			return -1;
+		}
+
+		/* Extension table inherits the current entry. Publish it after it has been
+		 * initialized. */
+		ext = &lpm->ext[ext_idx * EXT_SIZE];
+
+		for (uint32_t i = 0; i < EXT_SIZE; i++)
+			odp_atomic_store_u32(&ext[i], e);
+
+		e = ENTRY_EXT | ext_idx;
+		odp_atomic_store_rel_u32(&tbl[idx], e);
+	}
+
+	ret = range_update(lpm, ext_table(lpm, e), level + 1, addr, depth, new, del);
+
+	ext_collapse(lpm, &tbl[idx]);
+
+	return ret;
+}
+
+int odp_lpm_route_add(odp_lpm_t lpm_hdl, const void *prefix, uint8_t prefix_len,
+		      uint32_t next_hop)
+{
+	lpm_t *lpm = lpm_entry(lpm_hdl);
+	uint8_t addr[MAX_ADDR_LEN];
+	uint32_t old_next_hop = 0;
+	rule_t *rule;
+	int new_rule = 0;
+
+	if (odp_unlikely(prefix_len > lpm->max_depth || next_hop > MAX_NEXT_HOP)) {
+		_ODP_ERR("Bad prefix length (%u) or next hop (%" PRIu32 ")\n", prefix_len,
+			 next_hop);
+		return -1;
+	}
+
+	prefix_mask(lpm, addr, prefix, prefix_len);
+
+	odp_ticketlock_lock(&lpm->lock);
+
+	rule = rule_find(lpm, addr, prefix_len);
+
+	if (rule) {
+		old_next_hop = rule->next_hop;
+		rule->next_hop = next_hop;
+	} else {
+		if (lpm->num_routes >= lpm->max_routes) {
+			odp_ticketlock_unlock(&lpm->lock);
+			_ODP_DBG("LPM table full\n");
+			return -1;
+		}
+
+		rule = rule_insert(lpm, addr, prefix_len, next_hop);
+		new_rule = 1;
+	}
+
+	if (range_update(lpm, lpm->tbl, 0, addr, prefix_len, entry_make(prefix_len, next_hop),
+			 0)) {
+		if (new_rule)
+			rule_remove(lpm, rule);
+		else
+			rule->next_hop = old_next_hop;
+
+		odp_ticketlock_unlock(&lpm->lock);
+		return -1;
+	}
+
+	odp_ticketlock_unlock(&lpm->lock);
+
+	return 0;
+}
+
+int odp_lpm_route_del(odp_lpm_t lpm_hdl, const void *prefix, uint8_t prefix_len)
+{
+	lpm_t *lpm = lpm_entry(lpm_hdl);
+	uint8_t addr[MAX_ADDR_LEN];
+	rule_t *rule, *parent;
+	uint32_t new = 0;
+
+	if (odp_unlikely(prefix_len > lpm->max_depth)) {
+		_ODP_ERR("Bad prefix length: %u\n", prefix_len);
+		return -1;
+	}
+
+	prefix_mask(lpm, addr, prefix, prefix_len);
+
+	odp_ticketlock_lock(&lpm->lock);
+
+	rule = rule_find(lpm, addr, prefix_len);
+
+	if (rule == NULL) {
+		odp_ticketlock_unlock(&lpm->lock);
+		return -1;
+	}
+
+	/* Entries of the deleted route are replaced with the next longest matching route */
+	parent = rule_find_parent(lpm, addr, prefix_len);
+	if (parent)
+		new = entry_make(parent->depth, parent->next_hop);
+
+	range_update(lpm, lpm->tbl, 0, addr, prefix_len, new, 1);
+	rule_remove(lpm, rule);
+
+	odp_ticketlock_unlock(&lpm->lock);
+
+	return 0;
+}
+
+uint32_t odp_lpm_route_count(odp_lpm_t lpm_hdl)
+{
+	lpm_t *lpm = lpm_entry(lpm_hdl);
+
+	return lpm->num_routes;
+}
+
+void odp_lpm_print(odp_lpm_t lpm_hdl)
+{
+	lpm_t *lpm = lpm_entry(lpm_hdl);
+
+	if (lpm_hdl == ODP_LPM_INVALID) {
+		_ODP_ERR("Bad LPM table handle\n");
+		return;
+	}
+
+	_ODP_PRINT("\nLPM table info\n");
+	_ODP_PRINT("--------------\n");
+	_ODP_PRINT("  handle          0x%" PRIx64 "\n", odp_lpm_to_u64(lpm_hdl));
+	_ODP_PRINT("  name            %s\n", lpm->name);
+	_ODP_PRINT("  index           %i\n", lpm->index);
+	_ODP_PRINT("  type            %s\n", lpm->type == ODP_LPM_IPV4 ? "IPv4" : "IPv6");
+	_ODP_PRINT("  first stride    %u bits\n", lpm->first_bits);
+	_ODP_PRINT("  max routes      %u\n", lpm->max_routes);
+	_ODP_PRINT("  routes          %u\n", lpm->num_routes);
+	_ODP_PRINT("  ext tables      %u\n", lpm->num_ext);
+	_ODP_PRINT("  ext tables used %u\n", lpm->num_ext - lpm->num_ext_free);
+	_ODP_PRINT("  qsbr domain     0x%" PRIx64 "\n", odp_qsbr_to_u64(lpm->qsbr));
+	_ODP_PRINT("  rule slots      %u\n", lpm->rule_mask + 1);
+	_ODP_PRINT("\n");
+}
@@ -6,6 +6,7 @@
 
 #include <odp/api/atomic.h>
 #include <odp/api/buffer.h>
+#include <odp/api/cpu.h>
 #include <odp/api/event.h>
 #include <odp/api/hints.h>
 #include <odp/api/ml.h>
@@ -14,6 +15,7 @@
 #include <odp/api/shared_memory.h>
 #include <odp/api/std_types.h>
 #include <odp/api/ticketlock.h>
+#include <odp/api/time.h>
 
 #include <odp/api/plat/event_inline_types.h>
 #include <odp/api/plat/strong_types.h>
@@ -34,9 +36,12 @@
 #pragma GCC diagnostic pop
 
 #include <inttypes.h>
+#include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #define ML_MAX_IO_SEGS UINT32_MAX
 #define ML_MAX_COMPL_ID 32
@@ -45,6 +50,13 @@
 #define ML_MAX_MODELS_CREATED CONFIG_ML_MAX_MODELS
 #define ML_MAX_MODELS_LOADED CONFIG_ML_MAX_MODELS
 #define ML_MAX_ENGINES 1
+#define ML_MAX_WORKERS CONFIG_ML_MAX_MODELS
+
+/* Per model queue size of asynchronous run requests (power of two) */
+#define ML_BATCH_QUEUE_SIZE 64
+
+/* Batch worker sleep time when there are no requests to run */
+#define ML_WORKER_SLEEP_NS (10 * ODP_TIME_USEC_IN_NS)
 
 /* Error codes */
 enum {
@@ -87,6 +99,33 @@ typedef struct ort_run_opts_t {
 	char opt_model_filepath[ML_MAX_CONFIG_STR_LEN];
 } ort_run_opts_t;
 
+typedef struct ml_batch_opts_t {
+	/* Number of batch worker threads, 0 when disabled */
+	int num_workers;
+
+	/* Maximum wait time for more requests */
+	uint64_t max_wait_ns;
+
+	/* Maximum number of samples in a coalesced run */
+	uint32_t max_size;
+} ml_batch_opts_t;
+
+/* Queued asynchronous run request */
+typedef struct ml_request_t {
+	odp_ml_compl_param_t	compl_param;
+	uint32_t		batch_size;
+	uint64_t		enq_ns;
+	odp_ml_data_seg_t	input_seg[CONFIG_ML_MAX_INPUTS];
+	odp_ml_data_seg_t	output_seg[CONFIG_ML_MAX_OUTPUTS];
+} ml_request_t;
+
+/* Poll mode run status */
+enum {
+	ML_RUN_DONE = 0,
+	ML_RUN_PENDING,
+	ML_RUN_FAILED
+};
+
 typedef struct ml_input_t {
 	/* Combined input start address */
 	void *addr;
@@ -118,9 +157,32 @@ typedef struct ml_model_t {
 
 	struct {
 		void *user_ptr;
+		uint64_t error_code;
+		odp_atomic_u32_t status;
 	} result[ML_MAX_COMPL_ID + 1];
+
+	/* Asynchronous run requests waiting for a batch worker. Head and tail are
+	 * guarded by the model lock. */
+	struct {
+		odp_atomic_u32_t	num;
+		uint32_t		head;
+		uint32_t		tail;
+		/* Maximum coalesced batch size, 0 when requests are run one by one */
+		uint32_t		max_size;
+		/* Tensor memory of coalesced runs. Allocated on model load for max_size
+		 * samples, and used only by the batch worker of the model. */
+		void			*mem;
+		void			*input[CONFIG_ML_MAX_INPUTS];
+		void			*output[CONFIG_ML_MAX_OUTPUTS];
+		ml_request_t		req[ML_BATCH_QUEUE_SIZE];
+	} batch;
 } ml_model_t;
 
+typedef struct ml_worker_t {
+	pthread_t	thread;
+	uint32_t	idx;
+} ml_worker_t;
+
 typedef struct ml_global_t {
 	odp_shm_t		shm;
 
@@ -132,6 +194,11 @@ typedef struct ml_global_t {
 	const OrtApi		*ort_api;
 	OrtEnv			*env;
 	ort_run_opts_t		ort_run_opts;
+	ml_batch_opts_t		batch_opts;
+
+	odp_atomic_u32_t	worker_stop;
+	int			num_workers_started;
+	ml_worker_t		workers[ML_MAX_WORKERS];
 
 	ml_model_t		models[ML_MAX_MODELS_CREATED];
 
@@ -855,6 +922,116 @@ static int check_io_shape(ml_model_t *mdl)
 	return 0;
 }
 
+static inline uint32_t batch_shape_max(const odp_ml_shape_info_t *shape, uint32_t max_size)
+{
+	/* Only a dynamic first dimension can be concatenated */
+	if (shape->type != ODP_ML_SHAPE_BATCH || shape->dim[0] != ODP_ML_DIM_DYNAMIC)
+		return 0;
+
+	if (shape->dim_max[0] && shape->dim_max[0] < max_size)
+		return shape->dim_max[0];
+
+	return max_size;
+}
+
+/* Maximum batch size of coalesced runs, or 0 when requests cannot be coalesced */
+static uint32_t batch_size_max(const ml_model_t *mdl)
+{
+	uint32_t max_size = _odp_ml_glb->batch_opts.max_size;
+
+	if (!_odp_ml_glb->batch_opts.num_workers)
+		return 0;
+
+	for (uint32_t i = 0; i < mdl->info.num_inputs; i++)
+		max_size = batch_shape_max(&mdl->input_info[i].shape, max_size);
+
+	for (uint32_t i = 0; i < mdl->info.num_outputs; i++)
+		max_size = batch_shape_max(&mdl->output_info[i].shape, max_size);
+
+	return max_size;
+}
+
+static void ml_shape_to_int64(const odp_ml_shape_info_t *shape, uint32_t batch_size, int64_t *array)
+{
+	for (uint32_t i = 0; i < shape->num_dim; i++) {
+		/* Replace dynamic dimension size with provided batch_size */
+		if (shape->dim[i] == ODP_ML_DIM_DYNAMIC)
+			array[i] = batch_size;
+		else
+			array[i] = shape->dim[i];
+	}
+}
+
+/* Get the number of elements in given shape */
+static inline uint64_t get_num_elem(uint32_t batch_size, const odp_ml_shape_info_t *shape)
+{
+	uint64_t num_elements = 1;
+	int64_t dim[ODP_ML_MAX_DIMS] = {0};
+
+	ml_shape_to_int64(shape, batch_size, dim);
+
+	for (uint32_t i = 0; i < shape->num_dim; i++)
+		num_elements *= (uint64_t)dim[i];
+
+	return num_elements;
+}
+
+/* Allocate tensor memory for the maximum size coalesced run */
+static int batch_mem_alloc(ml_model_t *mdl)
+{
+	uint32_t max_size = mdl->batch.max_size;
+	uint64_t size[CONFIG_ML_MAX_INPUTS + CONFIG_ML_MAX_OUTPUTS];
+	uint64_t total = 0;
+	uint32_t num = 0;
+	uint8_t *addr;
+
+	if (!max_size)
+		return 0;
+
+	for (uint32_t i = 0; i < mdl->info.num_inputs; i++) {
+		const odp_ml_input_info_t *info = &mdl->input_info[i];
+
+		size[num] = _ODP_ROUNDUP_CACHE_LINE(info->data_type_size *
+						    get_num_elem(max_size, &info->shape));
+		total += size[num++];
+	}
+
+	for (uint32_t i = 0; i < mdl->info.num_outputs; i++) {
+		const odp_ml_output_info_t *info = &mdl->output_info[i];
+
+		size[num] = _ODP_ROUNDUP_CACHE_LINE(info->data_type_size *
+						    get_num_elem(max_size, &info->shape));
+		total += size[num++];
+	}
+
+	mdl->batch.mem = aligned_alloc(ODP_CACHE_LINE_SIZE, total);
+	if (!mdl->batch.mem) {
+		_ODP_ERR("Allocating %" PRIu64 " bytes of tensor memory failed\n", total);
+		return -1;
+	}
+
+	addr = mdl->batch.mem;
+	num = 0;
+
+	for (uint32_t i = 0; i < mdl->info.num_inputs; i++) {
+		mdl->batch.input[i] = addr;
+		addr += size[num++];
+	}
+
+	for (uint32_t i = 0; i < mdl->info.num_outputs; i++) {
+		mdl->batch.output[i] = addr;
+		addr += size[num++];
+	}
+
+	return 0;
+}
+
+static void batch_mem_free(ml_model_t *mdl)
+{
+	free(mdl->batch.mem);
+	mdl->batch.mem = NULL;
+}
+
 odp_ml_model_t odp_ml_model_create(const char *name, const odp_ml_model_param_t *param)
 {
 	OrtStatus *status;
@@ -973,6 +1150,7 @@ odp_ml_model_t odp_ml_model_create(const char *name, const odp_ml_model_param_t
 		_odp_strcpy(info->name, name, ODP_ML_MODEL_NAME_LEN);
 
 	mdl->max_compl_id = param->max_compl_id;
+	mdl->batch.max_size = batch_size_max(mdl);
 
 	odp_ticketlock_unlock(&mdl->lock);
 	return (odp_ml_model_t)mdl;
@@ -1489,6 +1667,12 @@ int odp_ml_model_load(odp_ml_model_t model, odp_ml_load_result_t *result)
 		goto load_fail;
 	}
 
+	if (odp_unlikely(batch_mem_alloc(mdl))) {
+		odp_ticketlock_unlock(&mdl->lock);
+		result_local.error_code = ML_LIB_FAILED;
+		goto load_fail;
+	}
+
 	mdl->state = ML_STATE_LOADED;
 	odp_ticketlock_unlock(&mdl->lock);
 	ret = 0;
@@ -1633,14 +1817,17 @@ int odp_ml_model_unload(odp_ml_model_t model, odp_ml_load_result_t *result)
 
 	odp_ticketlock_lock(&mdl->lock);
 	/* mdl->state == ML_STATE_FREE, ML_STATE_CREATED, ML_STATE_INFERENCING */
-	if (odp_unlikely(mdl->state != ML_STATE_LOADED)) {
+	if (odp_unlikely(mdl->state != ML_STATE_LOADED ||
+			 odp_atomic_load_u32(&mdl->batch.num))) {
 		_ODP_ERR("Model has not been created/loaded or inferencing has not finished yet\n");
 		odp_ticketlock_unlock(&mdl->lock);
 		result_local.error_code = ML_NOT_LOADED;
 		goto unload_fail;
 	}
 
+	/* Batch worker checks the state before using tensor memory */
 	mdl->state = ML_STATE_CREATED;
+	batch_mem_free(mdl);
 	odp_ticketlock_unlock(&mdl->lock);
 
 	ret = 0;
@@ -1705,31 +1892,6 @@ void odp_ml_run_param_init(odp_ml_run_param_t *param)
 	memset(param, 0, sizeof(odp_ml_run_param_t));
 }
 
-static void ml_shape_to_int64(const odp_ml_shape_info_t *shape, uint32_t batch_size, int64_t *array)
-{
-	for (uint32_t i = 0; i < shape->num_dim; i++) {
-		/* Replace dynamic dimension size with provided batch_size */
-		if (shape->dim[i] == ODP_ML_DIM_DYNAMIC)
-			array[i] = batch_size;
-		else
-			array[i] = shape->dim[i];
-	}
-}
-
-/* Get the number of elements in given shape */
-static inline uint64_t get_num_elem(uint32_t batch_size, const odp_ml_shape_info_t *shape)
-{
-	uint64_t num_elements = 1;
-	int64_t dim[ODP_ML_MAX_DIMS] = {0};
-
-	ml_shape_to_int64(shape, batch_size, dim);
-
-	for (uint32_t i = 0; i < shape->num_dim; i++)
-		num_elements *= (uint64_t)dim[i];
-
-	return num_elements;
-}
-
 static inline uint32_t dyn_io_size(const odp_ml_shape_info_t *shape, uint32_t data_type_size,
 				   const odp_ml_run_param_t *param)
 {
@@ -2412,6 +2574,112 @@ int odp_ml_run_multi(odp_ml_model_t model, const odp_ml_data_t data[],
 	return i;
 }
 
+/* Report run completion in event or poll mode */
+static int ml_run_compl(ml_model_t *mdl, const odp_ml_compl_param_t *compl_param,
+			uint64_t error_code)
+{
+	/* Send a completion event to the given queue */
+	if (compl_param->mode == ODP_ML_COMPL_MODE_EVENT) {
+		odp_ml_run_result_t *result;
+		odp_buffer_t buf = (odp_buffer_t)(uintptr_t)compl_param->event;
+
+		_odp_buffer_subtype_set(buf, ODP_EVENT_ML_COMPL_RUN);
+
+		result = odp_buffer_addr(buf);
+		result->error_code = error_code;
+		result->user_ptr = compl_param->user_ptr;
+
+		if (odp_unlikely(odp_queue_enq(compl_param->queue, compl_param->event))) {
+			_ODP_ERR("Completion event enqueue failed %" PRIu64 "\n",
+				 odp_queue_to_u64(compl_param->queue));
+			return -1;
+		}
+
+		return 0;
+	}
+
+	/* compl_param->mode == ODP_ML_COMPL_MODE_POLL */
+	mdl->result[compl_param->compl_id].user_ptr = compl_param->user_ptr;
+	mdl->result[compl_param->compl_id].error_code = error_code;
+	odp_atomic_store_rel_u32(&mdl->result[compl_param->compl_id].status,
+				 error_code ? ML_RUN_FAILED : ML_RUN_DONE);
+
+	return 0;
+}
+
+/* Check if a run request can be passed to a batch worker. Requests with segmented data and
+ * requests that do not fit into a coalesced batch are run synchronously. */
+static odp_bool_t ml_request_queueable(const ml_model_t *mdl, const odp_ml_data_t *data,
+				       const odp_ml_run_param_t *run_param)
+{
+	uint32_t batch_size = run_param ? run_param->batch_size : 0;
+
+	if (data->num_input_seg != mdl->info.num_inputs ||
+	    data->num_output_seg != mdl->info.num_outputs)
+		return false;
+
+	if (!mdl->batch.max_size)
+		return true;
+
+	if (!batch_size || batch_size > mdl->batch.max_size)
+		return false;
+
+	for (uint32_t i = 0; i < mdl->info.num_inputs; i++) {
+		const odp_ml_input_info_t *info = &mdl->input_info[i];
+
+		if (data->input_seg[i].size !=
+		    info->data_type_size * get_num_elem(batch_size, &info->shape))
+			return false;
+	}
+
+	for (uint32_t i = 0; i < mdl->info.num_outputs; i++) {
+		const odp_ml_output_info_t *info = &mdl->output_info[i];
+
+		if (data->output_seg[i].size <
+		    info->data_type_size * get_num_elem(batch_size, &info->shape))
+			return false;
+	}
+
+	return true;
+}
+
+static int ml_request_enq(ml_model_t *mdl, const odp_ml_data_t *data,
+			  const odp_ml_compl_param_t *compl_param,
+			  const odp_ml_run_param_t *run_param)
+{
+	ml_request_t *req;
+
+	odp_ticketlock_lock(&mdl->lock);
+
+	if (odp_unlikely(mdl->state != ML_STATE_LOADED && mdl->state != ML_STATE_INFERENCING)) {
+		_ODP_ERR("Wrong model state: not created or not loaded\n");
+		odp_ticketlock_unlock(&mdl->lock);
+		return -1;
+	}
+
+	if (odp_unlikely(mdl->batch.tail - mdl->batch.head == ML_BATCH_QUEUE_SIZE)) {
+		odp_ticketlock_unlock(&mdl->lock);
+		return 0;
+	}
+
+	req = &mdl->batch.req[mdl->batch.tail & (ML_BATCH_QUEUE_SIZE - 1)];
+	req->compl_param = *compl_param;
+	req->batch_size = run_param ? run_param->batch_size : 0;
+	req->enq_ns = odp_time_global_ns();
+	memcpy(req->input_seg, data->input_seg, data->num_input_seg * sizeof(odp_ml_data_seg_t));
+	memcpy(req->output_seg, data->output_seg,
+	       data->num_output_seg * sizeof(odp_ml_data_seg_t));
+
+	if (compl_param->mode == ODP_ML_COMPL_MODE_POLL)
+		odp_atomic_store_u32(&mdl->result[compl_param->compl_id].status, ML_RUN_PENDING);
+
+	mdl->batch.tail++;
+	odp_atomic_inc_u32(&mdl->batch.num);
+	odp_ticketlock_unlock(&mdl->lock);
+
+	return 1;
+}
+
 int odp_ml_run_start(odp_ml_model_t model, const odp_ml_data_t *data,
 		     const odp_ml_compl_param_t *compl_param,
 		     const odp_ml_run_param_t *run_param)
@@ -2435,33 +2703,22 @@ int odp_ml_run_start(odp_ml_model_t model, const odp_ml_data_t *data,
 		return -1;
 	}
 
+	/* Pass the request to a batch worker */
+	if (_odp_ml_glb->batch_opts.num_workers && data &&
+	    ml_request_queueable(mdl, data, run_param)) {
+		if (ODP_DEBUG && verify_run_params(model, data, run_param))
+			return -1;
+
+		return ml_request_enq(mdl, data, compl_param, run_param);
+	}
+
 	ret = odp_ml_run(model, data, run_param);
 
 	if (odp_unlikely(ret < 1))
 		return ret;
 
-	/* Send a completion event to the given queue */
-	if (compl_param->mode == ODP_ML_COMPL_MODE_EVENT) {
-		odp_ml_run_result_t *result;
-		odp_buffer_t buf = (odp_buffer_t)(uintptr_t)compl_param->event;
-
-		_odp_buffer_subtype_set(buf, ODP_EVENT_ML_COMPL_RUN);
-
-		result = odp_buffer_addr(buf);
-		result->error_code = 0;
-		result->user_ptr = compl_param->user_ptr;
-
-		if (odp_unlikely(odp_queue_enq(compl_param->queue, compl_param->event))) {
-			_ODP_ERR("Completion event enqueue failed %" PRIu64 "\n",
-				 odp_queue_to_u64(compl_param->queue));
-			return -1;
-		}
-
-		return 1;
-	}
-
-	/* compl_param->mode == ODP_ML_COMPL_MODE_POLL */
-	mdl->result[compl_param->compl_id].user_ptr = compl_param->user_ptr;
+	if (odp_unlikely(ml_run_compl(mdl, compl_param, 0)))
+		return -1;
 
 	return 1;
 }
@@ -2496,6 +2753,7 @@ int odp_ml_run_start_multi(odp_ml_model_t model, const odp_ml_data_t data[],
 
 int odp_ml_run_status(odp_ml_model_t model, uint32_t compl_id, odp_ml_run_result_t *result)
 {
+	uint32_t status;
 	ml_model_t *mdl = ml_model_from_handle(model);
 
 	if (odp_unlikely(model == ODP_ML_MODEL_INVALID ||
@@ -2504,12 +2762,304 @@ int odp_ml_run_status(odp_ml_model_t model, uint32_t compl_id, odp_ml_run_result
 		return -2;
 	}
 
+	status = odp_atomic_load_acq_u32(&mdl->result[compl_id].status);
+	if (status == ML_RUN_PENDING)
+		return 0;
+
 	if (result) {
-		result->error_code = 0;
+		result->error_code = mdl->result[compl_id].error_code;
 		result->user_ptr = mdl->result[compl_id].user_ptr;
 	}
 
-	return 1;
+	return status == ML_RUN_FAILED ? -1 : 1;
+}
+
+/* Run coalesced requests as one inference. Input data is concatenated along the first (batch)
+ * dimension into tensor memory of the model, and output tensors are split back to the
+ * requests. */
+static uint64_t ml_batch_infer(ml_model_t *mdl, OrtMemoryInfo *mem_info,
+			       const ml_request_t req[], uint32_t num, uint32_t batch_size)
+{
+	OrtStatus *status;
+	uint64_t error_code = 0;
+	ONNXTensorElementDataType onnx_dtype;
+	int64_t shape[ODP_ML_MAX_DIMS] = {0};
+	OrtValue *input_tensor[CONFIG_ML_MAX_INPUTS] = {0};
+	OrtValue *output_tensor[CONFIG_ML_MAX_OUTPUTS] = {0};
+	const char *input_names[CONFIG_ML_MAX_INPUTS] = {0};
+	const char *output_names[CONFIG_ML_MAX_OUTPUTS] = {0};
+	const OrtApi *ort_api = _odp_ml_glb->ort_api;
+	const odp_ml_model_info_t *ml_info = &mdl->info;
+
+	for (uint32_t i = 0; i < ml_info->num_inputs; i++) {
+		const odp_ml_input_info_t *info = &mdl->input_info[i];
+		uint64_t size = info->data_type_size * get_num_elem(batch_size, &info->shape);
+		uint8_t *addr = mdl->batch.input[i];
+
+		for (uint32_t r = 0; r < num; r++) {
+			memcpy(addr, req[r].input_seg[i].addr, req[r].input_seg[i].size);
+			addr += req[r].input_seg[i].size;
+		}
+
+		ml_shape_to_int64(&info->shape, batch_size, shape);
+		onnx_dtype = onnx_dtype_from_odp_dtype(info->data_type);
+		status = ort_api->CreateTensorWithDataAsOrtValue(mem_info, mdl->batch.input[i],
+								 size, shape, info->shape.num_dim,
+								 onnx_dtype, &input_tensor[i]);
+		if (check_ortstatus(status)) {
+			_ODP_ERR("CreateTensorWithDataAsOrtValue() failed\n");
+			error_code = ML_LIB_FAILED;
+			goto out;
+		}
+
+		input_names[i] = info->name;
+	}
+
+	/* Outputs are written directly into tensor memory of the model */
+	for (uint32_t i = 0; i < ml_info->num_outputs; i++) {
+		const odp_ml_output_info_t *info = &mdl->output_info[i];
+		uint64_t size = info->data_type_size * get_num_elem(batch_size, &info->shape);
+
+		ml_shape_to_int64(&info->shape, batch_size, shape);
+		onnx_dtype = onnx_dtype_from_odp_dtype(info->data_type);
+		status = ort_api->CreateTensorWithDataAsOrtValue(mem_info, mdl->batch.output[i],
+								 size, shape, info->shape.num_dim,
+								 onnx_dtype, &output_tensor[i]);
+		if (check_ortstatus(status)) {
+			_ODP_ERR("CreateTensorWithDataAsOrtValue() failed\n");
+			error_code = ML_LIB_FAILED;
+			goto out;
+		}
+
+		output_names[i] = info->name;
+	}
+
+	status = ort_api->Run(mdl->session,
+			      NULL,
+			      (const char * const *)input_names,
+			      (const OrtValue * const*)input_tensor,
+			      ml_info->num_inputs,
+			      (const char * const *)output_names,
+			      ml_info->num_outputs,
+			      output_tensor);
+
+	if (check_ortstatus(status)) {
+		_ODP_ERR("Run inference failed\n");
+		error_code = ML_LIB_FAILED;
+		goto out;
+	}
+
+	for (uint32_t i = 0; i < ml_info->num_outputs; i++) {
+		const odp_ml_output_info_t *info = &mdl->output_info[i];
+		uint64_t sample_size = info->data_type_size * get_num_elem(1, &info->shape);
+		const uint8_t *addr = mdl->batch.output[i];
+
+		for (uint32_t r = 0; r < num; r++) {
+			uint64_t size = sample_size * req[r].batch_size;
+
+			memcpy(req[r].output_seg[i].addr, addr, size);
+			addr += size;
+		}
+	}
+
+out:
+	for (uint32_t i = 0; i < ml_info->num_outputs; i++)
+		if (output_tensor[i])
+			ort_api->ReleaseValue(output_tensor[i]);
+
+	for (uint32_t i = 0; i < ml_info->num_inputs; i++)
+		if (input_tensor[i])
+			ort_api->ReleaseValue(input_tensor[i]);
+
+	return error_code;
+}
+
+static void ml_batch_run(ml_model_t *mdl, OrtMemoryInfo *mem_info, const ml_request_t req[],
+			 uint32_t num, uint32_t batch_size)
+{
+	uint64_t error_code = 0;
+
+	/* Wait for synchronous runs of the same model to finish */
+	while (1) {
+		odp_ticketlock_lock(&mdl->lock);
+
+		if (mdl->state == ML_STATE_LOADED) {
+			mdl->state = ML_STATE_INFERENCING;
+			odp_ticketlock_unlock(&mdl->lock);
+			break;
+		}
+
+		if (mdl->state != ML_STATE_INFERENCING) {
+			odp_ticketlock_unlock(&mdl->lock);
+			error_code = ML_NOT_LOADED;
+			break;
+		}
+
+		odp_ticketlock_unlock(&mdl->lock);
+		odp_cpu_pause();
+	}
+
+	if (!error_code) {
+		error_code = ml_batch_infer(mdl, mem_info, req, num, batch_size);
+
+		odp_ticketlock_lock(&mdl->lock);
+		mdl->state = ML_STATE_LOADED;
+		odp_ticketlock_unlock(&mdl->lock);
+	}
+
+	for (uint32_t r = 0; r < num; r++)
+		ml_run_compl(mdl, &req[r].compl_param, error_code);
+}
+
+/* Run a request, which is not coalesced with others */
+static void ml_single_run(ml_model_t *mdl, const ml_request_t *req)
+{
+	odp_ml_run_result_t result;
+	odp_ml_run_param_t param;
+	odp_ml_data_t data;
+	int ret;
+
+	memset(&result, 0, sizeof(result));
+	odp_ml_run_param_init(&param);
+	param.batch_size = req->batch_size;
+	param.result = &result;
+
+	data.num_input_seg = mdl->info.num_inputs;
+	data.input_seg = (odp_ml_data_seg_t *)(uintptr_t)req->input_seg;
+	data.num_output_seg = mdl->info.num_outputs;
+	data.output_seg = (odp_ml_data_seg_t *)(uintptr_t)req->output_seg;
+
+	while ((ret = odp_ml_run((odp_ml_model_t)mdl, &data, &param)) == 0)
+		odp_cpu_pause();
+
+	if (ret < 0 && !result.error_code)
+		result.error_code = ML_NOT_LOADED;
+
+	ml_run_compl(mdl, &req->compl_param, ret < 0 ? result.error_code : 0);
+}
+
+/* Dequeue and run requests of a model. Returns the number of requests run. */
+static uint32_t ml_batch_poll(ml_model_t *mdl, OrtMemoryInfo *mem_info)
+{
+	ml_request_t req[ML_BATCH_QUEUE_SIZE];
+	const ml_request_t *first;
+	uint32_t num, head, max_size;
+	uint32_t batch_size = 0;
+	uint32_t num_req = odp_atomic_load_u32(&mdl->batch.num);
+
+	if (!num_req)
+		return 0;
+
+	odp_ticketlock_lock(&mdl->lock);
+
+	head = mdl->batch.head;
+	max_size = mdl->batch.max_size;
+
+	if (!max_size) {
+		req[0] = mdl->batch.req[head & (ML_BATCH_QUEUE_SIZE - 1)];
+		mdl->batch.head++;
+		odp_atomic_dec_u32(&mdl->batch.num);
+		odp_ticketlock_unlock(&mdl->lock);
+
+		ml_single_run(mdl, &req[0]);
+		return 1;
+	}
+
+	for (num = 0; num < num_req; num++) {
+		const ml_request_t *cur = &mdl->batch.req[(head + num) & (ML_BATCH_QUEUE_SIZE - 1)];
+
+		if (batch_size + cur->batch_size > max_size)
+			break;
+
+		batch_size += cur->batch_size;
+	}
+
+	/* Wait for more requests until the batch is full or the oldest request has waited
+	 * long enough */
+	first = &mdl->batch.req[head & (ML_BATCH_QUEUE_SIZE - 1)];
+	if (num == num_req && batch_size < max_size &&
+	    odp_time_global_ns() - first->enq_ns < _odp_ml_glb->batch_opts.max_wait_ns) {
+		odp_ticketlock_unlock(&mdl->lock);
+		return 0;
+	}
+
+	for (uint32_t r = 0; r < num; r++)
+		req[r] = mdl->batch.req[(head + r) & (ML_BATCH_QUEUE_SIZE - 1)];
+
+	mdl->batch.head += num;
+	odp_atomic_sub_u32(&mdl->batch.num, num);
+	odp_ticketlock_unlock(&mdl->lock);
+
+	ml_batch_run(mdl, mem_info, req, num, batch_size);
+
+	return num;
+}
+
+static void *ml_batch_worker(void *arg)
+{
+	ml_worker_t *worker = arg;
+	OrtStatus *status;
+	OrtMemoryInfo *mem_info = NULL;
+	const OrtApi *ort_api = _odp_ml_glb->ort_api;
+	const uint32_t num_workers = _odp_ml_glb->batch_opts.num_workers;
+	const struct timespec ts = { .tv_sec = 0, .tv_nsec = ML_WORKER_SLEEP_NS };
+
+	status = ort_api->CreateCpuMemoryInfo(OrtArenaAllocator, OrtMemTypeDefault, &mem_info);
+	if (check_ortstatus(status)) {
+		_ODP_ERR("ML worker %u: CreateCpuMemoryInfo() failed\n", worker->idx);
+		return NULL;
+	}
+
+	while (!odp_atomic_load_u32(&_odp_ml_glb->worker_stop)) {
+		uint32_t num = 0;
+
+		/* Each worker serves a fixed subset of the models */
+		for (uint32_t i = worker->idx; i < ML_MAX_MODELS_CREATED; i += num_workers)
+			num += ml_batch_poll(&_odp_ml_glb->models[i], mem_info);
+
+		if (!num)
+			nanosleep(&ts, NULL);
+	}
+
+	ort_api->ReleaseMemoryInfo(mem_info);
+
+	return NULL;
+}
+
+static void ml_workers_stop(void)
+{
+	odp_atomic_store_u32(&_odp_ml_glb->worker_stop, 1);
+
+	for (int i = 0; i < _odp_ml_glb->num_workers_started; i++) {
+		int ret = pthread_join(_odp_ml_glb->workers[i].thread, NULL);
+
+		if (ret)
+			_ODP_ERR("Unable to join ML worker %d: %d\n", i, ret);
+	}
+
+	_odp_ml_glb->num_workers_started = 0;
+}
+
+static int ml_workers_start(void)
+{
+	odp_atomic_init_u32(&_odp_ml_glb->worker_stop, 0);
+
+	for (int i = 0; i < _odp_ml_glb->batch_opts.num_workers; i++) {
+		ml_worker_t *worker = &_odp_ml_glb->workers[i];
+		int ret;
+
+		worker->idx = i;
+		ret = pthread_create(&worker->thread, NULL, ml_batch_worker, worker);
+		if (ret) {
+			_ODP_ERR("Unable to create ML worker %d: %d\n", i, ret);
+			ml_workers_stop();
+			return -1;
+		}
+
+		_odp_ml_glb->num_workers_started++;
+	}
+
+	return 0;
 }
 
 static int opt_level_from_str(const char *level_str, GraphOptimizationLevel *level)
@@ -2540,8 +3090,9 @@ static int execution_mode_from_str(const char *mode_str, ExecutionMode *mode)
 	return 0;
 }
 
-static int read_config_file(ort_run_opts_t *opts)
+static int read_config_file(ort_run_opts_t *opts, ml_batch_opts_t *batch)
 {
+	int val;
 	const char *conf_str;
 	char mode_str[ML_MAX_CONFIG_STR_LEN];
 	char opt_level_str[ML_MAX_CONFIG_STR_LEN];
@@ -2602,6 +3153,53 @@ static int read_config_file(ort_run_opts_t *opts)
 	}
 	_ODP_PRINT("  %s: %s\n", conf_str, opts->opt_model_filepath);
 
+	conf_str =  "ml.batch_workers";
+	if (!_odp_libconfig_lookup_int(conf_str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", conf_str);
+		return -1;
+	}
+
+	if (val < 0 || val > ML_MAX_WORKERS) {
+		_ODP_ERR("Bad %s value: %i (max %i)\n", conf_str, val, ML_MAX_WORKERS);
+		return -1;
+	}
+
+	/* Workers are threads of the process calling odp_init_global(). They access input and
+	 * output data through application pointers, which are valid only in the address space
+	 * of the calling process. */
+	if (val > 0 && odp_global_ro.init_param.mem_model == ODP_MEM_MODEL_PROCESS) {
+		_ODP_ERR("%s must be 0 in process mode\n", conf_str);
+		return -1;
+	}
+	batch->num_workers = val;
+	_ODP_PRINT("  %s: %i\n", conf_str, val);
+
+	conf_str =  "ml.batch_max_wait_us";
+	if (!_odp_libconfig_lookup_int(conf_str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", conf_str);
+		return -1;
+	}
+
+	if (val < 0) {
+		_ODP_ERR("Bad %s value: %i\n", conf_str, val);
+		return -1;
+	}
+	batch->max_wait_ns = (uint64_t)val * ODP_TIME_USEC_IN_NS;
+	_ODP_PRINT("  %s: %i\n", conf_str, val);
+
+	conf_str =  "ml.batch_max_size";
+	if (!_odp_libconfig_lookup_int(conf_str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", conf_str);
+		return -1;
+	}
+
+	if (val < 1) {
+		_ODP_ERR("Bad %s value: %i\n", conf_str, val);
+		return -1;
+	}
+	batch->max_size = val;
+	_ODP_PRINT("  %s: %i\n", conf_str, val);
+
 	return 0;
 }
 
@@ -2636,7 +3234,7 @@ int _odp_ml_init_global(void)
 
 	odp_pool_param_init(&_odp_ml_glb->pool_param);
 
-	if (read_config_file(&_odp_ml_glb->ort_run_opts))
+	if (read_config_file(&_odp_ml_glb->ort_run_opts, &_odp_ml_glb->batch_opts))
 		goto error;
 
 	ort_api = OrtGetApiBase()->GetApi(ORT_API_VERSION);
@@ -2653,8 +3251,20 @@ int _odp_ml_init_global(void)
 	}
 	_odp_ml_glb->env = env;
 
-	for (i = 0; i < ML_MAX_MODELS_CREATED; i++)
-		odp_ticketlock_init(&_odp_ml_glb->models[i].lock);
+	for (i = 0; i < ML_MAX_MODELS_CREATED; i++) {
+		ml_model_t *mdl = &_odp_ml_glb->models[i];
+
+		odp_ticketlock_init(&mdl->lock);
+		odp_atomic_init_u32(&mdl->batch.num, 0);
+
+		for (int j = 0; j <= ML_MAX_COMPL_ID; j++)
+			odp_atomic_init_u32(&mdl->result[j].status, ML_RUN_DONE);
+	}
+
+	if (ml_workers_start()) {
+		ort_api->ReleaseEnv(env);
+		goto error;
+	}
 
 	return 0;
 
@@ -2673,6 +3283,11 @@ int _odp_ml_term_global(void)
 	if (_odp_ml_glb == NULL)
 		return 0;
 
+	ml_workers_stop();
+
+	for (uint32_t i = 0; i < ML_MAX_MODELS_CREATED; i++)
+		batch_mem_free(&_odp_ml_glb->models[i]);
+
 	if (_odp_ml_glb->env)
 		_odp_ml_glb->ort_api->ReleaseEnv(_odp_ml_glb->env);
 
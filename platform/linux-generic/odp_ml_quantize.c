@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: BSD-3-Clause
- * Copyright (c) 2023 Nokia
+ * Copyright (c) 2023-2026 Nokia
  * Copyright (c) 2024 Marvell
  */
 
@@ -8,6 +8,7 @@
 #include <odp_debug_internal.h>
 #include <odp_macros_internal.h>
 #include <odp_ml_fp16.h>
+#include <odp_ml_quantize_internal.h>
 
 #include <math.h>
 #include <stdint.h>
@@ -19,7 +20,9 @@ void odp_ml_fp32_to_uint8(uint8_t *u8, const float *fp32, uint32_t num, float sc
 
 	_ODP_ASSERT(scale < 0.0 || scale > 0.0);
 
-	for (uint32_t i = 0; i < num; i++) {
+	uint32_t i = _odp_ml_fp32_to_uint8_arch(u8, fp32, num, scale, zerop);
+
+	for (; i < num; i++) {
 		/* Range mapping: map real values to signed integer */
 		fval = nearbyintf(fp32[i] / scale) + (float)zerop;
 
@@ -33,7 +36,9 @@ void odp_ml_fp32_to_uint8(uint8_t *u8, const float *fp32, uint32_t num, float sc
 void odp_ml_fp32_from_uint8(float *fp32, const uint8_t *u8, uint32_t num, float scale,
 			    uint8_t zerop)
 {
-	for (uint32_t i = 0; i < num; i++)
+	uint32_t i = _odp_ml_fp32_from_uint8_arch(fp32, u8, num, scale, zerop);
+
+	for (; i < num; i++)
 		fp32[i] = (float)(u8[i] - zerop) * scale;
 }
 
@@ -43,7 +48,9 @@ void odp_ml_fp32_to_int8(int8_t *i8, const float *fp32, uint32_t num, float scal
 
 	_ODP_ASSERT(scale < 0.0 || scale > 0.0);
 
-	for (uint32_t i = 0; i < num; i++) {
+	uint32_t i = _odp_ml_fp32_to_int8_arch(i8, fp32, num, scale, zerop);
+
+	for (; i < num; i++) {
 		/* Range mapping: map real values to signed integer */
 		fval = nearbyintf(fp32[i] / scale) + (float)zerop;
 
@@ -59,7 +66,9 @@ void odp_ml_fp32_to_int8(int8_t *i8, const float *fp32, uint32_t num, float scal
 
 void odp_ml_fp32_from_int8(float *fp32, const int8_t *i8, uint32_t num, float scale, int8_t zerop)
 {
-	for (uint32_t i = 0; i < num; i++)
+	uint32_t i = _odp_ml_fp32_from_int8_arch(fp32, i8, num, scale, zerop);
+
+	for (; i < num; i++)
 		fp32[i] = (float)(i8[i] - zerop) * scale;
 }
 
@@ -70,7 +79,9 @@ void odp_ml_fp32_to_uint16(uint16_t *u16, const float *fp32, uint32_t num, float
 
 	_ODP_ASSERT(scale < 0.0 || scale > 0.0);
 
-	for (uint32_t i = 0; i < num; i++) {
+	uint32_t i = _odp_ml_fp32_to_uint16_arch(u16, fp32, num, scale, zerop);
+
+	for (; i < num; i++) {
 		/* Range mapping: map real values to signed integer */
 		fval = nearbyintf(fp32[i] / scale) + (float)zerop;
 
@@ -84,7 +95,9 @@ void odp_ml_fp32_to_uint16(uint16_t *u16, const float *fp32, uint32_t num, float
 void odp_ml_fp32_from_uint16(float *fp32, const uint16_t *u16, uint32_t num, float scale,
 			     uint16_t zerop)
 {
-	for (uint32_t i = 0; i < num; i++)
+	uint32_t i = _odp_ml_fp32_from_uint16_arch(fp32, u16, num, scale, zerop);
+
+	for (; i < num; i++)
 		fp32[i] = (float)(u16[i] - zerop) * scale;
 }
 
@@ -95,7 +108,9 @@ void odp_ml_fp32_to_int16(int16_t *i16, const float *fp32, uint32_t num, float s
 
 	_ODP_ASSERT(scale < 0.0 || scale > 0.0);
 
-	for (uint32_t i = 0; i < num; i++) {
+	uint32_t i = _odp_ml_fp32_to_int16_arch(i16, fp32, num, scale, zerop);
+
+	for (; i < num; i++) {
 		/* Range mapping: map real values to signed integer */
 		fval = nearbyintf(fp32[i] / scale) + (float)zerop;
 
@@ -112,22 +127,24 @@ void odp_ml_fp32_to_int16(int16_t *i16, const float *fp32, uint32_t num, float s
 void odp_ml_fp32_from_int16(float *fp32, const int16_t *i16, uint32_t num, float scale,
 			    int16_t zerop)
 {
-	for (uint32_t i = 0; i < num; i++)
+	uint32_t i = _odp_ml_fp32_from_int16_arch(fp32, i16, num, scale, zerop);
+
+	for (; i < num; i++)
 		fp32[i] = (float)(i16[i] - zerop) * scale;
 }
 
 void odp_ml_fp32_to_fp16(uint16_t *fp16, const float *fp32, uint32_t num)
 {
-	uint32_t i;
+	uint32_t i = _odp_ml_fp32_to_fp16_arch(fp16, fp32, num);
 
-	for (i = 0; i < num; i++)
+	for (; i < num; i++)
 		fp16[i] = _odp_float32_to_float16(fp32[i]);
 }
 
 void odp_ml_fp32_from_fp16(float *fp32, const uint16_t *fp16, uint32_t num)
 {
-	uint32_t i;
+	uint32_t i = _odp_ml_fp32_from_fp16_arch(fp32, fp16, num);
 
-	for (i = 0; i < num; i++)
+	for (; i < num; i++)
 		fp32[i] = _odp_float16_to_float32(fp16[i]);
 }
@@ -25,6 +25,7 @@
 #include <odp_packet_internal.h>
 #include <odp_packet_io_internal.h>
 #include <odp_pool_internal.h>
+#include <odp_proto_stats_internal.h>
 #include <odp_string_internal.h>
 
 /* Inlined API functions */
@@ -39,7 +40,6 @@
 #include <protocols/tcp.h>
 #include <protocols/udp.h>
 
-#include <errno.h>
 #include <string.h>
 #include <stdio.h>
 #include <inttypes.h>
@@ -69,6 +69,7 @@ const _odp_packet_inline_offset_t _odp_packet_inline ODP_ALIGNED_CACHE = {
 	.cls_mark       = offsetof(odp_packet_hdr_t, cls_mark),
 	.ipsec_ctx      = offsetof(odp_packet_hdr_t, ipsec_ctx),
 	.crypto_op      = offsetof(odp_packet_hdr_t, crypto_op_result),
+	.class_idx      = offsetof(odp_packet_hdr_t, event_hdr.class_idx),
 };
 
 #include <odp/visibility_end.h>
@@ -372,6 +373,13 @@ static inline void add_all_segs(odp_packet_hdr_t *to, odp_packet_hdr_t *from)
 	to->seg_count  += from->seg_count;
 }
 
+/* Allocation failures of packet length class pools are counted per request */
+static inline void packet_class_alloc_fail(pool_t *class_pool)
+{
+	if (CONFIG_POOL_STATISTICS && class_pool->params.stats.bit.alloc_fails)
+		odp_atomic_inc_u64(&class_pool->stats.alloc_fails);
+}
+
 static inline odp_packet_hdr_t *alloc_segments(pool_t *pool, int num)
 {
 	odp_packet_hdr_t *pkt_hdr[num];
@@ -383,6 +391,9 @@ static inline odp_packet_hdr_t *alloc_segments(pool_t *pool, int num)
 		if (ret > 0)
 			_odp_event_free_sp((_odp_event_hdr_t **)pkt_hdr, ret);
 
+		if (pool->num_class)
+			packet_class_alloc_fail(pool);
+
 		return NULL;
 	}
 
@@ -713,12 +724,79 @@ static inline odp_packet_t packet_alloc_single(pool_t *pool, uint32_t len, int n
 	return packet_handle(hdr);
 }
 
+/* Index of the best fitting packet length class */
+static inline uint32_t packet_class_idx(const pool_t *parent, uint32_t len)
+{
+	const uint32_t last = parent->num_class - 1;
+	uint32_t i = 0;
+
+	while (i < last && len > parent->class_pool[i]->seg_len)
+		i++;
+
+	return i;
+}
+
+/* Allocate packets from the best fitting packet length class. Larger classes are used when the
+ * best fitting class runs out of packets. */
+static int packet_alloc_class(pool_t *pool, uint32_t len, int max_num, odp_packet_t pkt[])
+{
+	const pool_t *parent = _odp_pool_entry(pool->parent);
+	const uint32_t last = parent->num_class - 1;
+	uint32_t first;
+	int num = 0;
+
+	if (odp_unlikely(len > parent->class_pool[last]->max_len || len == 0))
+		return -1;
+
+	first = packet_class_idx(parent, len);
+
+	for (uint32_t i = first; i <= last && num < max_num; i++) {
+		pool_t *class_pool = parent->class_pool[i];
+
+		num += packet_alloc(class_pool, len, max_num - num,
+				    num_segments(len, class_pool->seg_len), &pkt[num]);
+	}
+
+	if (odp_unlikely(num == 0))
+		packet_class_alloc_fail(parent->class_pool[first]);
+
+	return num;
+}
+
+static odp_packet_t packet_alloc_class_single(pool_t *pool, uint32_t len)
+{
+	const pool_t *parent = _odp_pool_entry(pool->parent);
+	const uint32_t last = parent->num_class - 1;
+	odp_packet_t pkt = ODP_PACKET_INVALID;
+	uint32_t first;
+
+	if (odp_unlikely(len > parent->class_pool[last]->max_len || len == 0))
+		return ODP_PACKET_INVALID;
+
+	first = packet_class_idx(parent, len);
+
+	for (uint32_t i = first; i <= last && pkt == ODP_PACKET_INVALID; i++) {
+		pool_t *class_pool = parent->class_pool[i];
+
+		pkt = packet_alloc_single(class_pool, len,
+					  num_segments(len, class_pool->seg_len));
+	}
+
+	if (odp_unlikely(pkt == ODP_PACKET_INVALID))
+		packet_class_alloc_fail(parent->class_pool[first]);
+
+	return pkt;
+}
+
 int _odp_packet_alloc_multi(odp_pool_t pool_hdl, uint32_t len,
 			    odp_packet_t pkt[], int max_num)
 {
 	pool_t *pool = _odp_pool_entry(pool_hdl);
 	int num, num_seg;
 
+	if (odp_unlikely(pool->num_class))
+		return _ODP_MAX(packet_alloc_class(pool, len, max_num, pkt), 0);
+
 	num_seg = num_segments(len, pool->seg_len);
 	num     = packet_alloc(pool, len, max_num, num_seg, pkt);
 
@@ -731,6 +809,9 @@ odp_packet_t odp_packet_alloc(odp_pool_t pool_hdl, uint32_t len)
 
 	_ODP_ASSERT(pool->type == ODP_POOL_PACKET);
 
+	if (odp_unlikely(pool->num_class))
+		return packet_alloc_class_single(pool, len);
+
 	if (odp_unlikely(len > pool->max_len || len == 0))
 		return ODP_PACKET_INVALID;
 
@@ -745,6 +826,9 @@ int odp_packet_alloc_multi(odp_pool_t pool_hdl, uint32_t len,
 
 	_ODP_ASSERT(pool->type == ODP_POOL_PACKET);
 
+	if (odp_unlikely(pool->num_class))
+		return packet_alloc_class(pool, len, max_num, pkt);
+
 	if (odp_unlikely(len > pool->max_len || len == 0))
 		return -1;
 
@@ -791,6 +875,28 @@ static inline int free_segmented(const odp_packet_t pkt[], int num, odp_packet_h
 	return num_freed;
 }
 
+/* Check if all packets are single segment packets without references. Packet headers are
+ * stored into 'pkt_hdrs' array. Debug builds count references of all packets, so those always
+ * use the generic free path. */
+static inline int free_is_simple(const odp_packet_t pkt[], int num, odp_packet_hdr_t *pkt_hdrs[])
+{
+	uint32_t complex = 0;
+
+	if (ODP_DEBUG == 1)
+		return 0;
+
+	/* No per packet branches */
+	for (int i = 0; i < num; i++) {
+		odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt[i]);
+
+		pkt_hdrs[i] = pkt_hdr;
+		complex |= (uint32_t)(pkt_hdr->seg_count - 1) | pkt_hdr->seg_indirect |
+			   segment_ref(pkt_hdr);
+	}
+
+	return complex == 0;
+}
+
 void odp_packet_free_multi(const odp_packet_t pkt[], int num)
 {
 	if (odp_unlikely(num < 1))
@@ -800,6 +906,11 @@ void odp_packet_free_multi(const odp_packet_t pkt[], int num)
 
 	_odp_packet_validate_multi(pkt, num, _ODP_EV_PACKET_FREE_MULTI);
 
+	if (odp_likely(free_is_simple(pkt, num, pkt_hdrs))) {
+		_odp_event_free_multi((_odp_event_hdr_t **)(uintptr_t)pkt_hdrs, num);
+		return;
+	}
+
 	num -= free_segmented(pkt, num, pkt_hdrs);
 	if (odp_likely(num))
 		packet_free_multi(pkt_hdrs, num);
@@ -821,6 +932,11 @@ void odp_packet_free_sp(const odp_packet_t pkt[], int num)
 			_ODP_ASSERT(odp_packet_pool(pkt[i]) == pool);
 	}
 
+	if (odp_likely(free_is_simple(pkt, num, pkt_hdrs))) {
+		_odp_event_free_sp((_odp_event_hdr_t **)(uintptr_t)pkt_hdrs, num);
+		return;
+	}
+
 	num -= free_segmented(pkt, num, pkt_hdrs);
 	if (odp_likely(num))
 		packet_free_sp(pkt_hdrs, num);
@@ -2335,7 +2451,8 @@ static odp_packet_t packet_ref(odp_packet_t pkt)
 	odp_packet_hdr_t *ref;
 	odp_pool_t pool;
 
-	pool = odp_packet_pool(pkt);
+	/* Reference segments are allocated from the same packet length class */
+	pool = pkt_hdr->event_hdr.pool;
 	_ODP_ASSERT(pool != ODP_POOL_INVALID);
 
 	ref = alloc_segments(_odp_pool_entry(pool), pkt_hdr->seg_count);
@@ -2401,6 +2518,68 @@ odp_packet_t odp_packet_ref_pkt(odp_packet_t pkt, uint32_t offset,
 	return hdr;
 }
 
+odp_packet_t _odp_packet_ref_part(odp_packet_t pkt, uint32_t offset, uint32_t len)
+{
+	odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt);
+	odp_packet_hdr_t *base = pkt_hdr;
+	odp_packet_hdr_t *ref, *seg;
+	uint32_t seg_offset = offset;
+	uint32_t left, seg_len;
+	int num = 1;
+
+	if (odp_unlikely(len == 0 || offset + len > pkt_hdr->frame_len ||
+			 odp_packet_is_referencing(pkt)))
+		return ODP_PACKET_INVALID;
+
+	/* Find the segment where the range starts */
+	while (seg_offset >= base->seg_len) {
+		seg_offset -= base->seg_len;
+		base = base->seg_next;
+	}
+
+	/* Count segments covering the range */
+	seg = base;
+	left = seg->seg_len - seg_offset;
+	while (left < len) {
+		seg = seg->seg_next;
+		left += seg->seg_len;
+		num++;
+	}
+
+	ref = alloc_segments(_odp_pool_entry(pkt_hdr->event_hdr.pool), num);
+	if (odp_unlikely(ref == NULL))
+		return ODP_PACKET_INVALID;
+
+	_odp_packet_reset_md(ref);
+
+	left = len;
+	for (seg = ref; seg != NULL; seg = seg->seg_next) {
+		seg_len = base->seg_len - seg_offset;
+		if (seg_len > left)
+			seg_len = left;
+
+		seg->seg_indirect = 1;
+		seg->seg_referenced = base;
+		seg->seg_data = base->seg_data + seg_offset;
+		seg->seg_len = seg_len;
+		segment_ref_inc(base);
+
+		left -= seg_len;
+		seg_offset = 0;
+		base = base->seg_next;
+	}
+
+	ref->p.flags.is_ref = 1;
+	ref->frame_len = len;
+	ref->seg_count = num;
+
+	/* cannot use headroom/tailroom of the referenced packet */
+	ref->headroom  = 0;
+	ref->tailroom  = 0;
+
+	return packet_handle(ref);
+}
+
 int odp_packet_has_ref(odp_packet_t pkt)
 {
 	odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt);
@@ -2569,25 +2748,18 @@ odp_packet_free_ctrl_t odp_packet_free_ctrl(odp_packet_t pkt)
 odp_packet_reass_status_t
 odp_packet_reass_status(odp_packet_t pkt)
 {
-	(void)pkt;
-	return ODP_PACKET_REASS_NONE;
+	return (odp_packet_reass_status_t)packet_hdr(pkt)->p.flags.reass;
 }
 
 int odp_packet_reass_info(odp_packet_t pkt, odp_packet_reass_info_t *info)
 {
-	(void)pkt;
-	(void)info;
-	return -1;
-}
+	odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt);
 
-int
-odp_packet_reass_partial_state(odp_packet_t pkt, odp_packet_t frags[],
-			       odp_packet_reass_partial_state_t *res)
-{
-	(void)pkt;
-	(void)frags;
-	(void)res;
-	return -ENOTSUP;
+	if (pkt_hdr->p.flags.reass != ODP_PACKET_REASS_COMPLETE)
+		return -1;
+
+	info->num_frags = pkt_hdr->reass_frags;
+	return 0;
 }
 
 uint32_t odp_packet_disassemble(odp_packet_t pkt, odp_packet_buf_t pkt_buf[], uint32_t num)
@@ -2690,13 +2862,25 @@ odp_packet_t odp_packet_reassemble(odp_pool_t pool_hdl, odp_packet_buf_t pkt_buf
 
 void odp_packet_proto_stats_request(odp_packet_t pkt, odp_packet_proto_stats_opt_t *opt)
 {
-	(void)pkt;
-	(void)opt;
+	odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt);
+
+	if (opt == NULL || opt->stat == ODP_PROTO_STATS_INVALID) {
+		pkt_hdr->p.flags.proto_stats = 0;
+		return;
+	}
+
+	pkt_hdr->p.flags.proto_stats = 1;
+	pkt_hdr->proto_stats_idx = _odp_proto_stats_to_idx(opt->stat);
+	pkt_hdr->proto_stats_adj[0] = opt->oct_count0_adj;
+	pkt_hdr->proto_stats_adj[1] = opt->oct_count1_adj;
 }
 
 odp_proto_stats_t odp_packet_proto_stats(odp_packet_t pkt)
 {
-	(void)pkt;
+	odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt);
+
+	if (!pkt_hdr->p.flags.proto_stats)
+		return ODP_PROTO_STATS_INVALID;
 
-	return ODP_PROTO_STATS_INVALID;
+	return _odp_proto_stats_from_idx(pkt_hdr->proto_stats_idx);
 }
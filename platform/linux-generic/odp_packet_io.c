@@ -25,14 +25,17 @@
 #include <odp_config_internal.h>
 #include <odp_debug_internal.h>
 #include <odp_event_vector_internal.h>
+#include <odp_gro_internal.h>
 #include <odp_init_internal.h>
 #include <odp_libconfig_internal.h>
 #include <odp_packet_internal.h>
 #include <odp_packet_io_internal.h>
+#include <odp_proto_stats_internal.h>
 #include <odp_string_internal.h>
 #include <odp_pcapng.h>
 #include <odp_queue_if.h>
 #include <odp_queue_basic_internal.h>
+#include <odp_reass_internal.h>
 #include <odp_schedule_if.h>
 
 #include <ifaddrs.h>
@@ -116,6 +119,20 @@ static int read_config_file(pktio_global_t *pktio_glb)
 	pktio_glb->config.tx_compl_pool_size = val;
 	_ODP_PRINT("  %s: %i\n", str, val);
 
+	str = "pktio.gro_max_segs";
+	if (!_odp_libconfig_lookup_int(str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+
+	if (val < 0 || val > _ODP_GRO_MAX_SEGS) {
+		_ODP_ERR("Bad value %s = %i\n", str, val);
+		return -1;
+	}
+
+	pktio_glb->config.gro_max_segs = val;
+	_ODP_PRINT("  %s: %i\n", str, val);
+
 	_ODP_PRINT("\n");
 
 	return 0;
@@ -270,13 +287,15 @@ static void init_pktio_entry(pktio_entry_t *entry)
 
 	/* Clear all flags */
 	entry->enabled.all_flags = 0;
+	entry->tx_ref = 0;
 
 	entry->tx_compl_pool = ODP_POOL_INVALID;
 	entry->tx_compl_status_shm = ODP_SHM_INVALID;
+	entry->reass_tbl = NULL;
 
-	odp_atomic_init_u64(&entry->stats_extra.in_discards, 0);
-	odp_atomic_init_u64(&entry->stats_extra.in_errors, 0);
-	odp_atomic_init_u64(&entry->stats_extra.out_discards, 0);
+	_ODP_STAT_INIT(entry->stats_extra, in_discards);
+	_ODP_STAT_INIT(entry->stats_extra, in_errors);
+	_ODP_STAT_INIT(entry->stats_extra, out_discards);
 	odp_atomic_init_u64(&entry->tx_ts, 0);
 
 	for (i = 0; i < ODP_PKTIN_MAX_QUEUES; i++) {
@@ -440,6 +459,21 @@ static int _pktio_close(pktio_entry_t *entry)
 	return 0;
 }
 
+/* Free partially formed packet vector and the packets in it */
+static void pktin_vector_drop(pktio_entry_t *entry, int index)
+{
+	pktin_vector_t *vector = &entry->in_queue[index].vector;
+	odp_packet_t *pkt_tbl;
+
+	if (vector->type != ODP_EVENT_PACKET_VECTOR || vector->num == 0)
+		return;
+
+	odp_packet_vector_tbl(vector->pktv, &pkt_tbl);
+	odp_packet_free_multi(pkt_tbl, vector->num);
+	odp_packet_vector_free(vector->pktv);
+	vector->num = 0;
+}
+
 static void destroy_in_queues(pktio_entry_t *entry, int num)
 {
 	int i;
@@ -449,6 +483,8 @@ static void destroy_in_queues(pktio_entry_t *entry, int num)
 			odp_queue_destroy(entry->in_queue[i].queue);
 			entry->in_queue[i].queue = ODP_QUEUE_INVALID;
 		}
+
+		pktin_vector_drop(entry, i);
 	}
 }
 
@@ -489,6 +525,8 @@ int odp_pktio_close(odp_pktio_t hdl)
 	entry->num_in_queue  = 0;
 	entry->num_out_queue = 0;
 
+	_odp_reass_destroy(entry);
+
 	if (entry->tx_compl_pool != ODP_POOL_INVALID) {
 		if (odp_pool_destroy(entry->tx_compl_pool) == -1) {
 			unlock_entry(entry);
@@ -610,6 +648,27 @@ int odp_pktio_config(odp_pktio_t hdl, const odp_pktio_config_t *config)
 		return -1;
 	}
 
+	if (config->reassembly.en_ipv4 || config->reassembly.en_ipv6) {
+		if ((config->reassembly.en_ipv4 && !capa.reassembly.ipv4) ||
+		    (config->reassembly.en_ipv6 && !capa.reassembly.ipv6)) {
+			_ODP_ERR("Reassembly not supported\n");
+			return -1;
+		}
+
+		if (config->reassembly.max_num_frags < 2 ||
+		    config->reassembly.max_num_frags > capa.reassembly.max_num_frags) {
+			_ODP_ERR("Unsupported reassembly max_num_frags: %u\n",
+				 config->reassembly.max_num_frags);
+			return -1;
+		}
+
+		if (config->reassembly.max_wait_time > capa.reassembly.max_wait_time) {
+			_ODP_ERR("Unsupported reassembly max_wait_time: %" PRIu64 "\n",
+				 config->reassembly.max_wait_time);
+			return -1;
+		}
+	}
+
 	lock_entry(entry);
 	if (entry->state == PKTIO_STATE_STARTED) {
 		unlock_entry(entry);
@@ -638,6 +697,7 @@ int odp_pktio_config(odp_pktio_t hdl, const odp_pktio_config_t *config)
 	}
 
 	entry->enabled.tx_aging = config->pktout.bit.aging_ena;
+	entry->enabled.proto_stats = config->pktout.bit.proto_stats_ena;
 
 	if (entry->ops->config)
 		res = entry->ops->config(entry, config);
@@ -675,6 +735,30 @@ int odp_pktio_start(odp_pktio_t hdl)
 	entry->parse_layer = pktio_cls_enabled(entry) ?
 				       ODP_PROTO_LAYER_ALL :
 				       entry->config.parser.layer;
+
+	/* Reassembly table is recreated on every start, as configuration may have changed */
+	_odp_reass_destroy(entry);
+	entry->enabled.reass = entry->config.reassembly.en_ipv4 ||
+			       entry->config.reassembly.en_ipv6;
+
+	if (entry->enabled.reass) {
+		/* Drivers deliver classified packets directly to CoS queues */
+		if (pktio_cls_enabled(entry)) {
+			unlock_entry(entry);
+			_ODP_ERR("Reassembly not supported with classifier\n");
+			return -1;
+		}
+
+		if (_odp_reass_create(entry)) {
+			unlock_entry(entry);
+			return -1;
+		}
+	}
+
+	/* GRO needs TCP headers parsed */
+	entry->enabled.gro = pktio_global->config.gro_max_segs > 1 &&
+			     entry->parse_layer >= ODP_PROTO_LAYER_L4;
+
 	if (entry->ops->start)
 		res = entry->ops->start(entry);
 	if (!res)
@@ -815,6 +899,81 @@ static inline odp_packet_vector_t packet_vector_create(odp_packet_t packets[], u
 	return pktv;
 }
 
+/* Software processing stages of received packets */
+static inline int pktin_post_recv(pktio_entry_t *entry, odp_packet_t pkt_tbl[], int num_rx,
+				  int num)
+{
+	if (odp_unlikely(entry->enabled.reass) && num_rx >= 0)
+		num_rx = _odp_reass_pktin(entry, pkt_tbl, num_rx, num);
+
+	if (odp_unlikely(entry->enabled.gro) && num_rx > 1)
+		num_rx = _odp_gro_pktin(pkt_tbl, num_rx, pktio_global->config.gro_max_segs);
+
+	return num_rx;
+}
+
+static inline int pktin_recv(pktio_entry_t *entry, int pktin_index, odp_packet_t pkt_tbl[],
+			     int num)
+{
+	int num_rx = entry->ops->recv(entry, pktin_index, pkt_tbl, num);
+
+	return pktin_post_recv(entry, pkt_tbl, num_rx, num);
+}
+
+/* Accumulate received packets into a packet vector over multiple polls. Vector is output when
+ * it is full or its timeout has passed. */
+static inline int pktin_recv_pktv_tmo(pktio_entry_t *entry, int pktin_index,
+				      _odp_event_hdr_t *event_hdrs[])
+{
+	pktin_vector_t *vector = &entry->in_queue[pktin_index].vector;
+	odp_packet_t pkt_tbl[CONFIG_PACKET_VECTOR_MAX_SIZE];
+	odp_packet_t *vec_tbl;
+	int num_rx;
+
+	/* Another thread is already receiving into the vector */
+	if (!odp_ticketlock_trylock(&vector->lock))
+		return 0;
+
+	num_rx = pktin_recv(entry, pktin_index, pkt_tbl, vector->max_size - vector->num);
+
+	if (num_rx > 0) {
+		if (vector->num == 0) {
+			vector->pktv = odp_packet_vector_alloc(vector->pool);
+
+			if (odp_unlikely(vector->pktv == ODP_PACKET_VECTOR_INVALID)) {
+				odp_packet_free_multi(pkt_tbl, num_rx);
+				odp_ticketlock_unlock(&vector->lock);
+				return 0;
+			}
+			vector->tmo_ns = odp_time_global_ns() + vector->max_tmo_ns;
+		}
+
+		odp_packet_vector_tbl(vector->pktv, &vec_tbl);
+		for (int i = 0; i < num_rx; i++)
+			vec_tbl[vector->num++] = pkt_tbl[i];
+	}
+
+	if (vector->num == 0 ||
+	    (vector->num < vector->max_size && odp_time_global_ns() < vector->tmo_ns)) {
+		odp_ticketlock_unlock(&vector->lock);
+		return num_rx < 0 ? num_rx : 0;
+	}
+
+	if (vector->num == 1) {
+		odp_packet_vector_tbl(vector->pktv, &vec_tbl);
+		event_hdrs[0] = packet_to_event_hdr(vec_tbl[0]);
+		odp_packet_vector_free(vector->pktv);
+	} else {
+		odp_packet_vector_size_set(vector->pktv, vector->num);
+		event_hdrs[0] = _odp_packet_vector_to_event_hdr(vector->pktv);
+	}
+	vector->num = 0;
+
+	odp_ticketlock_unlock(&vector->lock);
+
+	return 1;
+}
+
 static inline int pktin_recv_buf(pktio_entry_t *entry, int pktin_index,
 				 _odp_event_hdr_t *event_hdrs[], int num)
 {
@@ -824,15 +983,23 @@ static inline int pktin_recv_buf(pktio_entry_t *entry, int pktin_index,
 	int num_rx;
 
 	if (!vector_enabled)
-		return entry->ops->recv(entry, pktin_index, (odp_packet_t *)event_hdrs, num);
+		return pktin_recv(entry, pktin_index, (odp_packet_t *)event_hdrs, num);
+
+	if (vector_type == ODP_EVENT_PACKET_VECTOR && entry->in_queue[pktin_index].vector.max_tmo_ns)
+		return pktin_recv_pktv_tmo(entry, pktin_index, event_hdrs);
 
 	/* Always try to receive full vectors */
 	num = entry->in_queue[pktin_index].vector.max_size;
 
-	num_rx = entry->ops->recv(entry, pktin_index, pkt_tbl, num);
-	if (num_rx <= 0)
+	num_rx = pktin_recv(entry, pktin_index, pkt_tbl, num);
+	if (num_rx < 0)
 		return num_rx;
 
+	/* Event aggregator may output timed out events also when nothing was received */
+	if (num_rx == 0 &&
+	    (vector_type != ODP_EVENT_VECTOR || !entry->in_queue[pktin_index].vector.max_tmo_ns))
+		return 0;
+
 	if (vector_type == ODP_EVENT_VECTOR) {
 		odp_queue_t aggr_queue = entry->in_queue[pktin_index].vector.aggr_queue;
 		odp_event_vector_t evv = _odp_event_vector_create(aggr_queue, pkt_tbl, num_rx);
@@ -1588,19 +1755,20 @@ int odp_pktio_capability(odp_pktio_t pktio, odp_pktio_capability_t *capa)
 	capa->config.pktout.bit.aging_ena = 1;
 	capa->max_tx_aging_tmo_ns = MAX_TX_AGING_TMO_NS;
 
+	/* Proto stats are updated in software for all pktio types */
+	capa->config.pktout.bit.proto_stats_ena = 1;
+
 	/* Packet vector generation is common for all pktio types */
 	if (entry->param.in_mode ==  ODP_PKTIN_MODE_QUEUE ||
 	    entry->param.in_mode ==  ODP_PKTIN_MODE_SCHED) {
 		capa->vector.supported = ODP_SUPPORT_YES;
 		capa->vector.max_size = CONFIG_PACKET_VECTOR_MAX_SIZE;
 		capa->vector.min_size = 1;
-		capa->vector.max_tmo_ns = 0;
+		capa->vector.max_tmo_ns = CONFIG_VECTOR_MAX_TMO_NS;
 		capa->vector.min_tmo_ns = 0;
 	}
 
-	capa->reassembly.ip = false;
-	capa->reassembly.ipv4 = false;
-	capa->reassembly.ipv6 = false;
+	_odp_reass_capability(&capa->reassembly);
 	capa->flow_control.pause_rx = 0;
 	capa->flow_control.pfc_rx = 0;
 	capa->flow_control.pause_tx = 0;
@@ -1640,9 +1808,9 @@ int odp_pktio_stats(odp_pktio_t pktio,
 	if (entry->ops->stats)
 		ret = entry->ops->stats(entry, stats);
 	if (odp_likely(ret == 0)) {
-		stats->in_discards += odp_atomic_load_u64(&entry->stats_extra.in_discards);
-		stats->in_errors += odp_atomic_load_u64(&entry->stats_extra.in_errors);
-		stats->out_discards += odp_atomic_load_u64(&entry->stats_extra.out_discards);
+		stats->in_discards += _ODP_STAT_SUM(entry->stats_extra, in_discards);
+		stats->in_errors += _ODP_STAT_SUM(entry->stats_extra, in_errors);
+		stats->out_discards += _ODP_STAT_SUM(entry->stats_extra, out_discards);
 	}
 	unlock_entry(entry);
 
@@ -1668,9 +1836,9 @@ int odp_pktio_stats_reset(odp_pktio_t pktio)
 		return -1;
 	}
 
-	odp_atomic_store_u64(&entry->stats_extra.in_discards, 0);
-	odp_atomic_store_u64(&entry->stats_extra.in_errors, 0);
-	odp_atomic_store_u64(&entry->stats_extra.out_discards, 0);
+	_ODP_STAT_INIT(entry->stats_extra, in_discards);
+	_ODP_STAT_INIT(entry->stats_extra, in_errors);
+	_ODP_STAT_INIT(entry->stats_extra, out_discards);
 	if (entry->ops->stats)
 		ret = entry->ops->stats_reset(entry);
 	unlock_entry(entry);
@@ -2091,6 +2259,7 @@ int odp_pktin_queue_config(odp_pktio_t pktio, const odp_pktin_queue_param_t *par
 		destroy_in_queues(entry, entry->num_in_queue);
 
 	for (i = 0; i < num_queues; i++) {
+		pktin_vector_drop(entry, i);
 		entry->in_queue[i].vector.type = 0;
 
 		if (mode == ODP_PKTIN_MODE_QUEUE ||
@@ -2144,10 +2313,14 @@ int odp_pktin_queue_config(odp_pktio_t pktio, const odp_pktin_queue_param_t *par
 				entry->in_queue[i].vector.max_size = queue_param.aggr[0].max_size;
 				entry->in_queue[i].vector.pool = queue_param.aggr[0].pool;
 				entry->in_queue[i].vector.aggr_queue = odp_queue_aggr(queue, 0);
+				entry->in_queue[i].vector.max_tmo_ns = queue_param.aggr[0].max_tmo_ns;
 			} else if (param->vector.enable) {
 				entry->in_queue[i].vector.type = ODP_EVENT_PACKET_VECTOR;
 				entry->in_queue[i].vector.max_size = param->vector.max_size;
 				entry->in_queue[i].vector.pool = param->vector.pool;
+				entry->in_queue[i].vector.max_tmo_ns = param->vector.max_tmo_ns;
+				odp_ticketlock_init(&entry->in_queue[i].vector.lock);
+				entry->in_queue[i].vector.num = 0;
 			}
 		} else {
 			entry->in_queue[i].queue = ODP_QUEUE_INVALID;
@@ -2525,7 +2698,7 @@ int odp_pktin_recv(odp_pktin_queue_t queue, odp_packet_t packets[], int num)
 	if (odp_unlikely(entry->state != PKTIO_STATE_STARTED))
 		return 0;
 
-	ret = entry->ops->recv(entry, queue.index, packets, num);
+	ret = pktin_recv(entry, queue.index, packets, num);
 	if (_ODP_PCAPNG)
 		_odp_pcapng_dump_pkts(entry, queue.index, packets, ret);
 
@@ -2557,6 +2730,7 @@ int odp_pktin_recv_tmo(odp_pktin_queue_t queue, odp_packet_t packets[], int num,
 	if (entry->ops->recv_tmo && wait != ODP_PKTIN_NO_WAIT) {
 		ret = entry->ops->recv_tmo(entry, queue.index, packets, num,
 					      wait);
+		ret = pktin_post_recv(entry, packets, ret, num);
 		if (_ODP_PCAPNG)
 			_odp_pcapng_dump_pkts(entry, queue.index, packets, ret);
 
@@ -2564,7 +2738,7 @@ int odp_pktin_recv_tmo(odp_pktin_queue_t queue, odp_packet_t packets[], int num,
 	}
 
 	while (1) {
-		ret = entry->ops->recv(entry, queue.index, packets, num);
+		ret = pktin_recv(entry, queue.index, packets, num);
 		if (_ODP_PCAPNG)
 			_odp_pcapng_dump_pkts(entry, queue.index, packets, ret);
 
@@ -2627,13 +2801,13 @@ int odp_pktin_recv_mq_tmo(const odp_pktin_queue_t queues[], uint32_t num_q, uint
 	if (ret > 0 && from)
 		*from = lfrom;
 	if (trial_successful) {
-		if (_ODP_PCAPNG) {
-			pktio_entry_t *entry;
+		pktio_entry_t *entry = get_pktio_entry(queues[lfrom].pktio);
 
-			entry = get_pktio_entry(queues[lfrom].pktio);
-			if (entry)
-				_odp_pcapng_dump_pkts(entry, lfrom, packets, ret);
-		}
+		if (entry)
+			ret = pktin_post_recv(entry, packets, ret, num);
+
+		if (_ODP_PCAPNG && entry)
+			_odp_pcapng_dump_pkts(entry, lfrom, packets, ret);
 
 		return ret;
 	}
@@ -2775,7 +2949,9 @@ int odp_pktout_send(odp_pktout_queue_t queue, const odp_packet_t packets[],
 	pktio_entry_t *entry;
 	odp_pktio_t pktio = queue.pktio;
 	tx_compl_info_t tx_compl_info[num];
+	_odp_proto_stats_tx_t proto_stats_info[num];
 	uint16_t num_tx_c = 0;
+	int num_ps = 0;
 	int num_to_send = num, num_sent;
 
 	entry = get_pktio_entry(pktio);
@@ -2798,11 +2974,18 @@ int odp_pktout_send(odp_pktout_queue_t queue, const odp_packet_t packets[],
 					       tx_compl_status, &num_tx_c);
 	}
 
+	/* Packets are owned by the driver after send, collect updates beforehand */
+	if (odp_unlikely(_odp_pktio_proto_stats_enabled(entry)))
+		num_ps = _odp_proto_stats_tx_prepare(packets, num_to_send, proto_stats_info);
+
 	num_sent = entry->ops->send(entry, queue.index, packets, num_to_send);
 
 	if (odp_unlikely(num_tx_c))
 		finish_tx_compl(tx_compl_info, num_tx_c, num_sent);
 
+	if (odp_unlikely(num_ps) && num_sent > 0)
+		_odp_proto_stats_tx_finish(proto_stats_info, num_ps, num_sent);
+
 	return num_sent;
 }
 
@@ -3151,16 +3334,12 @@ int _odp_lso_num_packets(odp_packet_t packet, const odp_packet_lso_opt_t *lso_op
 	return num_pkt;
 }
 
-int _odp_lso_create_packets(odp_packet_t packet, const odp_packet_lso_opt_t *lso_opt,
-			    uint32_t payload_len, uint32_t left_over_len,
-			    odp_packet_t pkt_out[], int num_pkt)
+static int lso_copy_packets(odp_packet_t packet, uint32_t hdr_len, uint32_t payload_len,
+			    uint32_t left_over_len, odp_packet_t pkt_out[], int num_pkt)
 {
 	int i, num;
 	uint32_t offset;
 	odp_packet_t pkt;
-	odp_lso_profile_t lso_profile = lso_opt->lso_profile;
-	lso_profile_t *lso_prof = lso_profile_ptr(lso_profile);
-	const uint32_t hdr_len = lso_opt->payload_offset;
 	const uint32_t pkt_len = hdr_len + payload_len;
 	odp_pool_t pool = odp_packet_pool(packet);
 	int num_free = 0;
@@ -3217,6 +3396,161 @@ int _odp_lso_create_packets(odp_packet_t packet, const odp_packet_lso_opt_t *lso
 		}
 	}
 
+	return 0;
+
+error:
+	odp_packet_free_multi(pkt_out, num_free);
+	return -1;
+}
+
+/* Check that header segments and payload reference segments of each output
+ * packet fit into a single packet */
+static int lso_ref_segs_fit(odp_packet_t packet, uint32_t hdr_segs, uint32_t hdr_len,
+			    uint32_t payload_len, uint32_t left_over_len, int num_pkt)
+{
+	odp_packet_seg_t seg = odp_packet_first_seg(packet);
+	uint32_t seg_end = odp_packet_seg_data_len(packet, seg);
+	uint32_t offset = hdr_len;
+	uint32_t end, num;
+
+	for (int i = 0; i < num_pkt; i++) {
+		end = offset + payload_len;
+		if (left_over_len && i == num_pkt - 1)
+			end = offset + left_over_len;
+
+		/* Segment where the payload starts */
+		while (seg_end <= offset) {
+			seg = odp_packet_next_seg(packet, seg);
+			seg_end += odp_packet_seg_data_len(packet, seg);
+		}
+
+		num = 1;
+		while (seg_end < end) {
+			seg = odp_packet_next_seg(packet, seg);
+			seg_end += odp_packet_seg_data_len(packet, seg);
+			num++;
+		}
+
+		if (hdr_segs + num > PKT_MAX_SEGS)
+			return 0;
+
+		offset = end;
+	}
+
+	return 1;
+}
+
+/* Copy only headers into new packets and attach payload as references to the
+ * original packet data. Returns 1 when the output packets would have too many
+ * segments. */
+static int lso_ref_packets(odp_packet_t packet, uint32_t hdr_len, uint32_t payload_len,
+			   uint32_t left_over_len, odp_packet_t pkt_out[], int num_pkt)
+{
+	int i, num;
+	uint32_t offset, len;
+	odp_packet_t ref;
+	odp_pool_t pool = odp_packet_pool(packet);
+
+	num = odp_packet_alloc_multi(pool, hdr_len, pkt_out, num_pkt);
+	if (odp_unlikely(num < num_pkt)) {
+		_ODP_DBG("Alloc failed %i\n", num);
+		if (num > 0)
+			odp_packet_free_multi(pkt_out, num);
+		return -1;
+	}
+
+	if (odp_unlikely(!lso_ref_segs_fit(packet, odp_packet_num_segs(pkt_out[0]), hdr_len,
+					   payload_len, left_over_len, num_pkt))) {
+		odp_packet_free_multi(pkt_out, num_pkt);
+		return 1;
+	}
+
+	for (i = 0; i < num_pkt; i++) {
+		if (odp_packet_copy_from_pkt(pkt_out[i], 0, packet, 0, hdr_len)) {
+			_ODP_ERR("Header copy failed\n");
+			goto error;
+		}
+
+		offset = hdr_len + (i * payload_len);
+		len = payload_len;
+		if (left_over_len && i == num_pkt - 1)
+			len = left_over_len;
+
+		ref = _odp_packet_ref_part(packet, offset, len);
+		if (odp_unlikely(ref == ODP_PACKET_INVALID)) {
+			_ODP_DBG("Payload reference failed\n");
+			goto error;
+		}
+
+		if (odp_unlikely(odp_packet_concat(&pkt_out[i], ref) < 0)) {
+			_ODP_DBG("Payload concat failed\n");
+			odp_packet_free(ref);
+			goto error;
+		}
+	}
+
+	return 0;
+
+error:
+	odp_packet_free_multi(pkt_out, num_pkt);
+	return -1;
+}
+
+static int lso_custom_in_hdr(lso_profile_t *lso_prof, uint32_t hdr_len)
+{
+	int i;
+
+	for (i = 0; i < lso_prof->param.custom.num_custom; i++) {
+		if (lso_prof->param.custom.field[i].offset +
+		    lso_prof->param.custom.field[i].size > hdr_len)
+			return 0;
+	}
+
+	return 1;
+}
+
+int _odp_lso_create_packets(odp_packet_t packet, const odp_packet_lso_opt_t *lso_opt,
+			    uint32_t payload_len, uint32_t left_over_len,
+			    odp_packet_t pkt_out[], int num_pkt, int use_ref)
+{
+	int i;
+	uint32_t offset;
+	odp_lso_profile_t lso_profile = lso_opt->lso_profile;
+	lso_profile_t *lso_prof = lso_profile_ptr(lso_profile);
+	const odp_packet_hdr_t *pkt_hdr = packet_hdr(packet);
+	const uint32_t hdr_len = lso_opt->payload_offset;
+	int ret;
+
+	/* Payload data is shared with the original packet, so all modified
+	 * fields must be within the copied headers */
+	if (use_ref && lso_prof->param.lso_proto == ODP_LSO_PROTO_CUSTOM)
+		use_ref = lso_custom_in_hdr(lso_prof, hdr_len);
+
+	ret = 1;
+	if (use_ref && !odp_packet_is_referencing(packet))
+		ret = lso_ref_packets(packet, hdr_len, payload_len, left_over_len, pkt_out,
+				      num_pkt);
+
+	/* Copy when references are not used or would exceed packet segment limit */
+	if (ret > 0)
+		ret = lso_copy_packets(packet, hdr_len, payload_len, left_over_len, pkt_out,
+				       num_pkt);
+
+	if (odp_unlikely(ret))
+		return -1;
+
+	/* Each output packet updates the proto stats object of the original packet */
+	if (odp_unlikely(pkt_hdr->p.flags.proto_stats)) {
+		odp_packet_proto_stats_opt_t ps_opt;
+
+		ps_opt.stat = _odp_proto_stats_from_idx(pkt_hdr->proto_stats_idx);
+		ps_opt.oct_count0_adj = pkt_hdr->proto_stats_adj[0];
+		ps_opt.oct_count1_adj = pkt_hdr->proto_stats_adj[1];
+
+		for (i = 0; i < num_pkt; i++)
+			odp_packet_proto_stats_request(pkt_out[i], &ps_opt);
+	}
+
 	if (lso_prof->param.lso_proto == ODP_LSO_PROTO_IPV4) {
 		offset = odp_packet_l3_offset(packet);
 
@@ -3246,13 +3580,14 @@ int _odp_lso_create_packets(odp_packet_t packet, const odp_packet_lso_opt_t *lso
 	return 0;
 
 error:
-	odp_packet_free_multi(pkt_out, num_free);
+	odp_packet_free_multi(pkt_out, num_pkt);
 	return -1;
 }
 
 static int pktout_send_lso(odp_pktout_queue_t queue, odp_packet_t packet,
 			   const odp_packet_lso_opt_t *lso_opt)
 {
+	pktio_entry_t *entry = get_pktio_entry(queue.pktio);
 	int ret, num_pkt;
 	uint32_t payload_len, left_over_len;
 
@@ -3273,7 +3608,7 @@ static int pktout_send_lso(odp_pktout_queue_t queue, odp_packet_t packet,
 	odp_packet_t pkt_out[num_pkt];
 
 	ret = _odp_lso_create_packets(packet, lso_opt, payload_len, left_over_len, pkt_out,
-				      num_pkt);
+				      num_pkt, entry->tx_ref);
 
 	if (odp_unlikely(ret))
 		return -1;
@@ -3373,63 +3708,3 @@ void _odp_pktio_process_tx_compl(const pktio_entry_t *entry, const odp_packet_t
 	}
 }
 
-void
-odp_proto_stats_param_init(odp_proto_stats_param_t *param)
-{
-	if (param)
-		memset(param, 0, sizeof(*param));
-}
-
-int
-odp_proto_stats_capability(odp_pktio_t pktio, odp_proto_stats_capability_t *capa)
-{
-	(void)pktio;
-
-	if (capa == NULL)
-		return -1;
-
-	memset(capa, 0, sizeof(*capa));
-
-	return 0;
-}
-
-odp_proto_stats_t
-odp_proto_stats_lookup(const char *name)
-{
-	(void)name;
-
-	return ODP_PROTO_STATS_INVALID;
-}
-
-odp_proto_stats_t
-odp_proto_stats_create(const char *name, const odp_proto_stats_param_t *param)
-{
-	(void)name;
-	(void)param;
-
-	return ODP_PROTO_STATS_INVALID;
-}
-
-int
-odp_proto_stats_destroy(odp_proto_stats_t stat)
-{
-	(void)stat;
-
-	return 0;
-}
-
-int
-odp_proto_stats(odp_proto_stats_t stat, odp_proto_stats_data_t *data)
-{
-	(void)stat;
-
-	memset(data, 0, sizeof(odp_proto_stats_data_t));
-
-	return 0;
-}
-
-void
-odp_proto_stats_print(odp_proto_stats_t stat)
-{
-	(void)stat;
-}
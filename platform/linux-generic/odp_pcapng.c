@@ -1,6 +1,6 @@
 /* SPDX-License-Identifier: BSD-3-Clause
  * Copyright (c) 2018 Linaro Limited
- * Copyright (c) 2019-2022 Nokia
+ * Copyright (c) 2019-2026 Nokia
  */
 
 #include <odp_posix_extensions.h>
@@ -9,29 +9,45 @@
 
 #if defined(_ODP_PCAPNG) && _ODP_PCAPNG == 1
 
+#include <odp/api/atomic.h>
+#include <odp/api/byteorder.h>
+#include <odp/api/cpu.h>
 #include <odp/api/hints.h>
+#include <odp/api/packet_flags.h>
 #include <odp/api/shared_memory.h>
 #include <odp/api/spinlock.h>
+#include <odp/api/time.h>
 
+#include <odp/api/plat/atomic_inlines.h>
+#include <odp/api/plat/packet_flag_inlines.h>
 #include <odp/api/plat/packet_inlines.h>
 #include <odp/api/plat/packet_io_inlines.h>
+#include <odp/api/plat/time_inlines.h>
 
 #include <odp_config_internal.h>
+#include <odp_debug_internal.h>
 #include <odp_global_data.h>
 #include <odp_init_internal.h>
+#include <odp_libconfig_internal.h>
 #include <odp_macros_internal.h>
 #include <odp_packet_io_internal.h>
 #include <odp_pcapng.h>
+#include <protocols/ip.h>
+#include <ring/odp_ring_mpmc_u32_internal.h>
 
+#include <arpa/inet.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
 #include <pthread.h>
+#include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <sys/stat.h>
 #include <sys/uio.h>
 #include <sys/inotify.h>
 #include <sys/select.h>
+#include <time.h>
 
 #define PCAPNG_BLOCK_TYPE_EPB 0x00000006UL
 #define PCAPNG_BLOCK_TYPE_SHB 0x0A0D0D0AUL
@@ -39,6 +55,11 @@
 #define PCAPNG_ENDIAN_MAGIC 0x1A2B3C4DUL
 #define PCAPNG_DATA_ALIGN 4
 #define PCAPNG_LINKTYPE_ETHERNET 0x1
+#define PCAPNG_OPT_ENDOFOPT 0
+#define PCAPNG_OPT_IF_TSRESOL 9
+#define PCAPNG_OPT_IF_TSOFFSET 14
+/* Timestamps in nanoseconds */
+#define PCAPNG_TSRESOL_NS 9
 
 /* inotify */
 #define INOTIFY_BUF_LEN (16 * (sizeof(struct inotify_event)))
@@ -47,6 +68,22 @@
 #define PKTIO_MAX_QUEUES (ODP_PKTIN_MAX_QUEUES > ODP_PKTOUT_MAX_QUEUES ? \
 				ODP_PKTIN_MAX_QUEUES : ODP_PKTOUT_MAX_QUEUES)
 
+/* Maximum number of bytes captured per packet */
+#define PCAPNG_MAX_SNAPLEN (16 * 1024)
+
+/* Maximum number of packets written per queue in one writer thread round */
+#define PCAPNG_WRITE_BURST 32
+
+/* Maximum enhanced packet block length: header, data and trailing length */
+#define PCAPNG_MAX_BLOCK_LEN (sizeof(pcapng_enhanced_packet_block_t) + PCAPNG_MAX_SNAPLEN + \
+			      sizeof(uint32_t))
+
+/* Writer thread sleep time when there is nothing to write */
+#define PCAPNG_IDLE_USEC 1000
+
+#define PCAPNG_MAX_FILTER_TERMS 16
+#define PCAPNG_FILTER_LEN 256
+
 /* pcapng: enhanced packet block file encoding */
 typedef struct ODP_PACKED pcapng_section_hdr_block_s {
 	uint32_t block_type;
@@ -58,12 +95,24 @@ typedef struct ODP_PACKED pcapng_section_hdr_block_s {
 	uint32_t block_total_length2;
 } pcapng_section_hdr_block_t;
 
-typedef struct pcapng_interface_description_block {
+typedef struct ODP_PACKED pcapng_interface_description_block {
 	uint32_t block_type;
 	uint32_t block_total_length;
 	uint16_t linktype;
 	uint16_t reserved;
 	uint32_t snaplen;
+	/* if_tsresol option */
+	uint16_t tsresol_code;
+	uint16_t tsresol_len;
+	uint8_t tsresol;
+	uint8_t tsresol_pad[3];
+	/* if_tsoffset option */
+	uint16_t tsoffset_code;
+	uint16_t tsoffset_len;
+	int64_t tsoffset;
+	/* opt_endofopt */
+	uint16_t end_code;
+	uint16_t end_len;
 	uint32_t block_total_length2;
 } pcapng_interface_description_block_t;
 
@@ -77,6 +126,55 @@ typedef struct pcapng_enhanced_packet_block_s {
 	uint32_t packet_len;
 } pcapng_enhanced_packet_block_t;
 
+/* Captured packet in capture ring */
+typedef struct {
+	uint64_t ts_ns;
+	uint32_t pkt_len;
+	uint32_t cap_len;
+	uint8_t data[];
+} pcapng_slot_t;
+
+/* Capture ring of a pktio queue. Data path threads copy packets into free
+ * slots and the writer thread writes out captured slots. */
+typedef struct ODP_ALIGNED_CACHE {
+	ring_mpmc_u32_t free_ring;
+	ring_mpmc_u32_t cap_ring;
+	odp_atomic_u32_t sample;
+	odp_atomic_u64_t drops;
+	uint32_t *free_data;
+	uint32_t *cap_data;
+	uint8_t *slot_base;
+
+	/* Writer thread only */
+	uint64_t file_bytes;
+} pcapng_queue_t;
+
+typedef enum {
+	FILTER_ARP = 0,
+	FILTER_VLAN,
+	FILTER_IPV4,
+	FILTER_IPV6,
+	FILTER_TCP,
+	FILTER_UDP,
+	FILTER_SCTP,
+	FILTER_ICMP,
+	FILTER_PORT,
+	FILTER_HOST,
+	FILTER_HOST6
+} pcapng_filter_type_t;
+
+typedef struct {
+	pcapng_filter_type_t type;
+	odp_bool_t neg;
+	/* Term starts a new alternative ('or') */
+	odp_bool_t alt;
+	union {
+		uint16_t port;
+		uint32_t ipv4;
+		uint8_t ipv6[16];
+	};
+} pcapng_filter_t;
+
 /** Pktio entry specific data */
 typedef struct {
 	pktio_entry_t *pktio_entry;
@@ -87,17 +185,56 @@ typedef struct {
 		PCAPNG_WR_PKT,
 	} state[PKTIO_MAX_QUEUES];
 	int fd[PKTIO_MAX_QUEUES];
+	/* Current capture file index. Kept over pktio restarts. */
+	uint32_t file_idx[PKTIO_MAX_QUEUES];
+
+	/* Capture rings */
+	odp_shm_t shm;
+	pcapng_queue_t *queue;
+	uint32_t num_queues;
+	uint32_t snaplen;
+	uint32_t slot_size;
 } pcapng_entry_t;
 
 typedef struct ODP_ALIGNED_CACHE {
 	odp_shm_t shm;
 	int num_entries;
-	pthread_t inotify_thread;
+	pthread_t thread;
 	int inotify_fd;
 	int inotify_watch_fd;
-	int inotify_is_running;
+	int thread_is_running;
+	odp_atomic_u32_t thread_stop;
+	/* Index + 1 of the pktio entry the writer thread is writing without
+	 * holding the lock, or 0 */
+	odp_atomic_u32_t write_entry;
 	odp_spinlock_t lock;
+
+	/* Packet timestamps are ODP global time. Wall clock time of global time
+	 * zero is split into whole seconds (if_tsoffset) and nanoseconds added
+	 * to each timestamp. */
+	int64_t tsoffset_sec;
+	uint64_t tsoffset_ns;
+
+	struct {
+		uint32_t ring_size;
+		uint32_t snaplen;
+		uint32_t sample_rate;
+		uint64_t file_size;
+		uint32_t file_count;
+		char file_dir[PATH_MAX];
+		int num_filter;
+		pcapng_filter_t filter[PCAPNG_MAX_FILTER_TERMS];
+	} config;
+
 	pcapng_entry_t entry[CONFIG_PKTIO_ENTRIES];
+
+	/* Writer thread only. Enhanced packet blocks copied out of a capture
+	 * ring, and chunks of them written with a single write() call. */
+	struct {
+		struct iovec chunk[PCAPNG_WRITE_BURST];
+		int num_chunk;
+		uint8_t buf[PCAPNG_WRITE_BURST * PCAPNG_MAX_BLOCK_LEN];
+	} write;
 } pcapng_global_t;
 
 static pcapng_global_t *pcapng_gbl;
@@ -107,11 +244,206 @@ static inline pcapng_entry_t *pcapng_entry(pktio_entry_t *pktio_entry)
 	return &pcapng_gbl->entry[odp_pktio_index(pktio_entry->handle)];
 }
 
-int write_pcapng_hdr(pktio_entry_t *entry, int qidx);
+static inline odp_bool_t file_mode(void)
+{
+	return pcapng_gbl->config.file_dir[0] != 0;
+}
+
+static int write_pcapng_hdr(pktio_entry_t *entry, int qidx);
+
+static int parse_filter(char *str)
+{
+	pcapng_filter_t *filter = pcapng_gbl->config.filter;
+	odp_bool_t neg = false;
+	odp_bool_t alt = false;
+	char *save = NULL;
+	char *tok;
+	int num = 0;
+
+	for (tok = strtok_r(str, " \t", &save); tok; tok = strtok_r(NULL, " \t", &save)) {
+		pcapng_filter_t *f = &filter[num];
+
+		if (!strcmp(tok, "and"))
+			continue;
+
+		if (!strcmp(tok, "or")) {
+			if (num == 0 || alt || neg) {
+				_ODP_ERR("Misplaced 'or' in filter\n");
+				return -1;
+			}
+			alt = true;
+			continue;
+		}
+
+		if (!strcmp(tok, "not")) {
+			neg = !neg;
+			continue;
+		}
+
+		if (num == PCAPNG_MAX_FILTER_TERMS) {
+			_ODP_ERR("Too many filter terms (max %i)\n", PCAPNG_MAX_FILTER_TERMS);
+			return -1;
+		}
+
+		memset(f, 0, sizeof(pcapng_filter_t));
+		f->neg = neg;
+		f->alt = alt;
+		neg = false;
+		alt = false;
+
+		if (!strcmp(tok, "arp")) {
+			f->type = FILTER_ARP;
+		} else if (!strcmp(tok, "vlan")) {
+			f->type = FILTER_VLAN;
+		} else if (!strcmp(tok, "ip") || !strcmp(tok, "ipv4")) {
+			f->type = FILTER_IPV4;
+		} else if (!strcmp(tok, "ip6") || !strcmp(tok, "ipv6")) {
+			f->type = FILTER_IPV6;
+		} else if (!strcmp(tok, "tcp")) {
+			f->type = FILTER_TCP;
+		} else if (!strcmp(tok, "udp")) {
+			f->type = FILTER_UDP;
+		} else if (!strcmp(tok, "sctp")) {
+			f->type = FILTER_SCTP;
+		} else if (!strcmp(tok, "icmp")) {
+			f->type = FILTER_ICMP;
+		} else if (!strcmp(tok, "port") || !strcmp(tok, "host")) {
+			const char *arg = strtok_r(NULL, " \t", &save);
+
+			if (arg == NULL) {
+				_ODP_ERR("Missing filter argument for '%s'\n", tok);
+				return -1;
+			}
+
+			if (!strcmp(tok, "port")) {
+				char *end;
+				unsigned long port = strtoul(arg, &end, 0);
+
+				if (*end || port > UINT16_MAX) {
+					_ODP_ERR("Bad filter port: %s\n", arg);
+					return -1;
+				}
+				f->type = FILTER_PORT;
+				f->port = port;
+			} else if (inet_pton(AF_INET, arg, &f->ipv4) == 1) {
+				f->type = FILTER_HOST;
+			} else if (inet_pton(AF_INET6, arg, f->ipv6) == 1) {
+				f->type = FILTER_HOST6;
+			} else {
+				_ODP_ERR("Bad filter host: %s\n", arg);
+				return -1;
+			}
+		} else {
+			_ODP_ERR("Unknown filter term: %s\n", tok);
+			return -1;
+		}
+
+		num++;
+	}
+
+	if (neg || alt) {
+		_ODP_ERR("Filter ends with '%s'\n", neg ? "not" : "or");
+		return -1;
+	}
+
+	pcapng_gbl->config.num_filter = num;
+
+	return 0;
+}
+
+static int read_config_file(void)
+{
+	const char *str;
+	char filter[PCAPNG_FILTER_LEN];
+	int val = 0;
+
+	_ODP_PRINT("Pcapng config:\n");
+
+	str = "pktio_pcapng.ring_size";
+	if (!_odp_libconfig_lookup_int(str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+	if (val < 1 || !_ODP_CHECK_IS_POWER2(val)) {
+		_ODP_ERR("Bad '%s' value %i, must be a power of two\n", str, val);
+		return -1;
+	}
+	pcapng_gbl->config.ring_size = val;
+	_ODP_PRINT("  %s: %i\n", str, val);
+
+	str = "pktio_pcapng.snaplen";
+	if (!_odp_libconfig_lookup_int(str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+	if (val < 0) {
+		_ODP_ERR("Bad '%s' value %i\n", str, val);
+		return -1;
+	}
+	pcapng_gbl->config.snaplen = val;
+	_ODP_PRINT("  %s: %i\n", str, val);
+
+	str = "pktio_pcapng.sample_rate";
+	if (!_odp_libconfig_lookup_int(str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+	if (val < 1) {
+		_ODP_ERR("Bad '%s' value %i\n", str, val);
+		return -1;
+	}
+	pcapng_gbl->config.sample_rate = val;
+	_ODP_PRINT("  %s: %i\n", str, val);
+
+	str = "pktio_pcapng.filter";
+	memset(filter, 0, sizeof(filter));
+	if (_odp_libconfig_lookup_str(str, filter, sizeof(filter) - 1) < 0) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+	_ODP_PRINT("  %s: \"%s\"\n", str, filter);
+	if (parse_filter(filter))
+		return -1;
+
+	str = "pktio_pcapng.file_dir";
+	if (_odp_libconfig_lookup_str(str, pcapng_gbl->config.file_dir, PATH_MAX - 1) < 0) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+	_ODP_PRINT("  %s: \"%s\"\n", str, pcapng_gbl->config.file_dir);
+
+	str = "pktio_pcapng.file_size_kb";
+	if (!_odp_libconfig_lookup_int(str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+	if (val < 0) {
+		_ODP_ERR("Bad '%s' value %i\n", str, val);
+		return -1;
+	}
+	pcapng_gbl->config.file_size = (uint64_t)val * 1024;
+	_ODP_PRINT("  %s: %i\n", str, val);
+
+	str = "pktio_pcapng.file_count";
+	if (!_odp_libconfig_lookup_int(str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+	if (val < 1) {
+		_ODP_ERR("Bad '%s' value %i\n", str, val);
+		return -1;
+	}
+	pcapng_gbl->config.file_count = val;
+	_ODP_PRINT("  %s: %i\n\n", str, val);
+
+	return 0;
+}
 
 int _odp_pcapng_init_global(void)
 {
 	odp_shm_t shm;
+	struct timespec wall;
+	int64_t offset_ns, sec, nsec;
 
 	shm = odp_shm_reserve("_odp_pcapng_global", sizeof(pcapng_global_t),
 			      ODP_PAGE_SIZE, 0);
@@ -122,8 +454,38 @@ int _odp_pcapng_init_global(void)
 
 	memset(pcapng_gbl, 0, sizeof(pcapng_global_t));
 	pcapng_gbl->shm = shm;
+	pcapng_gbl->inotify_fd = -1;
+	pcapng_gbl->inotify_watch_fd = -1;
 
 	odp_spinlock_init(&pcapng_gbl->lock);
+	odp_atomic_init_u32(&pcapng_gbl->thread_stop, 0);
+	odp_atomic_init_u32(&pcapng_gbl->write_entry, 0);
+
+	if (clock_gettime(CLOCK_REALTIME, &wall)) {
+		_ODP_ERR("clock_gettime() failed: %s\n", strerror(errno));
+		odp_shm_free(shm);
+		return -1;
+	}
+
+	/* Offset from ODP global time to wall clock time */
+	offset_ns = (int64_t)wall.tv_sec * ODP_TIME_SEC_IN_NS + wall.tv_nsec -
+		    (int64_t)odp_time_global_ns();
+	sec = offset_ns / (int64_t)ODP_TIME_SEC_IN_NS;
+	nsec = offset_ns % (int64_t)ODP_TIME_SEC_IN_NS;
+	if (nsec < 0) {
+		sec--;
+		nsec += ODP_TIME_SEC_IN_NS;
+	}
+	pcapng_gbl->tsoffset_sec = sec;
+	pcapng_gbl->tsoffset_ns = nsec;
+
+	for (int i = 0; i < CONFIG_PKTIO_ENTRIES; i++)
+		pcapng_gbl->entry[i].shm = ODP_SHM_INVALID;
+
+	if (read_config_file()) {
+		odp_shm_free(shm);
+		return -1;
+	}
 
 	return 0;
 }
@@ -150,23 +512,15 @@ static void pcapng_drain_fifo(int fd)
 	} while (len > 0);
 }
 
+/* Called inside global lock */
 static void inotify_event_handle(pktio_entry_t *entry, int qidx,
 				 struct inotify_event *event)
 {
 	pcapng_entry_t *pcapng = pcapng_entry(entry);
-	int mtu = _ODP_MAX(odp_pktin_maxlen(entry->handle), odp_pktout_maxlen(entry->handle));
 
 	if (event->mask & IN_OPEN) {
 		int ret;
 
-		if (PIPE_BUF < mtu + sizeof(pcapng_enhanced_packet_block_t) +
-		    sizeof(uint32_t)) {
-			_ODP_ERR("PIPE_BUF:%d too small. Disabling pcap\n", PIPE_BUF);
-			pcapng->state[qidx] = PCAPNG_WR_STOP;
-
-			return;
-		}
-
 		ret = write_pcapng_hdr(entry, qidx);
 		if (ret) {
 			pcapng->state[qidx] = PCAPNG_WR_STOP;
@@ -195,7 +549,7 @@ static void get_pcapng_fifo_name(char *pcapng_entry, size_t len,
 
 static int get_qidx_from_fifo(pktio_entry_t *entry, char *name)
 {
-	unsigned int max_queue = _ODP_MAX(entry->num_in_queue, entry->num_out_queue);
+	unsigned int max_queue = pcapng_entry(entry)->num_queues;
 	unsigned int i;
 
 	for (i = 0; i < max_queue; i++) {
@@ -222,70 +576,309 @@ static int get_qidx_from_fifo(pktio_entry_t *entry, char *name)
 	return -1;
 }
 
+/* Called inside global lock */
 static pktio_entry_t *pktio_from_event(struct inotify_event *event)
 {
 	int i;
 
-	odp_spinlock_lock(&pcapng_gbl->lock);
-
 	for (i = 0; i < CONFIG_PKTIO_ENTRIES; i++) {
 		pktio_entry_t *entry = pcapng_gbl->entry[i].pktio_entry;
 
 		if (entry == NULL)
 			continue;
 
-		if (get_qidx_from_fifo(entry, event->name) != -1) {
-			odp_spinlock_unlock(&pcapng_gbl->lock);
+		if (get_qidx_from_fifo(entry, event->name) != -1)
 			return entry;
-		}
 	}
 
-	odp_spinlock_unlock(&pcapng_gbl->lock);
-
 	return NULL;
 }
 
-static void *inotify_update(void *arg)
+/* Wait for inotify events at most 'usec' microseconds and handle them */
+static void inotify_update(int inotify_fd, long usec)
 {
 	struct timeval time;
 	ssize_t rdlen;
-	int offset;
+	int offset = 0;
 	char buffer[INOTIFY_BUF_LEN];
 	fd_set rfds;
-	int inotify_fd = *(int *)arg;
-
-	while (1) {
-		offset = 0;
-		FD_ZERO(&rfds);
-		FD_SET(inotify_fd, &rfds);
-		time.tv_sec = 2;
-		time.tv_usec = 0;
-		select(inotify_fd + 1, &rfds, NULL, NULL, &time);
-		if (FD_ISSET(inotify_fd, &rfds)) {
-			rdlen = read(inotify_fd, buffer, INOTIFY_BUF_LEN);
-			while (offset < rdlen) {
-				int qidx;
-				struct inotify_event *event =
-					(struct inotify_event *)(void *)
-					 &buffer[offset];
-				pktio_entry_t *entry;
-
-				offset += sizeof(struct inotify_event) +
-						event->len;
-
-				entry = pktio_from_event(event);
-				if (entry == NULL)
-					continue;
-
-				qidx = get_qidx_from_fifo(entry, event->name);
-				if (qidx == -1)
-					continue;
-
-				inotify_event_handle(entry, qidx, event);
-			}
+
+	FD_ZERO(&rfds);
+	FD_SET(inotify_fd, &rfds);
+	time.tv_sec = 0;
+	time.tv_usec = usec;
+	select(inotify_fd + 1, &rfds, NULL, NULL, &time);
+	if (!FD_ISSET(inotify_fd, &rfds))
+		return;
+
+	rdlen = read(inotify_fd, buffer, INOTIFY_BUF_LEN);
+
+	odp_spinlock_lock(&pcapng_gbl->lock);
+
+	while (offset < rdlen) {
+		int qidx;
+		struct inotify_event *event =
+			(struct inotify_event *)(void *)
+			 &buffer[offset];
+		pktio_entry_t *entry;
+
+		offset += sizeof(struct inotify_event) +
+				event->len;
+
+		entry = pktio_from_event(event);
+		if (entry == NULL)
+			continue;
+
+		qidx = get_qidx_from_fifo(entry, event->name);
+		if (qidx == -1)
+			continue;
+
+		inotify_event_handle(entry, qidx, event);
+	}
+
+	odp_spinlock_unlock(&pcapng_gbl->lock);
+}
+
+static inline pcapng_slot_t *slot_ptr(pcapng_entry_t *pcapng, pcapng_queue_t *queue,
+				      uint32_t idx)
+{
+	return (pcapng_slot_t *)(uintptr_t)(queue->slot_base + (uint64_t)idx * pcapng->slot_size);
+}
+
+/* Open capture file of a queue. On pktio restart, capture continues in a new section at the end
+ * of the file. Rotation truncates the next file. */
+static int pcapng_file_open(pktio_entry_t *entry, int qidx, odp_bool_t truncate)
+{
+	pcapng_entry_t *pcapng = pcapng_entry(entry);
+	pcapng_queue_t *queue = &pcapng->queue[qidx];
+	char path[PATH_MAX + 256];
+	struct stat st;
+	int fd;
+
+	snprintf(path, sizeof(path), "%s/%d-%s-flow-%d-%u.pcapng", pcapng_gbl->config.file_dir,
+		 odp_global_ro.main_pid, entry->name, qidx, pcapng->file_idx[qidx]);
+
+	fd = open(path, O_WRONLY | O_CREAT | (truncate ? O_TRUNC : O_APPEND),
+		  S_IRUSR | S_IWUSR | S_IRGRP);
+	if (fd == -1) {
+		_ODP_ERR("Failed to open capture file %s: %s\n", path, strerror(errno));
+		return -1;
+	}
+
+	pcapng->fd[qidx] = fd;
+	queue->file_bytes = 0;
+
+	if (fstat(fd, &st) == 0)
+		queue->file_bytes = st.st_size;
+
+	/* Full file from a previous pktio start */
+	if (pcapng_gbl->config.file_size && queue->file_bytes >= pcapng_gbl->config.file_size) {
+		close(fd);
+		pcapng->fd[qidx] = -1;
+		pcapng->file_idx[qidx] = (pcapng->file_idx[qidx] + 1) %
+					 pcapng_gbl->config.file_count;
+		return pcapng_file_open(entry, qidx, true);
+	}
+
+	if (write_pcapng_hdr(entry, qidx)) {
+		close(fd);
+		pcapng->fd[qidx] = -1;
+		return -1;
+	}
+
+	queue->file_bytes += sizeof(pcapng_section_hdr_block_t) +
+			     sizeof(pcapng_interface_description_block_t);
+
+	return 0;
+}
+
+/* Continue capture into the next file */
+static void pcapng_file_rotate(pktio_entry_t *entry, int qidx)
+{
+	pcapng_entry_t *pcapng = pcapng_entry(entry);
+
+	close(pcapng->fd[qidx]);
+	pcapng->fd[qidx] = -1;
+	pcapng->file_idx[qidx] = (pcapng->file_idx[qidx] + 1) % pcapng_gbl->config.file_count;
+
+	if (pcapng_file_open(entry, qidx, true))
+		pcapng->state[qidx] = PCAPNG_WR_STOP;
+}
+
+/*
+ * In fifo mode, each write is kept less than PIPE_BUF. This makes writes
+ * atomic (on non blocking mode): write() transfers all the data and returns
+ * the number of bytes requested or -EAGAIN.
+ */
+static ssize_t write_blocks(int fd, const struct iovec *chunk, int num_chunk)
+{
+	ssize_t len = 0;
+	ssize_t ret;
+
+	for (int i = 0; i < num_chunk; i++) {
+		ret = write(fd, chunk[i].iov_base, chunk[i].iov_len);
+		/*
+		 * we don't care if a write fails, we asynchronously read the fifo
+		 * so the next block of packets might be successful. This error only
+		 * means that some packets failed to append on the pcap file
+		 */
+		if (ret > 0)
+			len += ret;
+	}
+
+	return len;
+}
+
+/* Copy captured packets of a queue into the write buffer as enhanced packet blocks. Called by the
+ * writer thread inside global lock. Returns number of packets copied. */
+static int pcapng_copy_queue(pktio_entry_t *entry, int qidx)
+{
+	pcapng_entry_t *pcapng = pcapng_entry(entry);
+	pcapng_queue_t *queue = &pcapng->queue[qidx];
+	const uint32_t ring_mask = pcapng_gbl->config.ring_size - 1;
+	const size_t max_write = file_mode() ? SIZE_MAX : PIPE_BUF;
+	uint32_t slot_idx[PCAPNG_WRITE_BURST];
+	uint8_t *buf = pcapng_gbl->write.buf;
+	struct iovec *chunk = pcapng_gbl->write.chunk;
+	int num_chunk = 0;
+	uint64_t ts_ns;
+	uint32_t num, i;
+
+	pcapng_gbl->write.num_chunk = 0;
+
+	num = ring_mpmc_u32_deq_multi(&queue->cap_ring, queue->cap_data, ring_mask, slot_idx,
+				      PCAPNG_WRITE_BURST);
+	if (num == 0)
+		return 0;
+
+	/* Packets captured before fifo was closed are discarded */
+	if (pcapng->state[qidx] != PCAPNG_WR_PKT)
+		goto out;
+
+	chunk[0].iov_base = buf;
+	chunk[0].iov_len = 0;
+
+	for (i = 0; i < num; i++) {
+		pcapng_slot_t *slot = slot_ptr(pcapng, queue, slot_idx[i]);
+		uint32_t data_len = _ODP_ROUNDUP_ALIGN(slot->cap_len, PCAPNG_DATA_ALIGN);
+		uint32_t len = sizeof(pcapng_enhanced_packet_block_t) + data_len + sizeof(uint32_t);
+		pcapng_enhanced_packet_block_t epb;
+
+		if (chunk[num_chunk].iov_len + len > max_write) {
+			num_chunk++;
+			chunk[num_chunk].iov_base = buf;
+			chunk[num_chunk].iov_len = 0;
+		}
+
+		epb.block_type = PCAPNG_BLOCK_TYPE_EPB;
+		epb.block_total_length = len;
+		epb.interface_idx = 0;
+		ts_ns = slot->ts_ns + pcapng_gbl->tsoffset_ns;
+		epb.timestamp_high = (uint32_t)(ts_ns >> 32);
+		epb.timestamp_low = (uint32_t)(ts_ns);
+		epb.captured_len = slot->cap_len;
+		epb.packet_len = slot->pkt_len;
+
+		/* Slot data is followed by zeroed block padding */
+		memcpy(buf, &epb, sizeof(epb));
+		memcpy(buf + sizeof(epb), slot->data, data_len);
+		memcpy(buf + sizeof(epb) + data_len, &len, sizeof(uint32_t));
+
+		buf += len;
+		chunk[num_chunk].iov_len += len;
+	}
+
+	pcapng_gbl->write.num_chunk = num_chunk + 1;
+
+out:
+	ring_mpmc_u32_enq_multi(&queue->free_ring, queue->free_data, ring_mask, slot_idx, num);
+
+	return num;
+}
+
+/* Write captured packets of a queue. The global lock is not held while writing, so that data path
+ * threads and pktio start/stop are not blocked by file or fifo I/O. */
+static int pcapng_write_queue(int idx, uint32_t qidx)
+{
+	pcapng_entry_t *pcapng = &pcapng_gbl->entry[idx];
+	pktio_entry_t *entry;
+	ssize_t wlen;
+	int num, fd;
+
+	odp_spinlock_lock(&pcapng_gbl->lock);
+
+	entry = pcapng->pktio_entry;
+	if (entry == NULL || qidx >= pcapng->num_queues) {
+		odp_spinlock_unlock(&pcapng_gbl->lock);
+		return -1;
+	}
+
+	num = pcapng_copy_queue(entry, qidx);
+	if (pcapng_gbl->write.num_chunk == 0) {
+		odp_spinlock_unlock(&pcapng_gbl->lock);
+		return num;
+	}
+
+	/* Pktio stop waits until the write is done before closing the file */
+	fd = pcapng->fd[qidx];
+	odp_atomic_store_u32(&pcapng_gbl->write_entry, idx + 1);
+
+	odp_spinlock_unlock(&pcapng_gbl->lock);
+
+	wlen = write_blocks(fd, pcapng_gbl->write.chunk, pcapng_gbl->write.num_chunk);
+
+	odp_spinlock_lock(&pcapng_gbl->lock);
+
+	if (pcapng->pktio_entry != NULL && file_mode()) {
+		pcapng_queue_t *queue = &pcapng->queue[qidx];
+
+		queue->file_bytes += wlen;
+
+		if (pcapng_gbl->config.file_size &&
+		    queue->file_bytes >= pcapng_gbl->config.file_size)
+			pcapng_file_rotate(entry, qidx);
+	}
+
+	odp_atomic_store_rel_u32(&pcapng_gbl->write_entry, 0);
+
+	odp_spinlock_unlock(&pcapng_gbl->lock);
+
+	return num;
+}
+
+static int pcapng_write(void)
+{
+	int num = 0;
+
+	for (int i = 0; i < CONFIG_PKTIO_ENTRIES; i++) {
+		for (uint32_t q = 0; ; q++) {
+			int ret = pcapng_write_queue(i, q);
+
+			if (ret < 0)
+				break;
+
+			num += ret;
 		}
 	}
 
+	return num;
+}
+
+static void *pcapng_thread(void *arg ODP_UNUSED)
+{
+	int num = 0;
+
+	while (!odp_atomic_load_u32(&pcapng_gbl->thread_stop)) {
+		long usec = num ? 0 : PCAPNG_IDLE_USEC;
+
+		if (pcapng_gbl->inotify_fd != -1)
+			inotify_update(pcapng_gbl->inotify_fd, usec);
+		else if (usec)
+			usleep(usec);
+
+		num = pcapng_write();
+	}
+
 	return NULL;
 }
 
@@ -307,26 +900,86 @@ static int get_fifo_max_size(void)
 	return ret;
 }
 
-int _odp_pcapng_start(pktio_entry_t *entry)
+static int pcapng_rings_create(pktio_entry_t *entry, uint32_t num_queues)
 {
 	pcapng_entry_t *pcapng = pcapng_entry(entry);
-	int ret = -1, fd;
-	pthread_attr_t attr;
+	const uint32_t ring_size = pcapng_gbl->config.ring_size;
+	uint32_t maxlen = _ODP_MAX(odp_pktin_maxlen(entry->handle),
+				   odp_pktout_maxlen(entry->handle));
+	uint32_t snaplen = pcapng_gbl->config.snaplen;
+	uint64_t ring_data_size, slot_area_size, size;
+	char name[ODP_SHM_NAME_LEN];
+	uint8_t *base;
+
+	if (snaplen == 0 || snaplen > maxlen)
+		snaplen = maxlen;
+
+	if (snaplen > PCAPNG_MAX_SNAPLEN)
+		snaplen = PCAPNG_MAX_SNAPLEN;
+
+	/* Whole enhanced packet block must fit into an atomic fifo write */
+	if (!file_mode() && snaplen > PIPE_BUF - sizeof(pcapng_enhanced_packet_block_t) -
+				      sizeof(uint32_t))
+		snaplen = PIPE_BUF - sizeof(pcapng_enhanced_packet_block_t) - sizeof(uint32_t);
+
+	snaplen -= snaplen % PCAPNG_DATA_ALIGN;
+
+	pcapng->snaplen = snaplen;
+	pcapng->slot_size = _ODP_ROUNDUP_CACHE_LINE(sizeof(pcapng_slot_t) + snaplen);
+
+	ring_data_size = _ODP_ROUNDUP_CACHE_LINE(2 * ring_size * sizeof(uint32_t));
+	slot_area_size = (uint64_t)ring_size * pcapng->slot_size;
+	size = num_queues * (sizeof(pcapng_queue_t) + ring_data_size + slot_area_size);
+
+	snprintf(name, sizeof(name), "_odp_pcapng_%i", odp_pktio_index(entry->handle));
+	pcapng->shm = odp_shm_reserve(name, size, ODP_CACHE_LINE_SIZE, 0);
+	if (pcapng->shm == ODP_SHM_INVALID) {
+		_ODP_ERR("pcapng: capture ring reserve failed (%" PRIu64 " bytes)\n", size);
+		return -1;
+	}
+
+	base = odp_shm_addr(pcapng->shm);
+	pcapng->queue = (pcapng_queue_t *)(uintptr_t)base;
+	base += num_queues * sizeof(pcapng_queue_t);
+
+	for (uint32_t q = 0; q < num_queues; q++) {
+		pcapng_queue_t *queue = &pcapng->queue[q];
+
+		memset(queue, 0, sizeof(pcapng_queue_t));
+		ring_mpmc_u32_init(&queue->free_ring);
+		ring_mpmc_u32_init(&queue->cap_ring);
+		odp_atomic_init_u32(&queue->sample, 0);
+		odp_atomic_init_u64(&queue->drops, 0);
+
+		queue->free_data = (uint32_t *)(uintptr_t)base;
+		queue->cap_data = queue->free_data + ring_size;
+		base += ring_data_size;
+		queue->slot_base = base;
+		base += slot_area_size;
+
+		for (uint32_t i = 0; i < ring_size; i++)
+			ring_mpmc_u32_enq(&queue->free_ring, queue->free_data, ring_size - 1, i);
+	}
+
+	pcapng->num_queues = num_queues;
+
+	return 0;
+}
+
+static int pcapng_fifos_create(pktio_entry_t *entry)
+{
+	pcapng_entry_t *pcapng = pcapng_entry(entry);
+	int fd, fifo_sz;
 	unsigned int i;
-	unsigned int max_queue = _ODP_MAX(entry->num_in_queue, entry->num_out_queue);
-	int fifo_sz;
 
 	fifo_sz = get_fifo_max_size();
 	if (fifo_sz < 0)
 		_ODP_DBG("failed to read max fifo size\n");
 
-	for (i = 0; i < max_queue; i++) {
+	for (i = 0; i < pcapng->num_queues; i++) {
 		char pcapng_name[128];
 		char pcapng_path[256];
 
-		pcapng->fd[i] = -1;
-		pcapng->state[i] = PCAPNG_WR_STOP;
-
 		get_pcapng_fifo_name(pcapng_name, sizeof(pcapng_name),
 				     entry->name, i);
 		snprintf(pcapng_path, sizeof(pcapng_path), "%s/%s",
@@ -359,23 +1012,16 @@ int _odp_pcapng_start(pktio_entry_t *entry)
 		pcapng->fd[i] = fd;
 	}
 
-	odp_spinlock_lock(&pcapng_gbl->lock);
-
-	/* already running from a previous pktio */
-	if (pcapng_gbl->inotify_is_running == 1) {
-		pcapng->pktio_entry = entry;
-		pcapng_gbl->num_entries++;
-		odp_spinlock_unlock(&pcapng_gbl->lock);
-		return 0;
-	}
-
-	pcapng_gbl->inotify_fd = -1;
-	pcapng_gbl->inotify_watch_fd = -1;
+	return 0;
+}
 
+/* Called inside global lock */
+static int pcapng_inotify_init(void)
+{
 	pcapng_gbl->inotify_fd = inotify_init();
 	if (pcapng_gbl->inotify_fd == -1) {
 		_ODP_ERR("can't init inotify. pcap disabled\n");
-		goto out_destroy;
+		return -1;
 	}
 
 	pcapng_gbl->inotify_watch_fd = inotify_add_watch(pcapng_gbl->inotify_fd,
@@ -384,87 +1030,183 @@ int _odp_pcapng_start(pktio_entry_t *entry)
 
 	if (pcapng_gbl->inotify_watch_fd == -1) {
 		_ODP_ERR("can't register inotify for %s. pcap disabled\n", strerror(errno));
-		goto out_destroy;
+		close(pcapng_gbl->inotify_fd);
+		pcapng_gbl->inotify_fd = -1;
+		return -1;
 	}
 
-	/* create a thread to poll inotify triggers */
-	pthread_attr_init(&attr);
-	ret = pthread_create(&pcapng_gbl->inotify_thread, &attr, inotify_update,
-			     &pcapng_gbl->inotify_fd);
-	if (ret) {
-		_ODP_ERR("Can't start inotify thread (ret=%d). pcapng disabled.\n", ret);
+	return 0;
+}
+
+/* Called when the last pktio stops capture */
+static void pcapng_inotify_term(void)
+{
+	if (pcapng_gbl->inotify_fd == -1)
+		return;
+
+	if (inotify_rm_watch(pcapng_gbl->inotify_fd, pcapng_gbl->inotify_watch_fd))
+		_ODP_ERR("can't deregister inotify %s\n", strerror(errno));
+
+	close(pcapng_gbl->inotify_fd);
+	pcapng_gbl->inotify_fd = -1;
+	pcapng_gbl->inotify_watch_fd = -1;
+}
+
+static void pcapng_files_close(pktio_entry_t *entry)
+{
+	pcapng_entry_t *pcapng = pcapng_entry(entry);
+	unsigned int i;
+
+	for (i = 0; i < pcapng->num_queues; i++) {
+		char pcapng_name[128];
+		char pcapng_path[256];
+
+		pcapng->state[i] = PCAPNG_WR_STOP;
+
+		if (pcapng->fd[i] != -1)
+			close(pcapng->fd[i]);
+		pcapng->fd[i] = -1;
+
+		if (file_mode())
+			continue;
+
+		get_pcapng_fifo_name(pcapng_name, sizeof(pcapng_name),
+				     entry->name, i);
+		snprintf(pcapng_path, sizeof(pcapng_path), "%s/%s",
+			 PCAPNG_WATCH_DIR, pcapng_name);
+
+		if (remove(pcapng_path))
+			_ODP_ERR("can't delete fifo %s\n", pcapng_path);
+	}
+}
+
+static void pcapng_rings_destroy(pktio_entry_t *entry)
+{
+	pcapng_entry_t *pcapng = pcapng_entry(entry);
+	uint64_t drops = 0;
+
+	if (pcapng->shm == ODP_SHM_INVALID)
+		return;
+
+	for (uint32_t q = 0; q < pcapng->num_queues; q++)
+		drops += odp_atomic_load_u64(&pcapng->queue[q].drops);
+
+	if (drops)
+		_ODP_DBG("%s: %" PRIu64 " packets dropped from capture\n", entry->name, drops);
+
+	if (odp_shm_free(pcapng->shm))
+		_ODP_ERR("shm free failed\n");
+
+	pcapng->shm = ODP_SHM_INVALID;
+	pcapng->queue = NULL;
+	pcapng->num_queues = 0;
+}
+
+int _odp_pcapng_start(pktio_entry_t *entry)
+{
+	pcapng_entry_t *pcapng = pcapng_entry(entry);
+	int ret = -1;
+	pthread_attr_t attr;
+	unsigned int i;
+	unsigned int max_queue = _ODP_MAX(entry->num_in_queue, entry->num_out_queue);
+
+	for (i = 0; i < PKTIO_MAX_QUEUES; i++) {
+		pcapng->fd[i] = -1;
+		pcapng->state[i] = PCAPNG_WR_STOP;
+	}
+
+	if (pcapng_rings_create(entry, max_queue))
+		return -1;
+
+	if (file_mode()) {
+		for (i = 0; i < max_queue; i++) {
+			if (pcapng_file_open(entry, i, false) == 0)
+				pcapng->state[i] = PCAPNG_WR_PKT;
+		}
 	} else {
+		pcapng_fifos_create(entry);
+	}
+
+	odp_spinlock_lock(&pcapng_gbl->lock);
+
+	/* already running from a previous pktio */
+	if (pcapng_gbl->thread_is_running == 1) {
 		pcapng->pktio_entry = entry;
 		pcapng_gbl->num_entries++;
-		pcapng_gbl->inotify_is_running = 1;
+		odp_spinlock_unlock(&pcapng_gbl->lock);
+		return 0;
+	}
+
+	if (!file_mode() && pcapng_inotify_init())
+		goto out_destroy;
+
+	/* create a thread to poll inotify triggers and write captured packets */
+	odp_atomic_store_u32(&pcapng_gbl->thread_stop, 0);
+	pthread_attr_init(&attr);
+	ret = pthread_create(&pcapng_gbl->thread, &attr, pcapng_thread, NULL);
+	pthread_attr_destroy(&attr);
+	if (ret) {
+		_ODP_ERR("Can't start pcapng thread (ret=%d). pcapng disabled.\n", ret);
+		pcapng_inotify_term();
+		goto out_destroy;
 	}
 
+	pcapng->pktio_entry = entry;
+	pcapng_gbl->num_entries++;
+	pcapng_gbl->thread_is_running = 1;
+
 	odp_spinlock_unlock(&pcapng_gbl->lock);
 
-	return ret;
+	return 0;
 
 out_destroy:
 	odp_spinlock_unlock(&pcapng_gbl->lock);
 
-	_odp_pcapng_stop(entry);
+	pcapng_files_close(entry);
+	pcapng_rings_destroy(entry);
 
-	return ret;
+	return -1;
 }
 
 void _odp_pcapng_stop(pktio_entry_t *entry)
 {
 	pcapng_entry_t *pcapng = pcapng_entry(entry);
-	int ret;
-	unsigned int i;
-	unsigned int max_queue = _ODP_MAX(entry->num_in_queue, entry->num_out_queue);
+	int stop_thread = 0;
 
 	odp_spinlock_lock(&pcapng_gbl->lock);
 
-	pcapng->pktio_entry = NULL;
-	pcapng_gbl->num_entries--;
+	/* Writer thread does not access the entry after this */
+	if (pcapng->pktio_entry != NULL) {
+		pcapng->pktio_entry = NULL;
+		pcapng_gbl->num_entries--;
 
-	if (pcapng_gbl->inotify_is_running == 1 &&
-	    pcapng_gbl->num_entries == 0) {
-		ret = pthread_cancel(pcapng_gbl->inotify_thread);
-		if (ret)
-			_ODP_ERR("can't cancel inotify thread %s\n", strerror(errno));
-		pcapng_gbl->inotify_is_running = 0;
-	}
-
-	if (pcapng_gbl->num_entries == 0) {
-		/* fd's will be -1 in case of any failure */
-		ret = inotify_rm_watch(pcapng_gbl->inotify_fd,
-				       pcapng_gbl->inotify_watch_fd);
-		if (ret)
-			_ODP_ERR("can't deregister inotify %s\n", strerror(errno));
-
-		if (pcapng_gbl->inotify_fd != -1)
-			close(pcapng_gbl->inotify_fd);
-
-		if (pcapng_gbl->inotify_watch_fd != -1)
-			close(pcapng_gbl->inotify_watch_fd);
+		if (pcapng_gbl->thread_is_running == 1 &&
+		    pcapng_gbl->num_entries == 0) {
+			pcapng_gbl->thread_is_running = 0;
+			stop_thread = 1;
+		}
 	}
 
 	odp_spinlock_unlock(&pcapng_gbl->lock);
 
-	for (i = 0; i < max_queue; i++) {
-		char pcapng_name[128];
-		char pcapng_path[256];
+	/* Wait until the writer thread is not writing into the files of this entry */
+	while (odp_atomic_load_acq_u32(&pcapng_gbl->write_entry) ==
+	       (uint32_t)odp_pktio_index(entry->handle) + 1)
+		odp_cpu_pause();
 
-		pcapng->state[i] = PCAPNG_WR_STOP;
-		close(pcapng->fd[i]);
+	if (stop_thread) {
+		odp_atomic_store_u32(&pcapng_gbl->thread_stop, 1);
+		if (pthread_join(pcapng_gbl->thread, NULL))
+			_ODP_ERR("can't join pcapng thread\n");
 
-		get_pcapng_fifo_name(pcapng_name, sizeof(pcapng_name),
-				     entry->name, i);
-		snprintf(pcapng_path, sizeof(pcapng_path), "%s/%s",
-			 PCAPNG_WATCH_DIR, pcapng_name);
-
-		if (remove(pcapng_path))
-			_ODP_ERR("can't delete fifo %s\n", pcapng_path);
+		pcapng_inotify_term();
 	}
+
+	pcapng_files_close(entry);
+	pcapng_rings_destroy(entry);
 }
 
-int write_pcapng_hdr(pktio_entry_t *entry, int qidx)
+static int write_pcapng_hdr(pktio_entry_t *entry, int qidx)
 {
 	pcapng_entry_t *pcapng = pcapng_entry(entry);
 	size_t len;
@@ -489,113 +1231,167 @@ int write_pcapng_hdr(pktio_entry_t *entry, int qidx)
 		_ODP_ERR("Failed to write pcapng section hdr\n");
 		return -1;
 	}
-	fsync(fd);
 
 	idb.block_type = PCAPNG_BLOCK_TYPE_IDB;
 	idb.block_total_length = sizeof(idb);
 	idb.block_total_length2 = sizeof(idb);
 	idb.linktype = PCAPNG_LINKTYPE_ETHERNET;
-	idb.snaplen = 0x0; /* unlimited */
+	idb.snaplen = pcapng->snaplen;
+	idb.tsresol_code = PCAPNG_OPT_IF_TSRESOL;
+	idb.tsresol_len = 1;
+	idb.tsresol = PCAPNG_TSRESOL_NS;
+	idb.tsoffset_code = PCAPNG_OPT_IF_TSOFFSET;
+	idb.tsoffset_len = sizeof(idb.tsoffset);
+	idb.tsoffset = pcapng_gbl->tsoffset_sec;
+	idb.end_code = PCAPNG_OPT_ENDOFOPT;
+	idb.end_len = 0;
 	len = write(fd, &idb, sizeof(idb));
 	if (len != sizeof(idb)) {
 		_ODP_ERR("Failed to write pcapng interface description\n");
 		return -1;
 	}
-	fsync(fd);
 
 	return 0;
 }
 
-/*
- * make sure that each fifo write is less than PIPE_BUF
- * this will make sure writes are atomic (on non blocking mode).
- * writev() transfers all the data and returns the number of bytes requested or
- * -EAGAIN
- */
-static ssize_t write_fifo(int fd, struct iovec *iov, int iovcnt)
+static inline odp_bool_t filter_port_match(odp_packet_t pkt, uint16_t port)
 {
-	ssize_t len = 0;
+	uint32_t seg_len;
+	uint16_t ports[2];
+	const uint8_t *l4;
 
-	len = writev(fd, iov, iovcnt);
-	/*
-	 * we don't care if a writev fails, we asynchronously read the fifo
-	 * so the next block of packets might be successful. This error only
-	 * means that some packets failed to append on the pcap file
-	 */
-	if (len > 0)
-		fsync(fd);
+	if (!odp_packet_has_tcp(pkt) && !odp_packet_has_udp(pkt) && !odp_packet_has_sctp(pkt))
+		return false;
 
-	return len;
+	l4 = odp_packet_l4_ptr(pkt, &seg_len);
+	if (l4 == NULL || seg_len < sizeof(ports))
+		return false;
+
+	memcpy(ports, l4, sizeof(ports));
+
+	return odp_be_to_cpu_16(ports[0]) == port || odp_be_to_cpu_16(ports[1]) == port;
+}
+
+static inline odp_bool_t filter_host_match(odp_packet_t pkt, const pcapng_filter_t *f)
+{
+	uint32_t seg_len;
+	const uint8_t *l3;
+
+	if (f->type == FILTER_HOST) {
+		if (!odp_packet_has_ipv4(pkt))
+			return false;
+
+		l3 = odp_packet_l3_ptr(pkt, &seg_len);
+		if (l3 == NULL || seg_len < _ODP_IPV4HDR_LEN)
+			return false;
+
+		return !memcmp(l3 + 12, &f->ipv4, 4) || !memcmp(l3 + 16, &f->ipv4, 4);
+	}
+
+	if (!odp_packet_has_ipv6(pkt))
+		return false;
+
+	l3 = odp_packet_l3_ptr(pkt, &seg_len);
+	if (l3 == NULL || seg_len < _ODP_IPV6HDR_LEN)
+		return false;
+
+	return !memcmp(l3 + 8, f->ipv6, 16) || !memcmp(l3 + 24, f->ipv6, 16);
+}
+
+static inline odp_bool_t filter_term_match(odp_packet_t pkt, const pcapng_filter_t *f)
+{
+	switch (f->type) {
+	case FILTER_ARP:
+		return odp_packet_has_arp(pkt);
+	case FILTER_VLAN:
+		return odp_packet_has_vlan(pkt);
+	case FILTER_IPV4:
+		return odp_packet_has_ipv4(pkt);
+	case FILTER_IPV6:
+		return odp_packet_has_ipv6(pkt);
+	case FILTER_TCP:
+		return odp_packet_has_tcp(pkt);
+	case FILTER_UDP:
+		return odp_packet_has_udp(pkt);
+	case FILTER_SCTP:
+		return odp_packet_has_sctp(pkt);
+	case FILTER_ICMP:
+		return odp_packet_has_icmp(pkt);
+	case FILTER_PORT:
+		return filter_port_match(pkt, f->port);
+	default:
+		return filter_host_match(pkt, f);
+	}
+}
+
+/* All filter terms of an alternative must match. Alternatives are separated by 'or'. */
+static inline odp_bool_t filter_match(odp_packet_t pkt)
+{
+	odp_bool_t match = true;
+
+	for (int i = 0; i < pcapng_gbl->config.num_filter; i++) {
+		const pcapng_filter_t *f = &pcapng_gbl->config.filter[i];
+
+		if (f->alt) {
+			if (match)
+				return true;
+			match = true;
+		}
+
+		if (match && filter_term_match(pkt, f) == f->neg)
+			match = false;
+	}
+
+	return match;
 }
 
 int _odp_pcapng_dump_pkts(pktio_entry_t *entry, int qidx,
 			  const odp_packet_t packets[], int num)
 {
 	pcapng_entry_t *pcapng = pcapng_entry(entry);
-	int i = 0;
-	struct iovec packet_iov[3 * num];
-	pcapng_enhanced_packet_block_t epb[num];
-	int iovcnt = 0;
-	ssize_t block_len = 0;
-	int fd = pcapng->fd[qidx];
-	ssize_t len = 0, wlen;
+	const uint32_t ring_mask = pcapng_gbl->config.ring_size - 1;
+	const uint32_t sample_rate = pcapng_gbl->config.sample_rate;
+	pcapng_queue_t *queue;
+	int num_cap = 0;
 
 	if (odp_likely(pcapng->state[qidx] != PCAPNG_WR_PKT))
 		return 0;
 
-	for (i = 0; i < num; i++) {
-		odp_packet_hdr_t *pkt_hdr = packet_hdr(packets[i]);
-		uint32_t seg_len;
-		char *buf = (char *)odp_packet_offset(packets[i], 0, &seg_len,
-						      NULL);
-
-		if (block_len + sizeof(epb[i]) +
-		    _ODP_ROUNDUP_ALIGN(seg_len, PCAPNG_DATA_ALIGN) +
-		    sizeof(uint32_t) > PIPE_BUF) {
-			wlen = write_fifo(fd, packet_iov, iovcnt);
-			if (wlen > 0) {
-				len += wlen;
-				block_len = 0;
-				iovcnt = 0;
-			}
+	queue = &pcapng->queue[qidx];
+
+	for (int i = 0; i < num; i++) {
+		odp_packet_t pkt = packets[i];
+		pcapng_slot_t *slot;
+		uint32_t idx;
+
+		if (sample_rate > 1 && odp_atomic_fetch_inc_u32(&queue->sample) % sample_rate)
+			continue;
+
+		if (pcapng_gbl->config.num_filter && !filter_match(pkt))
+			continue;
+
+		if (odp_unlikely(ring_mpmc_u32_deq(&queue->free_ring, queue->free_data, ring_mask,
+						   &idx) == 0)) {
+			odp_atomic_inc_u64(&queue->drops);
+			continue;
 		}
-		epb[i].block_type = PCAPNG_BLOCK_TYPE_EPB;
-		epb[i].block_total_length = sizeof(epb[i]) +
-			_ODP_ROUNDUP_ALIGN(seg_len, PCAPNG_DATA_ALIGN) +
-			PCAPNG_DATA_ALIGN;
-		epb[i].interface_idx = 0;
-		epb[i].timestamp_high =
-			(uint32_t)(pkt_hdr->timestamp.u64 >> 32);
-		epb[i].timestamp_low = (uint32_t)(pkt_hdr->timestamp.u64);
-		epb[i].captured_len = seg_len;
-		epb[i].packet_len = seg_len;
-
-		/* epb */
-		packet_iov[iovcnt].iov_base = &epb[i];
-		packet_iov[iovcnt].iov_len = sizeof(epb[i]);
-		block_len += packet_iov[iovcnt].iov_len;
-		iovcnt++;
-
-		/* data */
-		packet_iov[iovcnt].iov_base = buf;
-		packet_iov[iovcnt].iov_len = _ODP_ROUNDUP_ALIGN(seg_len, PCAPNG_DATA_ALIGN);
-		block_len += packet_iov[iovcnt].iov_len;
-		iovcnt++;
-
-		/* trailing */
-		packet_iov[iovcnt].iov_base = &epb[i].block_total_length;
-		packet_iov[iovcnt].iov_len = sizeof(uint32_t);
-		block_len += packet_iov[iovcnt].iov_len;
-		iovcnt++;
-	}
-
-	if (iovcnt) {
-		wlen = write_fifo(fd, packet_iov, iovcnt);
-		if (wlen > 0)
-			len += wlen;
+
+		slot = slot_ptr(pcapng, queue, idx);
+		slot->pkt_len = odp_packet_len(pkt);
+		slot->cap_len = _ODP_MIN(slot->pkt_len, pcapng->snaplen);
+		slot->ts_ns = odp_packet_has_ts(pkt) ? odp_time_to_ns(odp_packet_ts(pkt)) :
+						       odp_time_global_ns();
+		odp_packet_copy_to_mem(pkt, 0, slot->cap_len, slot->data);
+
+		/* Zero block padding, slot may contain data of an earlier packet */
+		memset(&slot->data[slot->cap_len], 0,
+		       _ODP_ROUNDUP_ALIGN(slot->cap_len, PCAPNG_DATA_ALIGN) - slot->cap_len);
+
+		ring_mpmc_u32_enq(&queue->cap_ring, queue->cap_data, ring_mask, idx);
+		num_cap++;
 	}
 
-	return len;
+	return num_cap;
 }
 
 #else /* _ODP_PCAPNG */
@@ -3,6 +3,8 @@
  * Copyright (c) 2019-2026 Nokia
  */
 
+#include <odp_posix_extensions.h>
+
 #include <odp/api/align.h>
 #include <odp/api/atomic.h>
 #include <odp/api/hints.h>
@@ -10,6 +12,7 @@
 #include <odp/api/shared_memory.h>
 #include <odp/api/system_info.h>
 #include <odp/api/ticketlock.h>
+#include <odp/api/time.h>
 
 #include <odp/api/plat/pool_inline_types.h>
 #include <odp/api/plat/thread_inlines.h>
@@ -36,6 +39,8 @@
 #include <stdio.h>
 #include <stddef.h>
 #include <inttypes.h>
+#include <pthread.h>
+#include <sched.h>
 
 #define LOCK(a)      odp_ticketlock_lock(a)
 #define UNLOCK(a)    odp_ticketlock_unlock(a)
@@ -54,6 +59,22 @@
 /* Maximum packet user area size */
 #define MAX_UAREA_SIZE 2048
 
+/* Maximum number of threads initializing pool memory */
+#define POOL_INIT_MAX_THREADS 64
+
+/* Minimum number of events per pool memory initialization thread */
+#define POOL_INIT_MIN_EVENTS (16 * 1024)
+
+/* Number of events stored into the global pool ring at a time during pool
+ * memory initialization */
+#define POOL_INIT_BURST 64
+
+/* Maximum number of events sorted by pool at a time in multi-event free */
+#define FREE_BURST_MAX 256
+
+/* Number of pool index buckets in multi-event free. Must be a power of two. */
+#define FREE_NUM_BUCKETS 16
+
 ODP_STATIC_ASSERT(CONFIG_PACKET_SEG_LEN_MIN >= 256,
 		  "ODP Segment size must be a minimum of 256 bytes");
 
@@ -63,6 +84,12 @@ ODP_STATIC_ASSERT(CONFIG_PACKET_SEG_SIZE < 0xffff,
 ODP_STATIC_ASSERT(CONFIG_INTERNAL_POOLS < CONFIG_POOLS,
 		  "Internal pool count needs to be less than total configured pool count");
 
+ODP_STATIC_ASSERT(CONFIG_PACKET_CLASS_POOLS >= ODP_POOL_MAX_SUBPARAMS,
+		  "Packet length class pools need to fit a pool with all subparameters");
+
+ODP_STATIC_ASSERT(CONFIG_INTERNAL_POOLS + CONFIG_PACKET_CLASS_POOLS < CONFIG_POOLS,
+		  "Reserved pool count needs to be less than total configured pool count");
+
 /* Thread local variables */
 typedef struct pool_local_t {
 	pool_cache_t *cache[CONFIG_POOLS];
@@ -84,7 +111,8 @@ const _odp_pool_inline_offset_t _odp_pool_inline ODP_ALIGNED_CACHE = {
 	.uarea_size        = offsetof(pool_t, param_uarea_size),
 	.trailer_size      = offsetof(pool_t, trailer_size),
 	.ext_head_offset   = offsetof(pool_t, ext_head_offset),
-	.ext_pkt_buf_size  = offsetof(pool_t, ext_param.pkt.buf_size)
+	.ext_pkt_buf_size  = offsetof(pool_t, ext_param.pkt.buf_size),
+	.parent            = offsetof(pool_t, parent)
 };
 
 #include <odp/visibility_end.h>
@@ -199,50 +227,34 @@ static void cache_flush(pool_cache_t *cache, pool_t *pool)
 		ring_mpmc_rst_ptr_enq(ring, (void **)ring_data, mask, event_hdr);
 }
 
-static inline int cache_available(pool_t *pool, odp_pool_stats_t *stats)
+static inline int thread_cache_available(pool_t *pool, odp_pool_stats_t *stats)
 {
-	uint64_t cached = 0;
 	const uint16_t first = stats->thread.first;
 	const uint16_t last = stats->thread.last;
-	const odp_bool_t cache_available = pool->params.stats.bit.cache_available;
-	const odp_bool_t per_thread = pool->params.stats.bit.thread_cache_available;
 	const int max_threads = odp_thread_count_max();
+	const uint32_t num_class = pool->num_class ? pool->num_class : 1;
 	uint16_t out_idx = 0;
-	int i, idx_limit;
-
-	if (per_thread) {
-		if (first > last || last >= max_threads) {
-			_ODP_ERR("Bad thread ids: first=%" PRIu16 " last=%" PRIu16 "\n",
-				 first, last);
-			return -1;
-		}
 
-		if (last - first + 1 > ODP_POOL_MAX_THREAD_STATS) {
-			_ODP_ERR("Too many thread ids: max=%d\n", ODP_POOL_MAX_THREAD_STATS);
-			return -1;
-		}
+	if (first > last || last >= max_threads) {
+		_ODP_ERR("Bad thread ids: first=%" PRIu16 " last=%" PRIu16 "\n", first, last);
+		return -1;
 	}
 
-	if (cache_available) {
-		i = 0;
-		idx_limit = max_threads;
-	} else {
-		i = first;
-		idx_limit = last + 1;
+	if (last - first + 1 > ODP_POOL_MAX_THREAD_STATS) {
+		_ODP_ERR("Too many thread ids: max=%d\n", ODP_POOL_MAX_THREAD_STATS);
+		return -1;
 	}
 
-	for (; i < idx_limit; i++) {
-		uint32_t cur = odp_atomic_load_u32(&pool->local_cache[i].cache_num);
+	for (int i = first; i <= last; i++) {
+		uint64_t cur = 0;
 
-		if (per_thread && i >= first && i <= last)
-			stats->thread.cache_available[out_idx++] = cur;
+		/* Sum over all packet length classes */
+		for (uint32_t j = 0; j < num_class; j++)
+			cur += odp_atomic_load_u32(&pool->class_pool[j]->local_cache[i].cache_num);
 
-		cached += cur;
+		stats->thread.cache_available[out_idx++] = cur;
 	}
 
-	if (cache_available)
-		stats->cache_available = cached;
-
 	return 0;
 }
 
@@ -370,6 +382,20 @@ static int read_config_file(pool_global_t *pool_glb)
 	pool_glb->config.buf_min_align = align;
 	_ODP_PRINT("  %s: %u\n", str, align);
 
+	str = "pool.init_threads";
+	if (!_odp_libconfig_lookup_int(str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+
+	if (val < 1 || val > POOL_INIT_MAX_THREADS) {
+		_ODP_ERR("Bad value %s = %i\n", str, val);
+		return -1;
+	}
+
+	pool_glb->config.init_threads = val;
+	_ODP_PRINT("  %s: %i\n", str, val);
+
 	_ODP_PRINT("\n");
 
 	return 0;
@@ -392,6 +418,7 @@ int _odp_pool_init_global(void)
 
 	memset(_odp_pool_glb, 0, sizeof(pool_global_t));
 	_odp_pool_glb->shm = shm;
+	odp_atomic_init_u32(&_odp_pool_glb->num_class_pools, 0);
 
 	if (read_config_file(_odp_pool_glb)) {
 		odp_shm_free(shm);
@@ -497,6 +524,8 @@ static pool_t *reserve_pool(uint32_t shmflags, uint8_t pool_ext, uint32_t num)
 
 			memset(&pool->memset_mark, 0,
 			       sizeof(pool_t) - offsetof(pool_t, memset_mark));
+			pool->parent = _odp_pool_handle(pool);
+			pool->class_pool[0] = pool;
 			sprintf(ring_name, "_odp_pool_ring_%d", i);
 
 			/* Reserve memory for the ring, and for lookup table in case of pool ext */
@@ -554,6 +583,7 @@ static void init_event_hdr(pool_t *pool, _odp_event_hdr_t *event_hdr, uint32_t e
 	event_hdr->event_type   = type;
 	event_hdr->subtype      = ODP_EVENT_NO_SUBTYPE;
 	event_hdr->pool         = _odp_pool_handle(pool);
+	event_hdr->class_idx    = pool->class_idx;
 
 	/* Store base values for fast init */
 	if (type == ODP_POOL_BUFFER || type == ODP_POOL_PACKET) {
@@ -607,61 +637,63 @@ static void init_event_hdr(pool_t *pool, _odp_event_hdr_t *event_hdr, uint32_t e
 	}
 }
 
-static void init_buffers(pool_t *pool)
+/* Pool memory block range initialized by a single thread */
+typedef struct {
+	pool_t *pool;
+	uint64_t page_size;
+	uint64_t first_block;
+	uint32_t first_event;
+	uint32_t num;
+
+} init_range_t;
+
+/* Skip packet buffers which cross huge page boundaries. Some NICs cannot
+ * handle buffers which cross page boundaries. */
+static inline int skip_block(const pool_t *pool, uint64_t page_size, uint64_t block)
 {
-	_odp_event_hdr_t *event_hdr;
+	uint64_t first_page, last_page;
+	uintptr_t addr;
+
+	if (pool->type != ODP_POOL_PACKET || page_size < FIRST_HP_SIZE)
+		return 0;
+
+	addr = (uintptr_t)&pool->base_addr[block * pool->block_size];
+	first_page = (uint64_t)addr & ~(page_size - 1);
+	last_page = ((uint64_t)addr + pool->block_size - 1) & ~(page_size - 1);
+
+	return last_page != first_page;
+}
+
+static void *init_range(void *arg)
+{
+	init_range_t *range = arg;
+	pool_t *pool = range->pool;
+	_odp_event_hdr_t *event_hdr[POOL_INIT_BURST];
+	_odp_event_hdr_t *hdr;
 	odp_buffer_hdr_t *buf_hdr;
 	odp_packet_hdr_t *pkt_hdr;
-	odp_shm_info_t shm_info;
 	void *addr;
 	void *uarea = NULL;
 	uint8_t *data = NULL;
 	uint8_t *data_ptr = NULL;
 	uint32_t offset;
-	ring_mpmc_rst_ptr_t *ring;
-	_odp_event_hdr_t **ring_data;
-	uint32_t mask;
-	odp_pool_type_t type;
-	uint64_t page_size;
-	int skipped_blocks = 0;
-
-	if (odp_shm_info(pool->shm, &shm_info))
-		_ODP_ABORT("Shm info failed\n");
+	uint32_t event_idx = range->first_event;
+	uint32_t num = 0;
+	uint64_t block = range->first_block;
+	odp_pool_type_t type = pool->type;
 
-	page_size = shm_info.page_size;
-	ring = &pool->ring->hdr;
-	ring_data = pool->ring->event_hdr;
-	mask = pool->ring_mask;
-	type = pool->type;
-
-	for (uint64_t i = 0; i < pool->num + skipped_blocks ; i++) {
-		addr = &pool->base_addr[i * pool->block_size];
-
-		/* Skip packet buffers which cross huge page boundaries. Some
-		 * NICs cannot handle buffers which cross page boundaries. */
-		if (type == ODP_POOL_PACKET && page_size >= FIRST_HP_SIZE) {
-			uint64_t first_page;
-			uint64_t last_page;
-
-			first_page = ((uint64_t)(uintptr_t)addr &
-					~(page_size - 1));
-			last_page = (((uint64_t)(uintptr_t)addr +
-					pool->block_size - 1) &
-					~(page_size - 1));
-			if (last_page != first_page) {
-				skipped_blocks++;
-				continue;
-			}
-		}
+	for (uint32_t i = 0; i < range->num; block++) {
+		if (skip_block(pool, range->page_size, block))
+			continue;
 
+		addr = &pool->base_addr[block * pool->block_size];
 		addr = (uint8_t *)addr + pool->block_offset;
-		event_hdr = addr;
+		hdr = addr;
 		buf_hdr = addr;
 		pkt_hdr = addr;
 
 		if (pool->uarea_size)
-			uarea = &pool->uarea_base_addr[(i - skipped_blocks) *
-						       pool->uarea_size];
+			uarea = &pool->uarea_base_addr[(uint64_t)event_idx * pool->uarea_size];
 
 		/* Only buffers and packets have data pointer */
 		if (type == ODP_POOL_BUFFER || type == ODP_POOL_PACKET) {
@@ -679,12 +711,112 @@ static void init_buffers(pool_t *pool)
 			data_ptr = &data[offset];
 		}
 
-		init_event_hdr(pool, event_hdr, i, data_ptr, uarea);
+		init_event_hdr(pool, hdr, block, data_ptr, uarea);
+		event_hdr[num++] = hdr;
+		event_idx++;
+		i++;
 
-		/* Store buffer into the global pool */
-		ring_mpmc_rst_ptr_enq(ring, (void **)ring_data, mask, event_hdr);
+		/* Store buffers into the global pool */
+		if (num == POOL_INIT_BURST || i == range->num) {
+			ring_mpmc_rst_ptr_enq_multi(&pool->ring->hdr, (void **)pool->ring->event_hdr,
+						    pool->ring_mask, (void **)event_hdr, num);
+			num = 0;
+		}
+	}
+
+	return NULL;
+}
+
+static int init_thread_create(pthread_t *thread, init_range_t *range)
+{
+	pthread_attr_t attr;
+	cpu_set_t cpu_set;
+	int cpu, ret;
+
+	/* Helper threads run on control CPUs, so that they do not disturb workers. Otherwise,
+	 * they would inherit the (possibly single CPU) affinity of the thread creating the pool. */
+	CPU_ZERO(&cpu_set);
+	cpu = odp_cpumask_first(&odp_global_ro.control_cpus);
+	while (cpu >= 0) {
+		CPU_SET(cpu, &cpu_set);
+		cpu = odp_cpumask_next(&odp_global_ro.control_cpus, cpu);
+	}
+
+	if (pthread_attr_init(&attr))
+		return -1;
+
+	if (pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &cpu_set)) {
+		pthread_attr_destroy(&attr);
+		return -1;
+	}
+
+	ret = pthread_create(thread, &attr, init_range, range);
+	pthread_attr_destroy(&attr);
+
+	return ret ? -1 : 0;
+}
+
+static void init_buffers(pool_t *pool)
+{
+	init_range_t range[POOL_INIT_MAX_THREADS];
+	pthread_t thread[POOL_INIT_MAX_THREADS];
+	int started[POOL_INIT_MAX_THREADS];
+	odp_shm_info_t shm_info;
+	void *uarea;
+	uint64_t page_size;
+	uint64_t block = 0;
+	uint32_t num_thr, event_idx = 0;
+
+	if (odp_shm_info(pool->shm, &shm_info))
+		_ODP_ABORT("Shm info failed\n");
+
+	page_size = shm_info.page_size;
+
+	num_thr = _odp_pool_glb->config.init_threads;
+	if (num_thr > pool->num / POOL_INIT_MIN_EVENTS)
+		num_thr = pool->num / POOL_INIT_MIN_EVENTS;
+	if (num_thr == 0)
+		num_thr = 1;
+
+	/* Split events evenly between threads. Skipped blocks are searched here, since each
+	 * thread needs to know its first block and event index. */
+	for (uint32_t i = 0; i < num_thr; i++) {
+		uint32_t end = (uint32_t)(((uint64_t)pool->num * (i + 1)) / num_thr);
+
+		while (skip_block(pool, page_size, block))
+			block++;
+
+		range[i].pool        = pool;
+		range[i].page_size   = page_size;
+		range[i].first_block = block;
+		range[i].first_event = event_idx;
+		range[i].num         = end - event_idx;
+
+		while (event_idx < end) {
+			if (!skip_block(pool, page_size, block))
+				event_idx++;
+			block++;
+		}
+	}
+
+	pool->skipped_blocks = block - pool->num;
+	pool->init_threads = 1;
+
+	for (uint32_t i = 1; i < num_thr; i++) {
+		started[i] = !init_thread_create(&thread[i], &range[i]);
+
+		if (started[i])
+			pool->init_threads++;
+		else
+			init_range(&range[i]);
+	}
+
+	init_range(&range[0]);
+
+	for (uint32_t i = 1; i < num_thr; i++) {
+		if (started[i] && pthread_join(thread[i], NULL))
+			_ODP_ABORT("Pool init thread join failed\n");
 	}
-	pool->skipped_blocks = skipped_blocks;
 
 	if (pool->uarea_size && pool->params.uarea_init.init_fn) {
 		for (uint32_t i = 0; i < pool->num; i++) {
@@ -791,9 +923,11 @@ static void set_mem_src_ops(pool_t *pool)
 }
 
 /* Create pool according to params. Actual type of the pool is type_2, which is recorded for pool
- * info calls. */
-odp_pool_t _odp_pool_create(const char *name, const odp_pool_param_t *params,
-			    odp_pool_type_t type_2)
+ * info calls. When 'pkt_class' is not NULL, the pool stores packet length class 'class_idx' of a
+ * packet pool with subparameters. */
+static odp_pool_t pool_create(const char *name, const odp_pool_param_t *params,
+			      odp_pool_type_t type_2, const odp_pool_pkt_subparam_t *pkt_class,
+			      uint32_t class_idx)
 {
 	pool_t *pool;
 	uint32_t uarea_size, headroom, tailroom;
@@ -804,6 +938,7 @@ odp_pool_t _odp_pool_create(const char *name, const odp_pool_param_t *params,
 	odp_pool_type_t type = params->type;
 	uint32_t shmflags = 0;
 	uint32_t num_extra = 0;
+	uint64_t huge_page_size, t1, t2, t3;
 	const char *max_prefix = "pool_000_";
 	int max_prefix_len = strlen(max_prefix);
 	char shm_name[ODP_POOL_NAME_LEN + max_prefix_len];
@@ -863,6 +998,29 @@ odp_pool_t _odp_pool_create(const char *name, const odp_pool_param_t *params,
 		seg_len = CONFIG_PACKET_MAX_SEG_LEN;
 		max_len = _odp_pool_glb->config.pkt_max_len;
 		trailer_size = _ODP_EV_ENDMARK_SIZE;
+		headroom    = CONFIG_PACKET_HEADROOM;
+		tailroom    = CONFIG_PACKET_TAILROOM;
+		uarea_size  = params->pkt.uarea_size;
+		cache_size  = params->pkt.cache_size;
+
+		if (params->pkt.max_len != 0)
+			max_len = params->pkt.max_len;
+
+		if (pkt_class) {
+			/* Segment fits a class length packet. Packets of small classes are
+			 * limited to PKT_MAX_SEGS segments instead of growing segments. */
+			num = pkt_class->num;
+			seg_len = _ODP_MAX(pkt_class->len, params->pkt.seg_len);
+			seg_len = _ODP_MAX(seg_len, (uint32_t)CONFIG_PACKET_CLASS_SEG_LEN_MIN);
+			seg_len = _ODP_ROUNDUP_CACHE_LINE(seg_len);
+			if (seg_len > CONFIG_PACKET_MAX_SEG_LEN)
+				seg_len = CONFIG_PACKET_MAX_SEG_LEN;
+			if (pkt_class->len > seg_len)
+				num *= (pkt_class->len + seg_len - 1) / seg_len;
+			if (max_len > PKT_MAX_SEGS * seg_len)
+				max_len = PKT_MAX_SEGS * seg_len;
+			break;
+		}
 
 		if (params->pkt.len &&
 		    params->pkt.len < CONFIG_PACKET_MAX_SEG_LEN)
@@ -874,8 +1032,6 @@ odp_pool_t _odp_pool_create(const char *name, const odp_pool_param_t *params,
 
 		/* Make sure that at least one 'max_len' packet can fit in the
 		 * pool. */
-		if (params->pkt.max_len != 0)
-			max_len = params->pkt.max_len;
 		if ((max_len + seg_len - 1) / seg_len > PKT_MAX_SEGS)
 			seg_len = (max_len + PKT_MAX_SEGS - 1) / PKT_MAX_SEGS;
 		if (seg_len > CONFIG_PACKET_MAX_SEG_LEN) {
@@ -893,11 +1049,6 @@ odp_pool_t _odp_pool_create(const char *name, const odp_pool_param_t *params,
 				 params->pkt.max_num, num);
 			return ODP_POOL_INVALID;
 		}
-
-		headroom    = CONFIG_PACKET_HEADROOM;
-		tailroom    = CONFIG_PACKET_TAILROOM;
-		uarea_size  = params->pkt.uarea_size;
-		cache_size  = params->pkt.cache_size;
 		break;
 
 	case ODP_POOL_TIMEOUT:
@@ -933,6 +1084,7 @@ odp_pool_t _odp_pool_create(const char *name, const odp_pool_param_t *params,
 	}
 
 	set_pool_name(pool, name);
+	pool->class_idx = class_idx;
 
 	/* Format SHM names from prefix, pool index and pool name. */
 	sprintf(shm_name,   "pool_%03i_%s", pool->pool_idx, pool->name);
@@ -941,7 +1093,10 @@ odp_pool_t _odp_pool_create(const char *name, const odp_pool_param_t *params,
 	pool->type_2 = type_2;
 	pool->params = *params;
 	pool->block_offset = 0;
-	set_mem_src_ops(pool);
+
+	/* Memory source consumers bind a single pool */
+	if (pkt_class == NULL)
+		set_mem_src_ops(pool);
 
 	if (type == ODP_POOL_PACKET) {
 		uint32_t adj_size;
@@ -1010,6 +1165,7 @@ odp_pool_t _odp_pool_create(const char *name, const odp_pool_param_t *params,
 
 	set_pool_cache_size(pool, cache_size);
 
+	t1 = odp_time_local_strict_ns();
 	shm = odp_shm_reserve(shm_name, pool->shm_size, ODP_PAGE_SIZE,
 			      shmflags);
 
@@ -1022,6 +1178,12 @@ odp_pool_t _odp_pool_create(const char *name, const odp_pool_param_t *params,
 
 	pool->mem_from_huge_pages = shm_is_from_huge_pages(pool->shm);
 
+	/* Report fallback to normal pages when pool memory would fill at least one huge page */
+	huge_page_size = odp_sys_huge_page_size();
+	if (!pool->mem_from_huge_pages && huge_page_size && pool->shm_size >= huge_page_size)
+		_ODP_WARN("Pool %s (%" PRIu64 " bytes) does not use huge pages\n", pool->name,
+			  pool->shm_size);
+
 	pool->base_addr = odp_shm_addr(pool->shm);
 	pool->max_addr  = pool->base_addr + pool->shm_size - 1;
 
@@ -1030,8 +1192,13 @@ odp_pool_t _odp_pool_create(const char *name, const odp_pool_param_t *params,
 		goto error;
 	}
 
+	t2 = odp_time_local_strict_ns();
 	ring_mpmc_rst_ptr_init(&pool->ring->hdr);
 	init_buffers(pool);
+	t3 = odp_time_local_strict_ns();
+
+	pool->shm_time_ns  = t2 - t1;
+	pool->init_time_ns = t3 - t2;
 
 	if (type == ODP_POOL_PACKET && pool->mem_src_ops && pool->mem_src_ops->bind &&
 	    pool->mem_src_ops->bind(pool->mem_src_data, pool)) {
@@ -1072,6 +1239,101 @@ error:
 	return ODP_POOL_INVALID;
 }
 
+odp_pool_t _odp_pool_create(const char *name, const odp_pool_param_t *params,
+			    odp_pool_type_t type_2)
+{
+	return pool_create(name, params, type_2, NULL, 0);
+}
+
+static int pool_destroy(pool_t *pool)
+{
+	const int max_threads = odp_thread_count_max();
+	int i;
+
+	LOCK(&pool->lock);
+
+	if (pool->reserved == 0) {
+		UNLOCK(&pool->lock);
+		_ODP_ERR("Pool not created\n");
+		return -1;
+	}
+
+	if (pool->type == ODP_POOL_PACKET && pool->mem_src_ops && pool->mem_src_ops->unbind)
+		pool->mem_src_ops->unbind(pool->mem_src_data);
+
+	/* Make sure local caches are empty */
+	for (i = 0; i < max_threads; i++)
+		cache_flush(&pool->local_cache[i], pool);
+
+	if (pool->pool_ext == 0)
+		odp_shm_free(pool->shm);
+
+	if (pool->uarea_shm != ODP_SHM_INVALID)
+		odp_shm_free(pool->uarea_shm);
+
+	pool->reserved = 0;
+	odp_shm_free(pool->ring_shm);
+	pool->ring = NULL;
+	UNLOCK(&pool->lock);
+
+	return 0;
+}
+
+/* Create a packet pool with subparameters. Each packet length class is stored in its own pool.
+ * The first pool of the set stores the main num/len class and is the pool handle visible to
+ * application. */
+static odp_pool_t pool_create_classes(const char *name, const odp_pool_param_t *params)
+{
+	odp_pool_pkt_subparam_t pkt_class[_ODP_POOL_MAX_CLASSES];
+	pool_t *class_pool[_ODP_POOL_MAX_CLASSES];
+	const uint32_t num_class = params->pkt.num_subparam + 1;
+	odp_pool_t pool_hdl;
+	pool_t *pool;
+	uint32_t i;
+
+	pkt_class[0].num = params->pkt.num;
+	pkt_class[0].len = params->pkt.len;
+
+	for (i = 1; i < num_class; i++)
+		pkt_class[i] = params->pkt.sub[i - 1];
+
+	/* Additional classes use the pools reserved for them */
+	if (odp_atomic_fetch_add_u32(&_odp_pool_glb->num_class_pools, num_class - 1) +
+	    num_class - 1 > CONFIG_PACKET_CLASS_POOLS) {
+		odp_atomic_sub_u32(&_odp_pool_glb->num_class_pools, num_class - 1);
+		_ODP_ERR("No more pools for packet length classes\n");
+		return ODP_POOL_INVALID;
+	}
+
+	for (i = 0; i < num_class; i++) {
+		/* Only the first pool has a name, so that lookup finds it */
+		pool_hdl = pool_create(i == 0 ? name : NULL, params, ODP_POOL_PACKET,
+				       &pkt_class[i], i);
+
+		if (pool_hdl == ODP_POOL_INVALID) {
+			_ODP_ERR("Packet length class %u create failed\n", i);
+
+			while (i--)
+				pool_destroy(class_pool[i]);
+
+			odp_atomic_sub_u32(&_odp_pool_glb->num_class_pools, num_class - 1);
+			return ODP_POOL_INVALID;
+		}
+
+		class_pool[i] = _odp_pool_entry(pool_hdl);
+	}
+
+	pool = class_pool[0];
+
+	for (i = 0; i < num_class; i++) {
+		class_pool[i]->num_class = num_class;
+		class_pool[i]->parent    = _odp_pool_handle(pool);
+		pool->class_pool[i]      = class_pool[i];
+	}
+
+	return _odp_pool_handle(pool);
+}
+
 static int check_params(const odp_pool_param_t *params)
 {
 	odp_pool_capability_t capa;
@@ -1159,6 +1421,35 @@ static int check_params(const odp_pool_param_t *params)
 			return -1;
 		}
 
+		if (params->pkt.num_subparam > capa.pkt.max_num_subparam) {
+			_ODP_ERR("pkt.num_subparam too large %u\n", params->pkt.num_subparam);
+			return -1;
+		}
+
+		for (uint32_t i = 0; i < params->pkt.num_subparam; i++) {
+			const odp_pool_pkt_subparam_t *sub = &params->pkt.sub[i];
+			const uint32_t prev_len = i ? params->pkt.sub[i - 1].len : params->pkt.len;
+
+			if (sub->len <= prev_len || sub->len > capa.pkt.max_len) {
+				_ODP_ERR("Bad pkt.sub[%u].len %u\n", i, sub->len);
+				return -1;
+			}
+
+			if (sub->num > capa.pkt.max_num) {
+				_ODP_ERR("pkt.sub[%u].num too large %u\n", i, sub->num);
+				return -1;
+			}
+
+			num += sub->num;
+		}
+
+		if (params->pkt.num_subparam && params->pkt.max_num &&
+		    num > params->pkt.max_num) {
+			_ODP_ERR("Pool 'max_num' parameter too small (%u/%u)\n",
+				 params->pkt.max_num, num);
+			return -1;
+		}
+
 		if (params->stats.all & ~capa.pkt.stats.all) {
 			_ODP_ERR("Unsupported pool statistics counter\n");
 			return -1;
@@ -1284,45 +1575,31 @@ odp_pool_t odp_pool_create(const char *name, const odp_pool_param_t *params)
 	if (check_params(params))
 		return ODP_POOL_INVALID;
 
+	if (params->type == ODP_POOL_PACKET && params->pkt.num_subparam)
+		return pool_create_classes(name, params);
+
 	return _odp_pool_create(name, params, params->type);
 }
 
 int odp_pool_destroy(odp_pool_t pool_hdl)
 {
 	pool_t *pool = _odp_pool_entry(pool_hdl);
-	const int max_threads = odp_thread_count_max();
-	int i;
+	int ret = 0;
 
 	if (pool == NULL)
 		return -1;
 
-	LOCK(&pool->lock);
+	/* Other packet length classes are destroyed with the first pool of the set */
+	if (pool->num_class && pool->class_idx == 0) {
+		const uint32_t num_class = pool->num_class;
 
-	if (pool->reserved == 0) {
-		UNLOCK(&pool->lock);
-		_ODP_ERR("Pool not created\n");
-		return -1;
-	}
-
-	if (pool->type == ODP_POOL_PACKET && pool->mem_src_ops && pool->mem_src_ops->unbind)
-		pool->mem_src_ops->unbind(pool->mem_src_data);
-
-	/* Make sure local caches are empty */
-	for (i = 0; i < max_threads; i++)
-		cache_flush(&pool->local_cache[i], pool);
-
-	if (pool->pool_ext == 0)
-		odp_shm_free(pool->shm);
-
-	if (pool->uarea_shm != ODP_SHM_INVALID)
-		odp_shm_free(pool->uarea_shm);
+		for (uint32_t i = 1; i < num_class; i++)
+			ret |= pool_destroy(pool->class_pool[i]);
 
-	pool->reserved = 0;
-	odp_shm_free(pool->ring_shm);
-	pool->ring = NULL;
-	UNLOCK(&pool->lock);
+		odp_atomic_sub_u32(&_odp_pool_glb->num_class_pools, num_class - 1);
+	}
 
-	return 0;
+	return pool_destroy(pool) | ret;
 }
 
 odp_pool_t odp_pool_lookup(const char *name)
@@ -1380,9 +1657,27 @@ int odp_pool_info(odp_pool_t pool_hdl, odp_pool_info_t *info)
 	info->min_data_addr = (uintptr_t)pool->base_addr;
 	info->max_data_addr = (uintptr_t)pool->max_addr;
 
+	/* Packet length classes are stored in separate memory areas */
+	for (uint32_t i = 1; i < pool->num_class; i++) {
+		const pool_t *class_pool = pool->class_pool[i];
+
+		info->pkt.max_num += class_pool->num;
+		info->min_data_addr = _ODP_MIN(info->min_data_addr,
+					       (uintptr_t)class_pool->base_addr);
+		info->max_data_addr = _ODP_MAX(info->max_data_addr,
+					       (uintptr_t)class_pool->max_addr);
+	}
+
 	return 0;
 }
 
+/* Packet length class pools count allocation failures per packet allocation request, since
+ * a request falls back to other classes */
+static inline int count_alloc_fail(const pool_t *pool)
+{
+	return pool->params.stats.bit.alloc_fails && pool->num_class == 0;
+}
+
 odp_event_t _odp_event_alloc(pool_t *pool)
 {
 	pool_cache_t *cache = local.cache[pool->pool_idx];
@@ -1405,7 +1700,7 @@ odp_event_t _odp_event_alloc(pool_t *pool)
 	if (CONFIG_POOL_STATISTICS) {
 		if (pool->params.stats.bit.alloc_ops)
 			odp_atomic_inc_u64(&pool->stats.alloc_ops);
-		if (odp_unlikely(pool->params.stats.bit.alloc_fails && cached == 0))
+		if (odp_unlikely(cached == 0 && count_alloc_fail(pool)))
 			odp_atomic_inc_u64(&pool->stats.alloc_fails);
 	}
 
@@ -1456,7 +1751,7 @@ int _odp_event_alloc_multi(pool_t *pool, _odp_event_hdr_t *event_hdr[], int max_
 		if (CONFIG_POOL_STATISTICS) {
 			if (pool->params.stats.bit.alloc_ops)
 				odp_atomic_inc_u64(&pool->stats.alloc_ops);
-			if (odp_unlikely(pool->params.stats.bit.alloc_fails && burst == 0))
+			if (odp_unlikely(burst == 0 && count_alloc_fail(pool)))
 				odp_atomic_inc_u64(&pool->stats.alloc_fails);
 		}
 
@@ -1578,7 +1873,7 @@ void _odp_event_free(odp_event_t event)
 		odp_atomic_inc_u64(&pool->stats.cache_free_ops);
 }
 
-void _odp_event_free_multi(_odp_event_hdr_t *event_hdr[], int num_total)
+static inline void event_free_runs(_odp_event_hdr_t *event_hdr[], int num_total)
 {
 	pool_t *pool;
 	int num;
@@ -1604,11 +1899,75 @@ void _odp_event_free_multi(_odp_event_hdr_t *event_hdr[], int num_total)
 	}
 }
 
+static inline void event_free_burst(_odp_event_hdr_t *event_hdr[], int num)
+{
+	_odp_event_hdr_t *sorted[FREE_BURST_MAX];
+	uint16_t pos[FREE_NUM_BUCKETS];
+	odp_pool_t pool;
+	uint32_t diff = 0;
+	uint16_t sum = 0;
+
+	if (odp_unlikely(num <= 0))
+		return;
+
+	pool = event_hdr[0]->pool;
+
+	/* Common case: all events are from the same pool */
+	for (int i = 0; i < num; i++)
+		diff |= (event_hdr[i]->pool != pool);
+
+	if (odp_likely(diff == 0)) {
+		event_free_to_pool(_odp_pool_entry(pool), event_hdr, num);
+		return;
+	}
+
+	/* Bucket events by low bits of pool index (stable counting sort), so that events of the
+	 * same pool are returned with a single cache or ring operation. Pools sharing a bucket
+	 * are split into runs afterwards. */
+	memset(pos, 0, sizeof(pos));
+
+	for (int i = 0; i < num; i++)
+		pos[event_hdr[i]->index.pool & (FREE_NUM_BUCKETS - 1)]++;
+
+	for (int b = 0; b < FREE_NUM_BUCKETS; b++) {
+		uint16_t cnt = pos[b];
+
+		pos[b] = sum;
+		sum += cnt;
+	}
+
+	for (int i = 0; i < num; i++)
+		sorted[pos[event_hdr[i]->index.pool & (FREE_NUM_BUCKETS - 1)]++] = event_hdr[i];
+
+	event_free_runs(sorted, num);
+}
+
+void _odp_event_free_multi(_odp_event_hdr_t *event_hdr[], int num_total)
+{
+	while (odp_unlikely(num_total > FREE_BURST_MAX)) {
+		event_free_burst(event_hdr, FREE_BURST_MAX);
+		event_hdr += FREE_BURST_MAX;
+		num_total -= FREE_BURST_MAX;
+	}
+
+	event_free_burst(event_hdr, num_total);
+}
+
 void _odp_event_free_sp(_odp_event_hdr_t *event_hdr[], int num)
 {
+	pool_t *pool;
+
 	_ODP_ASSERT(num > 0);
 
-	event_free_to_pool(_odp_pool_entry(event_hdr[0]->pool), event_hdr, num);
+	pool = _odp_pool_entry(event_hdr[0]->pool);
+
+	/* Packets of the same pool may be stored in different packet length classes */
+	if (odp_unlikely(pool->num_class)) {
+		_odp_event_free_multi(event_hdr, num);
+		return;
+	}
+
+	event_free_to_pool(pool, event_hdr, num);
 }
 
 odp_buffer_t odp_buffer_alloc(odp_pool_t pool_hdl)
@@ -1660,8 +2019,8 @@ int odp_pool_capability(odp_pool_capability_t *capa)
 {
 	odp_pool_stats_opt_t supported_stats;
 	uint32_t max_seg_len = CONFIG_PACKET_MAX_SEG_LEN;
-	/* Reserve pools for internal usage */
-	unsigned int max_pools = CONFIG_POOLS - CONFIG_INTERNAL_POOLS;
+	/* Reserve pools for internal usage and packet length classes */
+	unsigned int max_pools = CONFIG_POOLS - CONFIG_INTERNAL_POOLS - CONFIG_PACKET_CLASS_POOLS;
 
 	memset(capa, 0, sizeof(odp_pool_capability_t));
 
@@ -1702,6 +2061,7 @@ int odp_pool_capability(odp_pool_capability_t *capa)
 	capa->pkt.max_seg_len      = max_seg_len;
 	capa->pkt.max_uarea_size   = MAX_UAREA_SIZE;
 	capa->pkt.uarea_persistence = true;
+	capa->pkt.max_num_subparam = ODP_POOL_MAX_SUBPARAMS;
 	capa->pkt.min_cache_size   = 0;
 	capa->pkt.max_cache_size   = CONFIG_POOL_CACHE_MAX_SIZE;
 	capa->pkt.stats.all = supported_stats.all;
@@ -1809,11 +2169,28 @@ void odp_pool_print(odp_pool_t pool_hdl)
 	_ODP_PRINT("  max addr        %p\n", (void *)pool->max_addr);
 	_ODP_PRINT("  uarea shm size  %" PRIu64 "\n", pool->uarea_shm_size);
 	_ODP_PRINT("  uarea base addr %p\n", (void *)pool->uarea_base_addr);
+	_ODP_PRINT("  huge pages      %s\n", pool->mem_from_huge_pages ? "yes" : "no");
+	_ODP_PRINT("  shm reserve ns  %" PRIu64 "\n", pool->shm_time_ns);
+	_ODP_PRINT("  init ns         %" PRIu64 "\n", pool->init_time_ns);
+	_ODP_PRINT("  init threads    %u\n", pool->init_threads);
 	_ODP_PRINT("  cache size      %u\n", pool->cache_size);
 	_ODP_PRINT("  burst size      %u\n", pool->burst_size);
 	_ODP_PRINT("  mem src         %s\n",
 		   pool->mem_src_ops ? pool->mem_src_ops->name : "(none)");
 	_ODP_PRINT("  event valid.    %d\n", _ODP_EVENT_VALIDATION);
+
+	if (pool->num_class) {
+		_ODP_PRINT("  length classes  %u\n", pool->num_class);
+
+		for (uint32_t i = 0; i < pool->num_class; i++) {
+			const pool_t *class_pool = pool->class_pool[i];
+
+			_ODP_PRINT("    %u: pool index %u, seg len %u, num %u, max data len %u\n", i,
+				   class_pool->pool_idx, class_pool->seg_len, class_pool->num,
+				   class_pool->max_len);
+		}
+	}
+
 	_ODP_PRINT("\n");
 }
 
@@ -1885,9 +2262,52 @@ unsigned int odp_pool_max_index(void)
 	return CONFIG_POOLS - 1;
 }
 
+/* Read selected counters of a single pool (or packet length class) */
+static void read_stats(pool_t *pool, odp_pool_stats_selected_t *stats,
+		       const odp_pool_stats_opt_t *opt)
+{
+	if (opt->bit.available)
+		stats->available = ring_mpmc_rst_ptr_len(&pool->ring->hdr);
+
+	if (opt->bit.alloc_ops || opt->bit.total_ops)
+		stats->alloc_ops = odp_atomic_load_u64(&pool->stats.alloc_ops);
+
+	if (opt->bit.alloc_fails)
+		stats->alloc_fails = odp_atomic_load_u64(&pool->stats.alloc_fails);
+
+	if (opt->bit.free_ops || opt->bit.total_ops)
+		stats->free_ops = odp_atomic_load_u64(&pool->stats.free_ops);
+
+	if (opt->bit.total_ops)
+		stats->total_ops = stats->alloc_ops + stats->free_ops;
+
+	if (opt->bit.cache_available)
+		stats->cache_available = cache_total_available(pool);
+
+	if (opt->bit.cache_alloc_ops)
+		stats->cache_alloc_ops = odp_atomic_load_u64(&pool->stats.cache_alloc_ops);
+
+	if (opt->bit.cache_free_ops)
+		stats->cache_free_ops = odp_atomic_load_u64(&pool->stats.cache_free_ops);
+}
+
+static void add_stats(odp_pool_stats_selected_t *sum, const odp_pool_stats_selected_t *stats)
+{
+	sum->available       += stats->available;
+	sum->alloc_ops       += stats->alloc_ops;
+	sum->alloc_fails     += stats->alloc_fails;
+	sum->free_ops        += stats->free_ops;
+	sum->total_ops       += stats->total_ops;
+	sum->cache_available += stats->cache_available;
+	sum->cache_alloc_ops += stats->cache_alloc_ops;
+	sum->cache_free_ops  += stats->cache_free_ops;
+}
+
 int odp_pool_stats(odp_pool_t pool_hdl, odp_pool_stats_t *stats)
 {
 	pool_t *pool;
+	odp_pool_stats_selected_t sum;
+	uint32_t num_class;
 
 	if (odp_unlikely(pool_hdl == ODP_POOL_INVALID)) {
 		_ODP_ERR("Invalid pool handle\n");
@@ -1899,36 +2319,33 @@ int odp_pool_stats(odp_pool_t pool_hdl, odp_pool_stats_t *stats)
 	}
 
 	pool = _odp_pool_entry(pool_hdl);
+	num_class = pool->num_class ? pool->num_class : 1;
 
 	/* Zero everything else but per thread statistics */
 	memset(stats, 0, offsetof(odp_pool_stats_t, thread));
+	memset(&sum, 0, sizeof(sum));
 
-	if (pool->params.stats.bit.available)
-		stats->available = ring_mpmc_rst_ptr_len(&pool->ring->hdr);
-
-	if (pool->params.stats.bit.alloc_ops)
-		stats->alloc_ops = odp_atomic_load_u64(&pool->stats.alloc_ops);
-
-	if (pool->params.stats.bit.alloc_fails)
-		stats->alloc_fails = odp_atomic_load_u64(&pool->stats.alloc_fails);
-
-	if (pool->params.stats.bit.free_ops)
-		stats->free_ops = odp_atomic_load_u64(&pool->stats.free_ops);
-
-	if (pool->params.stats.bit.total_ops)
-		stats->total_ops = stats->alloc_ops + stats->free_ops;
-
-	if (pool->params.stats.bit.cache_available ||
-	    pool->params.stats.bit.thread_cache_available) {
-		if (cache_available(pool, stats))
+	if (pool->params.stats.bit.thread_cache_available) {
+		if (thread_cache_available(pool, stats))
 			return -1;
 	}
 
-	if (pool->params.stats.bit.cache_alloc_ops)
-		stats->cache_alloc_ops = odp_atomic_load_u64(&pool->stats.cache_alloc_ops);
+	for (uint32_t i = 0; i < num_class; i++) {
+		odp_pool_stats_selected_t cur;
 
-	if (pool->params.stats.bit.cache_free_ops)
-		stats->cache_free_ops = odp_atomic_load_u64(&pool->stats.cache_free_ops);
+		memset(&cur, 0, sizeof(cur));
+		read_stats(pool->class_pool[i], &cur, &pool->params.stats);
+		add_stats(&sum, &cur);
+	}
+
+	stats->available       = sum.available;
+	stats->alloc_ops       = sum.alloc_ops;
+	stats->alloc_fails     = sum.alloc_fails;
+	stats->free_ops        = sum.free_ops;
+	stats->total_ops       = sum.total_ops;
+	stats->cache_available = sum.cache_available;
+	stats->cache_alloc_ops = sum.cache_alloc_ops;
+	stats->cache_free_ops  = sum.cache_free_ops;
 
 	return 0;
 }
@@ -1958,29 +2375,55 @@ int odp_pool_stats_selected(odp_pool_t pool_hdl, odp_pool_stats_selected_t *stat
 		return -1;
 	}
 
-	if (opt->bit.available)
-		stats->available = ring_mpmc_rst_ptr_len(&pool->ring->hdr);
+	if (odp_likely(pool->num_class == 0)) {
+		read_stats(pool, stats, opt);
+		return 0;
+	}
 
-	if (opt->bit.alloc_ops || opt->bit.total_ops)
-		stats->alloc_ops = odp_atomic_load_u64(&pool->stats.alloc_ops);
+	memset(stats, 0, sizeof(odp_pool_stats_selected_t));
 
-	if (opt->bit.alloc_fails)
-		stats->alloc_fails = odp_atomic_load_u64(&pool->stats.alloc_fails);
+	for (uint32_t i = 0; i < pool->num_class; i++) {
+		odp_pool_stats_selected_t cur;
 
-	if (opt->bit.free_ops || opt->bit.total_ops)
-		stats->free_ops = odp_atomic_load_u64(&pool->stats.free_ops);
+		memset(&cur, 0, sizeof(cur));
+		read_stats(pool->class_pool[i], &cur, opt);
+		add_stats(stats, &cur);
+	}
 
-	if (opt->bit.total_ops)
-		stats->total_ops = stats->alloc_ops + stats->free_ops;
+	return 0;
+}
 
-	if (opt->bit.cache_available)
-		stats->cache_available = cache_total_available(pool);
+int odp_pool_stats_subparam(odp_pool_t pool_hdl, uint32_t idx, odp_pool_stats_selected_t *stats,
+			    const odp_pool_stats_opt_t *opt)
+{
+	pool_t *pool;
 
-	if (opt->bit.cache_alloc_ops)
-		stats->cache_alloc_ops = odp_atomic_load_u64(&pool->stats.cache_alloc_ops);
+	if (odp_unlikely(pool_hdl == ODP_POOL_INVALID)) {
+		_ODP_ERR("Invalid pool handle\n");
+		return -1;
+	}
+	if (odp_unlikely(stats == NULL)) {
+		_ODP_ERR("Output buffer NULL\n");
+		return -1;
+	}
+	if (odp_unlikely(opt == NULL)) {
+		_ODP_ERR("Pool counters NULL\n");
+		return -1;
+	}
 
-	if (opt->bit.cache_free_ops)
-		stats->cache_free_ops = odp_atomic_load_u64(&pool->stats.cache_free_ops);
+	pool = _odp_pool_entry(pool_hdl);
+
+	if (odp_unlikely(idx >= pool->num_class)) {
+		_ODP_ERR("Bad subparameter index %u\n", idx);
+		return -1;
+	}
+
+	if (odp_unlikely(opt->all & ~pool->params.stats.all)) {
+		_ODP_ERR("Trying to read disabled counter\n");
+		return -1;
+	}
+
+	read_stats(pool->class_pool[idx], stats, opt);
 
 	return 0;
 }
@@ -1988,6 +2431,7 @@ int odp_pool_stats_selected(odp_pool_t pool_hdl, odp_pool_stats_selected_t *stat
 int odp_pool_stats_reset(odp_pool_t pool_hdl)
 {
 	pool_t *pool;
+	uint32_t num_class;
 
 	if (odp_unlikely(pool_hdl == ODP_POOL_INVALID)) {
 		_ODP_ERR("Invalid pool handle\n");
@@ -1995,12 +2439,17 @@ int odp_pool_stats_reset(odp_pool_t pool_hdl)
 	}
 
 	pool = _odp_pool_entry(pool_hdl);
+	num_class = pool->num_class ? pool->num_class : 1;
 
-	odp_atomic_store_u64(&pool->stats.alloc_ops, 0);
-	odp_atomic_store_u64(&pool->stats.alloc_fails, 0);
-	odp_atomic_store_u64(&pool->stats.free_ops, 0);
-	odp_atomic_store_u64(&pool->stats.cache_alloc_ops, 0);
-	odp_atomic_store_u64(&pool->stats.cache_free_ops, 0);
+	for (uint32_t i = 0; i < num_class; i++) {
+		pool_t *class_pool = pool->class_pool[i];
+
+		odp_atomic_store_u64(&class_pool->stats.alloc_ops, 0);
+		odp_atomic_store_u64(&class_pool->stats.alloc_fails, 0);
+		odp_atomic_store_u64(&class_pool->stats.free_ops, 0);
+		odp_atomic_store_u64(&class_pool->stats.cache_alloc_ops, 0);
+		odp_atomic_store_u64(&class_pool->stats.cache_free_ops, 0);
+	}
 
 	return 0;
 }
@@ -2092,7 +2541,7 @@ int odp_pool_ext_capability(odp_pool_type_t type, odp_pool_ext_capability_t *cap
 	memset(capa, 0, sizeof(odp_pool_ext_capability_t));
 
 	capa->type           = type;
-	capa->max_pools      = CONFIG_POOLS - CONFIG_INTERNAL_POOLS;
+	capa->max_pools      = CONFIG_POOLS - CONFIG_INTERNAL_POOLS - CONFIG_PACKET_CLASS_POOLS;
 	capa->min_cache_size = 0;
 	capa->max_cache_size = CONFIG_POOL_CACHE_MAX_SIZE;
 	capa->stats.all      = supported_stats.all;
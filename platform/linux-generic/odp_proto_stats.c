@@ -0,0 +1,338 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#include <odp/api/align.h>
+#include <odp/api/atomic.h>
+#include <odp/api/hints.h>
+#include <odp/api/packet.h>
+#include <odp/api/packet_io.h>
+#include <odp/api/proto_stats.h>
+#include <odp/api/shared_memory.h>
+#include <odp/api/std_types.h>
+#include <odp/api/thread.h>
+#include <odp/api/ticketlock.h>
+
+#include <odp/api/plat/atomic_inlines.h>
+#include <odp/api/plat/strong_types.h>
+
+#include <odp_config_internal.h>
+#include <odp_debug_internal.h>
+#include <odp_init_internal.h>
+#include <odp_packet_internal.h>
+#include <odp_proto_stats_internal.h>
+#include <odp_string_internal.h>
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Counters are sharded by thread ID to avoid cache line contention between threads that
+ * update the same object. Each shard of an object is on its own cache line, and shards
+ * are laid out so that a thread updates only cache lines of its own shard. Counters are
+ * summed over all shards on read. */
+
+ODP_STATIC_ASSERT(CONFIG_MAX_PROTO_STATS <= UINT16_MAX, "Too many proto stats objects");
+
+typedef struct ODP_ALIGNED_CACHE {
+	odp_atomic_u64_t tx_pkts;
+	odp_atomic_u64_t tx_oct_count0;
+	odp_atomic_u64_t tx_oct_count1;
+
+} proto_stats_shard_t;
+
+typedef struct {
+	odp_proto_stats_param_t param;
+	uint8_t used;
+	char name[ODP_PROTO_STATS_NAME_LEN];
+
+} proto_stats_entry_t;
+
+typedef struct proto_stats_global_t {
+	proto_stats_shard_t shard[CONFIG_PROTO_STATS_SHARDS][CONFIG_MAX_PROTO_STATS];
+	proto_stats_entry_t entry[CONFIG_MAX_PROTO_STATS];
+	odp_ticketlock_t lock;
+	odp_shm_t shm;
+
+} proto_stats_global_t;
+
+static proto_stats_global_t *proto_stats_global;
+
+static inline int proto_stats_idx(odp_proto_stats_t stat)
+{
+	uint32_t idx = _odp_proto_stats_to_idx(stat);
+
+	if (odp_unlikely(stat == ODP_PROTO_STATS_INVALID || idx >= CONFIG_MAX_PROTO_STATS ||
+			 !proto_stats_global->entry[idx].used))
+		return -1;
+
+	return idx;
+}
+
+int _odp_proto_stats_init_global(void)
+{
+	odp_shm_t shm;
+
+	shm = odp_shm_reserve("_odp_proto_stats_global", sizeof(proto_stats_global_t),
+			      ODP_CACHE_LINE_SIZE, 0);
+
+	proto_stats_global = odp_shm_addr(shm);
+
+	if (proto_stats_global == NULL) {
+		_ODP_ERR("SHM reserve of proto stats global data failed\n");
+		return -1;
+	}
+
+	memset(proto_stats_global, 0, sizeof(proto_stats_global_t));
+	proto_stats_global->shm = shm;
+	odp_ticketlock_init(&proto_stats_global->lock);
+
+	return 0;
+}
+
+int _odp_proto_stats_term_global(void)
+{
+	if (proto_stats_global == NULL)
+		return 0;
+
+	for (int i = 0; i < CONFIG_MAX_PROTO_STATS; i++) {
+		if (proto_stats_global->entry[i].used)
+			_ODP_ERR("Proto stats not destroyed: %s\n",
+				 proto_stats_global->entry[i].name);
+	}
+
+	if (odp_shm_free(proto_stats_global->shm)) {
+		_ODP_ERR("SHM free failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+void odp_proto_stats_param_init(odp_proto_stats_param_t *param)
+{
+	if (param)
+		memset(param, 0, sizeof(*param));
+}
+
+int odp_proto_stats_capability(odp_pktio_t pktio, odp_proto_stats_capability_t *capa)
+{
+	if (capa == NULL || odp_pktio_index(pktio) < 0)
+		return -1;
+
+	memset(capa, 0, sizeof(*capa));
+
+	/* Packet output is common to all pktios */
+	capa->tx.counters.bit.tx_pkts = 1;
+	capa->tx.counters.bit.tx_oct_count0 = 1;
+	capa->tx.counters.bit.tx_oct_count1 = 1;
+	capa->tx.oct_count0_adj = true;
+	capa->tx.oct_count1_adj = true;
+
+	return 0;
+}
+
+odp_proto_stats_t odp_proto_stats_lookup(const char *name)
+{
+	odp_proto_stats_t stat = ODP_PROTO_STATS_INVALID;
+
+	if (name == NULL)
+		return ODP_PROTO_STATS_INVALID;
+
+	odp_ticketlock_lock(&proto_stats_global->lock);
+
+	for (uint32_t i = 0; i < CONFIG_MAX_PROTO_STATS; i++) {
+		proto_stats_entry_t *entry = &proto_stats_global->entry[i];
+
+		if (entry->used && strcmp(entry->name, name) == 0) {
+			stat = _odp_proto_stats_from_idx(i);
+			break;
+		}
+	}
+
+	odp_ticketlock_unlock(&proto_stats_global->lock);
+
+	return stat;
+}
+
+odp_proto_stats_t odp_proto_stats_create(const char *name, const odp_proto_stats_param_t *param)
+{
+	const uint64_t supported = (odp_proto_stats_counters_t){ .bit = { .tx_pkts = 1,
+				   .tx_oct_count0 = 1, .tx_oct_count1 = 1 } }.all_bits;
+	odp_proto_stats_t stat = ODP_PROTO_STATS_INVALID;
+	proto_stats_entry_t *entry;
+
+	if (param == NULL) {
+		_ODP_ERR("Bad parameter\n");
+		return ODP_PROTO_STATS_INVALID;
+	}
+
+	/* Counters that are not supported are allowed, but never updated */
+	if (param->counters.all_bits & ~supported)
+		_ODP_DBG("Unsupported proto stats counters: 0x%" PRIx64 "\n",
+			 param->counters.all_bits & ~supported);
+
+	odp_ticketlock_lock(&proto_stats_global->lock);
+
+	for (uint32_t i = 0; i < CONFIG_MAX_PROTO_STATS; i++) {
+		entry = &proto_stats_global->entry[i];
+
+		if (entry->used)
+			continue;
+
+		for (int j = 0; j < CONFIG_PROTO_STATS_SHARDS; j++) {
+			proto_stats_shard_t *shard = &proto_stats_global->shard[j][i];
+
+			odp_atomic_init_u64(&shard->tx_pkts, 0);
+			odp_atomic_init_u64(&shard->tx_oct_count0, 0);
+			odp_atomic_init_u64(&shard->tx_oct_count1, 0);
+		}
+
+		entry->param = *param;
+		entry->name[0] = 0;
+		if (name)
+			_odp_strcpy(entry->name, name, ODP_PROTO_STATS_NAME_LEN);
+
+		entry->used = 1;
+		stat = _odp_proto_stats_from_idx(i);
+		break;
+	}
+
+	odp_ticketlock_unlock(&proto_stats_global->lock);
+
+	if (stat == ODP_PROTO_STATS_INVALID)
+		_ODP_ERR("No free proto stats objects\n");
+
+	return stat;
+}
+
+int odp_proto_stats_destroy(odp_proto_stats_t stat)
+{
+	int idx;
+
+	odp_ticketlock_lock(&proto_stats_global->lock);
+
+	idx = proto_stats_idx(stat);
+	if (idx >= 0)
+		proto_stats_global->entry[idx].used = 0;
+
+	odp_ticketlock_unlock(&proto_stats_global->lock);
+
+	if (idx < 0) {
+		_ODP_ERR("Bad proto stats handle\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+int odp_proto_stats(odp_proto_stats_t stat, odp_proto_stats_data_t *data)
+{
+	int idx = proto_stats_idx(stat);
+
+	if (idx < 0 || data == NULL) {
+		_ODP_ERR("Bad parameter\n");
+		return -1;
+	}
+
+	memset(data, 0, sizeof(odp_proto_stats_data_t));
+
+	for (int i = 0; i < CONFIG_PROTO_STATS_SHARDS; i++) {
+		proto_stats_shard_t *shard = &proto_stats_global->shard[i][idx];
+
+		data->tx_pkts       += odp_atomic_load_u64(&shard->tx_pkts);
+		data->tx_oct_count0 += odp_atomic_load_u64(&shard->tx_oct_count0);
+		data->tx_oct_count1 += odp_atomic_load_u64(&shard->tx_oct_count1);
+	}
+
+	return 0;
+}
+
+void odp_proto_stats_print(odp_proto_stats_t stat)
+{
+	odp_proto_stats_data_t data;
+	int idx = proto_stats_idx(stat);
+
+	if (idx < 0 || odp_proto_stats(stat, &data)) {
+		_ODP_ERR("Bad proto stats handle\n");
+		return;
+	}
+
+	_ODP_PRINT("\nProto stats info\n");
+	_ODP_PRINT("----------------\n");
+	_ODP_PRINT("  handle          0x%" PRIxPTR "\n", _odp_typeval(stat));
+	_ODP_PRINT("  name            %s\n", proto_stats_global->entry[idx].name);
+	_ODP_PRINT("  counters        0x%" PRIx64 "\n",
+		   proto_stats_global->entry[idx].param.counters.all_bits);
+	_ODP_PRINT("  tx_pkts         %" PRIu64 "\n", data.tx_pkts);
+	_ODP_PRINT("  tx_oct_count0   %" PRIu64 "\n", data.tx_oct_count0);
+	_ODP_PRINT("  tx_oct_count1   %" PRIu64 "\n", data.tx_oct_count1);
+	_ODP_PRINT("\n");
+}
+
+static inline uint32_t oct_count(uint32_t len, int32_t adj)
+{
+	int64_t count = (int64_t)len + adj;
+
+	return count > 0 ? (uint32_t)count : 0;
+}
+
+int _odp_proto_stats_tx_prepare(const odp_packet_t packets[], int num,
+				_odp_proto_stats_tx_t info[])
+{
+	int num_info = 0;
+
+	for (int i = 0; i < num; i++) {
+		const odp_packet_hdr_t *pkt_hdr = packet_hdr(packets[i]);
+
+		if (odp_likely(!pkt_hdr->p.flags.proto_stats))
+			continue;
+
+		info[num_info].idx = pkt_hdr->proto_stats_idx;
+		info[num_info].pkt_idx = i;
+		info[num_info].oct_count0 = oct_count(pkt_hdr->frame_len,
+						      pkt_hdr->proto_stats_adj[0]);
+		info[num_info].oct_count1 = oct_count(pkt_hdr->frame_len,
+						      pkt_hdr->proto_stats_adj[1]);
+		num_info++;
+	}
+
+	return num_info;
+}
+
+void _odp_proto_stats_tx_finish(const _odp_proto_stats_tx_t info[], int num, int num_sent)
+{
+	proto_stats_shard_t *shard;
+	const proto_stats_entry_t *entry;
+	uint64_t pkts, oct0, oct1;
+	uint32_t idx;
+	int shard_idx = odp_thread_id() % CONFIG_PROTO_STATS_SHARDS;
+	int i = 0;
+
+	while (i < num && info[i].pkt_idx < num_sent) {
+		idx = info[i].idx;
+		pkts = 0;
+		oct0 = 0;
+		oct1 = 0;
+
+		/* Merge consecutive updates of the same object */
+		do {
+			pkts++;
+			oct0 += info[i].oct_count0;
+			oct1 += info[i].oct_count1;
+			i++;
+		} while (i < num && info[i].idx == idx && info[i].pkt_idx < num_sent);
+
+		entry = &proto_stats_global->entry[idx];
+		shard = &proto_stats_global->shard[shard_idx][idx];
+
+		if (entry->param.counters.bit.tx_pkts)
+			odp_atomic_add_u64(&shard->tx_pkts, pkts);
+
+		if (entry->param.counters.bit.tx_oct_count0)
+			odp_atomic_add_u64(&shard->tx_oct_count0, oct0);
+
+		if (entry->param.counters.bit.tx_oct_count1)
+			odp_atomic_add_u64(&shard->tx_oct_count1, oct1);
+	}
+}
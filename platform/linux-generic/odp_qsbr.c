@@ -0,0 +1,526 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#include <odp/api/align.h>
+#include <odp/api/atomic.h>
+#include <odp/api/cpu.h>
+#include <odp/api/hints.h>
+#include <odp/api/qsbr.h>
+#include <odp/api/shared_memory.h>
+#include <odp/api/std_types.h>
+#include <odp/api/sync.h>
+#include <odp/api/thread.h>
+#include <odp/api/ticketlock.h>
+
+#include <odp/api/plat/atomic_inlines.h>
+#include <odp/api/plat/cpu_inlines.h>
+#include <odp/api/plat/strong_types.h>
+#include <odp/api/plat/thread_inlines.h>
+
+#include <odp_config_internal.h>
+#include <odp_debug_internal.h>
+#include <odp_global_data.h>
+#include <odp_init_internal.h>
+#include <odp_macros_internal.h>
+#include <odp_qsbr_internal.h>
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Each domain has a grace period counter, which writers increment, and a sequence number
+ * per thread. An online thread reports a quiescent state by copying the current counter
+ * value into its sequence number with a plain store. Zero sequence number means that
+ * the thread is offline. A grace period that was started when the counter was set to
+ * value N has ended when all online threads have sequence number N or larger.
+ */
+
+#define MAX_DEFER  (1024 * 1024)
+
+typedef struct ODP_ALIGNED_CACHE {
+	odp_atomic_u64_t seq;
+
+} thr_state_t;
+
+typedef struct {
+	odp_qsbr_free_fn_t free_fn;
+	void *ptr;
+	uint64_t token;
+
+} defer_entry_t;
+
+typedef struct ODP_ALIGNED_CACHE qsbr_t {
+	/* Read only data */
+	thr_state_t *thr;
+	uint32_t num_thr;
+	odp_bool_t sched_quiescent;
+
+	/* Grace period counter */
+	odp_atomic_u64_t ODP_ALIGNED_CACHE token;
+
+	/* Deferred free queue */
+	odp_ticketlock_t ODP_ALIGNED_CACHE lock;
+	defer_entry_t *defer;
+	uint32_t num_defer;
+	uint32_t head;
+	uint32_t count;
+	uint64_t num_reclaimed;
+	int      index;
+	odp_shm_t shm;
+	char     name[ODP_QSBR_NAME_LEN];
+
+} qsbr_t;
+
+typedef struct qsbr_global_t {
+	odp_ticketlock_t lock;
+	odp_shm_t        shm;
+	qsbr_t           *domain[CONFIG_MAX_QSBR];
+
+} qsbr_global_t;
+
+static qsbr_global_t *qsbr_global;
+
+__thread _odp_qsbr_local_t _odp_qsbr_local;
+
+static inline qsbr_t *qsbr_entry(odp_qsbr_t qsbr)
+{
+	return (qsbr_t *)(uintptr_t)qsbr;
+}
+
+static inline odp_qsbr_t qsbr_handle(qsbr_t *qsbr)
+{
+	return (odp_qsbr_t)(uintptr_t)qsbr;
+}
+
+int _odp_qsbr_init_global(void)
+{
+	odp_shm_t shm;
+
+	shm = odp_shm_reserve("_odp_qsbr_global", sizeof(qsbr_global_t),
+			      ODP_CACHE_LINE_SIZE, 0);
+
+	qsbr_global = odp_shm_addr(shm);
+
+	if (qsbr_global == NULL) {
+		_ODP_ERR("SHM reserve of QSBR global data failed\n");
+		return -1;
+	}
+
+	memset(qsbr_global, 0, sizeof(qsbr_global_t));
+	qsbr_global->shm = shm;
+	odp_ticketlock_init(&qsbr_global->lock);
+
+	return 0;
+}
+
+int _odp_qsbr_term_global(void)
+{
+	if (qsbr_global == NULL)
+		return 0;
+
+	for (int i = 0; i < CONFIG_MAX_QSBR; i++) {
+		if (qsbr_global->domain[i])
+			_ODP_ERR("QSBR domain not destroyed: %s\n", qsbr_global->domain[i]->name);
+	}
+
+	if (odp_shm_free(qsbr_global->shm)) {
+		_ODP_ERR("SHM free failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+int odp_qsbr_capability(odp_qsbr_capability_t *capa)
+{
+	memset(capa, 0, sizeof(odp_qsbr_capability_t));
+
+	capa->max_domains = CONFIG_MAX_QSBR;
+	capa->max_defer   = MAX_DEFER;
+
+	return 0;
+}
+
+void odp_qsbr_param_init(odp_qsbr_param_t *param)
+{
+	memset(param, 0, sizeof(odp_qsbr_param_t));
+}
+
+static int reserve_index(qsbr_t *qsbr)
+{
+	int index = -1;
+
+	odp_ticketlock_lock(&qsbr_global->lock);
+
+	for (int i = 0; i < CONFIG_MAX_QSBR; i++) {
+		if (qsbr_global->domain[i] == NULL) {
+			index = i;
+			qsbr_global->domain[i] = qsbr;
+			break;
+		}
+	}
+
+	odp_ticketlock_unlock(&qsbr_global->lock);
+
+	return index;
+}
+
+static void free_index(int i)
+{
+	odp_ticketlock_lock(&qsbr_global->lock);
+	qsbr_global->domain[i] = NULL;
+	odp_ticketlock_unlock(&qsbr_global->lock);
+}
+
+odp_qsbr_t odp_qsbr_create(const char *name, const odp_qsbr_param_t *param)
+{
+	qsbr_t *qsbr;
+	odp_shm_t shm;
+	uint64_t thr_offset, defer_offset, shm_size;
+	uint32_t num_thr = odp_thread_count_max();
+	uint32_t shm_flags = 0;
+
+	if (name && strlen(name) >= ODP_QSBR_NAME_LEN) {
+		_ODP_ERR("Too long name: %s\n", name);
+		return ODP_QSBR_INVALID;
+	}
+
+	if (param->num_defer > MAX_DEFER) {
+		_ODP_ERR("Bad deferred free queue size: %" PRIu32 "\n", param->num_defer);
+		return ODP_QSBR_INVALID;
+	}
+
+	thr_offset = _ODP_ROUNDUP_CACHE_LINE(sizeof(qsbr_t));
+	defer_offset = thr_offset + (uint64_t)num_thr * sizeof(thr_state_t);
+	shm_size = defer_offset + (uint64_t)param->num_defer * sizeof(defer_entry_t);
+
+	if (odp_global_ro.shm_single_va)
+		shm_flags |= ODP_SHM_SINGLE_VA;
+
+	shm = odp_shm_reserve("_odp_qsbr", shm_size, ODP_CACHE_LINE_SIZE, shm_flags);
+	if (shm == ODP_SHM_INVALID) {
+		_ODP_ERR("SHM reserve failed\n");
+		return ODP_QSBR_INVALID;
+	}
+
+	qsbr = odp_shm_addr(shm);
+	memset(qsbr, 0, sizeof(qsbr_t));
+
+	if (name)
+		strcpy(qsbr->name, name);
+
+	odp_ticketlock_init(&qsbr->lock);
+	qsbr->shm             = shm;
+	qsbr->num_thr         = num_thr;
+	qsbr->sched_quiescent = !!param->sched_quiescent;
+	qsbr->num_defer       = param->num_defer;
+	qsbr->thr             = (thr_state_t *)(uintptr_t)((uint8_t *)qsbr + thr_offset);
+	qsbr->defer           = (defer_entry_t *)(uintptr_t)((uint8_t *)qsbr + defer_offset);
+
+	/* Sequence numbers of online threads are never zero */
+	odp_atomic_init_u64(&qsbr->token, 1);
+
+	for (uint32_t i = 0; i < num_thr; i++)
+		odp_atomic_init_u64(&qsbr->thr[i].seq, 0);
+
+	qsbr->index = reserve_index(qsbr);
+	if (qsbr->index < 0) {
+		_ODP_ERR("Maximum number of QSBR domains created\n");
+		odp_shm_free(shm);
+		return ODP_QSBR_INVALID;
+	}
+
+	return qsbr_handle(qsbr);
+}
+
+static inline void thread_quiescent(qsbr_t *qsbr, int thr)
+{
+	/* Release store orders all earlier accesses to protected objects before
+	 * the sequence number update */
+	odp_atomic_store_rel_u64(&qsbr->thr[thr].seq, odp_atomic_load_acq_u64(&qsbr->token));
+}
+
+/* Calling thread reports a quiescent state, when it is online */
+static inline void self_quiescent(qsbr_t *qsbr)
+{
+	int thr = odp_thread_id();
+
+	if (odp_atomic_load_u64(&qsbr->thr[thr].seq))
+		thread_quiescent(qsbr, thr);
+}
+
+/* Smallest sequence number of online threads, or UINT64_MAX when all threads are offline */
+static uint64_t min_seq(qsbr_t *qsbr)
+{
+	uint64_t min = UINT64_MAX;
+
+	odp_mb_full();
+
+	for (uint32_t i = 0; i < qsbr->num_thr; i++) {
+		uint64_t seq = odp_atomic_load_acq_u64(&qsbr->thr[i].seq);
+
+		if (seq && seq < min)
+			min = seq;
+	}
+
+	return min;
+}
+
+static uint32_t reclaim_locked(qsbr_t *qsbr, uint32_t max_num)
+{
+	uint64_t min = 0;
+	uint32_t num = 0;
+
+	while (num < max_num && qsbr->count) {
+		defer_entry_t *entry = &qsbr->defer[qsbr->head];
+
+		if (entry->token > min) {
+			/* Tokens are stored in increasing order. Rescan thread states only when
+			 * the previous scan is not recent enough for the entry. */
+			min = min_seq(qsbr);
+
+			if (entry->token > min)
+				break;
+		}
+
+		entry->free_fn(entry->ptr);
+
+		qsbr->head++;
+		if (qsbr->head == qsbr->num_defer)
+			qsbr->head = 0;
+
+		qsbr->count--;
+		num++;
+	}
+
+	qsbr->num_reclaimed += num;
+
+	return num;
+}
+
+int odp_qsbr_destroy(odp_qsbr_t qsbr_hdl)
+{
+	qsbr_t *qsbr = qsbr_entry(qsbr_hdl);
+
+	if (qsbr_hdl == ODP_QSBR_INVALID) {
+		_ODP_ERR("Bad QSBR domain handle\n");
+		return -1;
+	}
+
+	for (uint32_t i = 0; i < qsbr->num_thr; i++) {
+		if (odp_atomic_load_u64(&qsbr->thr[i].seq)) {
+			_ODP_ERR("Thread %" PRIu32 " online in QSBR domain\n", i);
+			return -1;
+		}
+	}
+
+	/* All threads are offline, all grace periods have ended */
+	odp_ticketlock_lock(&qsbr->lock);
+	reclaim_locked(qsbr, qsbr->count);
+	odp_ticketlock_unlock(&qsbr->lock);
+
+	free_index(qsbr->index);
+
+	if (odp_shm_free(qsbr->shm)) {
+		_ODP_ERR("SHM free failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+odp_qsbr_t odp_qsbr_lookup(const char *name)
+{
+	qsbr_t *qsbr;
+
+	if (name == NULL)
+		return ODP_QSBR_INVALID;
+
+	odp_ticketlock_lock(&qsbr_global->lock);
+
+	for (int i = 0; i < CONFIG_MAX_QSBR; i++) {
+		qsbr = qsbr_global->domain[i];
+
+		if (qsbr && strcmp(qsbr->name, name) == 0) {
+			odp_ticketlock_unlock(&qsbr_global->lock);
+			return qsbr_handle(qsbr);
+		}
+	}
+
+	odp_ticketlock_unlock(&qsbr_global->lock);
+
+	return ODP_QSBR_INVALID;
+}
+
+uint64_t odp_qsbr_to_u64(odp_qsbr_t qsbr)
+{
+	return _odp_pri(qsbr);
+}
+
+int odp_qsbr_thread_online(odp_qsbr_t qsbr_hdl)
+{
+	qsbr_t *qsbr = qsbr_entry(qsbr_hdl);
+	_odp_qsbr_local_t *local = &_odp_qsbr_local;
+	int thr = odp_thread_id();
+
+	if (odp_atomic_load_u64(&qsbr->thr[thr].seq))
+		return 0;
+
+	odp_atomic_store_u64(&qsbr->thr[thr].seq, odp_atomic_load_u64(&qsbr->token));
+
+	/* Writers must see the thread online before it reads any protected objects */
+	odp_mb_full();
+
+	if (qsbr->sched_quiescent) {
+		_ODP_ASSERT(local->num_sched < CONFIG_MAX_QSBR);
+		local->sched[local->num_sched++] = qsbr;
+	}
+
+	return 0;
+}
+
+void odp_qsbr_thread_offline(odp_qsbr_t qsbr_hdl)
+{
+	qsbr_t *qsbr = qsbr_entry(qsbr_hdl);
+	_odp_qsbr_local_t *local = &_odp_qsbr_local;
+	int thr = odp_thread_id();
+
+	if (odp_atomic_load_u64(&qsbr->thr[thr].seq) == 0)
+		return;
+
+	odp_atomic_store_rel_u64(&qsbr->thr[thr].seq, 0);
+
+	for (uint32_t i = 0; i < local->num_sched; i++) {
+		if (local->sched[i] == qsbr) {
+			local->num_sched--;
+			local->sched[i] = local->sched[local->num_sched];
+			break;
+		}
+	}
+}
+
+void odp_qsbr_quiescent(odp_qsbr_t qsbr_hdl)
+{
+	thread_quiescent(qsbr_entry(qsbr_hdl), odp_thread_id());
+}
+
+void _odp_qsbr_sched_quiescent_all(void)
+{
+	_odp_qsbr_local_t *local = &_odp_qsbr_local;
+	int thr = odp_thread_id();
+
+	for (uint32_t i = 0; i < local->num_sched; i++)
+		thread_quiescent(local->sched[i], thr);
+}
+
+uint64_t odp_qsbr_start(odp_qsbr_t qsbr_hdl)
+{
+	qsbr_t *qsbr = qsbr_entry(qsbr_hdl);
+
+	/* Object removals must be visible before the new grace period starts */
+	odp_mb_full();
+
+	return odp_atomic_fetch_inc_u64(&qsbr->token) + 1;
+}
+
+int odp_qsbr_check(odp_qsbr_t qsbr_hdl, uint64_t token, odp_bool_t wait)
+{
+	qsbr_t *qsbr = qsbr_entry(qsbr_hdl);
+
+	self_quiescent(qsbr);
+
+	while (min_seq(qsbr) < token) {
+		if (!wait)
+			return 0;
+
+		odp_cpu_pause();
+	}
+
+	return 1;
+}
+
+void odp_qsbr_synchronize(odp_qsbr_t qsbr)
+{
+	odp_qsbr_check(qsbr, odp_qsbr_start(qsbr), true);
+}
+
+int odp_qsbr_defer(odp_qsbr_t qsbr_hdl, odp_qsbr_free_fn_t free_fn, void *ptr)
+{
+	qsbr_t *qsbr = qsbr_entry(qsbr_hdl);
+	defer_entry_t *entry;
+	uint32_t tail;
+
+	odp_ticketlock_lock(&qsbr->lock);
+
+	if (odp_unlikely(qsbr->count == qsbr->num_defer)) {
+		self_quiescent(qsbr);
+
+		if (reclaim_locked(qsbr, qsbr->count) == 0) {
+			odp_ticketlock_unlock(&qsbr->lock);
+			return -1;
+		}
+	}
+
+	tail = qsbr->head + qsbr->count;
+	if (tail >= qsbr->num_defer)
+		tail -= qsbr->num_defer;
+
+	entry = &qsbr->defer[tail];
+	entry->free_fn = free_fn;
+	entry->ptr     = ptr;
+	entry->token   = odp_qsbr_start(qsbr_hdl);
+	qsbr->count++;
+
+	odp_ticketlock_unlock(&qsbr->lock);
+
+	return 0;
+}
+
+uint32_t odp_qsbr_reclaim(odp_qsbr_t qsbr_hdl, uint32_t max_num)
+{
+	qsbr_t *qsbr = qsbr_entry(qsbr_hdl);
+	uint32_t num;
+
+	/* Quick check without the lock */
+	if (qsbr->count == 0)
+		return 0;
+
+	self_quiescent(qsbr);
+
+	odp_ticketlock_lock(&qsbr->lock);
+	num = reclaim_locked(qsbr, max_num);
+	odp_ticketlock_unlock(&qsbr->lock);
+
+	return num;
+}
+
+void odp_qsbr_print(odp_qsbr_t qsbr_hdl)
+{
+	qsbr_t *qsbr = qsbr_entry(qsbr_hdl);
+	uint32_t num_online = 0;
+
+	if (qsbr_hdl == ODP_QSBR_INVALID) {
+		_ODP_ERR("Bad QSBR domain handle\n");
+		return;
+	}
+
+	for (uint32_t i = 0; i < qsbr->num_thr; i++) {
+		if (odp_atomic_load_u64(&qsbr->thr[i].seq))
+			num_online++;
+	}
+
+	_ODP_PRINT("\nQSBR domain info\n");
+	_ODP_PRINT("----------------\n");
+	_ODP_PRINT("  handle          0x%" PRIx64 "\n", odp_qsbr_to_u64(qsbr_hdl));
+	_ODP_PRINT("  name            %s\n", qsbr->name);
+	_ODP_PRINT("  index           %i\n", qsbr->index);
+	_ODP_PRINT("  sched quiescent %i\n", qsbr->sched_quiescent);
+	_ODP_PRINT("  grace period    %" PRIu64 "\n", odp_atomic_load_u64(&qsbr->token));
+	_ODP_PRINT("  online threads  %u\n", num_online);
+	_ODP_PRINT("  defer size      %u\n", qsbr->num_defer);
+	_ODP_PRINT("  defer pending   %u\n", qsbr->count);
+	_ODP_PRINT("  reclaimed       %" PRIu64 "\n", qsbr->num_reclaimed);
+	_ODP_PRINT("\n");
+}
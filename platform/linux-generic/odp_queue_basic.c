@@ -13,11 +13,13 @@
 #include <odp/api/std_types.h>
 #include <odp/api/sync.h>
 #include <odp/api/ticketlock.h>
+#include <odp/api/time.h>
 #include <odp/api/traffic_mngr.h>
 
 #include <odp/api/plat/queue_inline_types.h>
 #include <odp/api/plat/sync_inlines.h>
 #include <odp/api/plat/ticketlock_inlines.h>
+#include <odp/api/plat/time_inlines.h>
 
 #include <odp_config_internal.h>
 #include <odp_debug_internal.h>
@@ -30,6 +32,7 @@
 #include <odp_pool_internal.h>
 #include <odp_queue_basic_internal.h>
 #include <odp_queue_if.h>
+#include <odp_sched_stats_internal.h>
 #include <odp_schedule_if.h>
 #include <odp_timer_internal.h>
 #include <odp_string_internal.h>
@@ -71,8 +74,8 @@ static int queue_capa(odp_queue_capability_t *capa, int sched ODP_UNUSED)
 	capa->plain.aggr.max_num_per_queue = 1;
 	capa->plain.aggr.max_size = CONFIG_EVENT_VECTOR_MAX_SIZE;
 	capa->plain.aggr.min_size = 2;
-	capa->plain.aggr.max_tmo_ns = 0;
-	capa->plain.aggr.min_tmo_ns = 0;
+	capa->plain.aggr.max_tmo_ns = CONFIG_VECTOR_MAX_TMO_NS;
+	capa->plain.aggr.min_tmo_ns = CONFIG_EVENT_AGGR_MIN_TMO_NS;
 	capa->plain.aggr.stats.bit.len = 1;
 
 	return 0;
@@ -170,6 +173,10 @@ static int queue_init_global(void)
 		aggr_queue->type = ODP_QUEUE_TYPE_AGGR;
 	}
 
+	odp_ticketlock_init(&_odp_queue_glb->aggr_tmo.lock);
+	odp_atomic_init_u32(&_odp_queue_glb->aggr_tmo.num, 0);
+	odp_atomic_init_u64(&_odp_queue_glb->aggr_tmo.next_ns, 0);
+
 	if (read_config_file(_odp_queue_glb)) {
 		odp_shm_free(shm);
 		return -1;
@@ -337,7 +344,7 @@ static int event_aggr_check_param(const odp_queue_param_t *param)
 			 param->aggr->max_tmo_ns, aggr_capa->max_tmo_ns);
 		return -1;
 	}
-	if (param->aggr->max_tmo_ns < aggr_capa->min_tmo_ns) {
+	if (param->aggr->max_tmo_ns && param->aggr->max_tmo_ns < aggr_capa->min_tmo_ns) {
 		_ODP_ERR("Too small timeout: %" PRIu64 " < %" PRIu64 "\n",
 			 param->aggr->max_tmo_ns, aggr_capa->min_tmo_ns);
 		return -1;
@@ -373,6 +380,39 @@ static queue_entry_t *event_aggr_reserve(queue_global_t *global)
 	return NULL;
 }
 
+static void event_aggr_tmo_add(queue_entry_t *aggr_queue)
+{
+	uint32_t num;
+
+	odp_ticketlock_lock(&_odp_queue_glb->aggr_tmo.lock);
+
+	num = odp_atomic_load_u32(&_odp_queue_glb->aggr_tmo.num);
+	_odp_queue_glb->aggr_tmo.aggr_queue[num] = aggr_queue;
+	odp_atomic_store_rel_u32(&_odp_queue_glb->aggr_tmo.num, num + 1);
+
+	odp_ticketlock_unlock(&_odp_queue_glb->aggr_tmo.lock);
+}
+
+static void event_aggr_tmo_rem(queue_entry_t *aggr_queue)
+{
+	uint32_t num;
+
+	odp_ticketlock_lock(&_odp_queue_glb->aggr_tmo.lock);
+
+	num = odp_atomic_load_u32(&_odp_queue_glb->aggr_tmo.num);
+
+	for (uint32_t i = 0; i < num; i++) {
+		if (_odp_queue_glb->aggr_tmo.aggr_queue[i] == aggr_queue) {
+			_odp_queue_glb->aggr_tmo.aggr_queue[i] =
+				_odp_queue_glb->aggr_tmo.aggr_queue[num - 1];
+			odp_atomic_store_rel_u32(&_odp_queue_glb->aggr_tmo.num, num - 1);
+			break;
+		}
+	}
+
+	odp_ticketlock_unlock(&_odp_queue_glb->aggr_tmo.lock);
+}
+
 static void event_aggr_free(queue_entry_t *aggr_queue)
 {
 	event_aggr_t *aggr;
@@ -382,7 +422,11 @@ static void event_aggr_free(queue_entry_t *aggr_queue)
 
 	aggr = &aggr_queue->aggr;
 
+	if (aggr->max_tmo_ns)
+		event_aggr_tmo_rem(aggr_queue);
+
 	LOCK(aggr_queue);
+	odp_ticketlock_lock(&aggr->lock);
 
 	/* Free pending events */
 	if (aggr->num_events) {
@@ -390,6 +434,10 @@ static void event_aggr_free(queue_entry_t *aggr_queue)
 		aggr->num_events = 0;
 	}
 
+	/* Timeout scan may still access the aggregator */
+	aggr->max_tmo_ns = 0;
+	odp_ticketlock_unlock(&aggr->lock);
+
 	aggr_queue->status = QUEUE_STATUS_FREE;
 	UNLOCK(aggr_queue);
 }
@@ -520,6 +568,11 @@ static odp_queue_t queue_create(const char *name,
 		}
 		queue->aggr_queue = aggr_queue;
 		event_aggr_queue_init(aggr_queue, queue);
+
+		/* Scheduler checks timeouts of aggregators of scheduled queues. Plain queues
+		 * check aggregator timeout on dequeue. */
+		if (type == ODP_QUEUE_TYPE_SCHED && aggr_queue->aggr.max_tmo_ns)
+			event_aggr_tmo_add(aggr_queue);
 	}
 
 	return handle;
@@ -618,8 +671,10 @@ static int queue_destroy(odp_queue_t handle)
 	if (queue->queue_lf)
 		_odp_queue_lf_destroy(queue->queue_lf);
 
-	if (queue->param.num_aggr)
+	if (queue->param.num_aggr) {
 		event_aggr_free(queue->aggr_queue);
+		queue->aggr_queue = NULL;
+	}
 
 	UNLOCK(queue);
 
@@ -692,8 +747,15 @@ static odp_queue_t queue_lookup(const char *name)
 	return ODP_QUEUE_INVALID;
 }
 
+/* Start aggregation timeout when the first event is added. Called inside aggregator lock. */
+static inline void event_aggr_tmo_start(event_aggr_t *aggr)
+{
+	if (aggr->max_tmo_ns)
+		aggr->tmo_ns = odp_time_global_ns() + aggr->max_tmo_ns;
+}
+
 /* Used by packet IO with at most 'odp_event_aggr_config_t.max_size' packets. Always consumes
- * 'pkt_tbl'. */
+ * 'pkt_tbl'. Forms a vector also from timed out packets when 'num' is zero. */
 odp_event_vector_t _odp_event_vector_create(odp_queue_t aggr_handle,
 					    odp_packet_t pkt_tbl[],
 					    uint32_t num)
@@ -708,16 +770,28 @@ odp_event_vector_t _odp_event_vector_create(odp_queue_t aggr_handle,
 
 	odp_ticketlock_lock(&aggr->lock);
 
+	if (num && aggr->num_events == 0)
+		event_aggr_tmo_start(aggr);
+
 	while (num_aggr < num && aggr->num_events < aggr->max_size)
 		aggr->event_tbl[aggr->num_events++] = odp_packet_to_event(pkt_tbl[num_aggr++]);
 
-	if (aggr->num_events < aggr->max_size) {
+	/* Vector is formed when full or timed out */
+	if (aggr->num_events < aggr->max_size &&
+	    (aggr->num_events == 0 || aggr->max_tmo_ns == 0 ||
+	     odp_time_global_ns() < aggr->tmo_ns)) {
 		odp_ticketlock_unlock(&aggr->lock);
 		return ODP_EVENT_VECTOR_INVALID;
 	}
 
 	evv = odp_event_vector_alloc(aggr->pool);
 	if (odp_unlikely(evv == ODP_EVENT_VECTOR_INVALID)) {
+		/* Timed out events are retried on the next call */
+		if (aggr->num_events < aggr->max_size) {
+			odp_ticketlock_unlock(&aggr->lock);
+			return ODP_EVENT_VECTOR_INVALID;
+		}
+
 		/* Always leave room in aggregator to work in same manner as
 		 * _odp_event_aggr_enq() */
 		aggr->num_events--;
@@ -735,6 +809,9 @@ odp_event_vector_t _odp_event_vector_create(odp_queue_t aggr_handle,
 	odp_event_vector_type_set(evv, aggr->event_type);
 	aggr->num_events = 0;
 
+	if (num_aggr < num)
+		event_aggr_tmo_start(aggr);
+
 	while (num_aggr < num)
 		aggr->event_tbl[aggr->num_events++] = odp_packet_to_event(pkt_tbl[num_aggr++]);
 
@@ -762,6 +839,9 @@ int _odp_event_aggr_enq(queue_entry_t *aggr_queue, _odp_event_hdr_t *event_hdr[]
 	odp_ticketlock_lock(&aggr->lock);
 
 	for (num_enq = 0; num_enq < num; num_enq++) {
+		if (aggr->num_events == 0)
+			event_aggr_tmo_start(aggr);
+
 		aggr->event_tbl[aggr->num_events++] = _odp_event_from_hdr(event_hdr[num_enq]);
 
 		if (aggr->num_events < aggr->max_size)
@@ -834,25 +914,18 @@ static uint32_t event_aggr_len(odp_queue_t aggr_handle)
 	return len;
 }
 
-/* Called inside aggregator locks */
-static int event_aggr_enq_pending(event_aggr_t *aggr)
+/* Form an event from pending events. Called inside aggregator locks. */
+static _odp_event_hdr_t *event_aggr_pending(event_aggr_t *aggr)
 {
 	odp_event_t *evv_tbl;
 	odp_event_vector_t evv;
-	queue_entry_t *base_queue = qentry_from_handle(aggr->base_queue);
 
-	if (aggr->num_events == 1) {
-		if (odp_likely(base_queue->enqueue(base_queue->handle,
-						   _odp_event_hdr(aggr->event_tbl[0])) == 0)) {
-			aggr->num_events = 0;
-			return 1;
-		}
-		return 0;
-	}
+	if (aggr->num_events == 1)
+		return _odp_event_hdr(aggr->event_tbl[0]);
 
 	evv = odp_event_vector_alloc(aggr->pool);
 	if (odp_unlikely(evv == ODP_EVENT_VECTOR_INVALID))
-		return 0;
+		return NULL;
 
 	odp_event_vector_tbl(evv, &evv_tbl);
 	for (uint16_t i = 0; i < aggr->num_events; i++)
@@ -861,15 +934,90 @@ static int event_aggr_enq_pending(event_aggr_t *aggr)
 	odp_event_vector_size_set(evv, aggr->num_events);
 	odp_event_vector_type_set(evv, aggr->event_type);
 
-	if (odp_unlikely(base_queue->enqueue(base_queue->handle,
-					     (_odp_event_hdr_t *)(uintptr_t)evv)) != 0) {
-		odp_event_vector_free(evv);
+	return (_odp_event_hdr_t *)(uintptr_t)evv;
+}
+
+/* Called inside aggregator locks */
+static int event_aggr_enq_pending(event_aggr_t *aggr)
+{
+	queue_entry_t *base_queue = qentry_from_handle(aggr->base_queue);
+	_odp_event_hdr_t *event_hdr = event_aggr_pending(aggr);
+
+	if (odp_unlikely(event_hdr == NULL))
+		return 0;
+
+	if (odp_unlikely(base_queue->enqueue(base_queue->handle, event_hdr) != 0)) {
+		if (aggr->num_events > 1)
+			odp_event_vector_free(odp_event_vector_from_event(_odp_event_from_hdr(event_hdr)));
 		return 0;
 	}
 	aggr->num_events = 0;
 	return 1;
 }
 
+int _odp_event_aggr_deq_tmo(queue_entry_t *base_queue, _odp_event_hdr_t *event_hdr[])
+{
+	queue_entry_t *aggr_queue = base_queue->aggr_queue;
+	event_aggr_t *aggr;
+	int num = 0;
+
+	if (odp_likely(aggr_queue == NULL || aggr_queue->aggr.max_tmo_ns == 0))
+		return 0;
+
+	aggr = &aggr_queue->aggr;
+
+	if (!odp_ticketlock_trylock(&aggr->lock))
+		return 0;
+
+	/* Full vectors are enqueued inside the lock, so an empty queue has no older events */
+	if (aggr->num_events && odp_time_global_ns() >= aggr->tmo_ns &&
+	    base_queue->len(base_queue->handle) == 0) {
+		event_hdr[0] = event_aggr_pending(aggr);
+
+		if (odp_likely(event_hdr[0] != NULL)) {
+			aggr->num_events = 0;
+			num = 1;
+		}
+	}
+
+	odp_ticketlock_unlock(&aggr->lock);
+
+	return num;
+}
+
+void _odp_event_aggr_tmo_scan(void)
+{
+	uint64_t now = odp_time_global_ns();
+	uint64_t next = odp_atomic_load_u64(&_odp_queue_glb->aggr_tmo.next_ns);
+	uint32_t num;
+
+	/* Only one thread scans at a time */
+	if (now < next ||
+	    !odp_atomic_cas_u64(&_odp_queue_glb->aggr_tmo.next_ns, &next,
+				now + CONFIG_EVENT_AGGR_MIN_TMO_NS / 2))
+		return;
+
+	num = odp_atomic_load_acq_u32(&_odp_queue_glb->aggr_tmo.num);
+
+	for (uint32_t i = 0; i < num; i++) {
+		queue_entry_t *aggr_queue = _odp_queue_glb->aggr_tmo.aggr_queue[i];
+		event_aggr_t *aggr = &aggr_queue->aggr;
+		queue_entry_t *base_queue;
+
+		if (!odp_ticketlock_trylock(&aggr->lock))
+			continue;
+
+		base_queue = qentry_from_handle(aggr->base_queue);
+
+		/* Packet input forms its vectors when polled */
+		if (aggr->num_events && aggr->max_tmo_ns && now >= aggr->tmo_ns &&
+		    base_queue->pktin.pktio == ODP_PKTIO_INVALID)
+			event_aggr_enq_pending(aggr);
+
+		odp_ticketlock_unlock(&aggr->lock);
+	}
+}
+
 static int queue_api_enq_aggr(odp_queue_t handle, odp_event_t ev,
 			      const odp_aggr_enq_param_t *param)
 {
@@ -900,6 +1048,9 @@ static int queue_api_enq_aggr(odp_queue_t handle, odp_event_t ev,
 			return -1;
 		}
 
+	if (aggr->num_events == 0)
+		event_aggr_tmo_start(aggr);
+
 	aggr->event_tbl[aggr->num_events++] = ev;
 
 	/* Enqueue events in case of full vector or EoV */
@@ -952,8 +1103,11 @@ static _odp_event_hdr_t *plain_queue_deq(odp_queue_t handle)
 	_odp_event_hdr_t *event_hdr;
 
 	if (ring_mpmc_ptr_deq(ring_mpmc, queue->ring_data, queue->ring_mask,
-			      (uintptr_t *)&event_hdr) == 0)
+			      (uintptr_t *)&event_hdr) == 0) {
+		if (_odp_event_aggr_deq_tmo(queue, &event_hdr))
+			return event_hdr;
 		return NULL;
+	}
 
 	odp_prefetch(event_hdr);
 
@@ -970,7 +1124,7 @@ static inline int plain_queue_deq_multi(odp_queue_t handle, _odp_event_hdr_t *ev
 					  (uintptr_t *)event_hdr, num);
 
 	if (num_deq == 0)
-		return 0;
+		return _odp_event_aggr_deq_tmo(queue, event_hdr);
 
 	for (uint32_t i = 0; i < num_deq; i++)
 		odp_prefetch(event_hdr[i]);
@@ -1080,7 +1234,7 @@ static int queue_info(odp_queue_t handle, odp_queue_info_t *info)
 		info->param = base_queue->param;
 		info->param.aggr = NULL;
 		info->aggr_config.pool = queue->aggr.pool;
-		info->aggr_config.max_tmo_ns = 0;
+		info->aggr_config.max_tmo_ns = queue->aggr.max_tmo_ns;
 		info->aggr_config.max_size = queue->aggr.max_size;
 		info->aggr_config.event_type = queue->aggr.event_type;
 
@@ -1141,6 +1295,7 @@ static void event_aggr_print(queue_entry_t *aggr_queue)
 			    aggr->event_type);
 	len += _odp_snprint(&str[len], n - len, "  num events      %" PRIu16 "\n", num_events);
 	len += _odp_snprint(&str[len], n - len, "  max events      %" PRIu32 "\n", aggr->max_size);
+	len += _odp_snprint(&str[len], n - len, "  max tmo ns      %" PRIu64 "\n", aggr->max_tmo_ns);
 
 	_ODP_PRINT("%s\n", str);
 }
@@ -1365,6 +1520,8 @@ static int sched_queue_enq(odp_queue_t handle, _odp_event_hdr_t *event_hdr)
 	ring_st_ptr_t *ring_st = &queue->ring_st;
 	int ret, sched = 0;
 
+	_odp_sched_stats_stamp(&event_hdr, 1);
+
 	if (_odp_sched_fn->ord_enq_multi(handle, (void **)&event_hdr, 1, &ret))
 		return ret == 1 ? 0 : -1;
 
@@ -1399,6 +1556,8 @@ static inline int sched_queue_enq_multi(odp_queue_t handle,
 	int ret;
 	uint32_t num_enq;
 
+	_odp_sched_stats_stamp(event_hdr, num);
+
 	if (_odp_sched_fn->ord_enq_multi(handle, (void **)event_hdr, num, &ret))
 		return ret;
 
@@ -1521,6 +1680,7 @@ static void event_aggr_queue_init(queue_entry_t *aggr_queue, const queue_entry_t
 	aggr->pool = base_queue->param.aggr->pool;
 	aggr->event_type = base_queue->param.aggr->event_type;
 	aggr->max_size = base_queue->param.aggr->max_size;
+	aggr->max_tmo_ns = base_queue->param.aggr->max_tmo_ns;
 }
 
 static int queue_init(queue_entry_t *queue, const char *name,
@@ -1549,6 +1709,7 @@ static int queue_init(queue_entry_t *queue, const char *name,
 
 	queue->pktin = PKTIN_INVALID;
 	queue->pktout = PKTOUT_INVALID;
+	queue->aggr_queue = NULL;
 
 	queue_size = param->size;
 	if (queue_size == 0)
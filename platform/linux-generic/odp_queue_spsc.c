@@ -82,8 +82,11 @@ static _odp_event_hdr_t *queue_spsc_deq(odp_queue_t handle)
 	}
 
 	if (ring_spsc_ptr_deq(ring_spsc, queue->ring_data, queue->ring_mask,
-			      (uintptr_t *)&event_hdr) == 0)
+			      (uintptr_t *)&event_hdr) == 0) {
+		if (_odp_event_aggr_deq_tmo(queue, &event_hdr))
+			return event_hdr;
 		return NULL;
+	}
 
 	odp_prefetch(event_hdr);
 
@@ -105,7 +108,7 @@ static inline int queue_spsc_deq_multi(odp_queue_t handle, _odp_event_hdr_t *eve
 					  (uintptr_t *)event_hdr, num);
 
 	if (num_deq == 0)
-		return 0;
+		return _odp_event_aggr_deq_tmo(queue, event_hdr);
 
 	for (uint32_t i = 0; i < num_deq; i++)
 		odp_prefetch(event_hdr[i]);
@@ -7,7 +7,9 @@
 #include <odp/api/random.h>
 
 #include <odp/autoheader_internal.h>
+#include <odp_debug_internal.h>
 #include <odp_init_internal.h>
+#include <odp_libconfig_internal.h>
 #include <odp_random_std_internal.h>
 #include <odp_random_openssl_internal.h>
 #include <odp_random.h>
@@ -23,6 +25,22 @@
 #endif
 #endif
 
+/* Minimum number of bytes generated between DRBG reseeds */
+#define MIN_RESEED_KB 64
+
+/* Configuration is read during global init and inherited by all threads and processes */
+static struct {
+	/* Use DRBG for ODP_RANDOM_BASIC */
+	uint8_t drbg_basic;
+
+	/* Use DRBG for ODP_RANDOM_CRYPTO */
+	uint8_t drbg_crypto;
+
+	/* Number of bytes generated between DRBG reseeds */
+	uint64_t drbg_reseed;
+
+} random_config;
+
 odp_random_kind_t odp_random_max_kind(void)
 {
 	odp_random_kind_t kind, max_kind = ODP_RANDOM_BASIC;
@@ -41,12 +59,18 @@ int32_t odp_random_data(uint8_t *buf, uint32_t len, odp_random_kind_t kind)
 {
 	switch (kind) {
 	case ODP_RANDOM_BASIC:
-		if (_ODP_OPENSSL_RAND)
+		if (_ODP_OPENSSL_RAND) {
+			if (random_config.drbg_basic)
+				return _odp_random_openssl_drbg_data(buf, len);
 			return _odp_random_openssl_data(buf, len);
+		}
 		return _odp_random_std_data(buf, len);
 	case ODP_RANDOM_CRYPTO:
-		if (_ODP_OPENSSL_RAND)
+		if (_ODP_OPENSSL_RAND) {
+			if (random_config.drbg_crypto)
+				return _odp_random_openssl_drbg_data(buf, len);
 			return _odp_random_openssl_data(buf, len);
+		}
 		return _odp_random_crypto_data(buf, len);
 	case ODP_RANDOM_TRUE:
 		return _odp_random_true_data(buf, len);
@@ -60,11 +84,57 @@ int32_t odp_random_test_data(uint8_t *buf, uint32_t len, uint64_t *seed)
 	return _odp_random_std_test_data(buf, len, seed);
 }
 
+static int read_config_file(void)
+{
+	const char *str;
+	int val;
+
+	str = "random.drbg_basic";
+	if (!_odp_libconfig_lookup_int(str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+	random_config.drbg_basic = !!val;
+
+	str = "random.drbg_crypto";
+	if (!_odp_libconfig_lookup_int(str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+	random_config.drbg_crypto = !!val;
+
+	str = "random.drbg_reseed_kb";
+	if (!_odp_libconfig_lookup_int(str, &val)) {
+		_ODP_ERR("Config option '%s' not found.\n", str);
+		return -1;
+	}
+	if (val < MIN_RESEED_KB) {
+		_ODP_ERR("Bad %s value %i (min %i)\n", str, val, MIN_RESEED_KB);
+		return -1;
+	}
+	random_config.drbg_reseed = (uint64_t)val * 1024;
+
+	_ODP_PRINT("Random config:\n");
+	_ODP_PRINT("  random.drbg_basic: %u\n", random_config.drbg_basic);
+	_ODP_PRINT("  random.drbg_crypto: %u\n", random_config.drbg_crypto);
+	_ODP_PRINT("  random.drbg_reseed_kb: %i\n\n", val);
+
+	return 0;
+}
+
 int _odp_random_init_global(void)
 {
 #if defined(__aarch64__) && defined(__ARM_FEATURE_RNG)
 	odp_global_ro.flags.has_arm_rng = (getauxval(AT_HWCAP2) & HWCAP2_RNG) ? 1 : 0;
 #endif
+	if (read_config_file())
+		return -1;
+
+	if (!_ODP_OPENSSL_RAND) {
+		random_config.drbg_basic = 0;
+		random_config.drbg_crypto = 0;
+	}
+
 	return 0;
 }
 
@@ -76,7 +146,9 @@ int _odp_random_term_global(void)
 int _odp_random_init_local(void)
 {
 	if (_ODP_OPENSSL_RAND)
-		return _odp_random_openssl_init_local();
+		return _odp_random_openssl_init_local(random_config.drbg_basic ||
+						      random_config.drbg_crypto,
+						      random_config.drbg_reseed);
 	return _odp_random_std_init_local();
 }
 
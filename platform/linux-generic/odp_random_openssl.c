@@ -1,17 +1,56 @@
 /* SPDX-License-Identifier: BSD-3-Clause
  * Copyright (c) 2014-2018 Linaro Limited
- * Copyright (c) 2020 Nokia
+ * Copyright (c) 2020-2026 Nokia
  */
 
 #include <odp_posix_extensions.h>
 #include <stdint.h>
+#include <string.h>
+#include <odp/api/hints.h>
 #include <odp/autoheader_internal.h>
+#include <odp_debug_internal.h>
 #include <odp_init_internal.h>
 #include <odp_random_openssl_internal.h>
 
 #if _ODP_OPENSSL_RAND
+#include <openssl/evp.h>
 #include <openssl/rand.h>
 
+/*
+ * Per-thread DRBG
+ *
+ * AES-256 in counter mode generates random data into a thread local buffer. Each
+ * buffer refill generates also a new key and IV, which replace the previous ones
+ * (fast key erasure), so that already returned data cannot be reconstructed from
+ * the current state. Key and IV are reseeded from RAND_bytes() after every
+ * 'reseed' bytes of output. OpenSSL uses AES instructions of the CPU (e.g. AES-NI,
+ * ARMv8 crypto extensions) when those are available.
+ */
+
+#define DRBG_KEY_LEN 32
+#define DRBG_IV_LEN  16
+#define DRBG_SEED_LEN (DRBG_KEY_LEN + DRBG_IV_LEN)
+#define DRBG_BUF_SIZE 4096
+
+typedef struct {
+	EVP_CIPHER_CTX *ctx;
+
+	/* Bytes of output left until next reseed */
+	uint64_t reseed_left;
+
+	/* Reseed interval */
+	uint64_t reseed;
+
+	/* Read position in buffer */
+	uint32_t pos;
+
+	/* Next key and IV, followed by random data */
+	uint8_t buf[DRBG_SEED_LEN + DRBG_BUF_SIZE];
+
+} drbg_t;
+
+static __thread drbg_t drbg;
+
 int32_t _odp_random_openssl_data(uint8_t *buf, uint32_t len)
 {
 	int rc;
@@ -19,6 +58,119 @@ int32_t _odp_random_openssl_data(uint8_t *buf, uint32_t len)
 	rc = RAND_bytes(buf, len);
 	return (1 == rc) ? (int)len /*success*/: -1 /*failure*/;
 }
+
+static int drbg_reseed(void)
+{
+	uint8_t seed[DRBG_SEED_LEN];
+	int ret;
+
+	if (RAND_bytes(seed, DRBG_SEED_LEN) != 1)
+		return -1;
+
+	ret = EVP_EncryptInit_ex(drbg.ctx, EVP_aes_256_ctr(), NULL, seed, &seed[DRBG_KEY_LEN]);
+	memset(seed, 0, sizeof(seed));
+
+	if (ret != 1)
+		return -1;
+
+	drbg.reseed_left = drbg.reseed;
+	return 0;
+}
+
+static int drbg_refill(void)
+{
+	int len;
+
+	if (odp_unlikely(drbg.reseed_left < DRBG_BUF_SIZE)) {
+		if (drbg_reseed())
+			return -1;
+	}
+
+	/* Key stream is encrypted zeros */
+	memset(drbg.buf, 0, sizeof(drbg.buf));
+
+	if (EVP_EncryptUpdate(drbg.ctx, drbg.buf, &len, drbg.buf, sizeof(drbg.buf)) != 1)
+		return -1;
+
+	if (EVP_EncryptInit_ex(drbg.ctx, NULL, NULL, drbg.buf, &drbg.buf[DRBG_KEY_LEN]) != 1)
+		return -1;
+
+	memset(drbg.buf, 0, DRBG_SEED_LEN);
+	drbg.reseed_left -= DRBG_BUF_SIZE;
+	drbg.pos = DRBG_SEED_LEN;
+
+	return 0;
+}
+
+int32_t _odp_random_openssl_drbg_data(uint8_t *buf, uint32_t len)
+{
+	uint32_t left = len;
+
+	/* Thread has not been initialized */
+	if (odp_unlikely(drbg.ctx == NULL))
+		return _odp_random_openssl_data(buf, len);
+
+	while (left) {
+		uint32_t num = sizeof(drbg.buf) - drbg.pos;
+
+		if (odp_unlikely(num == 0)) {
+			if (drbg_refill())
+				return -1;
+
+			num = DRBG_BUF_SIZE;
+		}
+
+		if (num > left)
+			num = left;
+
+		memcpy(buf, &drbg.buf[drbg.pos], num);
+		/* Returned data is not kept in the buffer */
+		memset(&drbg.buf[drbg.pos], 0, num);
+		drbg.pos += num;
+		buf += num;
+		left -= num;
+	}
+
+	return len;
+}
+
+int _odp_random_openssl_init_local(int use_drbg, uint64_t reseed)
+{
+	if (!use_drbg)
+		return 0;
+
+	drbg.ctx = EVP_CIPHER_CTX_new();
+	if (drbg.ctx == NULL) {
+		_ODP_ERR("EVP_CIPHER_CTX_new() failed\n");
+		return -1;
+	}
+
+	drbg.reseed = reseed;
+	drbg.reseed_left = 0;
+	drbg.pos = sizeof(drbg.buf);
+
+	if (drbg_reseed()) {
+		_ODP_ERR("DRBG seeding failed\n");
+		EVP_CIPHER_CTX_free(drbg.ctx);
+		drbg.ctx = NULL;
+		return -1;
+	}
+
+	return 0;
+}
+
+int _odp_random_openssl_term_local(void)
+{
+	if (drbg.ctx) {
+		EVP_CIPHER_CTX_free(drbg.ctx);
+		drbg.ctx = NULL;
+	}
+
+	memset(drbg.buf, 0, sizeof(drbg.buf));
+	drbg.pos = sizeof(drbg.buf);
+
+	return 0;
+}
 #else
 /* Dummy functions for building without OpenSSL support */
 int32_t _odp_random_openssl_data(uint8_t *buf ODP_UNUSED,
@@ -26,9 +178,14 @@ int32_t _odp_random_openssl_data(uint8_t *buf ODP_UNUSED,
 {
 	return -1;
 }
-#endif /* _ODP_OPENSSL_RAND */
 
-int _odp_random_openssl_init_local(void)
+int32_t _odp_random_openssl_drbg_data(uint8_t *buf ODP_UNUSED,
+				      uint32_t len ODP_UNUSED)
+{
+	return -1;
+}
+
+int _odp_random_openssl_init_local(int use_drbg ODP_UNUSED, uint64_t reseed ODP_UNUSED)
 {
 	return 0;
 }
@@ -37,3 +194,4 @@ int _odp_random_openssl_term_local(void)
 {
 	return 0;
 }
+#endif /* _ODP_OPENSSL_RAND */
@@ -0,0 +1,783 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#include <odp/api/align.h>
+#include <odp/api/atomic.h>
+#include <odp/api/byteorder.h>
+#include <odp/api/hash.h>
+#include <odp/api/hints.h>
+#include <odp/api/packet.h>
+#include <odp/api/packet_io.h>
+#include <odp/api/queue.h>
+#include <odp/api/reassembly.h>
+#include <odp/api/shared_memory.h>
+#include <odp/api/ticketlock.h>
+#include <odp/api/time.h>
+
+#include <odp/api/plat/packet_flag_inlines.h>
+#include <odp/api/plat/packet_inlines.h>
+#include <odp/api/plat/time_inlines.h>
+
+#include <odp_chksum_internal.h>
+#include <odp_debug_internal.h>
+#include <odp_ipsec_internal.h>
+#include <odp_macros_internal.h>
+#include <odp_packet_internal.h>
+#include <odp_packet_io_internal.h>
+#include <odp_parse_internal.h>
+#include <odp_reass_internal.h>
+#include <protocols/eth.h>
+#include <protocols/ip.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Number of reassembly table shards. Fragments are mapped to shards by flow hash. */
+#define REASS_SHARDS 64
+
+/* Number of concurrent reassemblies per shard */
+#define REASS_SHARD_FLOWS 16
+
+/* Number of shards checked for expired reassemblies per receive call */
+#define REASS_EXPIRE_SHARDS 4
+
+/* Maximum number of VLAN tags in front of the IP header */
+#define REASS_MAX_VLANS 2
+
+/* Maximum length of L2 and L3 headers of a fragment */
+#define REASS_HDR_BYTES (_ODP_ETHHDR_LEN + REASS_MAX_VLANS * _ODP_VLANHDR_LEN + 60)
+
+/* Maximum IP datagram payload length */
+#define REASS_MAX_LEN 0xffff
+
+/* IPv6 fragment header */
+typedef struct ODP_PACKED {
+	uint8_t next_hdr;
+	uint8_t reserved;
+	odp_u16be_t frag_offset;
+	odp_u32be_t id;
+} ipv6_frag_hdr_t;
+
+#define IPV6_FRAG_HDR_LEN     8
+#define IPV6_FRAG_MORE        0x0001
+#define IPV6_FRAG_OFFSET_MASK 0xfff8
+
+ODP_STATIC_ASSERT(sizeof(ipv6_frag_hdr_t) == IPV6_FRAG_HDR_LEN, "IPV6_FRAG_HDR_SIZE_ERROR");
+
+ODP_STATIC_ASSERT(_ODP_REASS_MAX_FRAGS <= UINT8_MAX, "REASS_MAX_FRAGS_ERROR");
+
+/* Fragment type */
+#define FRAG_NONE 0
+#define FRAG_IPV4 1
+#define FRAG_IPV6 2
+
+/* Datagram identification. Unused bytes are zero. */
+typedef struct {
+	uint8_t src[_ODP_IPV6ADDR_LEN];
+	uint8_t dst[_ODP_IPV6ADDR_LEN];
+	uint32_t id;
+	uint8_t proto;
+	uint8_t ipv6;
+	uint16_t pad;
+
+} reass_key_t;
+
+/* Fragment information parsed from packet data */
+typedef struct {
+	reass_key_t key;
+	uint32_t l3_offset;
+	uint32_t hdr_len;
+	uint32_t offset;
+	uint32_t len;
+	int more;
+
+} frag_info_t;
+
+/* Reassembly in progress */
+typedef struct {
+	reass_key_t key;
+
+	/* Fragments in offset order */
+	odp_packet_hdr_t *head;
+
+	/* Reception time of the first fragment */
+	uint64_t start_ns;
+
+	/* Datagram payload length. Zero until the last fragment has been received. */
+	uint32_t total_len;
+
+	/* Sum of received fragment payload lengths */
+	uint32_t rcvd_len;
+
+	uint16_t num_frags;
+	uint8_t used;
+
+} reass_flow_t;
+
+typedef struct ODP_ALIGNED_CACHE {
+	odp_ticketlock_t lock;
+	reass_flow_t flow[REASS_SHARD_FLOWS];
+
+} reass_shard_t;
+
+typedef struct _odp_reass_tbl_t {
+	/* Number of reassemblies in progress */
+	odp_atomic_u32_t num_flows;
+
+	/* Next shard to be checked for expired reassemblies */
+	odp_atomic_u32_t expire_idx;
+
+	uint64_t max_wait_ns;
+	uint16_t max_num_frags;
+	uint8_t en_ipv4;
+	uint8_t en_ipv6;
+	odp_shm_t shm;
+
+	reass_shard_t shard[REASS_SHARDS];
+
+} reass_tbl_t;
+
+void _odp_reass_capability(odp_reass_capability_t *capa)
+{
+	capa->ip = true;
+	capa->ipv4 = true;
+	capa->ipv6 = true;
+	capa->max_wait_time = _ODP_REASS_MAX_WAIT_NS;
+	capa->max_num_frags = _ODP_REASS_MAX_FRAGS;
+}
+
+int _odp_reass_create(pktio_entry_t *entry)
+{
+	const odp_reass_config_t *config = &entry->config.reassembly;
+	char shm_name[ODP_SHM_NAME_LEN];
+	reass_tbl_t *tbl;
+	odp_shm_t shm;
+
+	snprintf(shm_name, sizeof(shm_name), "_odp_pktio_reass_%d", odp_pktio_index(entry->handle));
+	shm = odp_shm_reserve(shm_name, sizeof(reass_tbl_t), ODP_CACHE_LINE_SIZE, 0);
+	if (shm == ODP_SHM_INVALID) {
+		_ODP_ERR("Reassembly table reserve failed\n");
+		return -1;
+	}
+
+	tbl = odp_shm_addr(shm);
+	memset(tbl, 0, sizeof(reass_tbl_t));
+
+	odp_atomic_init_u32(&tbl->num_flows, 0);
+	odp_atomic_init_u32(&tbl->expire_idx, 0);
+	tbl->max_wait_ns = config->max_wait_time ? config->max_wait_time : _ODP_REASS_MAX_WAIT_NS;
+	tbl->max_num_frags = config->max_num_frags;
+	tbl->en_ipv4 = config->en_ipv4;
+	tbl->en_ipv6 = config->en_ipv6;
+	tbl->shm = shm;
+
+	for (int i = 0; i < REASS_SHARDS; i++)
+		odp_ticketlock_init(&tbl->shard[i].lock);
+
+	entry->reass_tbl = tbl;
+
+	return 0;
+}
+
+static void free_frags(odp_packet_hdr_t *hdr)
+{
+	while (hdr) {
+		odp_packet_hdr_t *next = hdr->reass.next;
+
+		odp_packet_free(packet_handle(hdr));
+		hdr = next;
+	}
+}
+
+void _odp_reass_destroy(pktio_entry_t *entry)
+{
+	reass_tbl_t *tbl = entry->reass_tbl;
+
+	if (tbl == NULL)
+		return;
+
+	for (int i = 0; i < REASS_SHARDS; i++) {
+		for (int j = 0; j < REASS_SHARD_FLOWS; j++) {
+			reass_flow_t *flow = &tbl->shard[i].flow[j];
+
+			if (flow->used)
+				free_frags(flow->head);
+		}
+	}
+
+	entry->reass_tbl = NULL;
+
+	if (odp_shm_free(tbl->shm))
+		_ODP_ERR("Reassembly table free failed\n");
+}
+
+/* Parse L2 and L3 headers of an IP fragment. Returns FRAG_NONE if the packet is not a valid
+ * fragment. */
+static int frag_parse(const uint8_t *data, uint32_t data_len, uint32_t frame_len,
+		      frag_info_t *info)
+{
+	const _odp_ethhdr_t *eth = (const _odp_ethhdr_t *)(uintptr_t)data;
+	uint32_t off = _ODP_ETHHDR_LEN;
+	uint16_t ethtype;
+
+	if (odp_unlikely(data_len < _ODP_ETHHDR_LEN))
+		return FRAG_NONE;
+
+	ethtype = odp_be_to_cpu_16(eth->type);
+
+	for (int i = 0; i < REASS_MAX_VLANS; i++) {
+		const _odp_vlanhdr_t *vlan = (const _odp_vlanhdr_t *)(uintptr_t)(data + off);
+
+		if (ethtype != _ODP_ETHTYPE_VLAN && ethtype != _ODP_ETHTYPE_VLAN_OUTER)
+			break;
+
+		if (data_len < off + _ODP_VLANHDR_LEN)
+			return FRAG_NONE;
+
+		ethtype = odp_be_to_cpu_16(vlan->type);
+		off += _ODP_VLANHDR_LEN;
+	}
+
+	if (ethtype == _ODP_ETHTYPE_IPV4) {
+		const _odp_ipv4hdr_t *ip = (const _odp_ipv4hdr_t *)(uintptr_t)(data + off);
+		uint32_t ihl, tot_len;
+		uint16_t frag_offset;
+
+		if (data_len < off + _ODP_IPV4HDR_LEN || _ODP_IPV4HDR_VER(ip->ver_ihl) != _ODP_IPV4)
+			return FRAG_NONE;
+
+		frag_offset = odp_be_to_cpu_16(ip->frag_offset);
+		if (!_ODP_IPV4HDR_IS_FRAGMENT(frag_offset))
+			return FRAG_NONE;
+
+		ihl = _ODP_IPV4HDR_IHL(ip->ver_ihl) * 4;
+		tot_len = odp_be_to_cpu_16(ip->tot_len);
+		if (ihl < _ODP_IPV4HDR_LEN || tot_len <= ihl || off + tot_len > frame_len)
+			return FRAG_NONE;
+
+		memset(&info->key, 0, sizeof(reass_key_t));
+		memcpy(info->key.src, &ip->src_addr, sizeof(ip->src_addr));
+		memcpy(info->key.dst, &ip->dst_addr, sizeof(ip->dst_addr));
+		info->key.id = ip->id;
+		info->key.proto = ip->proto;
+		info->l3_offset = off;
+		info->hdr_len = off + ihl;
+		info->offset = _ODP_IPV4HDR_FRAG_OFFSET(frag_offset) * 8;
+		info->len = tot_len - ihl;
+		info->more = !!(frag_offset & _ODP_IPV4HDR_FRAG_OFFSET_MORE_FRAGS);
+
+		return FRAG_IPV4;
+	}
+
+	if (ethtype == _ODP_ETHTYPE_IPV6) {
+		const _odp_ipv6hdr_t *ip = (const _odp_ipv6hdr_t *)(uintptr_t)(data + off);
+		const ipv6_frag_hdr_t *frag;
+		uint32_t payload_len;
+		uint16_t frag_offset;
+
+		/* Only fragment header directly after the IPv6 header is supported */
+		if (data_len < off + _ODP_IPV6HDR_LEN + IPV6_FRAG_HDR_LEN ||
+		    ip->next_hdr != _ODP_IPPROTO_FRAG)
+			return FRAG_NONE;
+
+		frag = (const ipv6_frag_hdr_t *)(uintptr_t)(data + off + _ODP_IPV6HDR_LEN);
+		frag_offset = odp_be_to_cpu_16(frag->frag_offset);
+
+		/* Atomic fragments are delivered as such */
+		if (!(frag_offset & (IPV6_FRAG_OFFSET_MASK | IPV6_FRAG_MORE)))
+			return FRAG_NONE;
+
+		payload_len = odp_be_to_cpu_16(ip->payload_len);
+		if (payload_len <= IPV6_FRAG_HDR_LEN ||
+		    off + _ODP_IPV6HDR_LEN + payload_len > frame_len)
+			return FRAG_NONE;
+
+		memset(&info->key, 0, sizeof(reass_key_t));
+		memcpy(info->key.src, &ip->src_addr, _ODP_IPV6ADDR_LEN);
+		memcpy(info->key.dst, &ip->dst_addr, _ODP_IPV6ADDR_LEN);
+		info->key.id = frag->id;
+		info->key.ipv6 = 1;
+		info->l3_offset = off;
+		info->hdr_len = off + _ODP_IPV6HDR_LEN + IPV6_FRAG_HDR_LEN;
+		info->offset = frag_offset & IPV6_FRAG_OFFSET_MASK;
+		info->len = payload_len - IPV6_FRAG_HDR_LEN;
+		info->more = !!(frag_offset & IPV6_FRAG_MORE);
+
+		return FRAG_IPV6;
+	}
+
+	return FRAG_NONE;
+}
+
+/* Check if a received packet is a fragment to be reassembled */
+static int frag_check(const reass_tbl_t *tbl, odp_packet_t pkt, frag_info_t *info)
+{
+	uint8_t buf[REASS_HDR_BYTES];
+	const uint8_t *data = odp_packet_data(pkt);
+	uint32_t seg_len = odp_packet_seg_len(pkt);
+	uint32_t pkt_len = odp_packet_len(pkt);
+	int type;
+
+	if (odp_unlikely(seg_len < REASS_HDR_BYTES && pkt_len > seg_len)) {
+		seg_len = _ODP_MIN(pkt_len, (uint32_t)REASS_HDR_BYTES);
+		odp_packet_copy_to_mem(pkt, 0, seg_len, buf);
+		data = buf;
+	}
+
+	type = frag_parse(data, seg_len, pkt_len, info);
+
+	if (type == FRAG_NONE ||
+	    (type == FRAG_IPV4 && !tbl->en_ipv4) ||
+	    (type == FRAG_IPV6 && !tbl->en_ipv6))
+		return 0;
+
+	/* All but the last fragment carry a multiple of 8 bytes. Also, the reassembled
+	 * packet must not exceed the maximum IP packet size. */
+	if ((info->more && (info->len & 7)) ||
+	    info->offset + info->len > REASS_MAX_LEN - (info->hdr_len - info->l3_offset))
+		return 0;
+
+	return 1;
+}
+
+/* Trim link layer padding */
+static int frame_trim(odp_packet_t *pkt, uint32_t frame_len)
+{
+	uint32_t pkt_len = odp_packet_len(*pkt);
+
+	if (pkt_len > frame_len &&
+	    odp_packet_trunc_tail(pkt, pkt_len - frame_len, NULL, NULL) < 0)
+		return -1;
+
+	return 0;
+}
+
+/* Re-parse reassembled packet as it would have been received */
+static int reass_parse(pktio_entry_t *entry, odp_packet_t pkt)
+{
+	odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt);
+	const odp_proto_layer_t layer = entry->parse_layer;
+	uint32_t pkt_len = odp_packet_len(pkt);
+	uint32_t seg_len = odp_packet_seg_len(pkt);
+	const uint8_t *data = odp_packet_data(pkt);
+	uint8_t buf[PARSE_BYTES];
+	uint32_t ts = pkt_hdr->p.input_flags.timestamp;
+	int ret;
+
+	if (layer == ODP_PROTO_LAYER_NONE)
+		return 0;
+
+	if (odp_unlikely(seg_len < PARSE_BYTES && pkt_len > seg_len)) {
+		seg_len = _ODP_MIN(pkt_len, (uint32_t)PARSE_BYTES);
+		odp_packet_copy_to_mem(pkt, 0, seg_len, buf);
+		data = buf;
+	}
+
+	packet_parse_reset(pkt_hdr, 0);
+	ret = _odp_packet_parse_common(pkt_hdr, data, pkt_len, seg_len, layer,
+				       entry->config.pktin);
+	pkt_hdr->p.input_flags.timestamp = ts;
+
+	return ret;
+}
+
+/* Build the reassembled packet from a complete set of fragments */
+static odp_packet_t reass_complete(pktio_entry_t *entry, odp_packet_hdr_t *head)
+{
+	uint8_t buf[REASS_HDR_BYTES];
+	odp_packet_t pkt = packet_handle(head);
+	odp_packet_hdr_t *next = head->reass.next;
+	odp_packet_hdr_t *pkt_hdr;
+	const uint32_t l3_offset = head->reass.l3_offset;
+	const uint32_t hdr_len = head->reass.hdr_len;
+	uint32_t total_len = head->reass.len;
+	uint8_t num_frags = 1;
+
+	if (frame_trim(&pkt, hdr_len + head->reass.len))
+		goto error;
+
+	while (next) {
+		odp_packet_t frag = packet_handle(next);
+		uint32_t len = next->reass.len;
+
+		head = next;
+		next = next->reass.next;
+
+		if (odp_packet_trunc_head(&frag, head->reass.hdr_len, NULL, NULL) < 0 ||
+		    frame_trim(&frag, len) || odp_packet_concat(&pkt, frag) < 0) {
+			odp_packet_free(frag);
+			goto error;
+		}
+
+		total_len += len;
+		num_frags++;
+	}
+
+	if (odp_packet_copy_to_mem(pkt, 0, hdr_len, buf))
+		goto error;
+
+	if (hdr_len - l3_offset == _ODP_IPV6HDR_LEN + IPV6_FRAG_HDR_LEN &&
+	    _ODP_IPV4HDR_VER(buf[l3_offset]) == _ODP_IPV6) {
+		_odp_ipv6hdr_t *ip = (_odp_ipv6hdr_t *)(uintptr_t)(buf + l3_offset);
+		const ipv6_frag_hdr_t *frag = (const ipv6_frag_hdr_t *)(uintptr_t)(ip + 1);
+
+		/* Remove fragment header */
+		ip->next_hdr = frag->next_hdr;
+		ip->payload_len = odp_cpu_to_be_16(total_len);
+
+		if (odp_packet_copy_from_mem(pkt, IPV6_FRAG_HDR_LEN,
+					     l3_offset + _ODP_IPV6HDR_LEN, buf) ||
+		    odp_packet_trunc_head(&pkt, IPV6_FRAG_HDR_LEN, NULL, NULL) < 0)
+			goto error;
+	} else {
+		_odp_ipv4hdr_t *ip = (_odp_ipv4hdr_t *)(uintptr_t)(buf + l3_offset);
+		const uint32_t ihl = hdr_len - l3_offset;
+		uint16_t frag_offset = odp_be_to_cpu_16(ip->frag_offset);
+
+		/* Keep only the don't fragment flag */
+		ip->frag_offset = odp_cpu_to_be_16(frag_offset & 0x4000);
+		ip->tot_len = odp_cpu_to_be_16(ihl + total_len);
+		ip->chksum = 0;
+		ip->chksum = ~chksum_finalize(chksum_partial(ip, ihl, 0));
+
+		if (odp_packet_copy_from_mem(pkt, l3_offset, ihl, ip))
+			goto error;
+	}
+
+	pkt_hdr = packet_hdr(pkt);
+
+	if (reass_parse(entry, pkt) < 0) {
+		odp_packet_free(pkt);
+		_ODP_STAT_INC(entry->stats_extra, in_errors);
+		return ODP_PACKET_INVALID;
+	}
+
+	pkt_hdr->p.flags.reass = ODP_PACKET_REASS_COMPLETE;
+	pkt_hdr->reass_frags = num_frags;
+
+	/* Reassembly is done before inline IPsec processing */
+	if (entry->config.inbound_ipsec && !pkt_hdr->p.flags.ip_err &&
+	    odp_packet_has_ipsec(pkt) && !_odp_ipsec_try_inline(&pkt)) {
+		pkt_hdr = packet_hdr(pkt);
+
+		if (odp_unlikely(odp_queue_enq(pkt_hdr->dst_queue, odp_packet_to_event(pkt)))) {
+			_ODP_STAT_INC(entry->stats_extra, in_discards);
+			odp_packet_free(pkt);
+		}
+
+		return ODP_PACKET_INVALID;
+	}
+
+	return pkt;
+
+error:
+	odp_packet_free(pkt);
+	free_frags(next);
+	_ODP_STAT_INC(entry->stats_extra, in_discards);
+	return ODP_PACKET_INVALID;
+}
+
+/* Combine fragments of an unfinished reassembly into a result packet of incomplete status */
+static odp_packet_t reass_incomplete(pktio_entry_t *entry, odp_packet_hdr_t *head)
+{
+	odp_packet_t pkt = packet_handle(head);
+	odp_packet_hdr_t *next = head->reass.next;
+	odp_packet_hdr_t *pkt_hdr;
+	const uint64_t start_ns = head->reass.start_ns;
+	uint8_t num_frags = 1;
+
+	if (frame_trim(&pkt, head->reass.hdr_len + head->reass.len))
+		goto error;
+
+	while (next) {
+		odp_packet_t frag = packet_handle(next);
+
+		head = next;
+		next = next->reass.next;
+
+		if (frame_trim(&frag, head->reass.hdr_len + head->reass.len) ||
+		    odp_packet_concat(&pkt, frag) < 0) {
+			odp_packet_free(frag);
+			goto error;
+		}
+
+		num_frags++;
+	}
+
+	pkt_hdr = packet_hdr(pkt);
+	pkt_hdr->p.flags.reass = ODP_PACKET_REASS_INCOMPLETE;
+	pkt_hdr->reass_frags = num_frags;
+	pkt_hdr->reass.start_ns = start_ns;
+
+	return pkt;
+
+error:
+	odp_packet_free(pkt);
+	free_frags(next);
+	_ODP_STAT_INC(entry->stats_extra, in_discards);
+	return ODP_PACKET_INVALID;
+}
+
+/* Remove a reassembly from the table. Called with the shard locked. */
+static odp_packet_hdr_t *flow_remove(reass_tbl_t *tbl, reass_flow_t *flow)
+{
+	odp_packet_hdr_t *head = flow->head;
+
+	head->reass.start_ns = flow->start_ns;
+	flow->head = NULL;
+	flow->used = 0;
+	odp_atomic_dec_u32(&tbl->num_flows);
+
+	return head;
+}
+
+static odp_packet_t frag_insert(pktio_entry_t *entry, reass_tbl_t *tbl, odp_packet_hdr_t *pkt_hdr,
+				const frag_info_t *info, uint64_t now)
+{
+	uint32_t hash = odp_hash_crc32c(&info->key, sizeof(reass_key_t), 0);
+	reass_shard_t *shard = &tbl->shard[hash % REASS_SHARDS];
+	reass_flow_t *flow = NULL;
+	reass_flow_t *free_flow = NULL;
+	reass_flow_t *oldest = NULL;
+	odp_packet_hdr_t *prev, *cur;
+	odp_packet_hdr_t *out = NULL;
+	const uint32_t end = info->offset + info->len;
+	int complete = 0;
+	int error;
+
+	pkt_hdr->reass.next = NULL;
+	pkt_hdr->reass.offset = info->offset;
+	pkt_hdr->reass.len = info->len;
+	pkt_hdr->reass.l3_offset = info->l3_offset;
+	pkt_hdr->reass.hdr_len = info->hdr_len;
+
+	odp_ticketlock_lock(&shard->lock);
+
+	for (int i = 0; i < REASS_SHARD_FLOWS; i++) {
+		reass_flow_t *f = &shard->flow[i];
+
+		if (!f->used) {
+			if (free_flow == NULL)
+				free_flow = f;
+			continue;
+		}
+
+		if (!memcmp(&f->key, &info->key, sizeof(reass_key_t))) {
+			flow = f;
+			break;
+		}
+
+		if (oldest == NULL || f->start_ns < oldest->start_ns)
+			oldest = f;
+	}
+
+	/* Expired reassembly that has not been noticed by the expiry scan yet */
+	if (flow && now - flow->start_ns > tbl->max_wait_ns) {
+		out = flow_remove(tbl, flow);
+		free_flow = flow;
+		flow = NULL;
+	}
+
+	if (flow == NULL) {
+		/* Table shard full, evict the oldest reassembly */
+		if (free_flow == NULL) {
+			out = flow_remove(tbl, oldest);
+			free_flow = oldest;
+		}
+
+		flow = free_flow;
+		flow->key = info->key;
+		flow->head = pkt_hdr;
+		flow->start_ns = now;
+		flow->total_len = info->more ? 0 : end;
+		flow->rcvd_len = info->len;
+		flow->num_frags = 1;
+		flow->used = 1;
+		odp_atomic_inc_u32(&tbl->num_flows);
+
+		odp_ticketlock_unlock(&shard->lock);
+
+		return out ? reass_incomplete(entry, out) : ODP_PACKET_INVALID;
+	}
+
+	prev = NULL;
+	cur = flow->head;
+
+	while (cur && cur->reass.offset < info->offset) {
+		prev = cur;
+		cur = cur->reass.next;
+	}
+
+	/* Overlapping or inconsistent fragments end the reassembly */
+	error = (prev && prev->reass.offset + prev->reass.len > info->offset) ||
+		(cur && end > cur->reass.offset) ||
+		(!info->more && (flow->total_len || cur)) ||
+		(flow->total_len && end > flow->total_len);
+
+	pkt_hdr->reass.next = cur;
+	if (prev)
+		prev->reass.next = pkt_hdr;
+	else
+		flow->head = pkt_hdr;
+
+	flow->num_frags++;
+	flow->rcvd_len += info->len;
+	if (!info->more)
+		flow->total_len = end;
+
+	if (!error && flow->total_len && flow->rcvd_len == flow->total_len) {
+		out = flow_remove(tbl, flow);
+		complete = 1;
+	} else if (error || flow->num_frags >= tbl->max_num_frags) {
+		out = flow_remove(tbl, flow);
+	}
+
+	odp_ticketlock_unlock(&shard->lock);
+
+	if (out == NULL)
+		return ODP_PACKET_INVALID;
+
+	return complete ? reass_complete(entry, out) : reass_incomplete(entry, out);
+}
+
+/* Output expired reassemblies as incomplete */
+static int reass_expire(pktio_entry_t *entry, reass_tbl_t *tbl, odp_packet_t pkt[], int max,
+			uint64_t now)
+{
+	odp_packet_hdr_t *out[REASS_SHARD_FLOWS];
+	int num = 0;
+
+	for (int i = 0; i < REASS_EXPIRE_SHARDS && num < max; i++) {
+		uint32_t idx = odp_atomic_fetch_inc_u32(&tbl->expire_idx) % REASS_SHARDS;
+		reass_shard_t *shard = &tbl->shard[idx];
+		int num_out = 0;
+
+		odp_ticketlock_lock(&shard->lock);
+
+		for (int j = 0; j < REASS_SHARD_FLOWS && num + num_out < max; j++) {
+			reass_flow_t *flow = &shard->flow[j];
+
+			if (flow->used && now - flow->start_ns > tbl->max_wait_ns)
+				out[num_out++] = flow_remove(tbl, flow);
+		}
+
+		odp_ticketlock_unlock(&shard->lock);
+
+		for (int j = 0; j < num_out; j++) {
+			odp_packet_t res = reass_incomplete(entry, out[j]);
+
+			if (res != ODP_PACKET_INVALID)
+				pkt[num++] = res;
+		}
+	}
+
+	return num;
+}
+
+int _odp_reass_pktin(pktio_entry_t *entry, odp_packet_t pkt[], int num, int max)
+{
+	reass_tbl_t *tbl = entry->reass_tbl;
+	const int l3_parsed = entry->parse_layer >= ODP_PROTO_LAYER_L3;
+	uint64_t now = 0;
+	int num_out = 0;
+
+	/* Each packet is replaced by at most one packet, so the table is compacted in place */
+	for (int i = 0; i < num; i++) {
+		odp_packet_t res = pkt[i];
+		odp_packet_hdr_t *pkt_hdr = packet_hdr(res);
+		frag_info_t info;
+
+		if ((l3_parsed && !pkt_hdr->p.input_flags.ipfrag) ||
+		    pkt_hdr->p.flags.all.error ||
+		    pkt_hdr->event_hdr.subtype != ODP_EVENT_PACKET_BASIC ||
+		    !frag_check(tbl, res, &info)) {
+			pkt[num_out++] = res;
+			continue;
+		}
+
+		if (now == 0)
+			now = odp_time_global_ns();
+
+		res = frag_insert(entry, tbl, pkt_hdr, &info, now);
+		if (res != ODP_PACKET_INVALID)
+			pkt[num_out++] = res;
+	}
+
+	if (odp_unlikely(odp_atomic_load_u32(&tbl->num_flows)) && num_out < max) {
+		if (now == 0)
+			now = odp_time_global_ns();
+
+		num_out += reass_expire(entry, tbl, &pkt[num_out], max - num_out, now);
+	}
+
+	return num_out;
+}
+
+int odp_packet_reass_partial_state(odp_packet_t pkt, odp_packet_t frags[],
+				   odp_packet_reass_partial_state_t *res)
+{
+	odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt);
+	uint8_t buf[REASS_HDR_BYTES];
+	uint32_t offset[_ODP_REASS_MAX_FRAGS];
+	const odp_pktio_t input = pkt_hdr->input;
+	const uint64_t start_ns = pkt_hdr->reass.start_ns;
+	const uint32_t pkt_len = odp_packet_len(pkt);
+	const uint32_t num = pkt_hdr->reass_frags;
+	odp_packet_parse_param_t param;
+	uint32_t off = 0;
+	uint32_t i;
+
+	if (pkt_hdr->p.flags.reass != ODP_PACKET_REASS_INCOMPLETE || num == 0 ||
+	    num > _ODP_REASS_MAX_FRAGS)
+		return -1;
+
+	/* Find fragment boundaries */
+	for (i = 0; i < num; i++) {
+		uint32_t len = _ODP_MIN(pkt_len - off, (uint32_t)REASS_HDR_BYTES);
+		frag_info_t info;
+
+		if (off >= pkt_len || odp_packet_copy_to_mem(pkt, off, len, buf) ||
+		    frag_parse(buf, len, pkt_len - off, &info) == FRAG_NONE)
+			return -1;
+
+		offset[i] = off;
+		off += info.hdr_len + info.len;
+	}
+
+	if (off != pkt_len)
+		return -1;
+
+	/* Split from the end, so that every fragment is copied only once */
+	for (i = num - 1; i > 0; i--) {
+		if (odp_packet_split(&pkt, offset[i], &frags[i]) < 0) {
+			_ODP_ERR("Packet split failed\n");
+
+			while (++i < num)
+				(void)odp_packet_concat(&pkt, frags[i]);
+
+			return -1;
+		}
+	}
+
+	frags[0] = pkt;
+
+	memset(&param, 0, sizeof(param));
+	param.proto = ODP_PROTO_ETH;
+	param.last_layer = ODP_PROTO_LAYER_ALL;
+
+	for (i = 0; i < num; i++) {
+		odp_packet_hdr_t *frag_hdr = packet_hdr(frags[i]);
+
+		(void)odp_packet_parse(frags[i], 0, &param);
+		frag_hdr->p.flags.reass = ODP_PACKET_REASS_NONE;
+		frag_hdr->reass_frags = 0;
+		frag_hdr->input = input;
+	}
+
+	res->num_frags = num;
+	res->elapsed_time = odp_time_global_ns() - start_ns;
+
+	return 0;
+}
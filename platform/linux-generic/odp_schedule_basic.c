@@ -24,6 +24,8 @@
 #include <ring/odp_ring_mpmc_rst_u32_internal.h>
 #include <odp_timer_internal.h>
 #include <odp_queue_basic_internal.h>
+#include <odp_qsbr_internal.h>
+#include <odp_sched_stats_internal.h>
 #include <odp_libconfig_internal.h>
 #include <odp/api/plat/queue_inlines.h>
 #include <odp/api/plat/schedule_inline_types.h>
@@ -163,6 +165,23 @@ static uint8_t sched_random_u8[] = {
 
 ODP_STATIC_ASSERT(sizeof(sched_random_u8) == RANDOM_TBL_SIZE, "Bad_random_table_size");
 
+/* Per thread statistics. Updated only by the owner thread. */
+typedef struct ODP_ALIGNED_CACHE {
+	odp_atomic_u64_t rounds;
+	odp_atomic_u64_t empty;
+	odp_atomic_u64_t events;
+	odp_atomic_u64_t spread_events[MAX_SPREAD];
+	odp_atomic_u64_t wait_hist[ODP_SCHEDULE_WAIT_HIST_BUCKETS];
+
+} sched_thr_stats_t;
+
+/* Per queue statistics. Updated by all threads scheduling the queue. */
+typedef struct ODP_ALIGNED_CACHE {
+	odp_atomic_u64_t events;
+	odp_atomic_u64_t wait_hist[ODP_SCHEDULE_WAIT_HIST_BUCKETS];
+
+} sched_queue_stats_t;
+
 /* Scheduler local data */
 typedef struct ODP_ALIGNED_CACHE {
 	uint32_t sched_round;
@@ -190,6 +209,10 @@ typedef struct ODP_ALIGNED_CACHE {
 	uint8_t grp[NUM_SCHED_GRPS];
 	uint8_t spread_tbl[SPREAD_TBL_SIZE];
 
+#if _ODP_SCHED_STATS
+	sched_thr_stats_t *stats;
+#endif
+
 	struct {
 		/* Source queue index */
 		uint32_t src_queue;
@@ -295,6 +318,17 @@ typedef struct {
 	uint32_t num_grp_prios;
 	odp_atomic_u32_t next_rand;
 
+#if _ODP_SCHED_STATS
+	sched_thr_stats_t thr_stats[ODP_THREAD_COUNT_MAX];
+	sched_queue_stats_t queue_stats[CONFIG_MAX_SCHED_QUEUES];
+
+	/* Counter values at the previous statistics reset. Counters are never cleared by
+	 * a reset, since that would race with the threads updating them. Statistics are
+	 * reported as differences to these values. */
+	sched_thr_stats_t thr_stats_base[ODP_THREAD_COUNT_MAX];
+	sched_queue_stats_t queue_stats_base[CONFIG_MAX_SCHED_QUEUES];
+#endif
+
 } sched_global_t;
 
 /* Check that queue[] variables are large enough */
@@ -570,6 +604,9 @@ static void sched_local_init(void)
 	sched_local.thr         = odp_thread_id();
 	sched_local.sync_ctx    = NO_SYNC_CONTEXT;
 	sched_local.stash.queue = ODP_QUEUE_INVALID;
+#if _ODP_SCHED_STATS
+	sched_local.stats       = &sched->thr_stats[sched_local.thr];
+#endif
 
 	spread = spread_from_index(sched_local.thr);
 	prefer_ratio = sched->config.prefer_ratio;
@@ -586,6 +623,93 @@ static void sched_local_init(void)
 	}
 }
 
+#if _ODP_SCHED_STATS
+static void thr_stats_init(sched_thr_stats_t *stats)
+{
+	odp_atomic_init_u64(&stats->rounds, 0);
+	odp_atomic_init_u64(&stats->empty, 0);
+	odp_atomic_init_u64(&stats->events, 0);
+
+	for (int i = 0; i < MAX_SPREAD; i++)
+		odp_atomic_init_u64(&stats->spread_events[i], 0);
+
+	for (int i = 0; i < ODP_SCHEDULE_WAIT_HIST_BUCKETS; i++)
+		odp_atomic_init_u64(&stats->wait_hist[i], 0);
+}
+
+/* Copy current counter values of 'src' into 'dst' */
+static void thr_stats_snapshot(sched_thr_stats_t *dst, sched_thr_stats_t *src)
+{
+	odp_atomic_store_u64(&dst->rounds, odp_atomic_load_u64(&src->rounds));
+	odp_atomic_store_u64(&dst->empty, odp_atomic_load_u64(&src->empty));
+	odp_atomic_store_u64(&dst->events, odp_atomic_load_u64(&src->events));
+
+	for (int i = 0; i < MAX_SPREAD; i++)
+		odp_atomic_store_u64(&dst->spread_events[i],
+				     odp_atomic_load_u64(&src->spread_events[i]));
+
+	for (int i = 0; i < ODP_SCHEDULE_WAIT_HIST_BUCKETS; i++)
+		odp_atomic_store_u64(&dst->wait_hist[i], odp_atomic_load_u64(&src->wait_hist[i]));
+}
+
+static void queue_stats_snapshot(sched_queue_stats_t *dst, sched_queue_stats_t *src)
+{
+	odp_atomic_store_u64(&dst->events, odp_atomic_load_u64(&src->events));
+
+	for (int i = 0; i < ODP_SCHEDULE_WAIT_HIST_BUCKETS; i++)
+		odp_atomic_store_u64(&dst->wait_hist[i], odp_atomic_load_u64(&src->wait_hist[i]));
+}
+
+/* Counter value since the previous statistics reset */
+static inline uint64_t stat_read(odp_atomic_u64_t *ctr, odp_atomic_u64_t *base)
+{
+	return odp_atomic_load_u64(ctr) - odp_atomic_load_u64(base);
+}
+#endif
+
+/* Initialize statistics of a queue that is being created. No other thread accesses them. */
+static void queue_stats_init(uint32_t queue_index ODP_UNUSED)
+{
+#if _ODP_SCHED_STATS
+	sched_queue_stats_t *stats = &sched->queue_stats[queue_index];
+	sched_queue_stats_t *base = &sched->queue_stats_base[queue_index];
+
+	odp_atomic_init_u64(&stats->events, 0);
+	odp_atomic_init_u64(&base->events, 0);
+
+	for (int i = 0; i < ODP_SCHEDULE_WAIT_HIST_BUCKETS; i++) {
+		odp_atomic_init_u64(&stats->wait_hist[i], 0);
+		odp_atomic_init_u64(&base->wait_hist[i], 0);
+	}
+#endif
+}
+
+static void stats_init(void)
+{
+#if _ODP_SCHED_STATS
+	for (int i = 0; i < ODP_THREAD_COUNT_MAX; i++) {
+		thr_stats_init(&sched->thr_stats[i]);
+		thr_stats_init(&sched->thr_stats_base[i]);
+	}
+
+	for (int i = 0; i < CONFIG_MAX_SCHED_QUEUES; i++)
+		queue_stats_init(i);
+#endif
+}
+
+/* Counters are updated concurrently by other threads (thread counters only by the owner
+ * thread), so a reset does not modify them. It only records current values as the new base. */
+static void schedule_stats_reset(void)
+{
+#if _ODP_SCHED_STATS
+	for (int i = 0; i < ODP_THREAD_COUNT_MAX; i++)
+		thr_stats_snapshot(&sched->thr_stats_base[i], &sched->thr_stats[i]);
+
+	for (int i = 0; i < CONFIG_MAX_SCHED_QUEUES; i++)
+		queue_stats_snapshot(&sched->queue_stats_base[i], &sched->queue_stats[i]);
+#endif
+}
+
 static int schedule_init_global(void)
 {
 	odp_shm_t shm;
@@ -695,6 +819,8 @@ static int schedule_init_global(void)
 
 	odp_thrmask_setall(&sched->mask_all);
 
+	stats_init();
+
 	_ODP_DBG("done\n");
 
 	return 0;
@@ -954,6 +1080,8 @@ static int schedule_create_queue(uint32_t queue_index,
 	for (i = 0; i < CONFIG_QUEUE_MAX_ORD_LOCKS; i++)
 		odp_atomic_init_u64(&sched->order[queue_index].lock[i], 0);
 
+	queue_stats_init(queue_index);
+
 	return 0;
 }
 
@@ -1480,6 +1608,68 @@ static inline void schedule_ord_stash_release_no_stash(odp_queue_t dst_queue ODP
 	/* Nothing to do */
 }
 
+#if _ODP_SCHED_STATS
+/* Thread statistics are written only by the owner thread, so there is no need for atomic RMW */
+static inline void thr_stat_add(odp_atomic_u64_t *stat, uint64_t val)
+{
+	odp_atomic_store_u64(stat, odp_atomic_load_u64(stat) + val);
+}
+#endif
+
+static inline void stats_round(int empty ODP_UNUSED)
+{
+#if _ODP_SCHED_STATS
+	thr_stat_add(&sched_local.stats->rounds, 1);
+
+	if (empty)
+		thr_stat_add(&sched_local.stats->empty, 1);
+#endif
+}
+
+/* Account events dequeued from a queue. Event wait times are available only for events that
+ * were enqueued into the queue ('timed'), not for packets received directly from pktin. */
+static inline void stats_events(uint32_t qi ODP_UNUSED, int spr ODP_UNUSED,
+				const odp_event_t ev[] ODP_UNUSED, int num ODP_UNUSED,
+				int timed ODP_UNUSED)
+{
+#if _ODP_SCHED_STATS
+	sched_thr_stats_t *thr_stats = sched_local.stats;
+	sched_queue_stats_t *q_stats = &sched->queue_stats[qi];
+	uint32_t hist[ODP_SCHEDULE_WAIT_HIST_BUCKETS];
+	uint32_t first = ODP_SCHEDULE_WAIT_HIST_BUCKETS;
+	uint32_t last = 0;
+	uint64_t now;
+
+	thr_stat_add(&thr_stats->events, num);
+	thr_stat_add(&thr_stats->spread_events[spr], num);
+	odp_atomic_add_u64(&q_stats->events, num);
+
+	if (!timed)
+		return;
+
+	/* Collect a burst into a local histogram to update only touched shared buckets */
+	memset(hist, 0, sizeof(hist));
+	now = odp_time_global_ns();
+
+	for (int i = 0; i < num; i++) {
+		uint64_t ts = _odp_event_hdr(ev[i])->sched_ts;
+		uint32_t b = _odp_sched_stats_bucket(now > ts ? now - ts : 0);
+
+		hist[b]++;
+		first = _ODP_MIN(first, b);
+		last = _ODP_MAX(last, b);
+	}
+
+	for (uint32_t b = first; b <= last; b++) {
+		if (hist[b] == 0)
+			continue;
+
+		thr_stat_add(&thr_stats->wait_hist[b], hist[b]);
+		odp_atomic_add_u64(&q_stats->wait_hist[b], hist[b]);
+	}
+#endif
+}
+
 static inline int queue_is_pktin(uint32_t queue_index)
 {
 	return sched->queue[queue_index].poll_pktin;
@@ -1577,6 +1767,7 @@ static inline int schedule_grp_prio(odp_queue_t *out_queue, odp_event_t out_ev[]
 		int pktin;
 		uint32_t max_deq;
 		int stashed = 1;
+		int timed = 1;
 		odp_event_t *ev_tbl = sched_local.stash.ev;
 
 		if (spr >= num_spread)
@@ -1674,8 +1865,11 @@ static inline int schedule_grp_prio(odp_queue_t *out_queue, odp_event_t out_ev[]
 
 			/* Process packets from an atomic or parallel queue right away. */
 			num = num_pkt;
+			timed = 0;
 		}
 
+		stats_events(qi, spr, ev_tbl, num, timed);
+
 		if (ordered) {
 			uint64_t ctx;
 			odp_atomic_u64_t *next_ctx;
@@ -1750,6 +1944,8 @@ static inline int do_schedule(odp_queue_t *out_q, odp_event_t out_ev[], uint32_t
 	else if (sched_local.sync_ctx == ODP_SCHED_SYNC_ORDERED)
 		release_ordered();
 
+	_odp_qsbr_sched_quiescent();
+
 	if (odp_unlikely(sched_local.pause))
 		return 0;
 
@@ -1826,17 +2022,21 @@ static inline int do_schedule(odp_queue_t *out_q, odp_event_t out_ev[], uint32_t
 			/* Schedule events from the selected group and priority level */
 			ret = schedule_grp_prio(out_q, out_ev, max_num, grp, prio, spr, balance);
 
-			if (odp_likely(ret))
+			if (odp_likely(ret)) {
+				stats_round(0);
 				return ret;
+			}
 		}
 	}
 
+	stats_round(1);
 	return 0;
 }
 
 static inline int schedule_run(odp_queue_t *out_queue, odp_event_t out_ev[], uint32_t max_num)
 {
 	timer_run(1);
+	_odp_event_aggr_tmo_run();
 
 	return do_schedule(out_queue, out_ev, max_num);
 }
@@ -1849,6 +2049,7 @@ static inline int schedule_loop(odp_queue_t *out_queue, uint64_t wait,
 	int ret;
 
 	while (1) {
+		_odp_event_aggr_tmo_run();
 		ret = do_schedule(out_queue, out_ev, max_num);
 		if (ret) {
 			timer_run(2);
@@ -1883,6 +2084,7 @@ static inline int schedule_loop_sleep(odp_queue_t *out_queue, uint64_t wait,
 	int first = 1, sleep = 0;
 
 	while (1) {
+		_odp_event_aggr_tmo_run();
 		ret = do_schedule(out_queue, out_ev, max_num);
 		if (ret) {
 			timer_run(2);
@@ -2490,18 +2692,139 @@ static int schedule_capability(odp_schedule_capability_t *capa)
 	capa->max_queue_size = _odp_queue_glb->config.max_queue_size;
 	capa->max_flow_id = BUF_HDR_MAX_FLOW_ID;
 	capa->order_wait = ODP_SUPPORT_YES;
+	capa->stats = _ODP_SCHED_STATS ? ODP_SUPPORT_YES : ODP_SUPPORT_NO;
 
 	capa->aggr.max_num = CONFIG_MAX_EVENT_AGGR;
 	capa->aggr.max_num_per_queue = 1;
 	capa->aggr.max_size = CONFIG_EVENT_VECTOR_MAX_SIZE;
 	capa->aggr.min_size = 2;
-	capa->aggr.max_tmo_ns = 0;
-	capa->aggr.min_tmo_ns = 0;
+	capa->aggr.max_tmo_ns = CONFIG_VECTOR_MAX_TMO_NS;
+	capa->aggr.min_tmo_ns = CONFIG_EVENT_AGGR_MIN_TMO_NS;
 	capa->aggr.stats.bit.len = 1;
 
 	return 0;
 }
 
+#if _ODP_SCHED_STATS
+static void thr_stats_sum(int thr, odp_schedule_stats_t *stats)
+{
+	sched_thr_stats_t *thr_stats = &sched->thr_stats[thr];
+	sched_thr_stats_t *base = &sched->thr_stats_base[thr];
+
+	stats->num_rounds += stat_read(&thr_stats->rounds, &base->rounds);
+	stats->num_empty  += stat_read(&thr_stats->empty, &base->empty);
+	stats->num_events += stat_read(&thr_stats->events, &base->events);
+
+	for (int i = 0; i < ODP_SCHEDULE_WAIT_HIST_BUCKETS; i++)
+		stats->wait_hist[i] += stat_read(&thr_stats->wait_hist[i], &base->wait_hist[i]);
+}
+#endif
+
+static int schedule_stats(odp_schedule_stats_t *stats ODP_UNUSED)
+{
+#if _ODP_SCHED_STATS
+	memset(stats, 0, sizeof(odp_schedule_stats_t));
+
+	for (int i = 0; i < ODP_THREAD_COUNT_MAX; i++)
+		thr_stats_sum(i, stats);
+
+	return 0;
+#else
+	return -1;
+#endif
+}
+
+static int schedule_thread_stats(int thr ODP_UNUSED, odp_schedule_stats_t *stats ODP_UNUSED)
+{
+#if _ODP_SCHED_STATS
+	if (odp_unlikely(thr < 0 || thr >= ODP_THREAD_COUNT_MAX)) {
+		_ODP_ERR("Bad thread ID: %i\n", thr);
+		return -1;
+	}
+
+	memset(stats, 0, sizeof(odp_schedule_stats_t));
+	thr_stats_sum(thr, stats);
+
+	return 0;
+#else
+	return -1;
+#endif
+}
+
+static int schedule_queue_stats(odp_queue_t queue ODP_UNUSED,
+				odp_schedule_queue_stats_t *stats ODP_UNUSED)
+{
+#if _ODP_SCHED_STATS
+	sched_queue_stats_t *q_stats, *base;
+	uint32_t queue_index;
+
+	if (odp_unlikely(queue == ODP_QUEUE_INVALID ||
+			 qentry_from_handle(queue)->type != ODP_QUEUE_TYPE_SCHED)) {
+		_ODP_ERR("Bad queue handle\n");
+		return -1;
+	}
+
+	queue_index = queue_to_index(queue);
+	_ODP_ASSERT(queue_index < CONFIG_MAX_SCHED_QUEUES);
+	q_stats = &sched->queue_stats[queue_index];
+	base = &sched->queue_stats_base[queue_index];
+
+	stats->num_events = stat_read(&q_stats->events, &base->events);
+
+	for (int i = 0; i < ODP_SCHEDULE_WAIT_HIST_BUCKETS; i++)
+		stats->wait_hist[i] = stat_read(&q_stats->wait_hist[i], &base->wait_hist[i]);
+
+	return 0;
+#else
+	return -1;
+#endif
+}
+
+static void print_stats(void)
+{
+#if _ODP_SCHED_STATS
+	odp_schedule_stats_t stats;
+	uint64_t spread_events[MAX_SPREAD] = {0};
+	int num_spread = sched->config.num_spread;
+	int last = 0;
+
+	(void)schedule_stats(&stats);
+
+	for (int i = 0; i < ODP_THREAD_COUNT_MAX; i++)
+		for (int spr = 0; spr < num_spread; spr++)
+			spread_events[spr] +=
+				stat_read(&sched->thr_stats[i].spread_events[spr],
+					  &sched->thr_stats_base[i].spread_events[spr]);
+
+	_ODP_PRINT("  Statistics:\n");
+	_ODP_PRINT("    rounds:          %" PRIu64 "\n", stats.num_rounds);
+	_ODP_PRINT("    empty rounds:    %" PRIu64 " (%.1f%%)\n", stats.num_empty,
+		   stats.num_rounds ? 100.0 * stats.num_empty / stats.num_rounds : 0.0);
+	_ODP_PRINT("    events:          %" PRIu64 "\n", stats.num_events);
+	_ODP_PRINT("    events per spread:\n");
+
+	for (int spr = 0; spr < num_spread; spr++)
+		_ODP_PRINT("      %i: %" PRIu64 "\n", spr, spread_events[spr]);
+
+	for (int i = 0; i < ODP_SCHEDULE_WAIT_HIST_BUCKETS; i++)
+		if (stats.wait_hist[i])
+			last = i;
+
+	_ODP_PRINT("    wait time histogram (ns):\n");
+
+	for (int i = 0; i <= last; i++) {
+		if (i == ODP_SCHEDULE_WAIT_HIST_BUCKETS - 1)
+			_ODP_PRINT("      >= %-11" PRIu64 " %" PRIu64 "\n", (uint64_t)1 << (i - 1),
+				   stats.wait_hist[i]);
+		else
+			_ODP_PRINT("      < %-12" PRIu64 " %" PRIu64 "\n", (uint64_t)1 << i,
+				   stats.wait_hist[i]);
+	}
+
+	_ODP_PRINT("\n");
+#endif
+}
+
 static void schedule_print(void)
 {
 	int spr, prio, grp, pos;
@@ -2582,6 +2905,8 @@ static void schedule_print(void)
 	}
 
 	_ODP_PRINT("\n");
+
+	print_stats();
 }
 
 /* Returns spread for queue debug prints */
@@ -2655,7 +2980,11 @@ const _odp_schedule_api_fn_t _odp_schedule_basic_api = {
 	.schedule_order_lock_start  = schedule_order_lock_start,
 	.schedule_order_lock_wait   = schedule_order_lock_wait,
 	.schedule_order_wait      = order_lock,
-	.schedule_print           = schedule_print
+	.schedule_print           = schedule_print,
+	.schedule_stats           = schedule_stats,
+	.schedule_thread_stats    = schedule_thread_stats,
+	.schedule_queue_stats     = schedule_queue_stats,
+	.schedule_stats_reset     = schedule_stats_reset
 };
 
 /* API functions used when powersave is enabled in the config file. */
@@ -2693,5 +3022,9 @@ const _odp_schedule_api_fn_t _odp_schedule_basic_sleep_api = {
 	.schedule_order_lock_start  = schedule_order_lock_start,
 	.schedule_order_lock_wait   = schedule_order_lock_wait,
 	.schedule_order_wait      = order_lock,
-	.schedule_print           = schedule_print
+	.schedule_print           = schedule_print,
+	.schedule_stats           = schedule_stats,
+	.schedule_thread_stats    = schedule_thread_stats,
+	.schedule_queue_stats     = schedule_queue_stats,
+	.schedule_stats_reset     = schedule_stats_reset
 };
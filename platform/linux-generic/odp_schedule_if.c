@@ -152,6 +152,26 @@ void odp_schedule_print(void)
 	_odp_sched_api->schedule_print();
 }
 
+int odp_schedule_stats(odp_schedule_stats_t *stats)
+{
+	return _odp_sched_api->schedule_stats(stats);
+}
+
+int odp_schedule_thread_stats(int thr, odp_schedule_stats_t *stats)
+{
+	return _odp_sched_api->schedule_thread_stats(thr, stats);
+}
+
+int odp_schedule_queue_stats(odp_queue_t queue, odp_schedule_queue_stats_t *stats)
+{
+	return _odp_sched_api->schedule_queue_stats(queue, stats);
+}
+
+void odp_schedule_stats_reset(void)
+{
+	_odp_sched_api->schedule_stats_reset();
+}
+
 int _odp_schedule_init_global(void)
 {
 	const char *sched = getenv("ODP_SCHEDULER");
@@ -22,6 +22,7 @@
 #include <ring/odp_ring_mpmc_rst_u32_internal.h>
 #include <odp_timer_internal.h>
 #include <odp_queue_basic_internal.h>
+#include <odp_qsbr_internal.h>
 #include <odp_string_internal.h>
 #include <odp_global_data.h>
 
@@ -790,6 +791,8 @@ static int schedule_multi(odp_queue_t *from, uint64_t wait,
 		sched_local.cmd = NULL;
 	}
 
+	_odp_qsbr_sched_quiescent();
+
 	if (odp_unlikely(sched_local.pause))
 		return 0;
 
@@ -1285,6 +1288,26 @@ static void schedule_print(void)
 	_ODP_PRINT("\n");
 }
 
+static int schedule_stats(odp_schedule_stats_t *stats ODP_UNUSED)
+{
+	return -1;
+}
+
+static int schedule_thread_stats(int thr ODP_UNUSED, odp_schedule_stats_t *stats ODP_UNUSED)
+{
+	return -1;
+}
+
+static int schedule_queue_stats(odp_queue_t queue ODP_UNUSED,
+				odp_schedule_queue_stats_t *stats ODP_UNUSED)
+{
+	return -1;
+}
+
+static void schedule_stats_reset(void)
+{
+}
+
 static void get_config(schedule_config_t *config)
 {
 	*config = sched_global->config_if;
@@ -1351,5 +1374,9 @@ const _odp_schedule_api_fn_t _odp_schedule_sp_api = {
 	.schedule_order_lock_start  = schedule_order_lock_start,
 	.schedule_order_lock_wait   = schedule_order_lock_wait,
 	.schedule_order_wait      = order_lock,
-	.schedule_print           = schedule_print
+	.schedule_print           = schedule_print,
+	.schedule_stats           = schedule_stats,
+	.schedule_thread_stats    = schedule_thread_stats,
+	.schedule_queue_stats     = schedule_queue_stats,
+	.schedule_stats_reset     = schedule_stats_reset
 };
@@ -0,0 +1,57 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#include <odp/api/align.h>
+#include <odp/api/atomic.h>
+#include <odp/api/shared_memory.h>
+
+#include <odp_debug_internal.h>
+#include <odp_global_data.h>
+#include <odp_macros_internal.h>
+#include <odp_stat_shard_internal.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+void *_odp_stat_shards_reserve(const char *name, size_t size, size_t *shard_size,
+			       odp_shm_t *shm)
+{
+	uint32_t shm_flags = 0;
+	size_t ssize = _ODP_ROUNDUP_CACHE_LINE(size);
+	void *base;
+
+	if (odp_global_ro.shm_single_va)
+		shm_flags |= ODP_SHM_SINGLE_VA;
+
+	*shm = odp_shm_reserve(name, CONFIG_STAT_SHARDS * ssize, ODP_CACHE_LINE_SIZE, shm_flags);
+	if (*shm == ODP_SHM_INVALID) {
+		_ODP_ERR("Statistics shard reserve failed: %s\n", name);
+		return NULL;
+	}
+
+	base = odp_shm_addr(*shm);
+	*shard_size = ssize;
+	_odp_stat_shards_reset(base, ssize);
+
+	return base;
+}
+
+void _odp_stat_shards_reset(void *base, size_t shard_size)
+{
+	odp_atomic_u64_t *ctr = base;
+	size_t num = (CONFIG_STAT_SHARDS * shard_size) / sizeof(odp_atomic_u64_t);
+
+	for (size_t i = 0; i < num; i++)
+		odp_atomic_init_u64(&ctr[i], 0);
+}
+
+int _odp_stat_shards_free(odp_shm_t shm)
+{
+	if (odp_shm_free(shm)) {
+		_ODP_ERR("Statistics shard free failed\n");
+		return -1;
+	}
+
+	return 0;
+}
@@ -8,17 +8,22 @@
 #include <malloc.h>
 #include <stdio.h>
 #include <inttypes.h>
+#include <odp/api/time.h>
+
 #include <odp_timer_wheel_internal.h>
 #include <odp_traffic_mngr_internal.h>
 #include <odp_debug_internal.h>
 #include <odp_macros_internal.h>
 
+/* Timer wheel tick length is about TICK_PERIOD_NS nanoseconds. Time values are
+ * in time source units, which are converted to wheel ticks with a shift
+ * (time_to_ticks_shift) selected based on the time source resolution. */
+#define TICK_PERIOD_NS         1024
+
 /* The following constants can be changed either at compile time or run time
  * as long as the following constraints are met (by the way REV stands for
  * REVOLUTION, i.e. one complete sweep through a specific timer wheel):
  */
-#define TIME_TO_TICKS_SHIFT    10
-#define TIME_PER_TICK          BIT(TIME_TO_TICKS_SHIFT)
 #define CURRENT_TIMER_SLOTS    1024
 #define LEVEL1_TIMER_SLOTS     2048
 #define LEVEL2_TIMER_SLOTS     1024
@@ -166,6 +171,7 @@ typedef struct {
 	uint64_t          total_promote_cnt;
 	uint64_t          promote_fail_cnt;
 	uint64_t          current_ticks;
+	uint32_t          time_to_ticks_shift;
 	wheel_desc_t      wheel_descs[4];
 	current_wheel_t  *current_wheel;
 	general_wheel_t  *general_wheels[3];
@@ -777,7 +783,20 @@ static int timer_general_wheel_update(timer_wheels_t *timer_wheels,
 	return ret_code;
 }
 
+static uint32_t time_to_ticks_shift(uint64_t time_res)
+{
+	uint64_t time_per_tick;
+	uint32_t shift = 0;
+
+	time_per_tick = (time_res * TICK_PERIOD_NS) / ODP_TIME_SEC_IN_NS;
+	while ((2ULL << shift) <= time_per_tick)
+		shift++;
+
+	return shift;
+}
+
 _odp_timer_wheel_t _odp_timer_wheel_create(uint32_t max_concurrent_timers,
+					   uint64_t time_res,
 					   void    *tm_system)
 {
 	timer_wheels_t *timer_wheels;
@@ -786,6 +805,8 @@ _odp_timer_wheel_t _odp_timer_wheel_create(uint32_t max_concurrent_timers,
 	timer_wheels  = malloc(sizeof(timer_wheels_t));
 	memset(timer_wheels, 0, sizeof(timer_wheels_t));
 
+	timer_wheels->time_to_ticks_shift = time_to_ticks_shift(time_res);
+
 	timer_wheels->wheel_descs[0].num_slots = CURRENT_TIMER_SLOTS;
 	timer_wheels->wheel_descs[1].num_slots = LEVEL1_TIMER_SLOTS;
 	timer_wheels->wheel_descs[2].num_slots = LEVEL2_TIMER_SLOTS;
@@ -825,7 +846,7 @@ void _odp_timer_wheel_start(_odp_timer_wheel_t timer_wheel,
 	uint64_t        current_ticks;
 
 	timer_wheels  = (timer_wheels_t *)(uintptr_t)timer_wheel;
-	current_ticks = current_time >> TIME_TO_TICKS_SHIFT;
+	current_ticks = current_time >> timer_wheels->time_to_ticks_shift;
 	timer_wheels->current_ticks = current_ticks;
 
 	current_wheel_start(timer_wheels, 0, current_ticks);
@@ -843,7 +864,7 @@ uint32_t _odp_timer_wheel_curr_time_update(_odp_timer_wheel_t timer_wheel,
 	int             rc;
 
 	timer_wheels      = (timer_wheels_t *)(uintptr_t)timer_wheel;
-	new_current_ticks = current_time >> TIME_TO_TICKS_SHIFT;
+	new_current_ticks = current_time >> timer_wheels->time_to_ticks_shift;
 	elapsed_ticks     = new_current_ticks - timer_wheels->current_ticks;
 	if (elapsed_ticks == 0)
 		return 0;
@@ -876,7 +897,7 @@ int _odp_timer_wheel_insert(_odp_timer_wheel_t timer_wheel,
 		return -5;  /* user_context must be at least 4-byte aligned. */
 
 	timer_wheels = (timer_wheels_t *)(uintptr_t)timer_wheel;
-	wakeup_ticks = (wakeup_time >> TIME_TO_TICKS_SHIFT) + 1;
+	wakeup_ticks = (wakeup_time >> timer_wheels->time_to_ticks_shift) + 1;
 	if (wakeup_time <= timer_wheels->current_ticks)
 		return -6;
 
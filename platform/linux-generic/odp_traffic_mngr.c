@@ -8,12 +8,14 @@
 #include <odp_posix_extensions.h>
 
 #include <odp/api/cpu.h>
+#include <odp/api/hash.h>
 #include <odp/api/packet.h>
 #include <odp/api/packet_flags.h>
 #include <odp/api/std_types.h>
 #include <odp/api/time.h>
 
 #include <odp/api/plat/byteorder_inlines.h>
+#include <odp/api/plat/hash_inlines.h>
 #include <odp/api/plat/packet_inlines.h>
 #include <odp/api/plat/time_inlines.h>
 
@@ -57,6 +59,22 @@ static const pkt_desc_t EMPTY_PKT_DESC = { .word = 0 };
 #define TM_MIN_SHAPER_BW  8000ULL
 #define TM_MAX_SHAPER_BW  (100ULL * 1000ULL * 1000ULL * 1000ULL)
 
+/* Shaper rates are stored in bytes per time source tick using a fixed point
+ * format with TM_RATE_FRAC_BITS fractional bits. Token counters use 26
+ * fractional bits. */
+#define TM_RATE_FRAC_BITS   32
+#define TM_RATE_TO_TKN_SHIFT (TM_RATE_FRAC_BITS - 26)
+
+/* Minimum delay of a shaper timer */
+#define TM_MIN_DELAY_NS  256
+
+/* Flow queuing mode defaults */
+#define TM_FQ_DEFAULT_NUM_FLOWS   1024
+#define TM_FQ_DEFAULT_MAX_PKTS    1024
+#define TM_FQ_DEFAULT_QUANTUM     1514
+#define TM_FQ_DEFAULT_TARGET_NS   (5 * ODP_TIME_MSEC_IN_NS)
+#define TM_FQ_DEFAULT_INTERVAL_NS (100 * ODP_TIME_MSEC_IN_NS)
+
 /* Possible values for running the shaper algorithm. TM_SHAPER_GREEN means that
  * the traffic is within the commit specification (rate and burst size),
  * TM_SHAPER_YELLOW means that the traffic is within the peak specification
@@ -588,35 +606,57 @@ static void *tm_get_profile_params(tm_handle_t profile_handle,
 	}
 }
 
+/* TM internal time is the raw time source value (in ticks), which avoids
+ * nanosecond conversions in the TM thread fast path. */
+static inline uint64_t tm_time_cur(void)
+{
+	return odp_time_local().u64;
+}
+
 static uint64_t tm_bps_to_rate(uint64_t bps)
 {
-	/* This code assumes that bps is in the range 1 kbps .. 1 tbps. */
-	if ((bps >> 32) == 0)
-		return (bps << 23) / ODP_TIME_SEC_IN_NS;
+	uint64_t time_res = odp_time_local_res();
+
+	/* Bytes per tick is bps / 8 / time_res. This code assumes that bps is
+	 * in the range 1 kbps .. 1 tbps. */
+	if ((bps >> 34) == 0)
+		return (bps << (TM_RATE_FRAC_BITS - 3)) / time_res;
 	else
-		return ((bps << 15) / ODP_TIME_SEC_IN_NS) << 8;
+		return ((bps << (TM_RATE_FRAC_BITS - 11)) / time_res) << 8;
 }
 
 static uint64_t tm_rate_to_bps(uint64_t rate)
 {
-	/* This code assumes that bps is in the range 1 kbps .. 1 tbps. */
-	return (rate * ODP_TIME_SEC_IN_NS) >> 23;
+	uint64_t time_res = odp_time_local_res();
+	const uint32_t shift = TM_RATE_FRAC_BITS - 3;
+
+	/* Split the multiplication to avoid overflow */
+	return (rate >> shift) * time_res +
+	       (((rate & ((1ULL << shift) - 1)) * time_res) >> shift);
 }
 
 static uint64_t tm_max_time_delta(uint64_t rate)
 {
+	/* Time delta, which fills 2^30 bytes into the token bucket */
 	if (rate == 0)
 		return 0;
 	else
-		return (1ULL << (26 + 30)) / rate;
+		return (1ULL << (26 + 30 + TM_RATE_TO_TKN_SHIFT)) / rate;
+}
+
+static uint64_t tm_min_time_delta(uint64_t rate)
+{
+	/* Time delta, which fills at least a byte into the token bucket, but
+	 * not less than the minimum timer delay */
+	return _ODP_MAX((1ULL << TM_RATE_FRAC_BITS) / rate,
+			odp_time_local_from_ns(TM_MIN_DELAY_NS).u64);
 }
 
 static void tm_shaper_params_cvt_to(const odp_tm_shaper_params_t *shaper_params,
 				    tm_shaper_params_t *tm_shaper_params)
 {
 	uint64_t commit_rate, peak_rate, max_commit_time_delta, highest_rate;
-	uint64_t max_peak_time_delta;
-	uint32_t min_time_delta;
+	uint64_t max_peak_time_delta, min_time_delta;
 	int64_t  commit_burst, peak_burst;
 
 	commit_rate = tm_bps_to_rate(shaper_params->commit_rate);
@@ -642,12 +682,12 @@ static void tm_shaper_params_cvt_to(const odp_tm_shaper_params_t *shaper_params,
 		peak_rate = 0;
 		max_peak_time_delta = 0;
 		peak_burst = 0;
-		min_time_delta = (uint32_t)((1 << 26) / commit_rate);
+		min_time_delta = tm_min_time_delta(commit_rate);
 	} else {
 		max_peak_time_delta = tm_max_time_delta(peak_rate);
 		peak_burst = (int64_t)shaper_params->peak_burst;
 		highest_rate = _ODP_MAX(commit_rate, peak_rate);
-		min_time_delta = (uint32_t)((1 << 26) / highest_rate);
+		min_time_delta = tm_min_time_delta(highest_rate);
 	}
 
 	tm_shaper_params->max_commit_time_delta = max_commit_time_delta;
@@ -814,11 +854,10 @@ static void update_shaper_elapsed_time(tm_system_t        *tm_system,
 
        /* If the time_delta is "too small" then we just exit without making
 	* any changes.  Too small is defined such that
-	* time_delta/ODP_TIME_SEC_IN_NS * MAX(commit_rate, peak_rate) is less
-	* than a byte.
+	* time_delta * MAX(commit_rate, peak_rate) is less than a byte.
 	*/
 	time_delta = tm_system->current_time - shaper_obj->last_update_time;
-	if (time_delta < (uint64_t)shaper_params->min_time_delta)
+	if (time_delta < shaper_params->min_time_delta)
 		return;
 
 	commit = shaper_obj->commit_cnt;
@@ -831,7 +870,8 @@ static void update_shaper_elapsed_time(tm_system_t        *tm_system,
 	if (shaper_params->max_commit_time_delta <= time_delta)
 		commit_inc = max_commit;
 	else
-		commit_inc = time_delta * shaper_params->commit_rate;
+		commit_inc = (time_delta * shaper_params->commit_rate) >>
+			     TM_RATE_TO_TKN_SHIFT;
 
 	shaper_obj->commit_cnt = (int64_t)_ODP_MIN(max_commit, commit + commit_inc);
 
@@ -841,7 +881,8 @@ static void update_shaper_elapsed_time(tm_system_t        *tm_system,
 		if (shaper_params->max_peak_time_delta <= time_delta)
 			peak_inc = max_peak;
 		else
-			peak_inc = time_delta * shaper_params->peak_rate;
+			peak_inc = (time_delta * shaper_params->peak_rate) >>
+				   TM_RATE_TO_TKN_SHIFT;
 
 		shaper_obj->peak_cnt = (int64_t)_ODP_MIN(max_peak, peak + peak_inc);
 	}
@@ -849,6 +890,12 @@ static void update_shaper_elapsed_time(tm_system_t        *tm_system,
 	shaper_obj->last_update_time = tm_system->current_time;
 }
 
+static inline uint64_t tkn_to_time(int64_t tkn_cnt, uint64_t rate)
+{
+	/* Round up, so that the token count is not negative after the delay */
+	return ((((uint64_t)tkn_cnt) << TM_RATE_TO_TKN_SHIFT) + rate - 1) / rate;
+}
+
 static uint64_t time_till_not_red(tm_shaper_params_t *shaper_params,
 				  tm_shaper_obj_t *shaper_obj)
 {
@@ -860,17 +907,18 @@ static uint64_t time_till_not_red(tm_shaper_params_t *shaper_params,
 	*/
 	commit_delay = 0;
 	if (shaper_obj->commit_cnt < 0)
-		commit_delay = (-shaper_obj->commit_cnt)
-			/ shaper_params->commit_rate;
+		commit_delay = tkn_to_time(-shaper_obj->commit_cnt,
+					   shaper_params->commit_rate);
 
-	min_time_delay =  _ODP_MAX(shaper_obj->shaper_params->min_time_delta, UINT64_C(256));
+	min_time_delay = shaper_obj->shaper_params->min_time_delta;
 	commit_delay = _ODP_MAX(commit_delay, min_time_delay);
 	if (!shaper_params->dual_rate)
 		return commit_delay;
 
 	peak_delay = 0;
 	if (shaper_obj->peak_cnt < 0)
-		peak_delay = (-shaper_obj->peak_cnt) / shaper_params->peak_rate;
+		peak_delay = tkn_to_time(-shaper_obj->peak_cnt,
+					 shaper_params->peak_rate);
 
 	peak_delay = _ODP_MAX(peak_delay, min_time_delay);
 	if (0 < shaper_obj->commit_cnt)
@@ -1740,13 +1788,117 @@ static odp_bool_t tm_consume_pkt_desc(tm_system_t     *tm_system,
 	return ret_code;
 }
 
+/* Flow hash used to select a flow queuing sub-flow. Packets without a flow
+ * hash are hashed from their IP addresses and TCP/UDP ports. */
+static uint32_t tm_fq_flow_hash(odp_packet_t pkt)
+{
+	odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt);
+	uint8_t *l3, *l4;
+	uint32_t hash = 0;
+
+	if (odp_packet_has_flow_hash(pkt))
+		return odp_packet_flow_hash(pkt);
+
+	l3 = odp_packet_l3_ptr(pkt, NULL);
+	if (l3 == NULL)
+		return 0;
+
+	if (pkt_hdr->p.input_flags.ipv4) {
+		_odp_ipv4hdr_t *ipv4 = (_odp_ipv4hdr_t *)(uintptr_t)l3;
+
+		hash = odp_hash_crc32c(&ipv4->src_addr, 2 * sizeof(ipv4->src_addr), 0);
+	} else if (pkt_hdr->p.input_flags.ipv6) {
+		_odp_ipv6hdr_t *ipv6 = (_odp_ipv6hdr_t *)(uintptr_t)l3;
+
+		hash = odp_hash_crc32c(&ipv6->src_addr, 2 * sizeof(ipv6->src_addr), 0);
+	} else {
+		return 0;
+	}
+
+	if (pkt_hdr->p.input_flags.tcp || pkt_hdr->p.input_flags.udp) {
+		l4 = odp_packet_l4_ptr(pkt, NULL);
+
+		/* Source and destination ports are the first four bytes of both
+		 * TCP and UDP headers. */
+		if (l4 != NULL)
+			hash = odp_hash_crc32c(l4, 2 * sizeof(uint16_t), hash);
+	}
+
+	return hash;
+}
+
+/* Release a packet that was dropped from a tm_queue. */
+static void tm_queue_drop_pkt(tm_system_t *tm_system, tm_queue_obj_t *tm_queue_obj,
+			      odp_packet_t pkt)
+{
+	tm_queue_cnts_decrement(tm_system, &tm_queue_obj->tm_wred_node,
+				tm_queue_obj->priority, odp_packet_len(pkt));
+	odp_atomic_inc_u64(&tm_queue_obj->stats.discards);
+	odp_packet_free(pkt);
+}
+
+/* Add a pkt behind the current head pkt of the tm_queue. Returns 0 when the pkt was
+ * queued and <0 when it was dropped. A full flow queue drops an older pkt instead. */
+static int tm_queue_pkt_append(tm_system_t *tm_system,
+			       tm_queue_obj_t *tm_queue_obj,
+			       odp_packet_t pkt)
+{
+	odp_packet_t drop_pkt;
+	int rc;
+
+	if (tm_queue_obj->fq_codel == _ODP_INT_FQ_CODEL_INVALID) {
+		rc = _odp_pkt_queue_append(tm_system->_odp_int_queue_pool,
+					   tm_queue_obj->_odp_int_pkt_queue, pkt);
+		if (odp_unlikely(rc < 0)) {
+			tm_queue_drop_pkt(tm_system, tm_queue_obj, pkt);
+			return -1;
+		}
+
+		return 0;
+	}
+
+	rc = _odp_fq_codel_enqueue(tm_queue_obj->fq_codel, pkt,
+				   tm_fq_flow_hash(pkt),
+				   tm_system->current_time, &drop_pkt);
+	if (odp_unlikely(rc < 0))
+		return -1;
+
+	if (odp_unlikely(rc > 0))
+		tm_queue_drop_pkt(tm_system, tm_queue_obj, drop_pkt);
+
+	return 0;
+}
+
+/* Get the next pkt of the tm_queue. Returns 1 when a pkt was removed, 0 when
+ * the tm_queue is empty and <0 on failure. */
+static int tm_queue_pkt_remove(tm_system_t *tm_system,
+			       tm_queue_obj_t *tm_queue_obj,
+			       odp_packet_t *pkt)
+{
+	odp_packet_t drop_pkts[_ODP_INT_FQ_CODEL_MAX_DROPS];
+	uint32_t num_drops, i;
+	int rc;
+
+	if (tm_queue_obj->fq_codel == _ODP_INT_FQ_CODEL_INVALID)
+		return _odp_pkt_queue_remove(tm_system->_odp_int_queue_pool,
+					     tm_queue_obj->_odp_int_pkt_queue, pkt);
+
+	rc = _odp_fq_codel_dequeue(tm_queue_obj->fq_codel,
+				   tm_system->current_time, pkt, drop_pkts,
+				   &num_drops);
+
+	for (i = 0; i < num_drops; i++)
+		tm_queue_drop_pkt(tm_system, tm_queue_obj, drop_pkts[i]);
+
+	return rc;
+}
+
 /* The consume_sent_pkt function returns true iff there is a new pkt at the
  * egress (i.e tm_system->egress_pkt_desc was set). */
 
 static odp_bool_t tm_consume_sent_pkt(tm_system_t *tm_system,
 				      pkt_desc_t *sent_pkt_desc)
 {
-	_odp_int_pkt_queue_t _odp_int_pkt_queue;
 	tm_queue_obj_t *tm_queue_obj;
 	odp_packet_t pkt;
 	pkt_desc_t *new_pkt_desc;
@@ -1763,9 +1915,7 @@ static odp_bool_t tm_consume_sent_pkt(tm_system_t *tm_system,
 				tm_queue_obj->priority, pkt_len);
 
 	/* Get the next pkt in the tm_queue, if there is one. */
-	_odp_int_pkt_queue = tm_queue_obj->_odp_int_pkt_queue;
-	rc = _odp_pkt_queue_remove(tm_system->_odp_int_queue_pool,
-				   _odp_int_pkt_queue, &pkt);
+	rc = tm_queue_pkt_remove(tm_system, tm_queue_obj, &pkt);
 	if (rc < 0)
 		return false;
 
@@ -2344,10 +2494,9 @@ static int tm_process_input_work_queue(tm_system_t *tm_system,
 		if (tm_queue_obj->pkt != ODP_PACKET_INVALID) {
 			/* If the tm_queue_obj already has a pkt to work with,
 			 * then just add this new pkt to the associated
-			 * _odp_int_pkt_queue. */
-			(void)_odp_pkt_queue_append(tm_system->_odp_int_queue_pool,
-						    tm_queue_obj->_odp_int_pkt_queue, pkt);
-			tm_queue_obj->pkts_enqueued_cnt++;
+			 * _odp_int_pkt_queue (or flow queue). */
+			if (tm_queue_pkt_append(tm_system, tm_queue_obj, pkt) == 0)
+				tm_queue_obj->pkts_enqueued_cnt++;
 		} else {
 			/* If the tm_queue_obj doesn't have a pkt to work
 			 * with, then make this one the head pkt. */
@@ -2484,7 +2633,7 @@ static void *tm_system_thread(void *arg)
 	input_work_queue_t *input_work_queue;
 	tm_system_group_t  *tm_group;
 	tm_system_t *tm_system;
-	uint64_t current_ns;
+	uint64_t current_time;
 	uint32_t destroying, work_queue_cnt, timer_cnt;
 	int rc;
 
@@ -2503,32 +2652,32 @@ static void *tm_system_thread(void *arg)
 
 	destroying = odp_atomic_load_acq_u64(&tm_system->destroying);
 
-	current_ns = odp_time_to_ns(odp_time_local());
-	_odp_timer_wheel_start(_odp_int_timer_wheel, current_ns);
+	current_time = tm_time_cur();
+	_odp_timer_wheel_start(_odp_int_timer_wheel, current_time);
 
 	while (destroying == 0) {
 		/* See if another thread wants to make a configuration
 		 * change. */
 		check_for_request();
 
-		current_ns = odp_time_to_ns(odp_time_local());
-		tm_system->current_time = current_ns;
+		current_time = tm_time_cur();
+		tm_system->current_time = current_time;
 		rc = _odp_timer_wheel_curr_time_update(_odp_int_timer_wheel,
-						       current_ns);
+						       current_time);
 		if (0 < rc) {
 			/* Process a batch of expired timers - each of which
 			 * could cause a pkt to egress the tm system. */
 			timer_cnt = 1;
 			(void)tm_process_expired_timers(tm_system,
 							_odp_int_timer_wheel,
-							current_ns);
+							current_time);
 		} else {
 			timer_cnt =
 				_odp_timer_wheel_count(_odp_int_timer_wheel);
 		}
 
-		current_ns = odp_time_to_ns(odp_time_local());
-		tm_system->current_time = current_ns;
+		current_time = tm_time_cur();
+		tm_system->current_time = current_time;
 		work_queue_cnt =
 			odp_atomic_load_u64(&input_work_queue->queue_cnt);
 
@@ -2540,8 +2689,8 @@ static void *tm_system_thread(void *arg)
 		if (tm_system->egress_pkt_desc.queue_num != 0)
 			tm_send_pkt(tm_system, 1);
 
-		current_ns = odp_time_to_ns(odp_time_local());
-		tm_system->current_time = current_ns;
+		current_time = tm_time_cur();
+		tm_system->current_time = current_time;
 		odp_atomic_store_rel_u32(&tm_system->is_idle,
 					 (timer_cnt == 0) && (work_queue_cnt == 0));
 		destroying = odp_atomic_load_acq_u64(&tm_system->destroying);
@@ -2659,6 +2808,10 @@ static int tm_capabilities(odp_tm_capabilities_t capabilities[],
 	cap_ptr->packet_ref.referencing_pkt = 1;
 	cap_ptr->packet_ref.referenced_pkt = 1;
 
+	cap_ptr->tm_queue_fq.supported = true;
+	cap_ptr->tm_queue_fq.max_flows = _ODP_INT_FQ_CODEL_MAX_FLOWS;
+	cap_ptr->tm_queue_fq.max_pkts  = _ODP_INT_FQ_CODEL_MAX_PKTS;
+
 	return 1;
 }
 
@@ -2784,6 +2937,12 @@ static void tm_system_capabilities_set(odp_tm_capabilities_t *cap_ptr,
 	cap_ptr->queue_stats.counter.discards = 1;
 	cap_ptr->queue_stats.counter.errors = 1;
 	cap_ptr->queue_stats.counter.packets = 1;
+
+	if (req_ptr->tm_queue_fq_needed) {
+		cap_ptr->tm_queue_fq.supported = true;
+		cap_ptr->tm_queue_fq.max_flows = _ODP_INT_FQ_CODEL_MAX_FLOWS;
+		cap_ptr->tm_queue_fq.max_pkts  = _ODP_INT_FQ_CODEL_MAX_PKTS;
+	}
 }
 
 static int affinitize_main_thread(void)
@@ -3131,7 +3290,9 @@ odp_tm_t odp_tm_create(const char            *name,
 	}
 
 	if (create_fail == 0) {
-		tm_system->_odp_int_timer_wheel = _odp_timer_wheel_create(max_timers, tm_system);
+		tm_system->_odp_int_timer_wheel = _odp_timer_wheel_create(max_timers,
+									  odp_time_local_res(),
+									  tm_system);
 		create_fail |= tm_system->_odp_int_timer_wheel
 			== _ODP_INT_TIMER_WHEEL_INVALID;
 	}
@@ -4096,12 +4257,18 @@ void odp_tm_queue_params_init(odp_tm_queue_params_t *params)
 	memset(params, 0, sizeof(odp_tm_queue_params_t));
 
 	params->ordered_enqueue = true;
+	params->fq.num_flows = TM_FQ_DEFAULT_NUM_FLOWS;
+	params->fq.max_pkts = TM_FQ_DEFAULT_MAX_PKTS;
+	params->fq.quantum = TM_FQ_DEFAULT_QUANTUM;
+	params->fq.target_ns = TM_FQ_DEFAULT_TARGET_NS;
+	params->fq.interval_ns = TM_FQ_DEFAULT_INTERVAL_NS;
 }
 
 odp_tm_queue_t odp_tm_queue_create(odp_tm_t odp_tm,
 				   const odp_tm_queue_params_t *params)
 {
 	_odp_int_pkt_queue_t _odp_int_pkt_queue;
+	_odp_int_fq_codel_t fq_codel = _ODP_INT_FQ_CODEL_INVALID;
 	tm_queue_obj_t *queue_obj;
 	odp_tm_queue_t odp_tm_queue = ODP_TM_INVALID;
 	odp_tm_wred_t wred_profile;
@@ -4112,6 +4279,21 @@ odp_tm_queue_t odp_tm_queue_create(odp_tm_t odp_tm,
 	/* Allocate a tm_queue_obj_t record. */
 	tm_system = GET_TM_SYSTEM(odp_tm);
 
+	if (params->fq.enable) {
+		if (!tm_system->capabilities.tm_queue_fq.supported) {
+			_ODP_ERR("TM queue flow queuing not enabled in requirements\n");
+			return ODP_TM_INVALID;
+		}
+
+		fq_codel = _odp_fq_codel_create(params->fq.num_flows,
+						params->fq.max_pkts,
+						params->fq.quantum,
+						odp_time_local_from_ns(params->fq.target_ns).u64,
+						odp_time_local_from_ns(params->fq.interval_ns).u64);
+		if (fq_codel == _ODP_INT_FQ_CODEL_INVALID)
+			return ODP_TM_INVALID;
+	}
+
 	odp_ticketlock_lock(&tm_glb->queue_obj.lock);
 
 	for (i = 0; i < ODP_TM_MAX_TM_QUEUES; i++) {
@@ -4135,6 +4317,7 @@ odp_tm_queue_t odp_tm_queue_create(odp_tm_t odp_tm,
 		queue_obj->tm_idx = tm_system->tm_idx;
 		queue_obj->queue_num = (uint32_t)_odp_int_pkt_queue;
 		queue_obj->_odp_int_pkt_queue = _odp_int_pkt_queue;
+		queue_obj->fq_codel = fq_codel;
 		queue_obj->pkt = ODP_PACKET_INVALID;
 		odp_ticketlock_init(&queue_obj->tm_wred_node.tm_wred_node_lock);
 		odp_atomic_init_u64(&queue_obj->stats.discards, 0);
@@ -4172,6 +4355,9 @@ odp_tm_queue_t odp_tm_queue_create(odp_tm_t odp_tm,
 
 	odp_ticketlock_unlock(&tm_glb->queue_obj.lock);
 
+	if (odp_tm_queue == ODP_TM_INVALID && fq_codel != _ODP_INT_FQ_CODEL_INVALID)
+		_odp_fq_codel_destroy(fq_codel);
+
 	return odp_tm_queue;
 }
 
@@ -4204,6 +4390,10 @@ int odp_tm_queue_destroy(odp_tm_queue_t tm_queue)
 	odp_ticketlock_lock(&tm_glb->queue_obj.lock);
 	_odp_pkt_queue_destroy(tm_system->_odp_int_queue_pool,
 			       tm_queue_obj->_odp_int_pkt_queue);
+	if (tm_queue_obj->fq_codel != _ODP_INT_FQ_CODEL_INVALID) {
+		_odp_fq_codel_destroy(tm_queue_obj->fq_codel);
+		tm_queue_obj->fq_codel = _ODP_INT_FQ_CODEL_INVALID;
+	}
 	tm_queue_obj->status = TM_STATUS_FREE;
 	odp_ticketlock_unlock(&tm_glb->queue_obj.lock);
 
@@ -4649,8 +4839,9 @@ int odp_tm_enq_multi_lso(odp_tm_queue_t tm_queue, const odp_packet_t packets[],
 		/* Create packets */
 		odp_packet_t pkt_out[num_pkt];
 
+		/* TM would unshare references, so copy payload directly */
 		ret = _odp_lso_create_packets(pkt, opt_ptr, payload_len, left_over_len, pkt_out,
-					      num_pkt);
+					      num_pkt, 0);
 
 		if (odp_unlikely(ret))
 			goto error;
@@ -5003,6 +5194,9 @@ void odp_tm_stats_print(odp_tm_t odp_tm)
 				   tm_queue_obj->pkts_enqueued_cnt,
 				   tm_queue_obj->pkts_dequeued_cnt,
 				   tm_queue_obj->pkts_consumed_cnt);
+
+		if (tm_queue_obj && tm_queue_obj->fq_codel != _ODP_INT_FQ_CODEL_INVALID)
+			_odp_fq_codel_stats_print(tm_queue_obj->fq_codel);
 	}
 }
 
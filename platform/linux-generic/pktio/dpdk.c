@@ -655,11 +655,22 @@ static inline int mbuf_to_pkt(pktio_entry_t *pktio_entry,
 	/* Allocate maximum sized packets */
 	max_len = pkt_dpdk->data_room;
 
-	num = _odp_packet_alloc_multi(pool, max_len + frame_offset,
-				      pkt_table, mbuf_num);
+	if (odp_unlikely(_odp_pool_entry(pool)->num_class)) {
+		/* Allocate packets from the best fitting packet length classes */
+		for (num = 0; num < mbuf_num; num++) {
+			pkt_len = rte_pktmbuf_pkt_len(mbuf_table[num]);
+
+			if (_odp_packet_alloc_multi(pool, pkt_len + frame_offset,
+						    &pkt_table[num], 1) != 1)
+				break;
+		}
+	} else {
+		num = _odp_packet_alloc_multi(pool, max_len + frame_offset,
+					      pkt_table, mbuf_num);
+	}
 	if (num != mbuf_num) {
 		rte_pktmbuf_free_bulk(&mbuf_table[num], mbuf_num - num);
-		odp_atomic_add_u64(&pktio_entry->stats_extra.in_discards, mbuf_num - num);
+		_ODP_STAT_ADD(pktio_entry->stats_extra, in_discards, mbuf_num - num);
 	}
 
 	for (i = 0; i < num; i++) {
@@ -683,7 +694,7 @@ static inline int mbuf_to_pkt(pktio_entry_t *pktio_entry,
 			ret = _odp_dpdk_packet_parse_common(pkt_hdr, data, pkt_len, pkt_len,
 							    mbuf, layer, pktin_cfg);
 			if (ret)
-				odp_atomic_inc_u64(&pktio_entry->stats_extra.in_errors);
+				_ODP_STAT_INC(pktio_entry->stats_extra, in_errors);
 
 			if (ret < 0) {
 				odp_packet_free(pkt);
@@ -697,7 +708,7 @@ static inline int mbuf_to_pkt(pktio_entry_t *pktio_entry,
 				ret = _odp_cls_classify_packet(pktio_entry, (const uint8_t *)data,
 							       &new_pool, pkt_hdr);
 				if (ret < 0)
-					odp_atomic_inc_u64(&pktio_entry->stats_extra.in_discards);
+					_ODP_STAT_INC(pktio_entry->stats_extra, in_discards);
 
 				if (ret) {
 					odp_packet_free(pkt);
@@ -709,13 +720,13 @@ static inline int mbuf_to_pkt(pktio_entry_t *pktio_entry,
 					    &pkt, &pkt_hdr, new_pool))) {
 					odp_packet_free(pkt);
 					rte_pktmbuf_free(mbuf);
-					odp_atomic_inc_u64(&pktio_entry->stats_extra.in_discards);
+					_ODP_STAT_INC(pktio_entry->stats_extra, in_discards);
 					continue;
 				}
 			}
 		}
 
-		pull_tail(pkt_hdr, max_len - pkt_len);
+		pull_tail(pkt_hdr, pkt_hdr->frame_len - frame_offset - pkt_len);
 		if (frame_offset)
 			pull_head(pkt_hdr, frame_offset);
 
@@ -749,7 +760,7 @@ static inline int mbuf_to_pkt(pktio_entry_t *pktio_entry,
 fail:
 	odp_packet_free_multi(&pkt_table[i], num - i);
 	rte_pktmbuf_free_bulk(&mbuf_table[i], num - i);
-	odp_atomic_add_u64(&pktio_entry->stats_extra.in_discards, num - i);
+	_ODP_STAT_ADD(pktio_entry->stats_extra, in_discards, num - i);
 
 	return (i > 0 ? i : -1);
 }
@@ -850,7 +861,7 @@ static inline int mbuf_to_pkt_zero(pktio_entry_t *pktio_entry,
 		if (odp_unlikely(mbuf->nb_segs != 1)) {
 			_ODP_ERR("Segmented buffers not supported\n");
 			rte_pktmbuf_free(mbuf);
-			odp_atomic_inc_u64(&pktio_entry->stats_extra.in_discards);
+			_ODP_STAT_INC(pktio_entry->stats_extra, in_discards);
 			continue;
 		}
 
@@ -873,7 +884,7 @@ static inline int mbuf_to_pkt_zero(pktio_entry_t *pktio_entry,
 		ret = _odp_dpdk_packet_parse_common(pkt_hdr, data, pkt_len, pkt_len,
 						    mbuf, layer, pktin_cfg);
 		if (ret)
-			odp_atomic_inc_u64(&pktio_entry->stats_extra.in_errors);
+			_ODP_STAT_INC(pktio_entry->stats_extra, in_errors);
 
 		if (ret < 0) {
 			rte_pktmbuf_free(mbuf);
@@ -886,7 +897,7 @@ static inline int mbuf_to_pkt_zero(pktio_entry_t *pktio_entry,
 			ret = _odp_cls_classify_packet(pktio_entry, (const uint8_t *)data,
 						       &new_pool, pkt_hdr);
 			if (ret < 0)
-				odp_atomic_inc_u64(&pktio_entry->stats_extra.in_discards);
+				_ODP_STAT_INC(pktio_entry->stats_extra, in_discards);
 
 			if (ret) {
 				rte_pktmbuf_free(mbuf);
@@ -895,7 +906,7 @@ static inline int mbuf_to_pkt_zero(pktio_entry_t *pktio_entry,
 
 			if (odp_unlikely(_odp_pktio_packet_to_pool(&pkt, &pkt_hdr, new_pool))) {
 				rte_pktmbuf_free(mbuf);
-				odp_atomic_inc_u64(&pktio_entry->stats_extra.in_discards);
+				_ODP_STAT_INC(pktio_entry->stats_extra, in_discards);
 				continue;
 			}
 
@@ -945,7 +956,7 @@ static inline int mbuf_to_pkt_zero_minimal(pktio_entry_t *pktio_entry,
 		if (odp_unlikely(mbuf->nb_segs != 1)) {
 			_ODP_ERR("Segmented buffers not supported\n");
 			rte_pktmbuf_free(mbuf);
-			odp_atomic_inc_u64(&pktio_entry->stats_extra.in_discards);
+			_ODP_STAT_INC(pktio_entry->stats_extra, in_discards);
 			continue;
 		}
 
@@ -1676,6 +1687,10 @@ static int dpdk_open(odp_pktio_t id ODP_UNUSED,
 
 	data_room = rte_pktmbuf_data_room_size(pkt_dpdk->pkt_pool) -
 			RTE_PKTMBUF_HEADROOM;
+	/* The largest packet length class limits data room of pools with subparameters */
+	if (pool_entry->num_class)
+		pool_entry = pool_entry->class_pool[pool_entry->num_class - 1];
+
 	pkt_dpdk->data_room = RTE_MIN(pool_entry->seg_len, data_room);
 
 	/* Reserve room for packet input offset */
@@ -531,6 +531,12 @@ static int ipc_pktio_open(odp_pktio_t id ODP_UNUSED,
 	if (strncmp(dev, "ipc", 3))
 		return -1;
 
+	/* Packets are shared as offsets into a single pool memory area */
+	if (_odp_pool_entry(pool)->num_class) {
+		_ODP_ERR("Pools with subparameters not supported\n");
+		return -1;
+	}
+
 	odp_atomic_init_u32(&pktio_ipc->ready, 0);
 
 	/* Shared info about remote pktio */
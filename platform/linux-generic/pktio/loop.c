@@ -26,6 +26,7 @@
 #include <odp_packet_io_internal.h>
 #include <odp_macros_internal.h>
 #include <odp_queue_if.h>
+#include <odp_stat_shard_internal.h>
 
 #include <protocols/eth.h>
 #include <protocols/ip.h>
@@ -57,8 +58,6 @@ typedef struct {
 typedef struct ODP_ALIGNED_CACHE {
 	/* queue handle as the "wire" */
 	odp_queue_t queue;
-	/* queue specific statistics */
-	stats_t stats;
 	/* config input queue size */
 	uint32_t in_size;
 	/* config output queue size */
@@ -68,6 +67,11 @@ typedef struct ODP_ALIGNED_CACHE {
 typedef struct {
 	/* loopback entries for "loop" device */
 	loop_queue_t loopqs[MAX_QUEUES];
+	/* queue specific statistics, sharded per thread. A shard is an array of MAX_QUEUES
+	 * stats_t structs. */
+	stats_t *stats;
+	size_t stats_shard_size;
+	odp_shm_t stats_shm;
 	/* hash config */
 	odp_pktin_hash_proto_t hash;
 	/* config queue count */
@@ -92,6 +96,18 @@ static inline pkt_loop_t *pkt_priv(pktio_entry_t *pktio_entry)
 	return (pkt_loop_t *)(uintptr_t)(pktio_entry->pkt_priv);
 }
 
+/* Calling thread's statistics of a queue */
+static inline stats_t *queue_stats(pkt_loop_t *pkt_loop, int index)
+{
+	stats_t *shard = _odp_stat_shard(pkt_loop->stats, pkt_loop->stats_shard_size);
+
+	return &shard[index];
+}
+
+/* Sum of a queue statistics counter over all shards */
+#define QUEUE_STATS_SUM(pkt_loop, index, field) \
+	_odp_stat_sum(&(pkt_loop)->stats[index].field, (pkt_loop)->stats_shard_size)
+
 /* MAC address for the "loop" interface */
 static const uint8_t pktio_loop_mac[] = {0x02, 0xe9, 0x34, 0x80, 0x73, 0x01};
 
@@ -101,6 +117,7 @@ static int loopback_open(odp_pktio_t id ODP_UNUSED, pktio_entry_t *pktio_entry,
 			 const char *devname, odp_pool_t pool)
 {
 	pkt_loop_t *pkt_loop = pkt_priv(pktio_entry);
+	char name[ODP_SHM_NAME_LEN];
 	long idx;
 
 	if (!strcmp(devname, "loop")) {
@@ -127,14 +144,13 @@ static int loopback_open(odp_pktio_t id ODP_UNUSED, pktio_entry_t *pktio_entry,
 	pkt_loop->queue_create = 1;
 	loopback_init_capability(pktio_entry);
 
-	for (uint32_t i = 0; i < MAX_QUEUES; i++) {
-		odp_atomic_init_u64(&pkt_loop->loopqs[i].stats.in_octets, 0);
-		odp_atomic_init_u64(&pkt_loop->loopqs[i].stats.in_packets, 0);
-		odp_atomic_init_u64(&pkt_loop->loopqs[i].stats.in_discards, 0);
-		odp_atomic_init_u64(&pkt_loop->loopqs[i].stats.in_errors, 0);
-		odp_atomic_init_u64(&pkt_loop->loopqs[i].stats.out_octets, 0);
-		odp_atomic_init_u64(&pkt_loop->loopqs[i].stats.out_packets, 0);
-	}
+	snprintf(name, sizeof(name), "_odp_pktio_loop_stats-%" PRIu64,
+		 odp_pktio_to_u64(pktio_entry->handle));
+	pkt_loop->stats = _odp_stat_shards_reserve(name, MAX_QUEUES * sizeof(stats_t),
+						   &pkt_loop->stats_shard_size,
+						   &pkt_loop->stats_shm);
+	if (pkt_loop->stats == NULL)
+		return -1;
 
 	return 0;
 }
@@ -246,18 +262,27 @@ static int loopback_pktout_queue_config(pktio_entry_t *pktio_entry,
 static int loopback_close(pktio_entry_t *pktio_entry)
 {
 	pkt_loop_t *pkt_loop = pkt_priv(pktio_entry);
+	int ret = loopback_queues_destroy(pkt_loop->loopqs, pkt_loop->num_qs);
 
-	return loopback_queues_destroy(pkt_loop->loopqs, pkt_loop->num_qs);
+	if (_odp_stat_shards_free(pkt_loop->stats_shm))
+		ret = -1;
+
+	return ret;
 }
 
 static int loopback_recv(pktio_entry_t *pktio_entry, int index, odp_packet_t pkts[], int num)
 {
 	int nbr, i;
-	loop_queue_t *entry = &pkt_priv(pktio_entry)->loopqs[index];
-	odp_queue_t queue = entry->queue;
-	stats_t *stats = &entry->stats;
+	pkt_loop_t *pkt_loop = pkt_priv(pktio_entry);
+	odp_queue_t queue = pkt_loop->loopqs[index].queue;
+	stats_t *stats = queue_stats(pkt_loop, index);
 	_odp_event_hdr_t *hdr_tbl[QUEUE_MULTI_MAX];
 	odp_packet_t cls_tbl[QUEUE_MULTI_MAX];
+	odp_packet_t pkt_tbl[QUEUE_MULTI_MAX];
+	odp_packet_t ipsec_tbl[QUEUE_MULTI_MAX];
+	uint32_t len_tbl[QUEUE_MULTI_MAX];
+	uint8_t ipsec_idx[QUEUE_MULTI_MAX];
+	uint8_t ipsec_done[QUEUE_MULTI_MAX];
 	odp_packet_hdr_t *pkt_hdr;
 	odp_packet_t pkt;
 	odp_time_t ts_val;
@@ -265,6 +290,8 @@ static int loopback_recv(pktio_entry_t *pktio_entry, int index, odp_packet_t pkt
 	int num_rx = 0;
 	int packets = 0;
 	int num_cls = 0;
+	int num_pkts = 0;
+	int num_ipsec = 0;
 	const int cls_enabled = pktio_cls_enabled(pktio_entry);
 	uint32_t octets = 0;
 	const odp_proto_layer_t layer = pktio_entry->parse_layer;
@@ -282,7 +309,6 @@ static int loopback_recv(pktio_entry_t *pktio_entry, int index, odp_packet_t pkt
 
 	for (i = 0; i < nbr; i++) {
 		uint32_t pkt_len;
-		int do_ipsec_enq = 0;
 
 		pkt = packet_from_event_hdr(hdr_tbl[i]);
 		pkt_len = odp_packet_len(pkt);
@@ -341,20 +367,47 @@ static int loopback_recv(pktio_entry_t *pktio_entry, int index, odp_packet_t pkt
 		packet_set_ts(pkt_hdr, ts);
 		pkt_hdr->input = pktio_entry->handle;
 
-		/* Try IPsec inline processing */
+		/* Collect packets for IPsec inline processing. With reassembly enabled,
+		 * fragments are processed after reassembly. */
 		if (pktio_entry->config.inbound_ipsec &&
 		    !pkt_hdr->p.flags.ip_err &&
-		    odp_packet_has_ipsec(pkt)) {
-			do_ipsec_enq = !_odp_ipsec_try_inline(&pkt);
-			pkt_hdr = packet_hdr(pkt);
+		    odp_packet_has_ipsec(pkt) &&
+		    !(pktio_entry->enabled.reass && pkt_hdr->p.input_flags.ipfrag)) {
+			ipsec_idx[num_ipsec] = num_pkts;
+			ipsec_tbl[num_ipsec++] = pkt;
+		}
+
+		pkt_tbl[num_pkts] = pkt;
+		len_tbl[num_pkts] = pkt_len;
+		ipsec_done[num_pkts] = 0;
+		num_pkts++;
+	}
+
+	/* Process IPsec packets of the burst together */
+	if (num_ipsec) {
+		uint8_t done[QUEUE_MULTI_MAX];
+
+		_odp_ipsec_try_inline_multi(ipsec_tbl, num_ipsec, done);
+
+		/* Packet handles may have changed */
+		for (i = 0; i < num_ipsec; i++) {
+			pkt_tbl[ipsec_idx[i]] = ipsec_tbl[i];
+			ipsec_done[ipsec_idx[i]] = done[i];
 		}
+	}
+
+	for (i = 0; i < num_pkts; i++) {
+		uint32_t pkt_len = len_tbl[i];
+
+		pkt = pkt_tbl[i];
+		pkt_hdr = packet_hdr(pkt);
 
 		if (!pkt_hdr->p.flags.all.error) {
 			octets += pkt_len;
 			packets++;
 		}
 
-		if (do_ipsec_enq) {
+		if (ipsec_done[i]) {
 			if (odp_unlikely(odp_queue_enq(pkt_hdr->dst_queue,
 						       odp_packet_to_event(pkt)))) {
 				odp_atomic_inc_u64(&stats->in_discards);
@@ -367,7 +420,7 @@ static int loopback_recv(pktio_entry_t *pktio_entry, int index, odp_packet_t pkt
 		} else if (cls_enabled) {
 			/* Enqueue packets directly to classifier destination queue */
 			cls_tbl[num_cls++] = pkt;
-			num_cls = _odp_cls_enq(cls_tbl, num_cls, (i + 1 == nbr));
+			num_cls = _odp_cls_enq(cls_tbl, num_cls, (i + 1 == num_pkts));
 		} else {
 			pkts[num_rx++] = pkt;
 		}
@@ -546,7 +599,7 @@ static int loopback_send(pktio_entry_t *pktio_entry, int index, const odp_packet
 	if (pkt_loop->num_qs == 0)
 		return 0;
 
-	stats =	&pkt_loop->loopqs[index].stats;
+	stats = queue_stats(pkt_loop, index);
 
 	if (odp_unlikely(num > QUEUE_MULTI_MAX))
 		num = QUEUE_MULTI_MAX;
@@ -747,14 +800,12 @@ static int loopback_stats(pktio_entry_t *pktio_entry, odp_pktio_stats_t *stats)
 	memset(stats, 0, sizeof(odp_pktio_stats_t));
 
 	for (uint32_t i = 0; i < MAX_QUEUES; i++) {
-		stats_t *qs = &pkt_loop->loopqs[i].stats;
-
-		stats->in_octets += odp_atomic_load_u64(&qs->in_octets);
-		stats->in_packets += odp_atomic_load_u64(&qs->in_packets);
-		stats->in_discards += odp_atomic_load_u64(&qs->in_discards);
-		stats->in_errors += odp_atomic_load_u64(&qs->in_errors);
-		stats->out_octets += odp_atomic_load_u64(&qs->out_octets);
-		stats->out_packets += odp_atomic_load_u64(&qs->out_packets);
+		stats->in_octets += QUEUE_STATS_SUM(pkt_loop, i, in_octets);
+		stats->in_packets += QUEUE_STATS_SUM(pkt_loop, i, in_packets);
+		stats->in_discards += QUEUE_STATS_SUM(pkt_loop, i, in_discards);
+		stats->in_errors += QUEUE_STATS_SUM(pkt_loop, i, in_errors);
+		stats->out_octets += QUEUE_STATS_SUM(pkt_loop, i, out_octets);
+		stats->out_packets += QUEUE_STATS_SUM(pkt_loop, i, out_packets);
 	}
 
 	return 0;
@@ -764,15 +815,20 @@ static int loopback_stats_reset(pktio_entry_t *pktio_entry)
 {
 	pkt_loop_t *pkt_loop = pkt_priv(pktio_entry);
 
-	for (uint32_t i = 0; i < MAX_QUEUES; i++) {
-		stats_t *qs = &pkt_loop->loopqs[i].stats;
-
-		odp_atomic_store_u64(&qs->in_octets, 0);
-		odp_atomic_store_u64(&qs->in_packets, 0);
-		odp_atomic_store_u64(&qs->in_discards, 0);
-		odp_atomic_store_u64(&qs->in_errors, 0);
-		odp_atomic_store_u64(&qs->out_octets, 0);
-		odp_atomic_store_u64(&qs->out_packets, 0);
+	for (uint32_t s = 0; s < CONFIG_STAT_SHARDS; s++) {
+		stats_t *shard = (stats_t *)(uintptr_t)((uint8_t *)pkt_loop->stats +
+							s * pkt_loop->stats_shard_size);
+
+		for (uint32_t i = 0; i < MAX_QUEUES; i++) {
+			stats_t *qs = &shard[i];
+
+			odp_atomic_store_u64(&qs->in_octets, 0);
+			odp_atomic_store_u64(&qs->in_packets, 0);
+			odp_atomic_store_u64(&qs->in_discards, 0);
+			odp_atomic_store_u64(&qs->in_errors, 0);
+			odp_atomic_store_u64(&qs->out_octets, 0);
+			odp_atomic_store_u64(&qs->out_packets, 0);
+		}
 	}
 
 	return 0;
@@ -781,13 +837,13 @@ static int loopback_stats_reset(pktio_entry_t *pktio_entry)
 static int loopback_pktin_stats(pktio_entry_t *pktio_entry, uint32_t index,
 				odp_pktin_queue_stats_t *pktin_stats)
 {
-	stats_t *qs = &pkt_priv(pktio_entry)->loopqs[index].stats;
+	pkt_loop_t *pkt_loop = pkt_priv(pktio_entry);
 
 	memset(pktin_stats, 0, sizeof(odp_pktin_queue_stats_t));
-	pktin_stats->octets = odp_atomic_load_u64(&qs->in_octets);
-	pktin_stats->packets = odp_atomic_load_u64(&qs->in_packets);
-	pktin_stats->discards = odp_atomic_load_u64(&qs->in_discards);
-	pktin_stats->errors = odp_atomic_load_u64(&qs->in_errors);
+	pktin_stats->octets = QUEUE_STATS_SUM(pkt_loop, index, in_octets);
+	pktin_stats->packets = QUEUE_STATS_SUM(pkt_loop, index, in_packets);
+	pktin_stats->discards = QUEUE_STATS_SUM(pkt_loop, index, in_discards);
+	pktin_stats->errors = QUEUE_STATS_SUM(pkt_loop, index, in_errors);
 
 	return 0;
 }
@@ -795,11 +851,11 @@ static int loopback_pktin_stats(pktio_entry_t *pktio_entry, uint32_t index,
 static int loopback_pktout_stats(pktio_entry_t *pktio_entry, uint32_t index,
 				 odp_pktout_queue_stats_t *pktout_stats)
 {
-	stats_t *qs = &pkt_priv(pktio_entry)->loopqs[index].stats;
+	pkt_loop_t *pkt_loop = pkt_priv(pktio_entry);
 
 	memset(pktout_stats, 0, sizeof(odp_pktout_queue_stats_t));
-	pktout_stats->octets = odp_atomic_load_u64(&qs->out_octets);
-	pktout_stats->packets = odp_atomic_load_u64(&qs->out_packets);
+	pktout_stats->octets = QUEUE_STATS_SUM(pkt_loop, index, out_octets);
+	pktout_stats->packets = QUEUE_STATS_SUM(pkt_loop, index, out_packets);
 
 	return 0;
 }
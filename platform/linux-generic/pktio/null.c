@@ -16,12 +16,14 @@ static int null_close(pktio_entry_t *pktio_entry ODP_UNUSED)
 	return 0;
 }
 
-static int null_open(odp_pktio_t id ODP_UNUSED, pktio_entry_t *pktio_entry ODP_UNUSED,
+static int null_open(odp_pktio_t id ODP_UNUSED, pktio_entry_t *pktio_entry,
 		     const char *devname, odp_pool_t pool ODP_UNUSED)
 {
 	if (strncmp(devname, "null:", 5) != 0)
 		return -1;
 
+	pktio_entry->tx_ref = 1;
+
 	return 0;
 }
 
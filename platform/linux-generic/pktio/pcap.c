@@ -342,7 +342,7 @@ static int pcapif_recv_pkt(pktio_entry_t *pktio_entry, int index ODP_UNUSED,
 			ret = _odp_packet_parse_common(pkt_hdr, data, pkt_len,
 						       pkt_len, layer, opt);
 			if (ret)
-				odp_atomic_inc_u64(&pktio_entry->stats_extra.in_errors);
+				_ODP_STAT_INC(pktio_entry->stats_extra, in_errors);
 
 			if (ret < 0) {
 				odp_packet_free(pkt);
@@ -355,7 +355,7 @@ static int pcapif_recv_pkt(pktio_entry_t *pktio_entry, int index ODP_UNUSED,
 				ret = _odp_cls_classify_packet(pktio_entry, data,
 							       &new_pool, pkt_hdr);
 				if (ret < 0)
-					odp_atomic_inc_u64(&pktio_entry->stats_extra.in_discards);
+					_ODP_STAT_INC(pktio_entry->stats_extra, in_discards);
 
 				if (ret) {
 					odp_packet_free(pkt);
@@ -365,7 +365,7 @@ static int pcapif_recv_pkt(pktio_entry_t *pktio_entry, int index ODP_UNUSED,
 				if (odp_unlikely(_odp_pktio_packet_to_pool(
 					    &pkt, &pkt_hdr, new_pool))) {
 					odp_packet_free(pkt);
-					odp_atomic_inc_u64(&pktio_entry->stats_extra.in_discards);
+					_ODP_STAT_INC(pktio_entry->stats_extra, in_discards);
 					continue;
 				}
 			}
@@ -42,6 +42,7 @@ typedef struct {
 	uint32_t mtu;    /**< maximum transmission unit */
 	uint32_t mtu_max; /**< maximum supported MTU value */
 	unsigned char if_mac[ETH_ALEN];	/**< IF eth mac addr */
+	uint8_t vnet_hdr; /**< virtio-net headers enabled */
 } pkt_sock_t;
 
 ODP_STATIC_ASSERT(PKTIO_PRIVATE_SIZE >= sizeof(pkt_sock_t),
@@ -129,6 +130,8 @@ static int sock_setup_pkt(pktio_entry_t *pktio_entry, const char *netdev,
 	}
 	pkt_sock->sockfd = sockfd;
 
+	pkt_sock->vnet_hdr = _odp_sock_vnet_hdr_enable(sockfd);
+
 	/* get if index */
 	memset(&ethreq, 0, sizeof(struct ifreq));
 	snprintf(ethreq.ifr_name, IF_NAMESIZE, "%s", netdev);
@@ -171,6 +174,7 @@ static int sock_setup_pkt(pktio_entry_t *pktio_entry, const char *netdev,
 
 	odp_ticketlock_init(&pkt_sock->rx_lock);
 	odp_ticketlock_init(&pkt_sock->tx_lock);
+	pktio_entry->tx_ref = 1;
 
 	return 0;
 
@@ -220,7 +224,9 @@ static int sock_mmsg_recv(pktio_entry_t *pktio_entry, int index ODP_UNUSED,
 	odp_time_t *ts = NULL;
 	const int sockfd = pkt_sock->sockfd;
 	struct mmsghdr msgvec[num];
-	struct iovec iovecs[num][PKT_MAX_SEGS];
+	struct iovec iovecs[num][PKT_MAX_SEGS + 1];
+	struct virtio_net_hdr vnet_hdr[num];
+	const int vnet = pkt_sock->vnet_hdr;
 	int nb_rx = 0;
 	int nb_cls = 0;
 	int nb_pkts;
@@ -238,8 +244,12 @@ static int sock_mmsg_recv(pktio_entry_t *pktio_entry, int index ODP_UNUSED,
 	for (i = 0; i < nb_pkts; i++) {
 		if (frame_offset)
 			pull_head(packet_hdr(pkt_table[i]), frame_offset);
+		if (vnet) {
+			iovecs[i][0].iov_base = &vnet_hdr[i];
+			iovecs[i][0].iov_len = sizeof(vnet_hdr[i]);
+		}
 		msgvec[i].msg_hdr.msg_iovlen =
-			_rx_pkt_to_iovec(pkt_table[i], iovecs[i]);
+			_rx_pkt_to_iovec(pkt_table[i], &iovecs[i][vnet]) + vnet;
 		msgvec[i].msg_hdr.msg_iov = iovecs[i];
 	}
 
@@ -253,11 +263,12 @@ static int sock_mmsg_recv(pktio_entry_t *pktio_entry, int index ODP_UNUSED,
 	}
 
 	for (i = 0; i < recv_msgs; i++) {
-		void *base = msgvec[i].msg_hdr.msg_iov->iov_base;
+		void *base = iovecs[i][vnet].iov_base;
 		struct ethhdr *eth_hdr = base;
 		odp_packet_t pkt = pkt_table[i];
 		odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt);
-		uint16_t pkt_len = msgvec[i].msg_len;
+		uint16_t pkt_len = msgvec[i].msg_len - (vnet ? sizeof(vnet_hdr[i]) : 0);
+		odp_pktin_config_opt_t parse_opt = opt;
 		int ret;
 
 		if (odp_unlikely(msgvec[i].msg_hdr.msg_flags & MSG_TRUNC)) {
@@ -274,9 +285,12 @@ static int sock_mmsg_recv(pktio_entry_t *pktio_entry, int index ODP_UNUSED,
 			continue;
 		}
 
+		if (vnet && odp_unlikely(vnet_hdr[i].flags & VIRTIO_NET_HDR_F_NEEDS_CSUM))
+			_odp_sock_vnet_hdr_csum_complete(pkt, &vnet_hdr[i], 0);
+
 		if (layer) {
 			uint8_t buf[PARSE_BYTES];
-			uint16_t seg_len = msgvec[i].msg_hdr.msg_iov->iov_len;
+			uint16_t seg_len = iovecs[i][vnet].iov_len;
 
 			/* Make sure there is enough data for the packet
 			* parser in the case of a segmented packet. */
@@ -286,23 +300,29 @@ static int sock_mmsg_recv(pktio_entry_t *pktio_entry, int index ODP_UNUSED,
 				base = buf;
 			}
 
+			if (vnet)
+				parse_opt = _odp_sock_vnet_hdr_rx_opt(&vnet_hdr[i], opt);
+
 			ret = _odp_packet_parse_common(pkt_hdr, base, pkt_len,
-						       seg_len, layer, opt);
+						       seg_len, layer, parse_opt);
 			if (ret)
-				odp_atomic_inc_u64(&pktio_entry->stats_extra.in_errors);
+				_ODP_STAT_INC(pktio_entry->stats_extra, in_errors);
 
 			if (ret < 0) {
 				odp_packet_free(pkt);
 				continue;
 			}
 
+			if (vnet)
+				_odp_sock_vnet_hdr_rx(pkt_hdr, &vnet_hdr[i], opt);
+
 			if (cls_enabled) {
 				odp_pool_t new_pool;
 
 				ret = _odp_cls_classify_packet(pktio_entry, base,
 							       &new_pool, pkt_hdr);
 				if (ret < 0)
-					odp_atomic_inc_u64(&pktio_entry->stats_extra.in_discards);
+					_ODP_STAT_INC(pktio_entry->stats_extra, in_discards);
 
 				if (ret) {
 					odp_packet_free(pkt);
@@ -312,7 +332,7 @@ static int sock_mmsg_recv(pktio_entry_t *pktio_entry, int index ODP_UNUSED,
 				if (odp_unlikely(_odp_pktio_packet_to_pool(
 					    &pkt, &pkt_hdr, new_pool))) {
 					odp_packet_free(pkt);
-					odp_atomic_inc_u64(&pktio_entry->stats_extra.in_discards);
+					_ODP_STAT_INC(pktio_entry->stats_extra, in_discards);
 					continue;
 				}
 			}
@@ -461,12 +481,44 @@ static inline uint32_t _tx_pkt_to_iovec(odp_packet_t pkt, struct iovec *iovecs)
 	return i;
 }
 
+static void sock_chksum_insert(pktio_entry_t *pktio_entry, odp_packet_t pkt,
+			       struct virtio_net_hdr *vnet_hdr)
+{
+	odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt);
+	const odp_pktout_config_opt_t *pktout_cfg = &pktio_entry->config.pktout;
+	uint8_t buf[PARSE_BYTES];
+	uint32_t len = _ODP_MIN(pkt_hdr->frame_len, (uint32_t)PARSE_BYTES);
+	uint32_t offset;
+	int ret;
+
+	ret = _odp_sock_vnet_hdr_tx(pktout_cfg, pkt_hdr, vnet_hdr, odp_packet_data(pkt),
+				    odp_packet_seg_len(pkt));
+
+	if (odp_unlikely(ret < 0)) {
+		/* Headers span multiple segments */
+		odp_packet_copy_to_mem(pkt, 0, len, buf);
+
+		ret = _odp_sock_vnet_hdr_tx(pktout_cfg, pkt_hdr, vnet_hdr, buf, len);
+
+		if (ret == 0 && vnet_hdr->flags) {
+			offset = vnet_hdr->csum_start + vnet_hdr->csum_offset;
+			odp_packet_copy_from_mem(pkt, offset, 2, &buf[offset]);
+		}
+	}
+
+	if (odp_unlikely(ret > 0))
+		_odp_sock_chksum_sw(pktout_cfg, pkt);
+}
+
 static int sock_mmsg_send(pktio_entry_t *pktio_entry, int index ODP_UNUSED,
 			  const odp_packet_t pkt_table[], int num)
 {
 	pkt_sock_t *pkt_sock = pkt_priv(pktio_entry);
 	struct mmsghdr msgvec[num];
-	struct iovec iovecs[num][PKT_MAX_SEGS];
+	struct iovec iovecs[num][PKT_MAX_SEGS + 1];
+	struct virtio_net_hdr vnet_hdr[num];
+	const int vnet = pkt_sock->vnet_hdr;
+	const uint8_t chksum_insert = pktio_entry->enabled.chksum_insert;
 	int ret;
 	int sockfd = pkt_sock->sockfd;
 	int i;
@@ -476,9 +528,19 @@ static int sock_mmsg_send(pktio_entry_t *pktio_entry, int index ODP_UNUSED,
 	memset(msgvec, 0, sizeof(msgvec));
 
 	for (i = 0; i < num; i++) {
+		if (vnet) {
+			if (odp_unlikely(chksum_insert))
+				sock_chksum_insert(pktio_entry, pkt_table[i], &vnet_hdr[i]);
+			else
+				memset(&vnet_hdr[i], 0, sizeof(vnet_hdr[i]));
+
+			iovecs[i][0].iov_base = &vnet_hdr[i];
+			iovecs[i][0].iov_len = sizeof(vnet_hdr[i]);
+		}
+
 		msgvec[i].msg_hdr.msg_iov = iovecs[i];
 		msgvec[i].msg_hdr.msg_iovlen = _tx_pkt_to_iovec(pkt_table[i],
-								iovecs[i]);
+								&iovecs[i][vnet]) + vnet;
 		if (tx_ts_enabled && tx_ts_idx == 0) {
 			if (odp_unlikely(packet_hdr(pkt_table[i])->p.flags.ts_set))
 				tx_ts_idx = i + 1;
@@ -583,9 +645,22 @@ static int sock_capability(pktio_entry_t *pktio_entry,
 	odp_pktio_config_init(&capa->config);
 	capa->config.pktin.bit.ts_all = 1;
 	capa->config.pktin.bit.ts_ptp = 1;
+	capa->config.pktin.bit.ipv4_chksum = 1;
 
 	capa->config.pktout.bit.ts_ena = 1;
 
+	/* Kernel reports validated L4 checksums and inserts L4 checksums
+	 * requested in virtio-net headers */
+	if (pkt_sock->vnet_hdr) {
+		capa->config.pktin.bit.udp_chksum = 1;
+		capa->config.pktin.bit.tcp_chksum = 1;
+		capa->config.pktin.bit.sctp_chksum = 1;
+		capa->config.pktout.bit.udp_chksum = 1;
+		capa->config.pktout.bit.tcp_chksum = 1;
+		capa->config.pktout.bit.udp_chksum_ena = 1;
+		capa->config.pktout.bit.tcp_chksum_ena = 1;
+	}
+
 	capa->tx_compl.mode_event = 1;
 	capa->tx_compl.mode_poll = 1;
 
@@ -595,6 +670,14 @@ static int sock_capability(pktio_entry_t *pktio_entry,
 	return 0;
 }
 
+static int sock_config(pktio_entry_t *pktio_entry, const odp_pktio_config_t *config)
+{
+	pktio_entry->enabled.chksum_insert = config->pktout.bit.udp_chksum_ena ||
+					     config->pktout.bit.tcp_chksum_ena;
+
+	return 0;
+}
+
 static int sock_stats(pktio_entry_t *pktio_entry,
 		      odp_pktio_stats_t *stats)
 {
@@ -673,7 +756,7 @@ const pktio_if_ops_t _odp_sock_mmsg_pktio_ops = {
 	.pktio_ts_res = NULL,
 	.pktio_ts_from_ns = NULL,
 	.pktio_time = NULL,
-	.config = NULL,
+	.config = sock_config,
 	.input_queues_config = NULL,
 	.output_queues_config = NULL,
 };
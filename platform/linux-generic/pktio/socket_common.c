@@ -16,9 +16,14 @@
 #include <linux/if_packet.h>
 #include <linux/sockios.h>
 #include <errno.h>
+#include <odp/api/byteorder.h>
+#include <odp_chksum_internal.h>
 #include <odp_debug_internal.h>
 #include <odp_socket_common.h>
 #include <protocols/eth.h>
+#include <protocols/ip.h>
+#include <protocols/tcp.h>
+#include <protocols/udp.h>
 
 /* Fallback for old kernels (< v4.6) */
 #ifndef ETHTOOL_GLINKSETTINGS
@@ -293,3 +298,175 @@ int _odp_link_info_fd(int fd, const char *name, odp_pktio_link_info_t *info)
 
 	return 0;
 }
+
+int _odp_sock_vnet_hdr_enable(int fd)
+{
+	int val = 1;
+
+	if (setsockopt(fd, SOL_PACKET, PACKET_VNET_HDR, &val, sizeof(val)) == -1) {
+		_ODP_DBG("setsockopt(PACKET_VNET_HDR): %s\n", strerror(errno));
+		return 0;
+	}
+
+	return 1;
+}
+
+int _odp_sock_vnet_hdr_tx(const odp_pktout_config_opt_t *pktout_cfg,
+			  const odp_packet_hdr_t *pkt_hdr, struct virtio_net_hdr *vnet_hdr,
+			  uint8_t *data, uint32_t len)
+{
+	const packet_parser_t *prs = &pkt_hdr->p;
+	const uint32_t l3_offset = prs->l3_offset;
+	const uint32_t l4_offset = prs->l4_offset;
+	const uint8_t *l3_hdr;
+	uint32_t l3_end;
+	uint8_t l4_proto;
+	uint16_t csum_offset, csum;
+	odp_bool_t chksum_pkt;
+	uint64_t sum;
+
+	memset(vnet_hdr, 0, sizeof(*vnet_hdr));
+
+	if (l3_offset == ODP_PACKET_OFFSET_INVALID)
+		return 0;
+
+	if (odp_unlikely(l3_offset + _ODP_IPV4HDR_LEN > len))
+		return -1;
+
+	l3_hdr = data + l3_offset;
+
+	if (_ODP_IPV4HDR_VER(*l3_hdr) == _ODP_IPV4) {
+		const _odp_ipv4hdr_t *ip = (const _odp_ipv4hdr_t *)(uintptr_t)l3_hdr;
+
+		if (_ODP_IPV4HDR_IS_FRAGMENT(odp_be_to_cpu_16(ip->frag_offset)))
+			return 0;
+
+		l3_end = l3_offset + odp_be_to_cpu_16(ip->tot_len);
+		sum = chksum_partial(&ip->src_addr, 2 * _ODP_IPV4ADDR_LEN, 0);
+	} else if (_ODP_IPV4HDR_VER(*l3_hdr) == _ODP_IPV6) {
+		const _odp_ipv6hdr_t *ipv6 = (const _odp_ipv6hdr_t *)(uintptr_t)l3_hdr;
+
+		if (odp_unlikely(l3_offset + _ODP_IPV6HDR_LEN > len))
+			return -1;
+
+		/* Extension headers may precede the L4 header */
+		l3_end = l3_offset + _ODP_IPV6HDR_LEN + odp_be_to_cpu_16(ipv6->payload_len);
+		sum = chksum_partial(&ipv6->src_addr, 2 * _ODP_IPV6ADDR_LEN, 0);
+	} else {
+		return 0;
+	}
+
+	if (prs->input_flags.ipfrag)
+		return 0;
+
+	if (prs->input_flags.udp) {
+		l4_proto = _ODP_IPPROTO_UDP;
+		chksum_pkt = prs->flags.l4_chksum_set ? prs->flags.l4_chksum :
+			     pktout_cfg->bit.udp_chksum;
+		csum_offset = ODP_OFFSETOF(_odp_udphdr_t, chksum);
+	} else if (prs->input_flags.tcp) {
+		l4_proto = _ODP_IPPROTO_TCP;
+		chksum_pkt = prs->flags.l4_chksum_set ? prs->flags.l4_chksum :
+			     pktout_cfg->bit.tcp_chksum;
+		csum_offset = ODP_OFFSETOF(_odp_tcphdr_t, cksm);
+	} else if (prs->input_flags.l4) {
+		/* Other L4 protocol */
+		return 0;
+	} else {
+		/* Packet was not parsed up to L4 */
+		chksum_pkt = prs->flags.l4_chksum_set ? prs->flags.l4_chksum :
+			     pktout_cfg->bit.udp_chksum || pktout_cfg->bit.tcp_chksum;
+		return chksum_pkt ? 1 : 0;
+	}
+
+	if (!chksum_pkt)
+		return 0;
+
+	/* L4 offset not set or not within L3 payload */
+	if (odp_unlikely(l4_offset == ODP_PACKET_OFFSET_INVALID ||
+			 l4_offset + csum_offset + sizeof(csum) > l3_end ||
+			 l3_end > pkt_hdr->frame_len))
+		return 1;
+
+	if (odp_unlikely(l4_offset + csum_offset + sizeof(csum) > len))
+		return -1;
+
+	/* Pseudo header length is L3 payload length, which excludes L2 padding */
+	sum += odp_cpu_to_be_16(l4_proto);
+	sum += odp_cpu_to_be_16(l3_end - l4_offset);
+	csum = chksum_finalize(sum);
+	memcpy(data + l4_offset + csum_offset, &csum, sizeof(csum));
+
+	vnet_hdr->flags = VIRTIO_NET_HDR_F_NEEDS_CSUM;
+	vnet_hdr->csum_start = l4_offset;
+	vnet_hdr->csum_offset = csum_offset;
+
+	return 0;
+}
+
+void _odp_sock_vnet_hdr_csum_complete(odp_packet_t pkt, const struct virtio_net_hdr *vnet_hdr,
+				      uint32_t offset)
+{
+	const uint32_t pkt_len = odp_packet_len(pkt);
+	const uint32_t start = offset + vnet_hdr->csum_start;
+	const uint32_t csum_offset = start + vnet_hdr->csum_offset;
+	uint32_t seg_len, len;
+	uint64_t sum = 0;
+	uint16_t csum;
+
+	if (odp_unlikely(csum_offset + sizeof(csum) > pkt_len))
+		return;
+
+	for (uint32_t off = start; off < pkt_len; off += len) {
+		const void *data = odp_packet_offset(pkt, off, &seg_len, NULL);
+
+		len = _ODP_MIN(seg_len, pkt_len - off);
+		sum += chksum_partial(data, len, off - start);
+	}
+
+	csum = ~chksum_finalize(sum);
+	if (csum == 0)
+		csum = 0xffff;
+
+	odp_packet_copy_from_mem(pkt, csum_offset, sizeof(csum), &csum);
+}
+
+void _odp_sock_chksum_sw(const odp_pktout_config_opt_t *pktout_cfg, odp_packet_t pkt)
+{
+	odp_packet_hdr_t *pkt_hdr = packet_hdr(pkt);
+	const packet_parser_t prs = pkt_hdr->p;
+	odp_packet_parse_param_t param;
+	odp_bool_t chksum_pkt;
+	uint8_t ver;
+
+	if (odp_packet_copy_to_mem(pkt, prs.l3_offset, 1, &ver))
+		return;
+
+	if (_ODP_IPV4HDR_VER(ver) == _ODP_IPV4)
+		param.proto = ODP_PROTO_IPV4;
+	else if (_ODP_IPV4HDR_VER(ver) == _ODP_IPV6)
+		param.proto = ODP_PROTO_IPV6;
+	else
+		return;
+
+	param.last_layer = ODP_PROTO_LAYER_L4;
+	param.chksums.all_chksum = 0;
+
+	if (odp_packet_parse(pkt, prs.l3_offset, &param) == 0 &&
+	    !pkt_hdr->p.input_flags.ipfrag) {
+		if (pkt_hdr->p.input_flags.udp) {
+			chksum_pkt = prs.flags.l4_chksum_set ? prs.flags.l4_chksum :
+				     pktout_cfg->bit.udp_chksum;
+			if (chksum_pkt)
+				_odp_packet_udp_chksum_insert(pkt);
+		} else if (pkt_hdr->p.input_flags.tcp) {
+			chksum_pkt = prs.flags.l4_chksum_set ? prs.flags.l4_chksum :
+				     pktout_cfg->bit.tcp_chksum;
+			if (chksum_pkt)
+				_odp_packet_tcp_chksum_insert(pkt);
+		}
+	}
+
+	/* Parsing overwrites packet metadata, which belongs to the application */
+	pkt_hdr->p = prs;
+}
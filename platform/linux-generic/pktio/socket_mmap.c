@@ -91,6 +91,7 @@ typedef struct {
 	unsigned int mmap_len;
 	unsigned char if_mac[ETH_ALEN];
 	struct sockaddr_ll ll;
+	uint8_t vnet_hdr; /**< virtio-net headers enabled */
 } pkt_sock_mmap_t;
 
 ODP_STATIC_ASSERT(PKTIO_PRIVATE_SIZE >= sizeof(pkt_sock_mmap_t),
@@ -161,6 +162,7 @@ static inline unsigned pkt_mmap_v2_rx(pktio_entry_t *pktio_entry,
 
 	for (i = 0; i < num; i++) {
 		struct tpacket2_hdr *tp_hdr;
+		const struct virtio_net_hdr *vnet_hdr;
 		odp_packet_t pkt;
 		odp_packet_hdr_t *hdr;
 		int ret;
@@ -263,11 +265,27 @@ static inline unsigned pkt_mmap_v2_rx(pktio_entry_t *pktio_entry,
 			*tci  = odp_cpu_to_be_16(tp_hdr->tp_vlan_tci);
 		}
 
+		/* Kernel writes virtio-net header just before the frame */
+		vnet_hdr = NULL;
+		if (pkt_sock->vnet_hdr) {
+			vnet_hdr = (const struct virtio_net_hdr *)
+				   (uintptr_t)(pkt_buf - sizeof(*vnet_hdr));
+
+			/* Checksum start offset does not include stripped VLAN header */
+			if (odp_unlikely(vnet_hdr->flags & VIRTIO_NET_HDR_F_NEEDS_CSUM))
+				_odp_sock_vnet_hdr_csum_complete(pkt, vnet_hdr, vlan_len);
+		}
+
 		if (layer) {
+			odp_pktin_config_opt_t parse_opt = opt;
+
+			if (vnet_hdr)
+				parse_opt = _odp_sock_vnet_hdr_rx_opt(vnet_hdr, opt);
+
 			ret = _odp_packet_parse_common(hdr, pkt_buf, pkt_len,
-						       pkt_len, layer, opt);
+						       pkt_len, layer, parse_opt);
 			if (ret)
-				odp_atomic_inc_u64(&pktio_entry->stats_extra.in_errors);
+				_ODP_STAT_INC(pktio_entry->stats_extra, in_errors);
 
 			if (ret < 0) {
 				odp_packet_free(pkt);
@@ -276,13 +294,16 @@ static inline unsigned pkt_mmap_v2_rx(pktio_entry_t *pktio_entry,
 				continue;
 			}
 
+			if (vnet_hdr)
+				_odp_sock_vnet_hdr_rx(hdr, vnet_hdr, opt);
+
 			if (cls_enabled) {
 				odp_pool_t new_pool;
 
 				ret = _odp_cls_classify_packet(pktio_entry, pkt_buf,
 							       &new_pool, hdr);
 				if (ret < 0)
-					odp_atomic_inc_u64(&pktio_entry->stats_extra.in_discards);
+					_ODP_STAT_INC(pktio_entry->stats_extra, in_discards);
 
 				if (ret) {
 					odp_packet_free(pkt);
@@ -296,7 +317,7 @@ static inline unsigned pkt_mmap_v2_rx(pktio_entry_t *pktio_entry,
 					odp_packet_free(pkt);
 					tp_hdr->tp_status = TP_STATUS_KERNEL;
 					frame_num = next_frame_num;
-					odp_atomic_inc_u64(&pktio_entry->stats_extra.in_discards);
+					_ODP_STAT_INC(pktio_entry->stats_extra, in_discards);
 					continue;
 				}
 			}
@@ -326,7 +347,7 @@ static inline unsigned pkt_mmap_v2_rx(pktio_entry_t *pktio_entry,
 	return nb_rx;
 }
 
-static inline int pkt_mmap_v2_tx(pktio_entry_t *pktio_entry, int sock,
+static inline int pkt_mmap_v2_tx(pktio_entry_t *pktio_entry, pkt_sock_mmap_t *pkt_sock,
 				 struct ring *ring,
 				 const odp_packet_t pkt_table[], uint32_t num)
 {
@@ -339,6 +360,9 @@ static inline int pkt_mmap_v2_tx(pktio_entry_t *pktio_entry, int sock,
 	int total_len = 0;
 	uint8_t tx_ts_enabled = _odp_pktio_tx_ts_enabled(pktio_entry);
 	uint32_t tx_ts_idx = 0;
+	const int sock = pkt_sock->sockfd;
+	const uint32_t vnet_len = pkt_sock->vnet_hdr ? sizeof(struct virtio_net_hdr) : 0;
+	const uint8_t chksum_insert = pktio_entry->enabled.chksum_insert;
 
 	frame_num = ring->frame_num;
 	first_frame_num = frame_num;
@@ -366,12 +390,31 @@ static inline int pkt_mmap_v2_tx(pktio_entry_t *pktio_entry, int sock,
 		odp_prefetch(next_ptr);
 
 		pkt_len = odp_packet_len(pkt_table[i]);
-		tp_hdr[i]->tp_len = pkt_len;
+		tp_hdr[i]->tp_len = vnet_len + pkt_len;
 		total_len += pkt_len;
 
 		buf = (uint8_t *)(void *)tp_hdr[i] + TPACKET2_HDRLEN -
 		       sizeof(struct sockaddr_ll);
-		odp_packet_copy_to_mem(pkt_table[i], 0, pkt_len, buf);
+		odp_packet_copy_to_mem(pkt_table[i], 0, pkt_len, buf + vnet_len);
+
+		if (vnet_len) {
+			struct virtio_net_hdr *vnet_hdr = (struct virtio_net_hdr *)(uintptr_t)buf;
+
+			/* Checksum field is updated in the ring copy only */
+			if (odp_unlikely(chksum_insert)) {
+				if (_odp_sock_vnet_hdr_tx(&pktio_entry->config.pktout,
+							  packet_hdr(pkt_table[i]), vnet_hdr,
+							  buf + vnet_len, pkt_len) > 0) {
+					/* L4 protocol not known, insert checksum in software */
+					_odp_sock_chksum_sw(&pktio_entry->config.pktout,
+							    pkt_table[i]);
+					odp_packet_copy_to_mem(pkt_table[i], 0, pkt_len,
+							       buf + vnet_len);
+				}
+			} else {
+				memset(vnet_hdr, 0, sizeof(*vnet_hdr));
+			}
+		}
 
 		tp_hdr[i]->tp_status = TP_STATUS_SEND_REQUEST;
 
@@ -452,7 +495,8 @@ static int mmap_setup_ring(pkt_sock_mmap_t *pkt_sock, struct ring *ring,
 	ring->type = type;
 	ring->version = TPACKET_V2;
 
-	frame_size = _ODP_ROUNDUP_POWER2_U32(mtu + TPACKET_HDRLEN + TPACKET_ALIGNMENT);
+	frame_size = _ODP_ROUNDUP_POWER2_U32(mtu + TPACKET_HDRLEN + TPACKET_ALIGNMENT +
+					     sizeof(struct virtio_net_hdr));
 	block_size = BLOCK_SIZE;
 	if (frame_size > block_size)
 		block_size = frame_size;
@@ -634,6 +678,9 @@ static int sock_mmap_open(odp_pktio_t id ODP_UNUSED,
 	if (pkt_sock->sockfd == -1)
 		goto error;
 
+	/* Must be enabled before ring setup */
+	pkt_sock->vnet_hdr = _odp_sock_vnet_hdr_enable(pkt_sock->sockfd);
+
 	ret = mmap_bind_sock(pkt_sock, netdev);
 	if (ret != 0)
 		goto error;
@@ -681,6 +728,8 @@ static int sock_mmap_open(odp_pktio_t id ODP_UNUSED,
 	if (ret != 0)
 		goto error;
 
+	pktio_entry->tx_ref = 1;
+
 	return 0;
 
 error:
@@ -808,8 +857,7 @@ static int sock_mmap_send(pktio_entry_t *pktio_entry, int index ODP_UNUSED,
 	pkt_sock_mmap_t *const pkt_sock = pkt_priv(pktio_entry);
 
 	odp_ticketlock_lock(&pkt_sock->tx_ring.lock);
-	ret = pkt_mmap_v2_tx(pktio_entry, pkt_sock->tx_ring.sock,
-			     &pkt_sock->tx_ring, pkt_table, num);
+	ret = pkt_mmap_v2_tx(pktio_entry, pkt_sock, &pkt_sock->tx_ring, pkt_table, num);
 	odp_ticketlock_unlock(&pkt_sock->tx_ring.lock);
 
 	return ret;
@@ -887,9 +935,22 @@ static int sock_mmap_capability(pktio_entry_t *pktio_entry,
 	odp_pktio_config_init(&capa->config);
 	capa->config.pktin.bit.ts_all = 1;
 	capa->config.pktin.bit.ts_ptp = 1;
+	capa->config.pktin.bit.ipv4_chksum = 1;
 
 	capa->config.pktout.bit.ts_ena = 1;
 
+	/* Kernel reports validated L4 checksums and inserts L4 checksums
+	 * requested in virtio-net headers */
+	if (pkt_sock->vnet_hdr) {
+		capa->config.pktin.bit.udp_chksum = 1;
+		capa->config.pktin.bit.tcp_chksum = 1;
+		capa->config.pktin.bit.sctp_chksum = 1;
+		capa->config.pktout.bit.udp_chksum = 1;
+		capa->config.pktout.bit.tcp_chksum = 1;
+		capa->config.pktout.bit.udp_chksum_ena = 1;
+		capa->config.pktout.bit.tcp_chksum_ena = 1;
+	}
+
 	capa->tx_compl.mode_event = 1;
 	capa->tx_compl.mode_poll = 1;
 
@@ -899,6 +960,14 @@ static int sock_mmap_capability(pktio_entry_t *pktio_entry,
 	return 0;
 }
 
+static int sock_mmap_config(pktio_entry_t *pktio_entry, const odp_pktio_config_t *config)
+{
+	pktio_entry->enabled.chksum_insert = config->pktout.bit.udp_chksum_ena ||
+					     config->pktout.bit.tcp_chksum_ena;
+
+	return 0;
+}
+
 static int sock_mmap_stats(pktio_entry_t *pktio_entry,
 			   odp_pktio_stats_t *stats)
 {
@@ -980,7 +1049,7 @@ const pktio_if_ops_t _odp_sock_mmap_pktio_ops = {
 	.pktio_ts_res = NULL,
 	.pktio_ts_from_ns = NULL,
 	.pktio_time = NULL,
-	.config = NULL,
+	.config = sock_mmap_config,
 	.input_queues_config = NULL,
 	.output_queues_config = NULL,
 };
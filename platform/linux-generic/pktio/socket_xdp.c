@@ -275,9 +275,16 @@ static int sock_xdp_open(odp_pktio_t pktio, pktio_entry_t *pktio_entry, const ch
 	if (disable_pktio)
 		return -1;
 
+	pool = _odp_pool_entry(pool_hdl);
+
+	/* UMEM is bound to a single pool memory area */
+	if (pool->num_class) {
+		_ODP_ERR("Pools with subparameters not supported\n");
+		return -1;
+	}
+
 	priv = pkt_priv(pktio_entry);
 	memset(priv, 0, sizeof(xdp_sock_info_t));
-	pool = _odp_pool_entry(pool_hdl);
 	priv->umem_info = (xdp_umem_info_t *)(void *)pool->mem_src_data;
 	priv->umem_info->pool = pool;
 	/* Mark transitory kernel-owned packets with the pktio index, so that they can be freed on
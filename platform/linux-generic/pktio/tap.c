@@ -177,6 +177,7 @@ static int tap_pktio_open(odp_pktio_t id ODP_UNUSED,
 	tap->skfd = skfd;
 	tap->mtu = mtu;
 	tap->pool = pool;
+	pktio_entry->tx_ref = 1;
 	return 0;
 sock_err:
 	close(skfd);
@@ -0,0 +1,179 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#include <odp_api.h>
+#include <odp/helper/odph_api.h>
+
+#include <odp/api/plat/event_validation_external.h>
+
+#include "odp_cunit_common.h"
+
+#include <signal.h>
+#include <stdint.h>
+#include <string.h>
+
+/* These match event_validation.conf */
+#define SAMPLE		4
+#define TOGGLE_SIGNAL	SIGUSR2
+
+#define NUM_BUF		16
+#define BUF_SIZE	64
+
+static odp_pool_t pool;
+
+static int event_validation_suite_init(void)
+{
+	odp_pool_capability_t capa;
+	odp_pool_param_t param;
+
+	if (odp_pool_capability(&capa)) {
+		ODPH_ERR("Pool capability failed\n");
+		return -1;
+	}
+
+	odp_pool_param_init(&param);
+	param.type = ODP_POOL_BUFFER;
+	param.buf.num = NUM_BUF;
+	param.buf.size = BUF_SIZE;
+	/* Freed buffers are allocated again in the same order */
+	param.buf.cache_size = capa.buf.min_cache_size;
+
+	pool = odp_pool_create("event_validation_pool", &param);
+	if (pool == ODP_POOL_INVALID) {
+		ODPH_ERR("Pool create failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static int event_validation_suite_term(void)
+{
+	if (odp_pool_destroy(pool)) {
+		ODPH_ERR("Pool destroy failed\n");
+		return -1;
+	}
+
+	return odp_cunit_print_inactive();
+}
+
+static int check_runtime(void)
+{
+	if (_ODP_EVENT_VALIDATION != _ODP_EV_VALIDATION_RUNTIME)
+		return ODP_TEST_INACTIVE;
+
+	return ODP_TEST_ACTIVE;
+}
+
+/* Overwrite the endmark that follows buffer data */
+static void endmark_corrupt(odp_buffer_t buf)
+{
+	uint8_t *end = (uint8_t *)odp_buffer_addr(buf) + odp_buffer_size(buf);
+
+	memset(end, 0x5a, sizeof(uint64_t));
+}
+
+static int alloc_all(odp_buffer_t buf[])
+{
+	int num = odp_buffer_alloc_multi(pool, buf, NUM_BUF);
+
+	CU_ASSERT_FATAL(num == NUM_BUF);
+
+	return num;
+}
+
+static void validation_toggle(void)
+{
+	CU_ASSERT_FATAL(raise(TOGGLE_SIGNAL) == 0);
+}
+
+static void event_validation_test_toggle(void)
+{
+	odp_buffer_t buf = odp_buffer_alloc(pool);
+
+	CU_ASSERT_FATAL(buf != ODP_BUFFER_INVALID);
+
+	/* Off at startup */
+	endmark_corrupt(buf);
+	CU_ASSERT(odp_buffer_is_valid(buf) == 1);
+
+	/* On: error is detected and the endmark fixed */
+	validation_toggle();
+	CU_ASSERT(odp_buffer_is_valid(buf) == 0);
+	CU_ASSERT(odp_buffer_is_valid(buf) == 1);
+
+	/* Off again */
+	validation_toggle();
+	endmark_corrupt(buf);
+	CU_ASSERT(odp_buffer_is_valid(buf) == 1);
+
+	/* Leave the buffer valid */
+	validation_toggle();
+	CU_ASSERT(odp_buffer_is_valid(buf) == 0);
+	validation_toggle();
+
+	odp_buffer_free(buf);
+}
+
+static void event_validation_test_sample(void)
+{
+	odp_buffer_t buf[NUM_BUF];
+	int num, i, num_invalid;
+
+	validation_toggle();
+
+	num = alloc_all(buf);
+
+	/* Only every SAMPLE'th free checks (and fixes) the endmark. Validity checks are not
+	 * sampled. */
+	for (i = 0; i < num; i++)
+		endmark_corrupt(buf[i]);
+
+	for (i = 0; i < num; i++)
+		odp_buffer_free(buf[i]);
+
+	num = alloc_all(buf);
+	num_invalid = 0;
+
+	for (i = 0; i < num; i++)
+		num_invalid += !odp_buffer_is_valid(buf[i]);
+
+	CU_ASSERT(num_invalid == NUM_BUF - NUM_BUF / SAMPLE);
+
+	/* All endmarks were fixed by the validity checks */
+	for (i = 0; i < num; i++)
+		CU_ASSERT(odp_buffer_is_valid(buf[i]) == 1);
+
+	odp_buffer_free_multi(buf, num);
+
+	validation_toggle();
+}
+
+odp_testinfo_t event_validation_suite[] = {
+	ODP_TEST_INFO_CONDITIONAL(event_validation_test_toggle, check_runtime),
+	ODP_TEST_INFO_CONDITIONAL(event_validation_test_sample, check_runtime),
+	ODP_TEST_INFO_NULL
+};
+
+odp_suiteinfo_t event_validation_suites[] = {
+	{"Event validation", event_validation_suite_init, event_validation_suite_term,
+	 event_validation_suite},
+	ODP_SUITE_INFO_NULL
+};
+
+int main(int argc, char *argv[])
+{
+	int ret;
+
+	/* parse common options: */
+	if (odp_cunit_parse_options(&argc, argv))
+		return -1;
+
+	ret = odp_cunit_register(event_validation_suites);
+
+	if (ret == 0)
+		ret = odp_cunit_run();
+
+	return ret;
+}
@@ -0,0 +1,12 @@
+#!/bin/sh
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2026 Nokia
+#
+
+# Run event validation test with the config file that enables sampling and
+# signal control. Both are found in the script directory.
+
+TEST_DIR=$(dirname $0)
+
+ODP_CONFIG_FILE=$TEST_DIR/event_validation.conf $TEST_DIR/event_validation_linux${EXEEXT}
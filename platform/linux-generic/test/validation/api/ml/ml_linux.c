@@ -708,26 +708,11 @@ static void test_ml_model_load_async_event(void)
 #define NUM_COLUMN 3
 #define MAX_BATCH_SIZE 4
 #define SIZE (NUM_COLUMN * MAX_BATCH_SIZE * sizeof(double))
-static void run_model_batch_add(void)
+static odp_ml_model_t create_model_batch_add(uint32_t max_compl_id)
 {
-	int ret;
-	odp_ml_data_t data;
 	odp_ml_model_t model;
-	odp_ml_data_seg_t input_segs[SIZE * 2];
-	odp_ml_data_seg_t output_segs[SIZE];
-	odp_ml_run_result_t result;
-	odp_ml_run_param_t run_param;
 	odp_ml_model_param_t model_param;
 
-	double y[12];
-	double y_expected[12];
-	uint32_t batch_size = MAX_BATCH_SIZE;
-	double x1[12] = {97, 47, 62, 19, 93, 59, 67, 42, 28, 55, 46, 31};
-	double x2[12] = {81, 56, 27, 4, 69, 12, 91, 98, 23, 90, 52, 64};
-
-	for (int i = 0; i < 12; i++)
-		y_expected[i] = x1[i] + x2[i];
-
 	odp_ml_model_param_init(&model_param);
 
 	odp_ml_data_format_t input_format[2] = {
@@ -754,12 +739,37 @@ static void run_model_batch_add(void)
 
 	/* Verify model info about matrix_mul.onnx */
 	if (fill_model_param("batch_add.onnx", &model_param))
-		return;
+		return ODP_ML_MODEL_INVALID;
 
+	model_param.max_compl_id = max_compl_id;
 	model = odp_ml_model_create("batch_add", &model_param);
 	free(model_param.model);
 	CU_ASSERT(model != ODP_ML_MODEL_INVALID);
-	if (!model)
+
+	return model;
+}
+
+static void run_model_batch_add(void)
+{
+	int ret;
+	odp_ml_data_t data;
+	odp_ml_model_t model;
+	odp_ml_data_seg_t input_segs[SIZE * 2];
+	odp_ml_data_seg_t output_segs[SIZE];
+	odp_ml_run_result_t result;
+	odp_ml_run_param_t run_param;
+
+	double y[12];
+	double y_expected[12];
+	uint32_t batch_size = MAX_BATCH_SIZE;
+	double x1[12] = {97, 47, 62, 19, 93, 59, 67, 42, 28, 55, 46, 31};
+	double x2[12] = {81, 56, 27, 4, 69, 12, 91, 98, 23, 90, 52, 64};
+
+	for (int i = 0; i < 12; i++)
+		y_expected[i] = x1[i] + x2[i];
+
+	model = create_model_batch_add(0);
+	if (model == ODP_ML_MODEL_INVALID)
 		return;
 
 	if (odp_ml_model_load(model, NULL)) {
@@ -1134,6 +1144,113 @@ static void test_ml_run_start_multi(void)
 	CU_ASSERT_FATAL(ret == 0);
 }
 
+/* Asynchronous runs of batch_add.onnx with different batch sizes. When batch workers are
+ * enabled in the config file, the runs are coalesced into larger batches. */
+#define NUM_BATCH_RUN 8
+static void test_ml_run_start_batch(void)
+{
+	int ret;
+	odp_ml_model_t model;
+	odp_ml_data_t data[NUM_BATCH_RUN];
+	odp_ml_data_seg_t input_seg[NUM_BATCH_RUN][2];
+	odp_ml_data_seg_t output_seg[NUM_BATCH_RUN];
+	odp_ml_compl_param_t compl_param;
+	odp_ml_run_param_t run_param;
+	odp_ml_run_result_t result;
+	double x1[NUM_BATCH_RUN][NUM_COLUMN * MAX_BATCH_SIZE];
+	double x2[NUM_BATCH_RUN][NUM_COLUMN * MAX_BATCH_SIZE];
+	double y[NUM_BATCH_RUN][NUM_COLUMN * MAX_BATCH_SIZE];
+	const uint32_t batch_size[NUM_BATCH_RUN] = {1, 1, 2, 3, 1, 4, 2, 1};
+	uint64_t wait_ns = ODP_TIME_MSEC_IN_NS;
+	int num_started = 0;
+
+	if (global.ml_capa.max_compl_id < NUM_BATCH_RUN - 1) {
+		ODPH_DBG("Too small max_compl_id %u\n", global.ml_capa.max_compl_id);
+		return;
+	}
+
+	model = create_model_batch_add(NUM_BATCH_RUN - 1);
+	if (model == ODP_ML_MODEL_INVALID)
+		return;
+
+	if (odp_ml_model_load(model, NULL)) {
+		CU_ASSERT(odp_ml_model_destroy(model) == 0);
+		return;
+	}
+
+	for (int r = 0; r < NUM_BATCH_RUN; r++) {
+		uint32_t size = sizeof(double) * NUM_COLUMN * batch_size[r];
+
+		for (int i = 0; i < NUM_COLUMN * MAX_BATCH_SIZE; i++) {
+			x1[r][i] = r * 100 + i;
+			x2[r][i] = i * 2;
+			y[r][i] = -1;
+		}
+
+		data[r].num_input_seg = 2;
+		data[r].input_seg = input_seg[r];
+		input_seg[r][0].addr = x1[r];
+		input_seg[r][0].size = size;
+		input_seg[r][1].addr = x2[r];
+		input_seg[r][1].size = size;
+
+		data[r].num_output_seg = 1;
+		data[r].output_seg = &output_seg[r];
+		output_seg[r].addr = y[r];
+		output_seg[r].size = size;
+	}
+
+	odp_ml_run_param_init(&run_param);
+
+	for (int i = 0; i < TIMEOUT * 1000 && num_started < NUM_BATCH_RUN; i++) {
+		odp_ml_compl_param_init(&compl_param);
+		compl_param.mode = ODP_ML_COMPL_MODE_POLL;
+		compl_param.compl_id = num_started;
+		compl_param.user_ptr = &y[num_started];
+		run_param.batch_size = batch_size[num_started];
+
+		ret = odp_ml_run_start(model, &data[num_started], &compl_param, &run_param);
+		CU_ASSERT(ret >= 0);
+		if (ret < 0)
+			break;
+
+		/* Request queue is full */
+		if (ret == 0) {
+			odp_time_wait_ns(wait_ns);
+			continue;
+		}
+
+		num_started++;
+	}
+
+	CU_ASSERT(num_started == NUM_BATCH_RUN);
+
+	for (int r = 0; r < num_started; r++) {
+		ret = 0;
+
+		for (int i = 0; i < TIMEOUT * 1000 && ret == 0; i++) {
+			memset(&result, 0, sizeof(result));
+			ret = odp_ml_run_status(model, r, &result);
+			if (ret == 0)
+				odp_time_wait_ns(wait_ns);
+		}
+
+		CU_ASSERT(ret == 1);
+		CU_ASSERT(!result.error_code);
+		CU_ASSERT(result.user_ptr == &y[r]);
+
+		for (uint32_t i = 0; i < NUM_COLUMN * MAX_BATCH_SIZE; i++) {
+			if (i < NUM_COLUMN * batch_size[r])
+				CU_ASSERT(y[r][i] == x1[r][i] + x2[r][i]);
+			else
+				CU_ASSERT(y[r][i] == -1);
+		}
+	}
+
+	CU_ASSERT_FATAL(odp_ml_model_unload(model, NULL) == 0);
+	CU_ASSERT(odp_ml_model_destroy(model) == 0);
+}
+
 static void test_ml_model_extra_stat_info(void)
 {
 	int ret;
@@ -1165,6 +1282,7 @@ odp_testinfo_t ml_suite[] = {
 	ODP_TEST_INFO_CONDITIONAL(test_ml_model_run_async_event, check_run_event),
 	ODP_TEST_INFO_CONDITIONAL(test_ml_model_run_async_poll, check_run_poll),
 	ODP_TEST_INFO_CONDITIONAL(test_ml_run_start_multi, check_run_poll_event),
+	ODP_TEST_INFO_CONDITIONAL(test_ml_run_start_batch, check_run_poll),
 	ODP_TEST_INFO_CONDITIONAL(test_ml_model_extra_stat_info, check_ml_support),
 	ODP_TEST_INFO_CONDITIONAL(test_ml_model_extra_stats, check_ml_support),
 	ODP_TEST_INFO_NULL
@@ -0,0 +1,12 @@
+#!/bin/sh
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2026 Nokia
+#
+
+# Run ML validation test with batch workers enabled. Test binary and config file
+# are found in the script directory.
+
+TEST_DIR=$(dirname $0)
+
+ODP_CONFIG_FILE=$TEST_DIR/ml_batch.conf $TEST_DIR/ml_linux${EXEEXT}
@@ -0,0 +1,425 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <odp_api.h>
+#include <odp/helper/odph_api.h>
+
+#include "odp_cunit_common.h"
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* These match pcapng.conf */
+#define RING_SIZE		4
+#define CAPTURE_PORT		5000
+
+#define OTHER_PORT		6000
+#define NUM_PKT			1024
+#define PKT_LEN_LONG		100
+/* Not a multiple of four, block is padded */
+#define PKT_LEN_SHORT		61
+#define PKT_LEN_ARP		60
+#define PAYLOAD_BYTE		0xa5
+#define MAX_CAPTURE		16
+#define WAIT_MS			2000
+
+#define BLOCK_TYPE_SHB		0x0A0D0D0A
+#define BLOCK_TYPE_IDB		0x00000001
+#define BLOCK_TYPE_EPB		0x00000006
+#define OPT_IF_TSRESOL		9
+#define OPT_IF_TSOFFSET		14
+#define EPB_HDR_LEN		28
+#define IDB_HDR_LEN		16
+
+/* Enhanced packet block as read from a capture file */
+typedef struct {
+	uint32_t len;
+	uint32_t cap_len;
+	uint32_t pkt_len;
+	uint64_t ts;
+	const uint8_t *data;
+	const uint8_t *pad;
+	uint32_t pad_len;
+} capture_t;
+
+typedef struct {
+	uint8_t *file;
+	int num;
+	int tsresol;
+	int64_t tsoffset;
+	capture_t cap[MAX_CAPTURE];
+} capture_file_t;
+
+static odp_pool_t pool;
+static odp_pktio_t pktio;
+static odp_pktin_queue_t pktin;
+static odp_pktout_queue_t pktout;
+static char file_name[128];
+
+static int pcapng_suite_init(void)
+{
+	odp_pool_param_t param;
+	odp_pktio_param_t pktio_param;
+
+	odp_pool_param_init(&param);
+	param.type = ODP_POOL_PACKET;
+	param.pkt.num = NUM_PKT;
+	param.pkt.len = PKT_LEN_LONG;
+
+	pool = odp_pool_create("pcapng_pool", &param);
+	if (pool == ODP_POOL_INVALID) {
+		ODPH_ERR("Pool create failed\n");
+		return -1;
+	}
+
+	odp_pktio_param_init(&pktio_param);
+	pktio_param.in_mode = ODP_PKTIN_MODE_DIRECT;
+	pktio_param.out_mode = ODP_PKTOUT_MODE_DIRECT;
+
+	pktio = odp_pktio_open("loop", pool, &pktio_param);
+	if (pktio == ODP_PKTIO_INVALID) {
+		ODPH_ERR("Pktio open failed\n");
+		return -1;
+	}
+
+	if (odp_pktin_queue_config(pktio, NULL) || odp_pktout_queue_config(pktio, NULL) ||
+	    odp_pktin_queue(pktio, &pktin, 1) != 1 || odp_pktout_queue(pktio, &pktout, 1) != 1) {
+		ODPH_ERR("Pktio queue config failed\n");
+		return -1;
+	}
+
+	/* Capture file of the first (and only) queue */
+	snprintf(file_name, sizeof(file_name), "%d-loop-flow-0-0.pcapng", (int)getpid());
+
+	return 0;
+}
+
+static int pcapng_suite_term(void)
+{
+	int ret = 0;
+
+	if (odp_pktio_close(pktio)) {
+		ODPH_ERR("Pktio close failed\n");
+		ret = -1;
+	}
+
+	if (odp_pool_destroy(pool)) {
+		ODPH_ERR("Pool destroy failed\n");
+		ret = -1;
+	}
+
+	if (ret == 0)
+		ret = odp_cunit_print_inactive();
+
+	return ret;
+}
+
+static odp_packet_t make_udp_tcp(uint8_t proto, uint16_t dst_port, uint32_t len)
+{
+	odp_packet_t pkt = odp_packet_alloc(pool, len);
+	odp_packet_parse_param_t param;
+	odph_ethhdr_t *eth;
+	odph_ipv4hdr_t *ip;
+	uint8_t *data;
+
+	CU_ASSERT_FATAL(pkt != ODP_PACKET_INVALID);
+	data = odp_packet_data(pkt);
+	memset(data, PAYLOAD_BYTE, len);
+
+	eth = (odph_ethhdr_t *)data;
+	memset(eth, 0, ODPH_ETHHDR_LEN);
+	eth->type = odp_cpu_to_be_16(ODPH_ETHTYPE_IPV4);
+
+	ip = (odph_ipv4hdr_t *)(data + ODPH_ETHHDR_LEN);
+	memset(ip, 0, ODPH_IPV4HDR_LEN);
+	ip->ver_ihl = ODPH_IPV4 << 4 | ODPH_IPV4HDR_IHL_MIN;
+	ip->tot_len = odp_cpu_to_be_16(len - ODPH_ETHHDR_LEN);
+	ip->ttl = 64;
+	ip->proto = proto;
+	ip->src_addr = odp_cpu_to_be_32(0x0a000001);
+	ip->dst_addr = odp_cpu_to_be_32(0x0a000002);
+
+	if (proto == ODPH_IPPROTO_UDP) {
+		odph_udphdr_t *udp = (odph_udphdr_t *)(ip + 1);
+
+		udp->src_port = odp_cpu_to_be_16(OTHER_PORT + 1);
+		udp->dst_port = odp_cpu_to_be_16(dst_port);
+		udp->length = odp_cpu_to_be_16(len - ODPH_ETHHDR_LEN - ODPH_IPV4HDR_LEN);
+		udp->chksum = 0;
+	} else {
+		odph_tcphdr_t *tcp = (odph_tcphdr_t *)(ip + 1);
+
+		memset(tcp, 0, ODPH_TCPHDR_LEN);
+		tcp->src_port = odp_cpu_to_be_16(OTHER_PORT + 1);
+		tcp->dst_port = odp_cpu_to_be_16(dst_port);
+		tcp->hl = ODPH_TCPHDR_LEN / 4;
+	}
+
+	odph_ipv4_csum_update(pkt);
+
+	/* Capture filter uses packet parse results */
+	memset(&param, 0, sizeof(param));
+	param.proto = ODP_PROTO_ETH;
+	param.last_layer = ODP_PROTO_LAYER_L4;
+	CU_ASSERT_FATAL(odp_packet_parse(pkt, 0, &param) == 0);
+
+	return pkt;
+}
+
+static odp_packet_t make_arp(void)
+{
+	odp_packet_t pkt = odp_packet_alloc(pool, PKT_LEN_ARP);
+	odp_packet_parse_param_t param;
+	odph_ethhdr_t *eth;
+	uint8_t *data;
+
+	CU_ASSERT_FATAL(pkt != ODP_PACKET_INVALID);
+	data = odp_packet_data(pkt);
+	memset(data, PAYLOAD_BYTE, PKT_LEN_ARP);
+
+	eth = (odph_ethhdr_t *)data;
+	memset(eth->dst.addr, 0xff, ODPH_ETHADDR_LEN);
+	eth->type = odp_cpu_to_be_16(ODPH_ETHTYPE_ARP);
+
+	memset(&param, 0, sizeof(param));
+	param.proto = ODP_PROTO_ETH;
+	param.last_layer = ODP_PROTO_LAYER_L4;
+	CU_ASSERT_FATAL(odp_packet_parse(pkt, 0, &param) == 0);
+
+	return pkt;
+}
+
+/* Read the capture file, returns number of enhanced packet blocks */
+static int capture_file_read(capture_file_t *cf)
+{
+	FILE *f;
+	long size;
+	uint32_t off = 0;
+
+	free(cf->file);
+	memset(cf, 0, sizeof(*cf));
+	cf->tsresol = -1;
+
+	f = fopen(file_name, "rb");
+	if (f == NULL)
+		return 0;
+
+	if (fseek(f, 0, SEEK_END)) {
+		fclose(f);
+		return 0;
+	}
+
+	size = ftell(f);
+	if (size <= 0 || fseek(f, 0, SEEK_SET)) {
+		fclose(f);
+		return 0;
+	}
+
+	cf->file = malloc(size);
+	if (cf->file == NULL || fread(cf->file, 1, size, f) != (size_t)size) {
+		fclose(f);
+		return 0;
+	}
+	fclose(f);
+
+	/* Writes are not atomic in file mode, stop at a partially written block */
+	while (off + 8 <= (uint32_t)size) {
+		const uint8_t *blk = cf->file + off;
+		uint32_t type, len, len2;
+
+		memcpy(&type, blk, 4);
+		memcpy(&len, blk + 4, 4);
+
+		if (len < 12 || len % 4 || off + len > (uint32_t)size)
+			break;
+
+		memcpy(&len2, blk + len - 4, 4);
+		CU_ASSERT(len == len2);
+
+		if (type == BLOCK_TYPE_IDB) {
+			uint32_t opt = off + IDB_HDR_LEN;
+
+			/* Options until opt_endofopt */
+			while (opt + 4 <= off + len - 4) {
+				uint16_t code, opt_len;
+
+				memcpy(&code, cf->file + opt, 2);
+				memcpy(&opt_len, cf->file + opt + 2, 2);
+				if (code == 0)
+					break;
+
+				if (code == OPT_IF_TSRESOL)
+					cf->tsresol = cf->file[opt + 4];
+				else if (code == OPT_IF_TSOFFSET)
+					memcpy(&cf->tsoffset, cf->file + opt + 4, sizeof(int64_t));
+
+				opt += 4 + ((opt_len + 3) & ~3u);
+			}
+		} else if (type == BLOCK_TYPE_EPB && cf->num < MAX_CAPTURE) {
+			capture_t *cap = &cf->cap[cf->num++];
+			uint32_t ts_high, ts_low;
+
+			memcpy(&ts_high, blk + 12, 4);
+			memcpy(&ts_low, blk + 16, 4);
+			memcpy(&cap->cap_len, blk + 20, 4);
+			memcpy(&cap->pkt_len, blk + 24, 4);
+			cap->len = len;
+			cap->ts = ((uint64_t)ts_high << 32) | ts_low;
+			cap->data = blk + EPB_HDR_LEN;
+			cap->pad = cap->data + cap->cap_len;
+			cap->pad_len = len - EPB_HDR_LEN - 4 - cap->cap_len;
+		} else {
+			CU_ASSERT(type == BLOCK_TYPE_SHB || type == BLOCK_TYPE_EPB);
+		}
+
+		off += len;
+	}
+
+	return cf->num;
+}
+
+/* Wait until the writer thread has written 'num' packets into the capture file */
+static int capture_wait(capture_file_t *cf, int num)
+{
+	for (int i = 0; i < WAIT_MS; i++) {
+		if (capture_file_read(cf) >= num)
+			return cf->num;
+
+		odp_time_wait_ns(ODP_TIME_MSEC_IN_NS);
+	}
+
+	return cf->num;
+}
+
+/* Send a packet and receive it back, both directions are captured */
+static void send_recv(odp_packet_t pkt, uint8_t *copy, uint32_t *len)
+{
+	odp_packet_t rx_pkt = ODP_PACKET_INVALID;
+
+	*len = odp_packet_len(pkt);
+	CU_ASSERT_FATAL(odp_packet_copy_to_mem(pkt, 0, *len, copy) == 0);
+	CU_ASSERT_FATAL(odp_pktout_send(pktout, &pkt, 1) == 1);
+
+	for (int i = 0; i < WAIT_MS && rx_pkt == ODP_PACKET_INVALID; i++) {
+		if (odp_pktin_recv(pktin, &rx_pkt, 1) != 1)
+			odp_time_wait_ns(ODP_TIME_MSEC_IN_NS);
+	}
+
+	CU_ASSERT_FATAL(rx_pkt != ODP_PACKET_INVALID);
+	CU_ASSERT(odp_packet_len(rx_pkt) == *len);
+	odp_packet_free(rx_pkt);
+}
+
+static void check_capture(const capture_t *cap, const uint8_t *data, uint32_t len,
+			  int64_t tsoffset, uint64_t wall_ns)
+{
+	uint64_t ts_ns;
+
+	CU_ASSERT(cap->pkt_len == len);
+	CU_ASSERT(cap->cap_len == len);
+	CU_ASSERT(cap->len == EPB_HDR_LEN + ((len + 3) & ~3u) + 4);
+	CU_ASSERT(memcmp(cap->data, data, len) == 0);
+
+	/* Padding is zero, also when the capture slot held a longer packet earlier */
+	for (uint32_t i = 0; i < cap->pad_len; i++)
+		CU_ASSERT(cap->pad[i] == 0);
+
+	/* Timestamp with if_tsoffset added is wall clock time */
+	ts_ns = cap->ts + tsoffset * ODP_TIME_SEC_IN_NS;
+	CU_ASSERT(ts_ns > wall_ns - ODP_TIME_SEC_IN_NS && ts_ns < wall_ns + ODP_TIME_SEC_IN_NS);
+}
+
+static uint64_t wall_time_ns(void)
+{
+	struct timespec ts;
+
+	CU_ASSERT(clock_gettime(CLOCK_REALTIME, &ts) == 0);
+
+	return (uint64_t)ts.tv_sec * ODP_TIME_SEC_IN_NS + ts.tv_nsec;
+}
+
+static void pcapng_test_capture(void)
+{
+	capture_file_t cf;
+	uint8_t data[4][PKT_LEN_LONG];
+	uint32_t len[4];
+	uint64_t wall_ns;
+	uint32_t other_len;
+	uint8_t other[PKT_LEN_LONG];
+	int num;
+
+	memset(&cf, 0, sizeof(cf));
+
+	CU_ASSERT_FATAL(odp_pktio_start(pktio) == 0);
+	wall_ns = wall_time_ns();
+
+	/* Fill all capture slots with payload bytes. Each packet is captured on output and
+	 * input. */
+	for (int i = 0; i < RING_SIZE / 2; i++) {
+		send_recv(make_udp_tcp(ODPH_IPPROTO_UDP, CAPTURE_PORT, PKT_LEN_LONG), data[i],
+			  &len[i]);
+		CU_ASSERT_FATAL(capture_wait(&cf, 2 * (i + 1)) == 2 * (i + 1));
+	}
+
+	/* Not captured: UDP to another port, and TCP to the capture port */
+	send_recv(make_udp_tcp(ODPH_IPPROTO_UDP, OTHER_PORT, PKT_LEN_LONG), other, &other_len);
+	send_recv(make_udp_tcp(ODPH_IPPROTO_TCP, CAPTURE_PORT, PKT_LEN_LONG), other, &other_len);
+
+	/* Captured by the second filter alternative */
+	send_recv(make_arp(), data[2], &len[2]);
+	CU_ASSERT_FATAL(capture_wait(&cf, 6) == 6);
+
+	/* Reuses a slot of a longer packet */
+	send_recv(make_udp_tcp(ODPH_IPPROTO_UDP, CAPTURE_PORT, PKT_LEN_SHORT), data[3], &len[3]);
+	capture_wait(&cf, 8);
+
+	/* Give time for any filtered packets to be written */
+	odp_time_wait_ns(10 * ODP_TIME_MSEC_IN_NS);
+	num = capture_file_read(&cf);
+
+	CU_ASSERT(odp_pktio_stop(pktio) == 0);
+
+	CU_ASSERT(num == 8);
+	CU_ASSERT(cf.tsresol == 9);
+
+	for (int i = 0; i < num && i < 8; i++)
+		check_capture(&cf.cap[i], data[i / 2], len[i / 2], cf.tsoffset, wall_ns);
+
+	free(cf.file);
+}
+
+odp_testinfo_t pcapng_suite[] = {
+	ODP_TEST_INFO(pcapng_test_capture),
+	ODP_TEST_INFO_NULL
+};
+
+odp_suiteinfo_t pcapng_suites[] = {
+	{"pcapng", pcapng_suite_init, pcapng_suite_term, pcapng_suite},
+	ODP_SUITE_INFO_NULL
+};
+
+int main(int argc, char *argv[])
+{
+	int ret;
+
+	/* parse common options: */
+	if (odp_cunit_parse_options(&argc, argv))
+		return -1;
+
+	ret = odp_cunit_register(pcapng_suites);
+
+	if (ret == 0)
+		ret = odp_cunit_run();
+
+	return ret;
+}
@@ -0,0 +1,21 @@
+#!/bin/sh
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2026 Nokia
+#
+
+# Run pcapng test with the config file that enables capture into files. Test
+# binary and config file are found in the script directory. Capture files are
+# written into a temporary directory, which is removed afterwards.
+
+TEST_DIR=$(cd $(dirname $0) && pwd)
+CAPTURE_DIR=$(mktemp -d)
+
+cd $CAPTURE_DIR
+ODP_CONFIG_FILE=$TEST_DIR/pcapng.conf $TEST_DIR/pcapng_linux${EXEEXT}
+ret=$?
+cd - > /dev/null
+
+rm -rf $CAPTURE_DIR
+
+exit $ret
@@ -79,6 +79,11 @@ int bench_run(void *arg)
 
 		desc = bench->desc != NULL ? bench->desc : bench->name;
 
+		if (bench->cond != NULL && !bench->cond()) {
+			printf("[%02d] odp_%-30s: %12s\n", i + 1, desc, "n/a");
+			continue;
+		}
+
 		/* The zeroeth round is a warmup round that will be ignored */
 		for (uint64_t round = 0; round <= max_rounds; round++)  {
 			if (bench->init != NULL)
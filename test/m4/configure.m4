@@ -33,15 +33,18 @@ AC_CONFIG_FILES([test/common/Makefile
 		 test/validation/api/errno/Makefile
 		 test/validation/api/event/Makefile
 		 test/validation/api/hash/Makefile
+		 test/validation/api/hashtable/Makefile
 		 test/validation/api/hints/Makefile
 		 test/validation/api/init/Makefile
 		 test/validation/api/ipsec/Makefile
 		 test/validation/api/lock/Makefile
+		 test/validation/api/lpm/Makefile
 		 test/validation/api/Makefile
 		 test/validation/api/ml/Makefile
 		 test/validation/api/packet/Makefile
 		 test/validation/api/pktio/Makefile
 		 test/validation/api/pool/Makefile
+		 test/validation/api/qsbr/Makefile
 		 test/validation/api/queue/Makefile
 		 test/validation/api/random/Makefile
 		 test/validation/api/scheduler/Makefile
@@ -67,6 +67,12 @@
 
 #define TEST_MAX_SIZES 7
 
+/** LSO test header length (Ethernet + IPv4) */
+#define TEST_LSO_HDR_LEN (ODPH_ETHHDR_LEN + ODPH_IPV4HDR_LEN)
+
+/** LSO test maximum payload length */
+#define TEST_LSO_PAYLOAD_LEN 256
+
 /** Get rid of path in filename - only for unix-type paths using '/' */
 #define NO_PATH(file_name) (strrchr((file_name), '/') ? \
 			    strrchr((file_name), '/') + 1 : (file_name))
@@ -74,6 +80,10 @@
 #define BENCH_INFO(run_fn, init_fn, term_fn, alt_name) \
 	{.name = #run_fn, .run = run_fn, .init = init_fn, .term = term_fn, .desc = alt_name}
 
+#define BENCH_INFO_COND(run_fn, init_fn, term_fn, alt_name, cond_fn) \
+	{.name = #run_fn, .run = run_fn, .init = init_fn, .term = term_fn, .desc = alt_name, \
+	 .cond = cond_fn}
+
 ODP_STATIC_ASSERT((TEST_ALIGN_OFFSET + TEST_ALIGN_LEN) <= TEST_MIN_PKT_SIZE,
 		  "Invalid_alignment");
 
@@ -111,6 +121,12 @@ typedef struct {
 	odp_pool_t pool_tmo;
 	/** Event vector pool */
 	odp_pool_t pool_evv;
+	/** Null pktio for LSO tests */
+	odp_pktio_t pktio;
+	/** Pktout queue of the null pktio */
+	odp_pktout_queue_t pktout;
+	/** LSO profile */
+	odp_lso_profile_t lso_profile;
 	struct {
 		/** Test packet length */
 		uint32_t len;
@@ -366,6 +382,21 @@ static void alloc_parse_packets(const void *pkt_data, uint32_t len)
 	}
 }
 
+static void alloc_lso_packets(void)
+{
+	int i;
+
+	allocate_test_packets(gbl_args->pkt.len, gbl_args->pkt_tbl, TEST_REPEAT_COUNT);
+
+	for (i = 0; i < TEST_REPEAT_COUNT; i++) {
+		if (odp_packet_copy_from_mem(gbl_args->pkt_tbl[i], 0, TEST_LSO_HDR_LEN,
+					     test_packet_ipv4_udp))
+			ODPH_ABORT("Copying test packet failed\n");
+
+		odp_packet_l3_offset_set(gbl_args->pkt_tbl[i], ODPH_ETHHDR_LEN);
+	}
+}
+
 static void alloc_parse_packets_ipv4_tcp(void)
 {
 	alloc_parse_packets(test_packet_ipv4_tcp, sizeof(test_packet_ipv4_tcp));
@@ -1628,6 +1659,29 @@ static int packet_ref_pkt(void)
 	return i;
 }
 
+static int pktout_send_lso(void)
+{
+	int i;
+	odp_packet_lso_opt_t lso_opt;
+	odp_packet_t *pkt_tbl = gbl_args->pkt_tbl;
+
+	lso_opt.lso_profile = gbl_args->lso_profile;
+	lso_opt.payload_offset = TEST_LSO_HDR_LEN;
+	lso_opt.max_payload_len = TEST_LSO_PAYLOAD_LEN;
+
+	for (i = 0; i < TEST_REPEAT_COUNT; i++) {
+		if (odp_pktout_send_lso(gbl_args->pktout, &pkt_tbl[i], 1, &lso_opt) != 1)
+			return 0;
+	}
+
+	return i;
+}
+
+static int check_lso(void)
+{
+	return gbl_args->lso_profile != ODP_LSO_PROFILE_INVALID;
+}
+
 static int packet_has_ref(void)
 {
 	int i;
@@ -1967,6 +2021,7 @@ bench_info_t test_suite[] = {
 	BENCH_INFO(packet_ref_pkt, alloc_packets_twice, free_packets_twice, NULL),
 	BENCH_INFO(packet_has_ref, alloc_ref_packets, free_packets_twice, NULL),
 	BENCH_INFO(packet_is_referencing, alloc_ref_packets, free_packets_twice, NULL),
+	BENCH_INFO_COND(pktout_send_lso, alloc_lso_packets, NULL, NULL, check_lso),
 	BENCH_INFO(packet_subtype, create_packets, free_packets, NULL),
 	BENCH_INFO(event_subtype, create_events, free_packets, NULL),
 	BENCH_INFO(packet_parse, alloc_parse_packets_ipv4_tcp, free_packets,
@@ -2043,6 +2098,79 @@ static odp_pool_t create_evv_pool(const odp_pool_capability_t *capa)
 	return create_pool("evv", &param);
 }
 
+/* Open a null pktio for LSO tests. LSO tests are skipped when not supported. */
+static void create_lso_pktio(void)
+{
+	odp_pktio_param_t pktio_param;
+	odp_pktio_capability_t pktio_capa;
+	odp_pktio_config_t pktio_config;
+	odp_lso_profile_param_t lso_param;
+
+	gbl_args->pktio = ODP_PKTIO_INVALID;
+	gbl_args->lso_profile = ODP_LSO_PROFILE_INVALID;
+
+	odp_pktio_param_init(&pktio_param);
+	pktio_param.in_mode = ODP_PKTIN_MODE_DISABLED;
+	pktio_param.out_mode = ODP_PKTOUT_MODE_DIRECT;
+
+	gbl_args->pktio = odp_pktio_open("null:0", gbl_args->pool, &pktio_param);
+	if (gbl_args->pktio == ODP_PKTIO_INVALID) {
+		printf("Note: null pktio not available, LSO tests skipped\n");
+		return;
+	}
+
+	if (odp_pktio_capability(gbl_args->pktio, &pktio_capa) ||
+	    pktio_capa.lso.max_profiles == 0 || !pktio_capa.lso.proto.ipv4 ||
+	    pktio_capa.lso.max_payload_len < TEST_LSO_PAYLOAD_LEN ||
+	    pktio_capa.lso.max_payload_offset < TEST_LSO_HDR_LEN ||
+	    pktio_capa.lso.max_segments < TEST_MAX_PKT_SIZE / TEST_LSO_PAYLOAD_LEN) {
+		printf("Note: LSO not supported, LSO tests skipped\n");
+		return;
+	}
+
+	odp_pktio_config_init(&pktio_config);
+	pktio_config.enable_lso = 1;
+
+	if (odp_pktio_config(gbl_args->pktio, &pktio_config) ||
+	    odp_pktout_queue_config(gbl_args->pktio, NULL) ||
+	    odp_pktout_queue(gbl_args->pktio, &gbl_args->pktout, 1) != 1) {
+		ODPH_ERR("Error: pktio configuration failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	odp_lso_profile_param_init(&lso_param);
+	lso_param.lso_proto = ODP_LSO_PROTO_IPV4;
+
+	gbl_args->lso_profile = odp_lso_profile_create(gbl_args->pktio, &lso_param);
+	if (gbl_args->lso_profile == ODP_LSO_PROFILE_INVALID) {
+		ODPH_ERR("Error: LSO profile create failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_pktio_start(gbl_args->pktio)) {
+		ODPH_ERR("Error: pktio start failed\n");
+		exit(EXIT_FAILURE);
+	}
+}
+
+static void destroy_lso_pktio(void)
+{
+	if (gbl_args->pktio == ODP_PKTIO_INVALID)
+		return;
+
+	if (gbl_args->lso_profile != ODP_LSO_PROFILE_INVALID &&
+	    (odp_pktio_stop(gbl_args->pktio) ||
+	     odp_lso_profile_destroy(gbl_args->lso_profile))) {
+		ODPH_ERR("Error: LSO pktio stop failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_pktio_close(gbl_args->pktio)) {
+		ODPH_ERR("Error: pktio close failed\n");
+		exit(EXIT_FAILURE);
+	}
+}
+
 /**
  * ODP packet microbenchmark application
  */
@@ -2193,6 +2321,7 @@ int main(int argc, char *argv[])
 	gbl_args->pool_buf = create_buffer_pool(&capa);
 	gbl_args->pool_tmo = create_timeout_pool(&capa);
 	gbl_args->pool_evv = create_evv_pool(&capa);
+	create_lso_pktio();
 
 	printf("CPU:               %i\n", odp_cpumask_first(&cpumask));
 	printf("CPU mask:          %s\n", cpumaskstr);
@@ -2235,6 +2364,8 @@ int main(int argc, char *argv[])
 
 	ret = gbl_args->suite.retval;
 
+	destroy_lso_pktio();
+
 	if (odp_pool_destroy(gbl_args->pool) ||
 	    odp_pool_destroy(gbl_args->pool_buf) ||
 	    odp_pool_destroy(gbl_args->pool_tmo) ||
@@ -0,0 +1,588 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @example odp_hashtable_perf.c
+ *
+ * Performance test application for hash table APIs
+ *
+ * @cond _ODP_HIDE_FROM_DOXYGEN_
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <getopt.h>
+
+#include <odp_api.h>
+#include <odp/helper/odph_api.h>
+
+#include <export_results.h>
+
+#define MAX_KEY_SIZE   64
+#define MAX_VALUE_SIZE 64
+#define MAX_BURST      64
+
+typedef struct test_options_t {
+	uint32_t num_entry;
+	uint32_t key_size;
+	uint32_t value_size;
+	uint32_t max_burst;
+	uint32_t num_round;
+	uint32_t update_pct;
+	uint32_t miss_pct;
+	int num_cpu;
+
+} test_options_t;
+
+typedef struct test_stat_t {
+	uint64_t rounds;
+	uint64_t lookups;
+	uint64_t hits;
+	uint64_t updates;
+	uint64_t nsec;
+	uint64_t cycles;
+
+} test_stat_t;
+
+typedef struct test_global_t {
+	odp_barrier_t barrier;
+	test_options_t options;
+	odp_instance_t instance;
+	odp_hashtable_t ht;
+	odph_thread_t thread_tbl[ODP_THREAD_COUNT_MAX];
+	test_stat_t stat[ODP_THREAD_COUNT_MAX];
+	test_common_options_t common_options;
+
+} test_global_t;
+
+static void print_usage(void)
+{
+	printf("\n"
+	       "Hash table performance test\n"
+	       "\n"
+	       "Usage: odp_hashtable_perf [options]\n"
+	       "\n"
+	       "  -c, --num_cpu <num>     Number of worker threads. Default: 1\n"
+	       "  -n, --num_entry <num>   Number of entries in the table. Default: 65536\n"
+	       "  -k, --key_size <num>    Key size in bytes (4 - %u). Default: 16\n"
+	       "  -v, --value_size <num>  Value size in bytes (0 - %u). Default: 8\n"
+	       "  -b, --burst_size <num>  Number of keys per lookup call. When > 1,\n"
+	       "                          odp_hashtable_get_multi() is used. Default: 1\n"
+	       "  -u, --update <pct>      Percentage of rounds that update a value instead\n"
+	       "                          of looking up. Default: 0\n"
+	       "  -m, --miss <pct>        Percentage of lookups for keys not in the table.\n"
+	       "                          Default: 0\n"
+	       "  -r, --num_round <num>   Number of rounds. Default: 100000\n"
+	       "  -h, --help              This help\n"
+	       "\n", MAX_KEY_SIZE, MAX_VALUE_SIZE);
+}
+
+static int parse_options(int argc, char *argv[], test_options_t *test_options)
+{
+	int opt;
+	int ret = 0;
+
+	static const struct option longopts[] = {
+		{ "num_cpu", required_argument, NULL, 'c' },
+		{ "num_entry", required_argument, NULL, 'n' },
+		{ "key_size", required_argument, NULL, 'k' },
+		{ "value_size", required_argument, NULL, 'v' },
+		{ "burst_size", required_argument, NULL, 'b' },
+		{ "update", required_argument, NULL, 'u' },
+		{ "miss", required_argument, NULL, 'm' },
+		{ "num_round", required_argument, NULL, 'r' },
+		{ "help", no_argument, NULL, 'h' },
+		{ NULL, 0, NULL, 0 }
+	};
+
+	static const char *shortopts = "+c:n:k:v:b:u:m:r:h";
+
+	test_options->num_cpu = 1;
+	test_options->num_entry = 65536;
+	test_options->key_size = 16;
+	test_options->value_size = 8;
+	test_options->max_burst = 1;
+	test_options->update_pct = 0;
+	test_options->miss_pct = 0;
+	test_options->num_round = 100000;
+
+	while (1) {
+		opt = getopt_long(argc, argv, shortopts, longopts, NULL);
+
+		if (opt == -1)
+			break;
+
+		switch (opt) {
+		case 'c':
+			test_options->num_cpu = atoi(optarg);
+			break;
+		case 'n':
+			test_options->num_entry = atoi(optarg);
+			break;
+		case 'k':
+			test_options->key_size = atoi(optarg);
+			break;
+		case 'v':
+			test_options->value_size = atoi(optarg);
+			break;
+		case 'b':
+			test_options->max_burst = atoi(optarg);
+			break;
+		case 'u':
+			test_options->update_pct = atoi(optarg);
+			break;
+		case 'm':
+			test_options->miss_pct = atoi(optarg);
+			break;
+		case 'r':
+			test_options->num_round = atoi(optarg);
+			break;
+		case 'h':
+			/* fall through */
+		default:
+			print_usage();
+			ret = -1;
+			break;
+		}
+	}
+
+	if (test_options->key_size < sizeof(uint32_t) ||
+	    test_options->key_size > MAX_KEY_SIZE) {
+		ODPH_ERR("Bad key size %u\n", test_options->key_size);
+		return -1;
+	}
+
+	if (test_options->value_size > MAX_VALUE_SIZE) {
+		ODPH_ERR("Bad value size %u\n", test_options->value_size);
+		return -1;
+	}
+
+	if (test_options->max_burst == 0 || test_options->max_burst > MAX_BURST) {
+		ODPH_ERR("Bad burst size %u. Test maximum %u.\n",
+			 test_options->max_burst, MAX_BURST);
+		return -1;
+	}
+
+	if (test_options->num_entry == 0 || test_options->update_pct > 100 ||
+	    test_options->miss_pct > 100) {
+		ODPH_ERR("Bad options\n");
+		return -1;
+	}
+
+	return ret;
+}
+
+/* Keys 0 ... num_entry - 1 are stored, keys above that are misses */
+static inline void make_key(uint8_t *key, uint32_t key_size, uint32_t i)
+{
+	memset(key, 0, key_size);
+	memcpy(key, &i, sizeof(uint32_t));
+	key[key_size - 1] = 0xa5;
+}
+
+static int create_table(test_global_t *global)
+{
+	test_options_t *test_options = &global->options;
+	odp_hashtable_capability_t capa;
+	odp_hashtable_param_t param;
+	uint8_t key[MAX_KEY_SIZE];
+	uint64_t value[MAX_VALUE_SIZE / sizeof(uint64_t)];
+	odp_time_t t1, t2;
+	uint32_t i;
+
+	printf("\nHash table performance test\n");
+	printf("  num rounds           %u\n", test_options->num_round);
+	printf("  num entries          %u\n", test_options->num_entry);
+	printf("  key size             %u\n", test_options->key_size);
+	printf("  value size           %u\n", test_options->value_size);
+	printf("  max burst size       %u\n", test_options->max_burst);
+	printf("  update percentage    %u\n", test_options->update_pct);
+	printf("  miss percentage      %u\n", test_options->miss_pct);
+
+	if (odp_hashtable_capability(&capa)) {
+		ODPH_ERR("Hash table capability failed\n");
+		return -1;
+	}
+
+	if (test_options->num_entry > capa.max_num ||
+	    test_options->key_size > capa.max_key_size ||
+	    test_options->value_size > capa.max_value_size ||
+	    test_options->max_burst > capa.max_get_multi) {
+		ODPH_ERR("Not supported. Capability: max_num %u, max_key_size %u, "
+			 "max_value_size %u, max_get_multi %u\n", capa.max_num,
+			 capa.max_key_size, capa.max_value_size, capa.max_get_multi);
+		return -1;
+	}
+
+	odp_hashtable_param_init(&param);
+	param.num = test_options->num_entry;
+	param.key_size = test_options->key_size;
+	param.value_size = test_options->value_size;
+
+	global->ht = odp_hashtable_create("hashtable_perf", &param);
+	if (global->ht == ODP_HASHTABLE_INVALID) {
+		ODPH_ERR("Hash table create failed\n");
+		return -1;
+	}
+
+	memset(value, 0, sizeof(value));
+	t1 = odp_time_local();
+
+	for (i = 0; i < test_options->num_entry; i++) {
+		make_key(key, test_options->key_size, i);
+		value[0] = i;
+
+		if (odp_hashtable_put(global->ht, key, value)) {
+			ODPH_ERR("Hash table put failed (%u)\n", i);
+			return -1;
+		}
+	}
+
+	t2 = odp_time_local();
+
+	printf("  insert rate          %.3f M/s\n",
+	       (1000.0 * test_options->num_entry) / odp_time_diff_ns(t2, t1));
+
+	return 0;
+}
+
+static int run_test(void *arg)
+{
+	uint64_t c1, c2;
+	odp_time_t t1, t2;
+	uint32_t rounds, i;
+	int ret;
+	test_global_t *global = arg;
+	test_options_t *test_options = &global->options;
+	odp_hashtable_t ht = global->ht;
+	uint32_t key_size = test_options->key_size;
+	uint32_t num_entry = test_options->num_entry;
+	uint32_t num_round = test_options->num_round;
+	uint32_t burst = test_options->max_burst;
+	uint32_t update_pct = test_options->update_pct;
+	uint32_t miss_pct = test_options->miss_pct;
+	int thr = odp_thread_id();
+	test_stat_t *stat = &global->stat[thr];
+	uint64_t lookups = 0, hits = 0, updates = 0;
+	uint64_t seed = 0x9e3779b97f4a7c15ULL * (thr + 1);
+	uint8_t key[MAX_BURST][MAX_KEY_SIZE];
+	uint64_t value[MAX_BURST][MAX_VALUE_SIZE / sizeof(uint64_t)];
+	const void *key_ptr[MAX_BURST];
+	void *value_ptr[MAX_BURST];
+	uint8_t found[MAX_BURST];
+
+	for (i = 0; i < burst; i++) {
+		key_ptr[i] = key[i];
+		value_ptr[i] = value[i];
+	}
+
+	/* Start all workers at the same time */
+	odp_barrier_wait(&global->barrier);
+
+	t1 = odp_time_local();
+	c1 = odp_cpu_cycles();
+
+	for (rounds = 0; rounds < num_round; rounds++) {
+		/* xorshift64 */
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+
+		if (update_pct && (seed % 100) < update_pct) {
+			make_key(key[0], key_size, (seed >> 8) % num_entry);
+			value[0][0] = seed;
+
+			if (odp_hashtable_put(ht, key[0], value[0])) {
+				ODPH_ERR("Hash table put failed\n");
+				return -1;
+			}
+
+			updates++;
+			continue;
+		}
+
+		for (i = 0; i < burst; i++) {
+			uint32_t idx = ((seed >> 8) + i * 7919) % num_entry;
+
+			if (miss_pct && ((seed >> 32) + i) % 100 < miss_pct)
+				idx += num_entry;
+
+			make_key(key[i], key_size, idx);
+		}
+
+		if (burst == 1) {
+			ret = odp_hashtable_get(ht, key[0], value[0]);
+		} else {
+			ret = odp_hashtable_get_multi(ht, key_ptr, value_ptr, found,
+						      burst);
+		}
+
+		if (ret < 0) {
+			ODPH_ERR("Hash table get failed\n");
+			return -1;
+		}
+
+		lookups += burst;
+		hits += ret;
+	}
+
+	c2 = odp_cpu_cycles();
+	t2 = odp_time_local();
+
+	stat->rounds = rounds;
+	stat->lookups = lookups;
+	stat->hits = hits;
+	stat->updates = updates;
+	stat->nsec = odp_time_diff_ns(t2, t1);
+	stat->cycles = odp_cpu_cycles_diff(c2, c1);
+
+	return 0;
+}
+
+static int start_workers(test_global_t *global)
+{
+	odph_thread_common_param_t thr_common;
+	odph_thread_param_t thr_param;
+	odp_cpumask_t cpumask;
+	int ret;
+	test_options_t *test_options = &global->options;
+	int num_cpu = test_options->num_cpu;
+
+	ret = odp_cpumask_default_worker(&cpumask, num_cpu);
+
+	if (num_cpu && ret != num_cpu) {
+		ODPH_ERR("Error: Too many workers. Max supported %i\n.", ret);
+		return -1;
+	}
+
+	/* Zero: all available workers */
+	if (num_cpu == 0) {
+		num_cpu = ret;
+		test_options->num_cpu = num_cpu;
+	}
+
+	printf("  num workers          %u\n\n", num_cpu);
+
+	odp_barrier_init(&global->barrier, num_cpu);
+
+	odph_thread_common_param_init(&thr_common);
+	thr_common.instance = global->instance;
+	thr_common.cpumask = &cpumask;
+	thr_common.share_param = 1;
+
+	odph_thread_param_init(&thr_param);
+	thr_param.start = run_test;
+	thr_param.arg = global;
+	thr_param.thr_type = ODP_THREAD_WORKER;
+
+	if (odph_thread_create(global->thread_tbl, &thr_common, &thr_param,
+			       num_cpu) != num_cpu)
+		return -1;
+
+	return 0;
+}
+
+static int output_results(test_global_t *global)
+{
+	int i, num;
+	double nsec_ave, cycles_ave, ops_ave;
+	test_options_t *test_options = &global->options;
+	int num_cpu = test_options->num_cpu;
+	uint64_t rounds_sum = 0;
+	uint64_t lookup_sum = 0;
+	uint64_t hit_sum = 0;
+	uint64_t update_sum = 0;
+	uint64_t nsec_sum = 0;
+	uint64_t cycles_sum = 0;
+
+	for (i = 0; i < ODP_THREAD_COUNT_MAX; i++) {
+		rounds_sum += global->stat[i].rounds;
+		lookup_sum += global->stat[i].lookups;
+		hit_sum += global->stat[i].hits;
+		update_sum += global->stat[i].updates;
+		nsec_sum += global->stat[i].nsec;
+		cycles_sum += global->stat[i].cycles;
+	}
+
+	if (rounds_sum == 0 || nsec_sum == 0) {
+		printf("No results.\n");
+		return 0;
+	}
+
+	nsec_ave = nsec_sum / num_cpu;
+	cycles_ave = cycles_sum / num_cpu;
+	ops_ave = (lookup_sum + update_sum) / num_cpu;
+	num = 0;
+
+	printf("RESULTS - per thread (Million ops per sec):\n");
+	printf("----------------------------------------------\n");
+	printf("        1      2      3      4      5      6      7      8      9     10");
+
+	for (i = 0; i < ODP_THREAD_COUNT_MAX; i++) {
+		if (global->stat[i].rounds) {
+			if ((num % 10) == 0)
+				printf("\n   ");
+
+			printf("%6.1f ", (1000.0 * (global->stat[i].lookups +
+						    global->stat[i].updates)) /
+			       global->stat[i].nsec);
+			num++;
+		}
+	}
+	printf("\n\n");
+
+	printf("RESULTS - per thread average (%i threads):\n", num_cpu);
+	printf("------------------------------------------\n");
+	printf("  duration:                 %.3f msec\n", nsec_ave / 1000000);
+	printf("  num cycles:               %.3f M\n", cycles_ave / 1000000);
+	printf("  cycles per op:            %.3f\n", cycles_ave / ops_ave);
+	printf("  lookups:                  %" PRIu64 "\n", lookup_sum / num_cpu);
+	printf("  hit ratio:                %.3f %%\n",
+	       lookup_sum ? (100.0 * hit_sum) / lookup_sum : 0.0);
+	printf("  updates:                  %" PRIu64 "\n", update_sum / num_cpu);
+	printf("  ops per sec:              %.3f M\n\n", (1000.0 * ops_ave) / nsec_ave);
+
+	printf("TOTAL lookups per sec:      %.3f M\n", (1000.0 * lookup_sum) / nsec_ave);
+	printf("TOTAL updates per sec:      %.3f M\n\n", (1000.0 * update_sum) / nsec_ave);
+
+	if (global->common_options.is_export) {
+		if (test_common_write("duration (msec),num cycles (M),cycles per op,"
+				      "ops per sec (M),total lookups per sec (M),"
+				      "total updates per sec (M)\n")) {
+			ODPH_ERR("Export failed\n");
+			test_common_write_term();
+			return -1;
+		}
+
+		if (test_common_write("%f,%f,%f,%f,%f,%f\n",
+				      nsec_ave / 1000000, cycles_ave / 1000000,
+				      cycles_ave / ops_ave, (1000.0 * ops_ave) / nsec_ave,
+				      (1000.0 * lookup_sum) / nsec_ave,
+				      (1000.0 * update_sum) / nsec_ave)) {
+			ODPH_ERR("Export failed\n");
+			test_common_write_term();
+			return -1;
+		}
+
+		test_common_write_term();
+	}
+
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	odph_helper_options_t helper_options;
+	odp_instance_t instance;
+	odp_init_t init;
+	odp_shm_t shm;
+	test_global_t *global;
+	test_common_options_t common_options;
+	int ret = 0;
+
+	/* Let helper collect its own arguments (e.g. --odph_proc) */
+	argc = odph_parse_options(argc, argv);
+	if (odph_options(&helper_options)) {
+		ODPH_ERR("Error: Reading ODP helper options failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	argc = test_common_parse_options(argc, argv);
+	if (test_common_options(&common_options)) {
+		ODPH_ERR("Error: Reading test options failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	/* List features not to be used */
+	odp_init_param_init(&init);
+	init.not_used.feat.cls = 1;
+	init.not_used.feat.compress = 1;
+	init.not_used.feat.crypto = 1;
+	init.not_used.feat.ipsec = 1;
+	init.not_used.feat.schedule = 1;
+	init.not_used.feat.timer = 1;
+	init.not_used.feat.tm = 1;
+
+	init.mem_model = helper_options.mem_model;
+
+	/* Init ODP before calling anything else */
+	if (odp_init_global(&instance, &init, NULL)) {
+		ODPH_ERR("Error: Global init failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	/* Init this thread */
+	if (odp_init_local(instance, ODP_THREAD_CONTROL)) {
+		ODPH_ERR("Error: Local init failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	shm = odp_shm_reserve("hashtable_perf_global", sizeof(test_global_t),
+			      ODP_CACHE_LINE_SIZE, 0);
+	if (shm == ODP_SHM_INVALID) {
+		ODPH_ERR("Error: Shared mem reserve failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	global = odp_shm_addr(shm);
+	if (global == NULL) {
+		ODPH_ERR("Error: Shared mem alloc failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	memset(global, 0, sizeof(test_global_t));
+	global->ht = ODP_HASHTABLE_INVALID;
+	global->common_options = common_options;
+
+	if (parse_options(argc, argv, &global->options))
+		exit(EXIT_FAILURE);
+
+	odp_sys_info_print();
+
+	global->instance = instance;
+
+	if (create_table(global)) {
+		ODPH_ERR("Error: Create hash table failed.\n");
+		ret = -1;
+		goto destroy;
+	}
+
+	if (start_workers(global)) {
+		ODPH_ERR("Error: Test start failed.\n");
+		ret = -1;
+		goto destroy;
+	}
+
+	/* Wait workers to exit */
+	odph_thread_join(global->thread_tbl, global->options.num_cpu);
+
+	if (output_results(global))
+		ret = -1;
+
+destroy:
+	if (global->ht != ODP_HASHTABLE_INVALID && odp_hashtable_destroy(global->ht)) {
+		ODPH_ERR("Error: Destroy hash table failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_shm_free(shm)) {
+		ODPH_ERR("Error: Shared mem free failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_term_local()) {
+		ODPH_ERR("Error: term local failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_term_global(instance)) {
+		ODPH_ERR("Error: term global failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	return ret;
+}
@@ -163,6 +163,13 @@ typedef struct {
 	 * Specified through -v or --vector argument.
 	 */
 	uint32_t vec_pkt_size;
+
+	/*
+	 * Packet pool segment length. Payloads longer than this are
+	 * segmented. If 0, maximum segment length is used.
+	 * Specified through -g or --seg_len argument.
+	 */
+	uint32_t seg_len;
 } ipsec_args_t;
 
 /*
@@ -628,12 +635,23 @@ make_packet_multi(odp_pool_t pkt_pool, unsigned int payload_length,
 	}
 
 	for (i = 0; i < num; i++) {
+		odp_packet_seg_t seg = odp_packet_first_seg(pkt[i]);
+
+		/* Payload may span multiple segments */
+		while (seg != ODP_PACKET_SEG_INVALID) {
+			uint32_t len = odp_packet_seg_data_len(pkt[i], seg);
+
+			memset(odp_packet_seg_data(pkt[i], seg), 1, len);
+			seg = odp_packet_next_seg(pkt[i], seg);
+		}
+
 		odp_packet_copy_from_mem(pkt[i], 0, sizeof(test_data), test_data);
 		odp_packet_l3_offset_set(pkt[i], 0);
 
-		uint8_t *mem = odp_packet_data(pkt[i]);
-		((odph_ipv4hdr_t *)mem)->tot_len = odp_cpu_to_be_16(payload_length);
-		memset(mem + sizeof(test_data), 1, payload_length - sizeof(test_data));
+		odp_u16be_t tot_len = odp_cpu_to_be_16(payload_length);
+
+		odp_packet_copy_from_mem(pkt[i], ODP_OFFSETOF(odph_ipv4hdr_t, tot_len),
+					 sizeof(tot_len), &tot_len);
 	}
 
 	return 0;
@@ -1042,6 +1060,8 @@ static void usage(char *progname)
 	print_config_names("				      ");
 	printf("  -d, --debug	       Enable dump of processed packets.\n"
 	       "  -f, --flight <number> Max number of packet processed in parallel (default 1)\n"
+	       "  -g, --seg_len <bytes> Packet pool segment length. Longer payloads are segmented.\n"
+	       "                       (default: maximum segment length)\n"
 	       "  -c, --count <number> Number of packets (default 10000)\n"
 	       "  -b, --burst <number> Number of packets in one IPsec API submission (default 1)\n"
 	       "  -v, --vector <number> Enable vector packet completion from IPsec APIs with specified vector size.\n"
@@ -1071,10 +1091,11 @@ static void parse_args(int argc, char *argv[], ipsec_args_t *cargs)
 		{"schedule", no_argument, NULL, 's'},
 		{"tunnel", no_argument, NULL, 't'},
 		{"ah", no_argument, NULL, 'u'},
+		{"seg_len", required_argument, NULL, 'g'},
 		{NULL, 0, NULL, 0}
 	};
 
-	static const char *shortopts = "+a:b:c:df:hm:nl:sptuv:";
+	static const char *shortopts = "+a:b:c:df:g:hm:nl:sptuv:";
 
 	cargs->in_flight = 1;
 	cargs->debug_packets = 0;
@@ -1082,6 +1103,7 @@ static void parse_args(int argc, char *argv[], ipsec_args_t *cargs)
 	cargs->burst_size = 1;
 	cargs->vec_pkt_size = 0;
 	cargs->payload_length = 0;
+	cargs->seg_len = 0;
 	cargs->alg_config = NULL;
 	cargs->schedule = 0;
 	cargs->ah = 0;
@@ -1127,6 +1149,9 @@ static void parse_args(int argc, char *argv[], ipsec_args_t *cargs)
 		case 'f':
 			cargs->in_flight = atoi(optarg);
 			break;
+		case 'g':
+			cargs->seg_len = atoi(optarg);
+			break;
 		case 'h':
 			usage(argv[0]);
 			exit(EXIT_SUCCESS);
@@ -1186,7 +1211,7 @@ int main(int argc, char *argv[])
 	odp_ipsec_capability_t ipsec_capa;
 	odp_pool_capability_t capa;
 	odp_ipsec_config_t config;
-	uint32_t max_seg_len;
+	uint32_t max_seg_len, max_payload;
 	unsigned int i;
 
 	/* Let helper collect its own arguments (e.g. --odph_proc) */
@@ -1224,9 +1249,18 @@ int main(int argc, char *argv[])
 	}
 
 	max_seg_len = capa.pkt.max_seg_len;
+	max_payload = max_seg_len;
+
+	if (cargs.seg_len) {
+		/* Segmented packets, payload length is limited only by the
+		 * maximum packet length */
+		if (cargs.seg_len < max_seg_len)
+			max_seg_len = cargs.seg_len;
+		max_payload = capa.pkt.max_len ? capa.pkt.max_len : UINT32_MAX;
+	}
 
 	for (i = 0; i < ODPH_ARRAY_SIZE(global_payloads); i++) {
-		if (global_payloads[i] > max_seg_len)
+		if (global_payloads[i] > max_payload)
 			break;
 	}
 
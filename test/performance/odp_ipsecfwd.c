@@ -165,6 +165,7 @@ typedef struct prog_config_s {
 	int num_thrs;
 	odp_bool_t is_dir_rx;
 	odp_bool_t is_hashed_tx;
+	odp_bool_t is_inline_in;
 	uint8_t mode;
 } prog_config_t;
 
@@ -433,6 +434,10 @@ static void print_usage(void)
 	       "                      directly. '--mode', '--num_input_qs' and '--num_output_qs'\n"
 	       "                      options are ignored, input and output queue counts will\n"
 	       "                      match worker count.\n"
+	       "  -N, --inline_in     Use inline inbound IPsec. Inbound IPsec packets are\n"
+	       "                      processed already during packet input and delivered to\n"
+	       "                      SA queues. Inbound SAs without a configured lookup mode\n"
+	       "                      use SPI lookup. Cannot be used with '--direct_rx'.\n"
 	       "  -h, --help          This help.\n"
 	       "\n", pool_capa.pkt.max_num > 0U ? ODPH_MIN(pool_capa.pkt.max_num, PKT_CNT) :
 	       PKT_CNT, pool_capa.pkt.max_len > 0U ? ODPH_MIN(pool_capa.pkt.max_len, PKT_SIZE) :
@@ -972,7 +977,8 @@ static odp_bool_t setup_ipsec(prog_config_t *config)
 	odp_ipsec_config_init(&ipsec_config);
 
 	if (!config->is_dir_rx) {
-		ipsec_config.inbound_mode = ODP_IPSEC_OP_MODE_ASYNC;
+		ipsec_config.inbound_mode = config->is_inline_in ? ODP_IPSEC_OP_MODE_INLINE :
+								   ODP_IPSEC_OP_MODE_ASYNC;
 		ipsec_config.outbound_mode = ODP_IPSEC_OP_MODE_ASYNC;
 		config->ops.proc = process_packets_in_enq;
 		config->ops.compl = complete_ipsec_ops;
@@ -1249,6 +1255,12 @@ static void create_sa_entry(odp_ipsec_sa_param_t *sa_param, prog_config_t *confi
 	}
 
 	sa_param->dest_queue = config->sa_qs[config->num_sas % config->num_sa_qs];
+
+	/* Inline inbound processing needs to find the SA on its own */
+	if (config->is_inline_in && dir == ODP_IPSEC_DIR_INBOUND &&
+	    sa_param->inbound.lookup_mode == ODP_IPSEC_LOOKUP_DISABLED)
+		sa_param->inbound.lookup_mode = ODP_IPSEC_LOOKUP_SPI;
+
 	sa = odp_ipsec_sa_create(sa_param);
 
 	if (sa == ODP_IPSEC_SA_INVALID) {
@@ -1306,6 +1318,11 @@ static void parse_sas(config_t *cfg, prog_config_t *config)
 		return;
 	}
 
+	if (config->is_inline_in && ipsec_capa.op_mode_inline_in == ODP_SUPPORT_NO) {
+		ODPH_ERR("Inline inbound IPsec not supported\n");
+		return;
+	}
+
 	if (!setup_ipsec(config))
 		return;
 
@@ -1458,6 +1475,11 @@ static parse_result_t check_options(prog_config_t *config)
 		return PRS_NOK;
 	}
 
+	if (config->is_dir_rx && config->is_inline_in) {
+		ODPH_ERR("Inline inbound IPsec cannot be used with direct RX\n");
+		return PRS_NOK;
+	}
+
 	if (config->is_dir_rx) {
 		config->num_input_qs = config->num_thrs;
 		config->num_output_qs = config->num_thrs;
@@ -1482,11 +1504,12 @@ static parse_result_t parse_options(int argc, char **argv, prog_config_t *config
 		{ "num_sa_qs", required_argument, NULL, 'S' },
 		{ "num_output_qs", required_argument, NULL, 'O' },
 		{ "direct_rx", no_argument, NULL, 'd' },
+		{ "inline_in", no_argument, NULL, 'N' },
 		{ "help", no_argument, NULL, 'h' },
 		{ NULL, 0, NULL, 0 }
 	};
 
-	static const char *shortopts = "i:n:l:c:m:C:I:S:O:dh";
+	static const char *shortopts = "i:n:l:c:m:C:I:S:O:dNh";
 
 	while (true) {
 		opt = getopt_long(argc, argv, shortopts, longopts, NULL);
@@ -1525,6 +1548,9 @@ static parse_result_t parse_options(int argc, char **argv, prog_config_t *config
 		case 'd':
 			config->is_dir_rx = true;
 			break;
+		case 'N':
+			config->is_inline_in = true;
+			break;
 		case 'h':
 			print_usage();
 			return PRS_TERM;
@@ -1731,6 +1757,15 @@ static odp_bool_t setup_pktios(prog_config_t *config)
 
 		odp_pktio_config_init(&pktio_config);
 
+		if (config->is_inline_in) {
+			if (!capa.config.inbound_ipsec) {
+				ODPH_ERR("Inline inbound IPsec not supported (%s)\n", pktio->name);
+				return false;
+			}
+
+			pktio_config.inbound_ipsec = 1;
+		}
+
 		if (odp_pktio_config(pktio->handle, &pktio_config) < 0) {
 			ODPH_ERR("Error configuring packet I/O extra options (%s)\n", pktio->name);
 			return false;
@@ -1890,10 +1925,12 @@ static void print_stats(const prog_config_t *config)
 	       "    input queue count:  %u\n"
 	       "    SA queue count:     %u\n"
 	       "    output queue count: %u\n"
-	       "    RX mode:            %s\n", config->conf_file,
+	       "    RX mode:            %s\n"
+	       "    inline inbound:     %s\n", config->conf_file,
 	       config->mode == ORDERED ? "ordered" : "parallel", config->num_input_qs,
 	       config->num_sa_qs, config->num_output_qs,
-	       config->is_dir_rx ? "direct" : "scheduled");
+	       config->is_dir_rx ? "direct" : "scheduled",
+	       config->is_inline_in ? "yes" : "no");
 
 	for (int i = 0; i < config->num_thrs; ++i) {
 		stats = &config->thread_config[i].stats;
@@ -133,6 +133,9 @@ typedef struct {
 	/* Print debug info on every packet */
 	uint8_t verbose_pkt;
 
+	/* Maximum number of fragments in inline IP reassembly, 0: disabled */
+	uint16_t reass;
+
 	unsigned int cpu_count;
 	int if_count;		/* Number of interfaces to be used */
 	int addr_count;		/* Number of dst addresses to be used */
@@ -316,7 +319,8 @@ typedef struct {
 enum longopt_only {
 	OPT_WAIT_LINK = 256,
 	OPT_SCHED_PREFETCH = 257,
-	OPT_CACHE_STASH = 258
+	OPT_CACHE_STASH = 258,
+	OPT_REASS = 259
 };
 
 /* Global pointer to args */
@@ -370,6 +374,31 @@ static inline int drop_err_pkts(odp_packet_t pkt_tbl[], unsigned num)
 	return dropped;
 }
 
+/*
+ * Drop packets of incomplete inline reassembly
+ *
+ * Returns number of packets dropped
+ */
+static inline int drop_reass_incomplete(odp_packet_t pkt_tbl[], int num)
+{
+	odp_packet_t pkt;
+	int dropped = 0;
+	int i, j;
+
+	for (i = 0, j = 0; i < num; ++i) {
+		pkt = pkt_tbl[i];
+
+		if (odp_unlikely(odp_packet_reass_status(pkt) == ODP_PACKET_REASS_INCOMPLETE)) {
+			odp_packet_free(pkt); /* Drop */
+			dropped++;
+		} else if (odp_unlikely(i != j++)) {
+			pkt_tbl[j - 1] = pkt;
+		}
+	}
+
+	return dropped;
+}
+
 static inline void prefetch_data(uint8_t prefetch, odp_packet_t pkt_tbl[], uint32_t num)
 {
 	if (prefetch == 0)
@@ -528,6 +557,21 @@ static inline int process_extra_features(const appl_args_t *appl_args, odp_packe
 		if (appl_args->verbose_pkt)
 			print_packets(pkt_tbl, pkts);
 
+		if (appl_args->reass) {
+			int rx_drops;
+
+			/* Incomplete reassembly results do not contain valid packet data */
+			rx_drops = drop_reass_incomplete(pkt_tbl, pkts);
+
+			if (odp_unlikely(rx_drops)) {
+				stats->s.rx_drops += rx_drops;
+				if (pkts == rx_drops)
+					return 0;
+
+				pkts -= rx_drops;
+			}
+		}
+
 		if (rd_words)
 			data_rd(pkt_tbl, pkts, rd_words, stats);
 
@@ -1551,6 +1595,30 @@ static int create_pktio(const char *dev, int idx, int num_rx, int num_tx, odp_po
 		}
 	}
 
+	if (gbl_args->appl.reass) {
+		if (!pktio_capa.reassembly.ipv4 && !pktio_capa.reassembly.ipv6 &&
+		    !pktio_capa.reassembly.ip) {
+			ODPH_ERR("Inline reassembly not supported: %s\n", dev);
+			return -1;
+		}
+
+		if (gbl_args->appl.reass > pktio_capa.reassembly.max_num_frags) {
+			ODPH_ERR("Max reassembly fragments %u exceeds capability %u: %s\n",
+				 gbl_args->appl.reass, pktio_capa.reassembly.max_num_frags, dev);
+			return -1;
+		}
+
+		if (pktio_capa.reassembly.ip) {
+			config.reassembly.en_ipv4 = true;
+			config.reassembly.en_ipv6 = true;
+		} else {
+			config.reassembly.en_ipv4 = pktio_capa.reassembly.ipv4;
+			config.reassembly.en_ipv6 = pktio_capa.reassembly.ipv6;
+		}
+
+		config.reassembly.max_num_frags = gbl_args->appl.reass;
+	}
+
 	/* Provide hint to pktio that packet references are not used */
 	config.pktout.bit.no_packet_refs = 1;
 
@@ -2361,6 +2429,9 @@ static void usage(char *progname)
 	       "  --schedule_prefetch <num>      Number of events to be prefetched for scheduling. Default: 0.\n"
 	       "  --wait_link <sec>              Wait up to <sec> seconds for network links to be up.\n"
 	       "                                 Default: 0 (don't check link status)\n"
+	       "  --reass <num>                  Enable inline IP reassembly of up to <num> fragments\n"
+	       "                                 per packet. Incomplete reassemblies are dropped.\n"
+	       "                                 Default: 0 (disabled)\n"
 	       "  -v, --verbose                  Verbose output.\n"
 	       "  -V, --verbose_pkt              Print debug information on every received\n"
 	       "                                 packet.\n"
@@ -2422,6 +2493,7 @@ static void parse_args(int argc, char *argv[], appl_args_t *appl_args)
 		{"flow_control", required_argument, NULL, 'X'},
 		{"cache_stash", required_argument, NULL, OPT_CACHE_STASH},
 		{"schedule_prefetch", required_argument, NULL, OPT_SCHED_PREFETCH},
+		{"reass", required_argument, NULL, OPT_REASS},
 		{"verbose", no_argument, NULL, 'v'},
 		{"verbose_pkt", no_argument, NULL, 'V'},
 		{"help", no_argument, NULL, 'h'},
@@ -2760,6 +2832,9 @@ static void parse_args(int argc, char *argv[], appl_args_t *appl_args)
 		case OPT_SCHED_PREFETCH:
 			appl_args->sched_prefetch = atoi(optarg);
 			break;
+		case OPT_REASS:
+			appl_args->reass = atoi(optarg);
+			break;
 		case 'v':
 			appl_args->verbose = 1;
 			break;
@@ -2837,7 +2912,7 @@ static void parse_args(int argc, char *argv[], appl_args_t *appl_args)
 	appl_args->extra_feat = 0;
 	if (appl_args->error_check || appl_args->chksum || appl_args->packet_copy ||
 	    appl_args->data_rd || appl_args->verbose_pkt || appl_args->wait_ns ||
-	    appl_args->memcpy_bytes)
+	    appl_args->memcpy_bytes || appl_args->reass)
 		appl_args->extra_feat = 1;
 
 	appl_args->has_state = 0;
@@ -2908,7 +2983,7 @@ static void print_options(void)
 					   appl_args->if_count : 1);
 
 	if (appl_args->extra_feat || appl_args->has_state) {
-		printf("Extra features:     %s%s%s%s%s%s%s%s\n",
+		printf("Extra features:     %s%s%s%s%s%s%s%s%s\n",
 		       appl_args->error_check ? "error_check " : "",
 		       appl_args->chksum ? "chksum " : "",
 		       appl_args->packet_copy ? "packet_copy " : "",
@@ -2916,7 +2991,8 @@ static void print_options(void)
 		       appl_args->tx_compl.mode != ODP_PACKET_TX_COMPL_DISABLED ? "tx_compl" : "",
 		       appl_args->verbose_pkt ? "verbose_pkt" : "",
 		       appl_args->wait_ns ? "wait_ns" : "",
-		       appl_args->memcpy_bytes ? "memcpy" : "");
+		       appl_args->memcpy_bytes ? "memcpy " : "",
+		       appl_args->reass ? "reass" : "");
 
 		if (appl_args->memcpy_bytes)
 			printf("  Memcpy:           %" PRIu64 " bytes\n", appl_args->memcpy_bytes);
@@ -0,0 +1,615 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @example odp_lpm_perf.c
+ *
+ * Performance test application for longest prefix match (LPM) table APIs
+ *
+ * @cond _ODP_HIDE_FROM_DOXYGEN_
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <getopt.h>
+
+#include <odp_api.h>
+#include <odp/helper/odph_api.h>
+
+#include <export_results.h>
+
+#define MAX_BURST    256
+#define NUM_ADDR     (1024 * 1024)
+#define ADDR_LEN     16
+
+typedef struct test_options_t {
+	uint32_t num_route;
+	uint32_t num_ext;
+	uint32_t max_burst;
+	uint32_t num_round;
+	uint32_t miss_pct;
+	int ipv6;
+	int num_cpu;
+
+} test_options_t;
+
+typedef struct test_stat_t {
+	uint64_t rounds;
+	uint64_t lookups;
+	uint64_t hits;
+	uint64_t nsec;
+	uint64_t cycles;
+
+} test_stat_t;
+
+typedef struct test_global_t {
+	odp_barrier_t barrier;
+	test_options_t options;
+	odp_instance_t instance;
+	odp_lpm_t lpm;
+	uint8_t (*addr)[ADDR_LEN];
+	odph_thread_t thread_tbl[ODP_THREAD_COUNT_MAX];
+	test_stat_t stat[ODP_THREAD_COUNT_MAX];
+	test_common_options_t common_options;
+
+} test_global_t;
+
+static void print_usage(void)
+{
+	printf("\n"
+	       "LPM table performance test\n"
+	       "\n"
+	       "Usage: odp_lpm_perf [options]\n"
+	       "\n"
+	       "  -c, --num_cpu <num>     Number of worker threads. Default: 1\n"
+	       "  -6, --ipv6              Test IPv6 table. Default: IPv4\n"
+	       "  -n, --num_route <num>   Number of routes. Default: 1000000 (IPv4), 50000 (IPv6)\n"
+	       "  -e, --num_ext <num>     Number of extension tables. Default: implementation\n"
+	       "                          default (IPv4), 4 per route (IPv6)\n"
+	       "  -b, --burst_size <num>  Number of addresses per lookup call. When > 1,\n"
+	       "                          odp_lpm_match_multi() is used. Default: 32\n"
+	       "  -m, --miss <pct>        Percentage of random destination addresses, which\n"
+	       "                          may miss all routes. Default: 0\n"
+	       "  -r, --num_round <num>   Number of rounds. Default: 100000\n"
+	       "  -h, --help              This help\n"
+	       "\n");
+}
+
+static int parse_options(int argc, char *argv[], test_options_t *test_options)
+{
+	int opt;
+	int ret = 0;
+
+	static const struct option longopts[] = {
+		{ "num_cpu", required_argument, NULL, 'c' },
+		{ "ipv6", no_argument, NULL, '6' },
+		{ "num_route", required_argument, NULL, 'n' },
+		{ "num_ext", required_argument, NULL, 'e' },
+		{ "burst_size", required_argument, NULL, 'b' },
+		{ "miss", required_argument, NULL, 'm' },
+		{ "num_round", required_argument, NULL, 'r' },
+		{ "help", no_argument, NULL, 'h' },
+		{ NULL, 0, NULL, 0 }
+	};
+
+	static const char *shortopts = "+c:6n:e:b:m:r:h";
+
+	test_options->num_cpu = 1;
+	test_options->ipv6 = 0;
+	test_options->num_route = 0;
+	test_options->num_ext = 0;
+	test_options->max_burst = 32;
+	test_options->miss_pct = 0;
+	test_options->num_round = 100000;
+
+	while (1) {
+		opt = getopt_long(argc, argv, shortopts, longopts, NULL);
+
+		if (opt == -1)
+			break;
+
+		switch (opt) {
+		case 'c':
+			test_options->num_cpu = atoi(optarg);
+			break;
+		case '6':
+			test_options->ipv6 = 1;
+			break;
+		case 'n':
+			test_options->num_route = atoi(optarg);
+			break;
+		case 'e':
+			test_options->num_ext = atoi(optarg);
+			break;
+		case 'b':
+			test_options->max_burst = atoi(optarg);
+			break;
+		case 'm':
+			test_options->miss_pct = atoi(optarg);
+			break;
+		case 'r':
+			test_options->num_round = atoi(optarg);
+			break;
+		case 'h':
+			/* fall through */
+		default:
+			print_usage();
+			ret = -1;
+			break;
+		}
+	}
+
+	if (test_options->num_route == 0)
+		test_options->num_route = test_options->ipv6 ? 50000 : 1000000;
+
+	/* Random IPv6 routes share few extension tables. Most are /48 and need four each. */
+	if (test_options->ipv6 && test_options->num_ext == 0)
+		test_options->num_ext = 4 * test_options->num_route;
+
+	if (test_options->max_burst == 0 || test_options->max_burst > MAX_BURST) {
+		ODPH_ERR("Bad burst size %u. Test maximum %u.\n",
+			 test_options->max_burst, MAX_BURST);
+		return -1;
+	}
+
+	if (test_options->miss_pct > 100) {
+		ODPH_ERR("Bad miss percentage %u\n", test_options->miss_pct);
+		return -1;
+	}
+
+	return ret;
+}
+
+static inline uint64_t rand_u64(uint64_t *seed)
+{
+	/* xorshift64 */
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 7;
+	*seed ^= *seed << 17;
+
+	return *seed;
+}
+
+/* Prefix length distribution roughly resembles a full BGP table: most IPv4 prefixes are /24
+ * and most IPv6 prefixes /48, while short and host routes are rare. */
+static uint32_t random_prefix_len(uint64_t *seed, int ipv6)
+{
+	uint32_t r = rand_u64(seed) % 1000;
+
+	if (ipv6) {
+		if (r < 500)
+			return 48;
+		if (r < 900)
+			return 32 + rand_u64(seed) % 16;
+		if (r < 990)
+			return 49 + rand_u64(seed) % 16;
+
+		return 65 + rand_u64(seed) % 64;
+	}
+
+	if (r < 600)
+		return 24;
+	if (r < 975)
+		return 16 + rand_u64(seed) % 8;
+	if (r < 980)
+		return 8 + rand_u64(seed) % 8;
+
+	return 25 + rand_u64(seed) % 8;
+}
+
+static void random_addr(uint64_t *seed, uint8_t *addr, int ipv6)
+{
+	uint64_t r = rand_u64(seed);
+
+	memcpy(addr, &r, sizeof(r));
+	r = rand_u64(seed);
+	memcpy(&addr[8], &r, sizeof(r));
+
+	/* Global unicast IPv6 addresses */
+	if (ipv6)
+		addr[0] = 0x20 | (addr[0] & 0x1f);
+}
+
+static int create_table(test_global_t *global)
+{
+	test_options_t *test_options = &global->options;
+	odp_lpm_capability_t capa;
+	odp_lpm_param_t param;
+	uint8_t prefix[ADDR_LEN];
+	uint8_t (*route)[ADDR_LEN];
+	uint8_t *route_len;
+	uint64_t seed = 0x0123456789abcdefULL;
+	int ipv6 = test_options->ipv6;
+	uint32_t num_route = test_options->num_route;
+	uint32_t i, j, max_routes, len;
+	odp_time_t t1, t2;
+	int ret = 0;
+
+	printf("\nLPM table performance test\n");
+	printf("  address type         %s\n", ipv6 ? "IPv6" : "IPv4");
+	printf("  num rounds           %u\n", test_options->num_round);
+	printf("  num routes           %u\n", num_route);
+	printf("  num ext tables       %u\n", test_options->num_ext);
+	printf("  max burst size       %u\n", test_options->max_burst);
+	printf("  miss percentage      %u\n", test_options->miss_pct);
+
+	if (odp_lpm_capability(&capa)) {
+		ODPH_ERR("LPM capability failed\n");
+		return -1;
+	}
+
+	max_routes = ipv6 ? capa.ipv6.max_routes : capa.ipv4.max_routes;
+
+	if (num_route == 0 || num_route > max_routes) {
+		ODPH_ERR("Bad number of routes. Max routes %u.\n", max_routes);
+		return -1;
+	}
+
+	odp_lpm_param_init(&param);
+	param.type = ipv6 ? ODP_LPM_IPV6 : ODP_LPM_IPV4;
+	param.max_routes = num_route;
+	param.num_ext = test_options->num_ext;
+
+	global->lpm = odp_lpm_create("lpm_perf", &param);
+	if (global->lpm == ODP_LPM_INVALID) {
+		ODPH_ERR("LPM table create failed\n");
+		return -1;
+	}
+
+	route = malloc((uint64_t)num_route * ADDR_LEN);
+	route_len = malloc(num_route);
+	global->addr = malloc((uint64_t)NUM_ADDR * ADDR_LEN);
+
+	if (route == NULL || route_len == NULL || global->addr == NULL) {
+		ODPH_ERR("Malloc failed\n");
+		ret = -1;
+		goto free;
+	}
+
+	t1 = odp_time_local();
+
+	for (i = 0; i < num_route; i++) {
+		random_addr(&seed, prefix, ipv6);
+		len = random_prefix_len(&seed, ipv6);
+
+		memcpy(route[i], prefix, ADDR_LEN);
+		route_len[i] = len;
+
+		if (odp_lpm_route_add(global->lpm, prefix, len, i % (capa.max_next_hop + 1))) {
+			ODPH_ERR("Route add failed (%u)\n", i);
+			ret = -1;
+			goto free;
+		}
+	}
+
+	t2 = odp_time_local();
+
+	printf("  route add rate       %.3f k/s\n",
+	       (1000000.0 * num_route) / odp_time_diff_ns(t2, t1));
+	printf("  routes in table      %u\n", odp_lpm_route_count(global->lpm));
+
+	/* Destination addresses are either random or inside a random route */
+	for (i = 0; i < NUM_ADDR; i++) {
+		uint8_t *addr = global->addr[i];
+
+		random_addr(&seed, addr, ipv6);
+
+		if (rand_u64(&seed) % 100 < test_options->miss_pct)
+			continue;
+
+		j = rand_u64(&seed) % num_route;
+		len = route_len[j];
+
+		for (uint32_t b = 0; b < ADDR_LEN && len; b++) {
+			uint8_t mask = len >= 8 ? 0xff : (uint8_t)(0xff << (8 - len));
+
+			addr[b] = (route[j][b] & mask) | (addr[b] & ~mask);
+			len = len >= 8 ? len - 8 : 0;
+		}
+	}
+
+	odp_lpm_print(global->lpm);
+
+free:
+	free(route);
+	free(route_len);
+
+	return ret;
+}
+
+static int run_test(void *arg)
+{
+	uint64_t c1, c2;
+	odp_time_t t1, t2;
+	uint32_t rounds, i;
+	int ret;
+	test_global_t *global = arg;
+	test_options_t *test_options = &global->options;
+	odp_lpm_t lpm = global->lpm;
+	uint32_t num_round = test_options->num_round;
+	uint32_t burst = test_options->max_burst;
+	int thr = odp_thread_id();
+	test_stat_t *stat = &global->stat[thr];
+	uint64_t lookups = 0, hits = 0;
+	uint32_t pos = (thr * 7919 * burst) % NUM_ADDR;
+	const void *addr[MAX_BURST];
+	uint32_t next_hop[MAX_BURST];
+	uint8_t found[MAX_BURST];
+
+	/* Start all workers at the same time */
+	odp_barrier_wait(&global->barrier);
+
+	t1 = odp_time_local();
+	c1 = odp_cpu_cycles();
+
+	for (rounds = 0; rounds < num_round; rounds++) {
+		for (i = 0; i < burst; i++) {
+			addr[i] = global->addr[pos];
+			pos = (pos + 1) & (NUM_ADDR - 1);
+		}
+
+		if (burst == 1)
+			ret = odp_lpm_match(lpm, addr[0], &next_hop[0]);
+		else
+			ret = odp_lpm_match_multi(lpm, addr, next_hop, found, burst);
+
+		if (ret < 0) {
+			ODPH_ERR("LPM match failed\n");
+			return -1;
+		}
+
+		lookups += burst;
+		hits += ret;
+	}
+
+	c2 = odp_cpu_cycles();
+	t2 = odp_time_local();
+
+	stat->rounds = rounds;
+	stat->lookups = lookups;
+	stat->hits = hits;
+	stat->nsec = odp_time_diff_ns(t2, t1);
+	stat->cycles = odp_cpu_cycles_diff(c2, c1);
+
+	return 0;
+}
+
+static int start_workers(test_global_t *global)
+{
+	odph_thread_common_param_t thr_common;
+	odph_thread_param_t thr_param;
+	odp_cpumask_t cpumask;
+	int ret;
+	test_options_t *test_options = &global->options;
+	int num_cpu = test_options->num_cpu;
+
+	ret = odp_cpumask_default_worker(&cpumask, num_cpu);
+
+	if (num_cpu && ret != num_cpu) {
+		ODPH_ERR("Error: Too many workers. Max supported %i\n.", ret);
+		return -1;
+	}
+
+	/* Zero: all available workers */
+	if (num_cpu == 0) {
+		num_cpu = ret;
+		test_options->num_cpu = num_cpu;
+	}
+
+	printf("  num workers          %u\n\n", num_cpu);
+
+	odp_barrier_init(&global->barrier, num_cpu);
+
+	odph_thread_common_param_init(&thr_common);
+	thr_common.instance = global->instance;
+	thr_common.cpumask = &cpumask;
+	thr_common.share_param = 1;
+
+	odph_thread_param_init(&thr_param);
+	thr_param.start = run_test;
+	thr_param.arg = global;
+	thr_param.thr_type = ODP_THREAD_WORKER;
+
+	if (odph_thread_create(global->thread_tbl, &thr_common, &thr_param,
+			       num_cpu) != num_cpu)
+		return -1;
+
+	return 0;
+}
+
+static int output_results(test_global_t *global)
+{
+	int i, num;
+	double nsec_ave, cycles_ave, lookups_ave;
+	test_options_t *test_options = &global->options;
+	int num_cpu = test_options->num_cpu;
+	uint64_t rounds_sum = 0;
+	uint64_t lookup_sum = 0;
+	uint64_t hit_sum = 0;
+	uint64_t nsec_sum = 0;
+	uint64_t cycles_sum = 0;
+
+	for (i = 0; i < ODP_THREAD_COUNT_MAX; i++) {
+		rounds_sum += global->stat[i].rounds;
+		lookup_sum += global->stat[i].lookups;
+		hit_sum += global->stat[i].hits;
+		nsec_sum += global->stat[i].nsec;
+		cycles_sum += global->stat[i].cycles;
+	}
+
+	if (rounds_sum == 0 || nsec_sum == 0) {
+		printf("No results.\n");
+		return 0;
+	}
+
+	nsec_ave = nsec_sum / num_cpu;
+	cycles_ave = cycles_sum / num_cpu;
+	lookups_ave = lookup_sum / num_cpu;
+	num = 0;
+
+	printf("RESULTS - per thread (Million lookups per sec):\n");
+	printf("----------------------------------------------\n");
+	printf("        1      2      3      4      5      6      7      8      9     10");
+
+	for (i = 0; i < ODP_THREAD_COUNT_MAX; i++) {
+		if (global->stat[i].rounds) {
+			if ((num % 10) == 0)
+				printf("\n   ");
+
+			printf("%6.1f ", (1000.0 * global->stat[i].lookups) / global->stat[i].nsec);
+			num++;
+		}
+	}
+	printf("\n\n");
+
+	printf("RESULTS - per thread average (%i threads):\n", num_cpu);
+	printf("------------------------------------------\n");
+	printf("  duration:                 %.3f msec\n", nsec_ave / 1000000);
+	printf("  num cycles:               %.3f M\n", cycles_ave / 1000000);
+	printf("  cycles per lookup:        %.3f\n", cycles_ave / lookups_ave);
+	printf("  hit ratio:                %.3f %%\n", (100.0 * hit_sum) / lookup_sum);
+	printf("  lookups per sec:          %.3f M\n\n", (1000.0 * lookups_ave) / nsec_ave);
+
+	printf("TOTAL lookups per sec:      %.3f M\n\n", (1000.0 * lookup_sum) / nsec_ave);
+
+	if (global->common_options.is_export) {
+		if (test_common_write("duration (msec),num cycles (M),cycles per lookup,"
+				      "lookups per sec (M),total lookups per sec (M)\n")) {
+			ODPH_ERR("Export failed\n");
+			test_common_write_term();
+			return -1;
+		}
+
+		if (test_common_write("%f,%f,%f,%f,%f\n",
+				      nsec_ave / 1000000, cycles_ave / 1000000,
+				      cycles_ave / lookups_ave, (1000.0 * lookups_ave) / nsec_ave,
+				      (1000.0 * lookup_sum) / nsec_ave)) {
+			ODPH_ERR("Export failed\n");
+			test_common_write_term();
+			return -1;
+		}
+
+		test_common_write_term();
+	}
+
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	odph_helper_options_t helper_options;
+	odp_instance_t instance;
+	odp_init_t init;
+	odp_shm_t shm;
+	test_global_t *global;
+	test_common_options_t common_options;
+	int ret = 0;
+
+	/* Let helper collect its own arguments (e.g. --odph_proc) */
+	argc = odph_parse_options(argc, argv);
+	if (odph_options(&helper_options)) {
+		ODPH_ERR("Error: Reading ODP helper options failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	argc = test_common_parse_options(argc, argv);
+	if (test_common_options(&common_options)) {
+		ODPH_ERR("Error: Reading test options failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	/* List features not to be used */
+	odp_init_param_init(&init);
+	init.not_used.feat.cls = 1;
+	init.not_used.feat.compress = 1;
+	init.not_used.feat.crypto = 1;
+	init.not_used.feat.ipsec = 1;
+	init.not_used.feat.schedule = 1;
+	init.not_used.feat.timer = 1;
+	init.not_used.feat.tm = 1;
+
+	init.mem_model = helper_options.mem_model;
+
+	/* Init ODP before calling anything else */
+	if (odp_init_global(&instance, &init, NULL)) {
+		ODPH_ERR("Error: Global init failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	/* Init this thread */
+	if (odp_init_local(instance, ODP_THREAD_CONTROL)) {
+		ODPH_ERR("Error: Local init failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	shm = odp_shm_reserve("lpm_perf_global", sizeof(test_global_t),
+			      ODP_CACHE_LINE_SIZE, 0);
+	if (shm == ODP_SHM_INVALID) {
+		ODPH_ERR("Error: Shared mem reserve failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	global = odp_shm_addr(shm);
+	if (global == NULL) {
+		ODPH_ERR("Error: Shared mem alloc failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	memset(global, 0, sizeof(test_global_t));
+	global->lpm = ODP_LPM_INVALID;
+	global->common_options = common_options;
+
+	if (parse_options(argc, argv, &global->options))
+		exit(EXIT_FAILURE);
+
+	odp_sys_info_print();
+
+	global->instance = instance;
+
+	if (create_table(global)) {
+		ODPH_ERR("Error: Create LPM table failed.\n");
+		ret = -1;
+		goto destroy;
+	}
+
+	if (start_workers(global)) {
+		ODPH_ERR("Error: Test start failed.\n");
+		ret = -1;
+		goto destroy;
+	}
+
+	/* Wait workers to exit */
+	odph_thread_join(global->thread_tbl, global->options.num_cpu);
+
+	if (output_results(global))
+		ret = -1;
+
+destroy:
+	free(global->addr);
+
+	if (global->lpm != ODP_LPM_INVALID && odp_lpm_destroy(global->lpm)) {
+		ODPH_ERR("Error: Destroy LPM table failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_shm_free(shm)) {
+		ODPH_ERR("Error: Shared mem free failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_term_local()) {
+		ODPH_ERR("Error: term local failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_term_global(instance)) {
+		ODPH_ERR("Error: term global failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	return ret;
+}
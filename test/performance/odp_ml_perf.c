@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: BSD-3-Clause
- * Copyright (c) 2024 Nokia
+ * Copyright (c) 2024-2026 Nokia
  */
 
 /**
@@ -23,11 +23,20 @@
 
 #define TEST_SKIP 77
 
+/* Number of elements in conversion tests */
+#define CONVERT_MIN_ELEMS 1024
+#define CONVERT_MAX_ELEMS (1024 * 1024)
+
+/* Number of elements converted per test round in conversion tests */
+#define CONVERT_ROUND_ELEMS (64 * 1024)
+
 enum {
 	MODE_INFERENCE = 0,
 	MODE_INFERENCE_QUANT,
 	MODE_CREATE,
 	MODE_LOAD,
+	MODE_CONVERT,
+	MODE_ASYNC,
 	MODE_NUM,
 };
 
@@ -36,6 +45,7 @@ typedef struct {
 	char *model_name, *input_name, *reference_name;
 	float scale_q, scale_d;
 	int num_batch;
+	int in_flight;
 } test_opt_t;
 
 static test_opt_t opt_def = {
@@ -43,6 +53,7 @@ static test_opt_t opt_def = {
 	.rounds = 50,
 	.warmup = 5,
 	.num_batch = 1,
+	.in_flight = 8,
 };
 
 typedef struct io_size {
@@ -75,6 +86,8 @@ typedef struct {
 	odp_ml_output_info_t out_info[MAX_IO];
 	io_size out[MAX_IO];
 	uint64_t inp_size_q, inp_size_d, out_size_q, out_size_d;
+	odp_pool_t compl_pool;
+	odp_queue_t compl_queue[ODP_THREAD_COUNT_MAX];
 	stat_t stat[ODP_THREAD_COUNT_MAX];
 } test_global_t;
 
@@ -188,6 +201,11 @@ static void usage(const char *prog)
 	       "                        1: Quantization-inference-dequantization\n"
 	       "                        2: Create-destroy\n"
 	       "                        3: Load-unload\n"
+	       "                        4: Quantization and fp16 conversion throughput with\n"
+	       "                           1K - 1M elements. Model and input files are not used.\n"
+	       "                        5: Asynchronous inference with completion events. Each\n"
+	       "                           thread keeps -o runs in flight. With latency option,\n"
+	       "                           latency is measured from run start to completion.\n"
 	       "  -l, --latency       Measure each round, report min, avg, max\n"
 	       "  -w, --warmup        Warmup rounds. Default %d.\n"
 	       "  -R, --reference     Reference file. To verify correctness, output from the last\n"
@@ -195,9 +213,11 @@ static void usage(const char *prog)
 	       "  -q, --quant         Quantization scale\n"
 	       "  -d, --dequant       Dequantization scale\n"
 	       "  -b, --batches       Number of batches\n"
+	       "  -o, --in_flight     Number of asynchronous runs in flight per thread in mode 5.\n"
+	       "                      Default %d.\n"
 	       "  -h, --help          Help\n"
 	       "\n",
-	       prog, opt_def.rounds, opt_def.warmup);
+	       prog, opt_def.rounds, opt_def.warmup, opt_def.in_flight);
 }
 
 static int parse_args(int argc, char *argv[])
@@ -214,10 +234,11 @@ static int parse_args(int argc, char *argv[])
 		{ "quant", required_argument, NULL, 'q' },
 		{ "dequant", required_argument, NULL, 'd' },
 		{ "batches", required_argument, NULL, 'b' },
+		{ "in_flight", required_argument, NULL, 'o' },
 		{ "help", no_argument, NULL, 'h' },
 		{ NULL, 0, NULL, 0 } };
 
-	static const char *shortopts = "+M:I:c:r:m:lw:R:q:d:b:h";
+	static const char *shortopts = "+M:I:c:r:m:lw:R:q:d:b:o:h";
 
 	glb->opt = opt_def;
 
@@ -261,6 +282,9 @@ static int parse_args(int argc, char *argv[])
 		case 'b':
 			glb->opt.num_batch = atoi(optarg);
 			break;
+		case 'o':
+			glb->opt.in_flight = atoi(optarg);
+			break;
 		case 'h':
 			usage(argv[0]);
 			return 1;
@@ -272,7 +296,7 @@ static int parse_args(int argc, char *argv[])
 
 	optind = 1; /* reset 'extern optind' from the getopt lib */
 
-	if (!glb->opt.model_name || !glb->opt.input_name) {
+	if (glb->opt.mode != MODE_CONVERT && (!glb->opt.model_name || !glb->opt.input_name)) {
 		ODPH_ERR("Model and input files are mandatory\n");
 		exit(EXIT_FAILURE);
 	}
@@ -287,6 +311,16 @@ static int parse_args(int argc, char *argv[])
 		exit(EXIT_FAILURE);
 	}
 
+	if (glb->opt.in_flight < 1) {
+		ODPH_ERR("Invalid number of runs in flight: %d\n", glb->opt.in_flight);
+		exit(EXIT_FAILURE);
+	}
+
+	if (glb->opt.mode == MODE_ASYNC && (glb->opt.scale_q > 0.0 || glb->opt.scale_d > 0.0)) {
+		ODPH_ERR("Quantization is not supported in asynchronous mode\n");
+		exit(EXIT_FAILURE);
+	}
+
 	printf("Options:\n");
 	printf("--------\n");
 	printf("model_name: %s\n", glb->opt.model_name);
@@ -300,6 +334,7 @@ static int parse_args(int argc, char *argv[])
 	printf("scale_q: %g\n", glb->opt.scale_q);
 	printf("scale_d: %g\n", glb->opt.scale_d);
 	printf("num_batch: %d\n", glb->opt.num_batch);
+	printf("in_flight: %d\n", glb->opt.in_flight);
 	printf("\n");
 
 	return 0;
@@ -591,6 +626,195 @@ error:
 	return ret;
 }
 
+static int start_async(odp_event_t ev, int slot, odp_ml_data_t *data,
+		       odp_ml_compl_param_t *compl_param, odp_ml_run_param_t *run_param)
+{
+	int r;
+
+	compl_param->event = ev;
+	compl_param->user_ptr = (void *)(uintptr_t)slot;
+
+	while (!(r = odp_ml_run_start(glb->mdl, data, compl_param, run_param)))
+		;
+
+	if (r != 1) {
+		ODPH_ERR("odp_ml_run_start() failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static int test_ml_async(void *ptr)
+{
+	odp_time_t time = ODP_TIME_NULL;
+	odp_ml_data_seg_t inp_seg[MAX_IO];
+	odp_ml_data_seg_t *out_seg = NULL;
+	odp_ml_data_t *data = NULL;
+	odp_time_t *start = NULL;
+	uint8_t *output = NULL;
+	uint8_t *inp_addr = glb->inp_file_data;
+	uint8_t *out_addr;
+	odp_ml_compl_param_t compl_param;
+	odp_ml_run_param_t run_param;
+	int thread_idx = (int)(uintptr_t)ptr;
+	odp_queue_t queue = glb->compl_queue[thread_idx];
+	int in_flight = glb->opt.in_flight;
+	int total = glb->opt.rounds + glb->opt.warmup;
+	int started = 0, done = 0, pending = 0;
+	int ret = 0;
+
+	out_seg = malloc(in_flight * MAX_IO * sizeof(odp_ml_data_seg_t));
+	data = malloc(in_flight * sizeof(odp_ml_data_t));
+	start = malloc(in_flight * sizeof(odp_time_t));
+	output = malloc(in_flight * glb->out_size_q);
+
+	if (!out_seg || !data || !start || !output) {
+		ODPH_ERR("Memory allocation failed\n");
+		ret = -1;
+		goto error;
+	}
+
+	for (int i = 0; i < glb->num_inp; i++) {
+		inp_seg[i].addr = inp_addr;
+		inp_seg[i].size = glb->inp[i].size;
+		inp_addr += glb->inp[i].size;
+	}
+
+	/* Input data is shared, each run in flight has its own output buffer */
+	out_addr = output;
+	for (int j = 0; j < in_flight; j++) {
+		for (int i = 0; i < glb->num_out; i++) {
+			out_seg[j * MAX_IO + i].addr = out_addr;
+			out_seg[j * MAX_IO + i].size = glb->out[i].size;
+			out_addr += glb->out[i].size;
+		}
+
+		data[j].input_seg = inp_seg;
+		data[j].num_input_seg = glb->num_inp;
+		data[j].output_seg = &out_seg[j * MAX_IO];
+		data[j].num_output_seg = glb->num_out;
+	}
+
+	odp_ml_run_param_init(&run_param);
+	run_param.batch_size = glb->opt.num_batch;
+	odp_ml_compl_param_init(&compl_param);
+	compl_param.mode = ODP_ML_COMPL_MODE_EVENT;
+	compl_param.queue = queue;
+
+	odp_barrier_wait(&glb->barrier);
+
+	if (!glb->opt.warmup)
+		time_start(&time);
+
+	for (int slot = 0; slot < in_flight && started < total; slot++) {
+		odp_ml_compl_t compl = odp_ml_compl_alloc(glb->compl_pool);
+
+		if (compl == ODP_ML_COMPL_INVALID) {
+			ODPH_ERR("odp_ml_compl_alloc() failed\n");
+			ret = -1;
+			goto error;
+		}
+
+		time_start(&start[slot]);
+
+		if (start_async(odp_ml_compl_to_event(compl), slot, &data[slot], &compl_param,
+				&run_param)) {
+			odp_ml_compl_free(compl);
+			ret = -1;
+			goto error;
+		}
+
+		started++;
+		pending++;
+	}
+
+	while (done < total) {
+		odp_ml_run_result_t result;
+		odp_event_t ev = odp_queue_deq(queue);
+		odp_ml_compl_t compl;
+		int slot;
+
+		if (ev == ODP_EVENT_INVALID)
+			continue;
+
+		pending--;
+		compl = odp_ml_compl_from_event(ev);
+
+		if (odp_ml_compl_run_result(compl, &result)) {
+			ODPH_ERR("Model run failed, error code %" PRIu64 "\n", result.error_code);
+			odp_ml_compl_free(compl);
+			ret = -1;
+			goto error;
+		}
+
+		slot = (int)(uintptr_t)result.user_ptr;
+		done++;
+
+		if (glb->opt.latency && done > glb->opt.warmup)
+			time_elapsed(&start[slot], thread_idx);
+
+		if (done == glb->opt.warmup)
+			time_start(&time);
+
+		if (started == total) {
+			odp_ml_compl_free(compl);
+			continue;
+		}
+
+		time_start(&start[slot]);
+
+		if (start_async(ev, slot, &data[slot], &compl_param, &run_param)) {
+			odp_ml_compl_free(compl);
+			ret = -1;
+			goto error;
+		}
+
+		started++;
+		pending++;
+	}
+
+	if (!glb->opt.latency)
+		time_elapsed(&time, thread_idx);
+
+	if (glb->ref_file_data) {
+		if (glb->out_size_q != glb->ref_file_size) {
+			ODPH_ERR("Output size mismatch: %" PRIu64
+				 " differs from reference file size %" PRIu64 "\n",
+				 glb->out_size_q, glb->ref_file_size);
+			ret = -1;
+			goto error;
+		}
+
+		for (int j = 0; j < in_flight && j < total; j++) {
+			if (memcmp(glb->ref_file_data, output + j * glb->out_size_q,
+				   glb->out_size_q)) {
+				ODPH_ERR("Output differs from reference\n");
+				ret = -1;
+				goto error;
+			}
+		}
+	}
+
+error:
+	/* Runs still in flight write to the output buffers */
+	while (pending) {
+		odp_event_t ev = odp_queue_deq(queue);
+
+		if (ev != ODP_EVENT_INVALID) {
+			odp_ml_compl_free(odp_ml_compl_from_event(ev));
+			pending--;
+		}
+	}
+
+	free(out_seg);
+	free(data);
+	free(start);
+	free(output);
+
+	return ret;
+}
+
 static int test_ml_create(void *ptr)
 {
 	odp_time_t time = ODP_TIME_NULL;
@@ -687,6 +911,124 @@ error:
 	return ret;
 }
 
+typedef enum {
+	CONV_TO_U8 = 0,
+	CONV_FROM_U8,
+	CONV_TO_I8,
+	CONV_FROM_I8,
+	CONV_TO_U16,
+	CONV_FROM_U16,
+	CONV_TO_I16,
+	CONV_FROM_I16,
+	CONV_TO_FP16,
+	CONV_FROM_FP16,
+	CONV_NUM
+} conv_t;
+
+static const char *conv_name[CONV_NUM] = {
+	"fp32_to_uint8", "fp32_from_uint8", "fp32_to_int8", "fp32_from_int8",
+	"fp32_to_uint16", "fp32_from_uint16", "fp32_to_int16", "fp32_from_int16",
+	"fp32_to_fp16", "fp32_from_fp16"
+};
+
+static void convert(conv_t conv, float *fp32, void *q, uint32_t num)
+{
+	const float scale = 0.1f;
+
+	switch (conv) {
+	case CONV_TO_U8:
+		odp_ml_fp32_to_uint8(q, fp32, num, scale, 128);
+		break;
+	case CONV_FROM_U8:
+		odp_ml_fp32_from_uint8(fp32, q, num, scale, 128);
+		break;
+	case CONV_TO_I8:
+		odp_ml_fp32_to_int8(q, fp32, num, scale, 0);
+		break;
+	case CONV_FROM_I8:
+		odp_ml_fp32_from_int8(fp32, q, num, scale, 0);
+		break;
+	case CONV_TO_U16:
+		odp_ml_fp32_to_uint16(q, fp32, num, scale, 32768);
+		break;
+	case CONV_FROM_U16:
+		odp_ml_fp32_from_uint16(fp32, q, num, scale, 32768);
+		break;
+	case CONV_TO_I16:
+		odp_ml_fp32_to_int16(q, fp32, num, scale, 0);
+		break;
+	case CONV_FROM_I16:
+		odp_ml_fp32_from_int16(fp32, q, num, scale, 0);
+		break;
+	case CONV_TO_FP16:
+		odp_ml_fp32_to_fp16(q, fp32, num);
+		break;
+	case CONV_FROM_FP16:
+		odp_ml_fp32_from_fp16(fp32, q, num);
+		break;
+	default:
+		break;
+	}
+}
+
+/* Measure conversion throughput in the calling thread. Number of calls is scaled so that
+ * each test converts the same total number of elements. */
+static int test_convert(void)
+{
+	float *fp32 = malloc(CONVERT_MAX_ELEMS * sizeof(float));
+	uint16_t *q = malloc(CONVERT_MAX_ELEMS * sizeof(uint16_t));
+	int ret = 0;
+
+	if (!fp32 || !q) {
+		ODPH_ERR("Allocation failed\n");
+		ret = -1;
+		goto out;
+	}
+
+	for (uint32_t i = 0; i < CONVERT_MAX_ELEMS; i++)
+		fp32[i] = (float)((int32_t)(i % 2048) - 1024) * 0.37f;
+
+	memset(q, 0, CONVERT_MAX_ELEMS * sizeof(uint16_t));
+
+	printf("\n%-18s %10s %12s %12s\n", "conversion", "elements", "nsec/call",
+	       "Melem/sec");
+	printf("-------------------------------------------------------\n");
+
+	for (int c = 0; c < CONV_NUM; c++) {
+		for (uint32_t num = CONVERT_MIN_ELEMS; num <= CONVERT_MAX_ELEMS; num *= 4) {
+			uint64_t rounds = (uint64_t)glb->opt.rounds * CONVERT_ROUND_ELEMS / num;
+			odp_time_t t1, t2;
+			uint64_t nsec;
+
+			if (rounds == 0)
+				rounds = 1;
+
+			for (int i = 0; i < glb->opt.warmup; i++)
+				convert(c, fp32, q, num);
+
+			t1 = odp_time_local_strict();
+
+			for (uint64_t r = 0; r < rounds; r++)
+				convert(c, fp32, q, num);
+
+			t2 = odp_time_local_strict();
+			nsec = odp_time_diff_ns(t2, t1);
+
+			printf("%-18s %10u %12.1f %12.1f\n", conv_name[c], num,
+			       (double)nsec / rounds,
+			       (double)rounds * num * 1000.0 / (nsec ? nsec : 1));
+		}
+	}
+
+	printf("\n");
+
+out:
+	free(fp32);
+	free(q);
+
+	return ret;
+}
+
 static void print_results_avg(void)
 {
 	int num_threads = glb->opt.num_threads;
@@ -812,6 +1154,9 @@ int main(int argc, char *argv[])
 	}
 
 	memset(glb, 0, sizeof(test_global_t));
+	glb->compl_pool = ODP_POOL_INVALID;
+	for (int i = 0; i < ODP_THREAD_COUNT_MAX; i++)
+		glb->compl_queue[i] = ODP_QUEUE_INVALID;
 
 	ret = parse_args(argc, argv);
 	if (ret) {
@@ -820,6 +1165,11 @@ int main(int argc, char *argv[])
 		goto odp_term;
 	}
 
+	if (glb->opt.mode == MODE_CONVERT) {
+		ret = test_convert();
+		goto odp_term;
+	}
+
 	if (read_file_to_shm(&glb->model_file_shm, &glb->model_file_data, &glb->model_file_size,
 			     glb->opt.model_name, "ml_perf_model")) {
 		ret = -1;
@@ -889,10 +1239,29 @@ int main(int argc, char *argv[])
 	odp_ml_config_t ml_config;
 	odp_ml_model_param_t model_param;
 
+	if (glb->opt.mode == MODE_ASYNC) {
+		if (!(glb->capa.run.compl_mode_mask & ODP_ML_COMPL_MODE_EVENT)) {
+			ODPH_ERR("Event mode run completion not supported\n");
+			ret = TEST_SKIP;
+			goto odp_term;
+		}
+
+		uint32_t num_compl = glb->opt.num_threads * glb->opt.in_flight;
+
+		if (glb->capa.pool.max_num && glb->capa.pool.max_num < num_compl) {
+			ODPH_ERR("Maximum number of completion events %u less than %u\n",
+				 glb->capa.pool.max_num, num_compl);
+			ret = -1;
+			goto odp_term;
+		}
+	}
+
 	odp_ml_config_init(&ml_config);
 	ml_config.max_model_size = glb->capa.max_model_size;
 	ml_config.load_mode_mask = ODP_ML_COMPL_MODE_SYNC;
 	ml_config.run_mode_mask = ODP_ML_COMPL_MODE_SYNC;
+	if (glb->opt.mode == MODE_ASYNC)
+		ml_config.run_mode_mask |= ODP_ML_COMPL_MODE_EVENT;
 
 	if (odp_ml_config(&ml_config)) {
 		ODPH_ERR("odp_ml_config() failed\n");
@@ -974,7 +1343,31 @@ int main(int argc, char *argv[])
 		goto odp_term;
 	}
 
-	if (glb->opt.mode != MODE_INFERENCE && glb->opt.mode != MODE_INFERENCE_QUANT) {
+	if (glb->opt.mode == MODE_ASYNC) {
+		odp_ml_compl_pool_param_t pool_param;
+
+		odp_ml_compl_pool_param_init(&pool_param);
+		pool_param.num = glb->opt.num_threads * glb->opt.in_flight;
+
+		glb->compl_pool = odp_ml_compl_pool_create("ml_perf_compl", &pool_param);
+		if (glb->compl_pool == ODP_POOL_INVALID) {
+			ODPH_ERR("odp_ml_compl_pool_create() failed\n");
+			ret = -1;
+			goto odp_term;
+		}
+
+		for (int i = 0; i < glb->opt.num_threads; i++) {
+			glb->compl_queue[i] = odp_queue_create(NULL, NULL);
+			if (glb->compl_queue[i] == ODP_QUEUE_INVALID) {
+				ODPH_ERR("odp_queue_create() failed\n");
+				ret = -1;
+				goto odp_term;
+			}
+		}
+	}
+
+	if (glb->opt.mode != MODE_INFERENCE && glb->opt.mode != MODE_INFERENCE_QUANT &&
+	    glb->opt.mode != MODE_ASYNC) {
 		const odp_ml_model_t mdl = glb->mdl;
 
 		glb->mdl = ODP_ML_MODEL_INVALID;
@@ -1027,6 +1420,9 @@ int main(int argc, char *argv[])
 		case MODE_LOAD:
 			thr_param[i].start = test_ml_load;
 			break;
+		case MODE_ASYNC:
+			thr_param[i].start = test_ml_async;
+			break;
 		}
 	}
 
@@ -1057,6 +1453,19 @@ int main(int argc, char *argv[])
 
 odp_term:
 
+	for (int i = 0; i < ODP_THREAD_COUNT_MAX; i++) {
+		if (glb->compl_queue[i] != ODP_QUEUE_INVALID &&
+		    odp_queue_destroy(glb->compl_queue[i])) {
+			ODPH_ERR("odp_queue_destroy() failed\n");
+			ret = -1;
+		}
+	}
+
+	if (glb->compl_pool != ODP_POOL_INVALID && odp_pool_destroy(glb->compl_pool)) {
+		ODPH_ERR("odp_pool_destroy() failed\n");
+		ret = -1;
+	}
+
 	if (glb->mdl != ODP_ML_MODEL_INVALID) {
 		if (odp_ml_model_unload(glb->mdl, NULL)) {
 			ODPH_ERR("odp_ml_model_unload() failed\n");
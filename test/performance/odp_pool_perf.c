@@ -24,6 +24,7 @@
 #include <export_results.h>
 
 #define DEFAULT_BURST_SIZE 32
+#define MAX_POOLS          32
 
 #define STAT_AVAILABLE  0x1
 #define STAT_CACHE      0x2
@@ -41,6 +42,7 @@ typedef struct test_options_t {
 	uint32_t data_size;
 	uint32_t cache_size;
 	uint32_t stats_mode;
+	uint32_t num_pool;
 	int      pool_type;
 
 } test_options_t;
@@ -58,7 +60,7 @@ typedef struct test_global_t {
 	test_options_t test_options;
 
 	odp_barrier_t barrier;
-	odp_pool_t pool;
+	odp_pool_t pool[MAX_POOLS];
 	odp_cpumask_t cpumask;
 	odph_thread_t thread_tbl[ODP_THREAD_COUNT_MAX];
 	test_stat_t stat[ODP_THREAD_COUNT_MAX];
@@ -90,9 +92,13 @@ static void print_usage(void)
 	       "                           0x40: total_ops\n"
 	       "  -t, --pool_type        0: Buffer pool (default)\n"
 	       "                         1: Packet pool\n"
+	       "  -p, --num_pool         Number of pools (default 1, max %d). Each pool has 'num_event'\n"
+	       "                         events. When more than one, each burst is allocated evenly from\n"
+	       "                         all pools and freed as a mixed pool burst. Burst size must not be\n"
+	       "                         smaller than the number of pools.\n"
 	       "  -C, --cache_size       Pool cache size (per thread)\n"
 	       "  -h, --help             This help\n"
-	       "\n", DEFAULT_BURST_SIZE);
+	       "\n", DEFAULT_BURST_SIZE, MAX_POOLS);
 }
 
 static int parse_options(int argc, char *argv[], test_options_t *test_options)
@@ -109,12 +115,13 @@ static int parse_options(int argc, char *argv[], test_options_t *test_options)
 		{"data_size",  required_argument, NULL, 's'},
 		{"stats_mode", required_argument, NULL, 'S'},
 		{"pool_type",  required_argument, NULL, 't'},
+		{"num_pool",   required_argument, NULL, 'p'},
 		{"cache_size", required_argument, NULL, 'C'},
 		{"help",       no_argument,       NULL, 'h'},
 		{NULL, 0, NULL, 0}
 	};
 
-	static const char *shortopts = "+c:e:r:b:n:s:S:t:C:h";
+	static const char *shortopts = "+c:e:r:b:n:s:S:t:p:C:h";
 
 	test_options->num_cpu    = 1;
 	test_options->num_event  = 1000;
@@ -124,6 +131,7 @@ static int parse_options(int argc, char *argv[], test_options_t *test_options)
 	test_options->data_size  = 64;
 	test_options->stats_mode = 0;
 	test_options->pool_type  = 0;
+	test_options->num_pool   = 1;
 	test_options->cache_size = UINT32_MAX;
 
 	while (1) {
@@ -157,6 +165,9 @@ static int parse_options(int argc, char *argv[], test_options_t *test_options)
 		case 't':
 			test_options->pool_type = atoi(optarg);
 			break;
+		case 'p':
+			test_options->num_pool = atoi(optarg);
+			break;
 		case 'C':
 			test_options->cache_size = atoi(optarg);
 			break;
@@ -178,6 +189,17 @@ static int parse_options(int argc, char *argv[], test_options_t *test_options)
 		ret = -1;
 	}
 
+	if (test_options->num_pool < 1 || test_options->num_pool > MAX_POOLS) {
+		printf("Bad number of pools (%u)\n", test_options->num_pool);
+		ret = -1;
+	}
+
+	if (test_options->max_burst && test_options->max_burst < test_options->num_pool) {
+		printf("Burst size (%u) smaller than number of pools (%u)\n",
+		       test_options->max_burst, test_options->num_pool);
+		ret = -1;
+	}
+
 	return ret;
 }
 
@@ -228,6 +250,7 @@ static int create_pool(test_global_t *global)
 	uint32_t data_size  = test_options->data_size;
 	uint32_t cache_size = test_options->cache_size;
 	uint32_t stats_mode = test_options->stats_mode;
+	uint32_t num_pool   = test_options->num_pool;
 	int packet_pool = test_options->pool_type;
 
 	stats.all = 0;
@@ -261,6 +284,7 @@ static int create_pool(test_global_t *global)
 	printf("  cache size %u\n", cache_size);
 	printf("  stats mode 0x%x\n", stats_mode);
 	printf("  pool type  %s\n", packet_pool ? "packet" : "buffer");
+	printf("  num pools  %u\n", num_pool);
 	printf("  op type    %s\n\n", test_options->max_burst == 0 ? "single" : "multi");
 
 	if (odp_pool_capability(&pool_capa)) {
@@ -298,6 +322,11 @@ static int create_pool(test_global_t *global)
 		return -1;
 	}
 
+	if (num_pool > pool_capa.max_pools) {
+		printf("Error: max pools supported %u\n", pool_capa.max_pools);
+		return -1;
+	}
+
 	if (max_num && num_event > max_num) {
 		printf("Error: max events supported %u\n", max_num);
 		return -1;
@@ -324,14 +353,16 @@ static int create_pool(test_global_t *global)
 
 	pool_param.stats.all = stats.all;
 
-	pool = odp_pool_create("pool perf", &pool_param);
+	for (uint32_t i = 0; i < num_pool; i++) {
+		pool = odp_pool_create("pool perf", &pool_param);
 
-	if (pool == ODP_POOL_INVALID) {
-		printf("Error: Pool create failed.\n");
-		return -1;
-	}
+		if (pool == ODP_POOL_INVALID) {
+			printf("Error: Pool create failed.\n");
+			return -1;
+		}
 
-	global->pool = pool;
+		global->pool[i] = pool;
+	}
 
 	return 0;
 }
@@ -349,10 +380,17 @@ static inline void record_results(test_stat_t *stats, uint64_t start_cycles, odp
 	stats->cycles = odp_cpu_cycles_diff(finish_cycles, start_cycles);
 }
 
+/* Split burst size evenly between pools */
+static void set_pool_burst(uint32_t pool_burst[], uint32_t num_pool, uint32_t max_burst)
+{
+	for (uint32_t i = 0; i < num_pool; i++)
+		pool_burst[i] = max_burst / num_pool + (i < max_burst % num_pool ? 1 : 0);
+}
+
 static int test_buffer_pool(void *arg)
 {
 	int ret, thr;
-	uint32_t num, num_free, num_freed, i, rounds;
+	uint32_t num, num_free, num_freed, i, p, rounds;
 	uint64_t start_cycles, events, frees;
 	odp_time_t start_time;
 	test_global_t *global = arg;
@@ -360,15 +398,19 @@ static int test_buffer_pool(void *arg)
 	uint32_t num_round = test_options->num_round;
 	uint32_t max_burst = test_options->max_burst;
 	uint32_t num_burst = test_options->num_burst;
+	uint32_t num_pool = test_options->num_pool;
 	uint32_t max_num = num_burst * max_burst;
-	odp_pool_t pool = global->pool;
+	odp_pool_t *pool = global->pool;
 	odp_buffer_t buf[max_num];
+	uint32_t pool_burst[num_pool];
 
 	thr = odp_thread_id();
 
 	for (i = 0; i < max_num; i++)
 		buf[i] = ODP_BUFFER_INVALID;
 
+	set_pool_burst(pool_burst, num_pool, max_burst);
+
 	events = 0;
 	frees = 0;
 	ret = 0;
@@ -383,18 +425,19 @@ static int test_buffer_pool(void *arg)
 		num = 0;
 
 		for (i = 0; i < num_burst; i++) {
-			ret = odp_buffer_alloc_multi(pool, &buf[num],
-						     max_burst);
-			if (odp_unlikely(ret < 0)) {
-				printf("Error: Alloc failed. Round %u\n",
-				       rounds);
-				if (num)
-					odp_buffer_free_multi(buf, num);
-
-				return -1;
+			for (p = 0; p < num_pool; p++) {
+				ret = odp_buffer_alloc_multi(pool[p], &buf[num], pool_burst[p]);
+				if (odp_unlikely(ret < 0)) {
+					printf("Error: Alloc failed. Round %u\n",
+					       rounds);
+					if (num)
+						odp_buffer_free_multi(buf, num);
+
+					return -1;
+				}
+
+				num += ret;
 			}
-
-			num += ret;
 		}
 
 		if (odp_unlikely(num == 0))
@@ -429,7 +472,8 @@ static int test_buffer_pool_single(void *arg)
 	test_options_t *test_options = &global->test_options;
 	uint32_t num_round = test_options->num_round;
 	uint32_t num_burst = test_options->num_burst;
-	odp_pool_t pool = global->pool;
+	uint32_t num_pool = test_options->num_pool;
+	odp_pool_t *pool = global->pool;
 	odp_buffer_t buf[num_burst];
 
 	thr = odp_thread_id();
@@ -450,7 +494,7 @@ static int test_buffer_pool_single(void *arg)
 		num = 0;
 
 		for (i = 0; i < num_burst; i++) {
-			buf[num] = odp_buffer_alloc(pool);
+			buf[num] = odp_buffer_alloc(pool[i % num_pool]);
 
 			if (odp_unlikely(buf[num] == ODP_BUFFER_INVALID))
 				continue;
@@ -478,7 +522,7 @@ static int test_buffer_pool_single(void *arg)
 static int test_packet_pool(void *arg)
 {
 	int ret, thr;
-	uint32_t num, num_free, num_freed, i, rounds;
+	uint32_t num, num_free, num_freed, i, p, rounds;
 	uint64_t start_cycles, events, frees;
 	odp_time_t start_time;
 	test_global_t *global = arg;
@@ -488,14 +532,18 @@ static int test_packet_pool(void *arg)
 	uint32_t num_burst = test_options->num_burst;
 	uint32_t max_num = num_burst * max_burst;
 	uint32_t data_size = test_options->data_size;
-	odp_pool_t pool = global->pool;
+	uint32_t num_pool = test_options->num_pool;
+	odp_pool_t *pool = global->pool;
 	odp_packet_t pkt[max_num];
+	uint32_t pool_burst[num_pool];
 
 	thr = odp_thread_id();
 
 	for (i = 0; i < max_num; i++)
 		pkt[i] = ODP_PACKET_INVALID;
 
+	set_pool_burst(pool_burst, num_pool, max_burst);
+
 	events = 0;
 	frees = 0;
 	ret = 0;
@@ -510,19 +558,21 @@ static int test_packet_pool(void *arg)
 		num = 0;
 
 		for (i = 0; i < num_burst; i++) {
-			ret = odp_packet_alloc_multi(pool, data_size, &pkt[num],
-						     max_burst);
-			if (odp_unlikely(ret < 0)) {
-				printf("Error: Alloc failed. Round %u\n",
-				       rounds);
+			for (p = 0; p < num_pool; p++) {
+				ret = odp_packet_alloc_multi(pool[p], data_size, &pkt[num],
+							     pool_burst[p]);
+				if (odp_unlikely(ret < 0)) {
+					printf("Error: Alloc failed. Round %u\n",
+					       rounds);
 
-				if (num)
-					odp_packet_free_multi(pkt, num);
+					if (num)
+						odp_packet_free_multi(pkt, num);
 
-				return -1;
-			}
+					return -1;
+				}
 
-			num += ret;
+				num += ret;
+			}
 		}
 
 		if (odp_unlikely(num == 0))
@@ -558,7 +608,8 @@ static int test_packet_pool_single(void *arg)
 	uint32_t num_round = test_options->num_round;
 	uint32_t num_burst = test_options->num_burst;
 	uint32_t data_size = test_options->data_size;
-	odp_pool_t pool = global->pool;
+	uint32_t num_pool = test_options->num_pool;
+	odp_pool_t *pool = global->pool;
 	odp_packet_t pkt[num_burst];
 
 	thr = odp_thread_id();
@@ -579,7 +630,7 @@ static int test_packet_pool_single(void *arg)
 		num = 0;
 
 		for (i = 0; i < num_burst; i++) {
-			pkt[num] = odp_packet_alloc(pool, data_size);
+			pkt[num] = odp_packet_alloc(pool[i % num_pool], data_size);
 
 			if (odp_unlikely(pkt[num] == ODP_PACKET_INVALID))
 				continue;
@@ -641,7 +692,7 @@ static void test_stats_perf(test_global_t *global)
 	uint64_t nsec;
 	int i;
 	int num_thr = global->test_options.num_cpu + 1; /* workers + main thread */
-	odp_pool_t pool = global->pool;
+	odp_pool_t pool = global->pool[0];
 	double nsec_ave = 0.0;
 	const int rounds = 1000;
 
@@ -691,7 +742,7 @@ static int output_results(test_global_t *global)
 	double events_ave, nsec_ave, cycles_ave;
 	test_options_t *test_options = &global->test_options;
 	int num_cpu = test_options->num_cpu;
-	uint32_t num_burst = test_options->num_burst;
+	uint32_t num_alloc = test_options->num_burst;
 	uint64_t rounds_sum = 0;
 	uint64_t frees_sum = 0;
 	uint64_t events_sum = 0;
@@ -713,7 +764,11 @@ static int output_results(test_global_t *global)
 	}
 
 	rounds_ave = rounds_sum / num_cpu;
-	allocs_ave = (num_burst * rounds_sum) / num_cpu;
+	/* Multi event tests allocate each burst from all pools */
+	if (test_options->max_burst)
+		num_alloc *= test_options->num_pool;
+
+	allocs_ave = (num_alloc * rounds_sum) / num_cpu;
 	frees_ave  = frees_sum / num_cpu;
 	events_ave = events_sum / num_cpu;
 	nsec_ave   = nsec_sum / num_cpu;
@@ -846,7 +901,8 @@ int main(int argc, char **argv)
 	}
 
 	memset(global, 0, sizeof(test_global_t));
-	global->pool = ODP_POOL_INVALID;
+	for (int i = 0; i < MAX_POOLS; i++)
+		global->pool[i] = ODP_POOL_INVALID;
 
 	global->common_options = common_options;
 
@@ -873,9 +929,11 @@ int main(int argc, char **argv)
 	if (output_results(global))
 		return -1;
 
-	if (odp_pool_destroy(global->pool)) {
-		printf("Error: Pool destroy failed.\n");
-		return -1;
+	for (uint32_t i = 0; i < global->test_options.num_pool; i++) {
+		if (odp_pool_destroy(global->pool[i])) {
+			printf("Error: Pool destroy failed.\n");
+			return -1;
+		}
 	}
 
 	if (odp_shm_free(shm)) {
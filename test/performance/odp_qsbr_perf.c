@@ -0,0 +1,524 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @example odp_qsbr_perf.c
+ *
+ * Performance test application for quiescent state based reclamation (QSBR) APIs. Compares
+ * read side cost of QSBR protected objects to reference counted objects.
+ *
+ * @cond _ODP_HIDE_FROM_DOXYGEN_
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <getopt.h>
+
+#include <odp_api.h>
+#include <odp/helper/odph_api.h>
+
+#include <export_results.h>
+
+#define MAX_OBJ      1024
+#define OBJ_DATA     6
+
+enum {
+	MODE_REFCOUNT = 0,
+	MODE_QSBR,
+	MODE_NONE
+};
+
+typedef struct test_options_t {
+	uint32_t mode;
+	uint32_t num_obj;
+	uint32_t burst;
+	uint32_t num_round;
+	int num_cpu;
+
+} test_options_t;
+
+typedef struct test_stat_t {
+	uint64_t rounds;
+	uint64_t reads;
+	uint64_t sum;
+	uint64_t nsec;
+	uint64_t cycles;
+
+} test_stat_t;
+
+/* Reference count and data of an object share a cache line */
+typedef struct ODP_ALIGNED_CACHE obj_t {
+	odp_atomic_u32_t refcount;
+	uint32_t pad;
+	uint64_t data[OBJ_DATA];
+
+} obj_t;
+
+typedef struct test_global_t {
+	odp_barrier_t barrier;
+	test_options_t options;
+	odp_instance_t instance;
+	odp_qsbr_t qsbr;
+	odp_atomic_u64_t obj_ptr[MAX_OBJ];
+	obj_t obj[MAX_OBJ];
+	odph_thread_t thread_tbl[ODP_THREAD_COUNT_MAX];
+	test_stat_t stat[ODP_THREAD_COUNT_MAX];
+	test_common_options_t common_options;
+
+} test_global_t;
+
+static const char *mode_name[] = {"refcount", "QSBR", "none"};
+
+static void print_usage(void)
+{
+	printf("\n"
+	       "QSBR performance test\n"
+	       "\n"
+	       "Usage: odp_qsbr_perf [options]\n"
+	       "\n"
+	       "  -c, --num_cpu <num>     Number of worker threads. Default: 1\n"
+	       "  -m, --mode <num>        Object protection mode:\n"
+	       "                            0: Reference count (atomic increment and decrement\n"
+	       "                               per object access)\n"
+	       "                            1: QSBR (quiescent state reported once per burst)\n"
+	       "                            2: None (no protection, baseline)\n"
+	       "                          Default: 1\n"
+	       "  -n, --num_obj <num>     Number of shared objects. Default: 16\n"
+	       "  -b, --burst <num>       Number of object reads per round. Default: 32\n"
+	       "  -r, --num_round <num>   Number of rounds. Default: 1000000\n"
+	       "  -h, --help              This help\n"
+	       "\n");
+}
+
+static int parse_options(int argc, char *argv[], test_options_t *test_options)
+{
+	int opt;
+	int ret = 0;
+
+	static const struct option longopts[] = {
+		{ "num_cpu", required_argument, NULL, 'c' },
+		{ "mode", required_argument, NULL, 'm' },
+		{ "num_obj", required_argument, NULL, 'n' },
+		{ "burst", required_argument, NULL, 'b' },
+		{ "num_round", required_argument, NULL, 'r' },
+		{ "help", no_argument, NULL, 'h' },
+		{ NULL, 0, NULL, 0 }
+	};
+
+	static const char *shortopts = "+c:m:n:b:r:h";
+
+	test_options->num_cpu = 1;
+	test_options->mode = MODE_QSBR;
+	test_options->num_obj = 16;
+	test_options->burst = 32;
+	test_options->num_round = 1000000;
+
+	while (1) {
+		opt = getopt_long(argc, argv, shortopts, longopts, NULL);
+
+		if (opt == -1)
+			break;
+
+		switch (opt) {
+		case 'c':
+			test_options->num_cpu = atoi(optarg);
+			break;
+		case 'm':
+			test_options->mode = atoi(optarg);
+			break;
+		case 'n':
+			test_options->num_obj = atoi(optarg);
+			break;
+		case 'b':
+			test_options->burst = atoi(optarg);
+			break;
+		case 'r':
+			test_options->num_round = atoi(optarg);
+			break;
+		case 'h':
+			/* fall through */
+		default:
+			print_usage();
+			ret = -1;
+			break;
+		}
+	}
+
+	if (test_options->mode > MODE_NONE) {
+		ODPH_ERR("Bad mode %u\n", test_options->mode);
+		return -1;
+	}
+
+	if (test_options->num_obj == 0 || test_options->num_obj > MAX_OBJ) {
+		ODPH_ERR("Bad number of objects %u. Test maximum %u.\n",
+			 test_options->num_obj, MAX_OBJ);
+		return -1;
+	}
+
+	if (test_options->burst == 0) {
+		ODPH_ERR("Bad burst size %u\n", test_options->burst);
+		return -1;
+	}
+
+	return ret;
+}
+
+static int create_objects(test_global_t *global)
+{
+	test_options_t *test_options = &global->options;
+	odp_qsbr_param_t param;
+
+	printf("\nQSBR performance test\n");
+	printf("  mode                 %s\n", mode_name[test_options->mode]);
+	printf("  num rounds           %u\n", test_options->num_round);
+	printf("  num objects          %u\n", test_options->num_obj);
+	printf("  burst size           %u\n", test_options->burst);
+
+	for (uint32_t i = 0; i < test_options->num_obj; i++) {
+		obj_t *obj = &global->obj[i];
+
+		/* Object table holds one reference */
+		odp_atomic_init_u32(&obj->refcount, 1);
+
+		for (int j = 0; j < OBJ_DATA; j++)
+			obj->data[j] = i + j;
+
+		odp_atomic_init_u64(&global->obj_ptr[i], (uintptr_t)obj);
+	}
+
+	if (test_options->mode != MODE_QSBR)
+		return 0;
+
+	odp_qsbr_param_init(&param);
+
+	global->qsbr = odp_qsbr_create("qsbr_perf", &param);
+	if (global->qsbr == ODP_QSBR_INVALID) {
+		ODPH_ERR("QSBR domain create failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static inline uint64_t read_obj(obj_t *obj)
+{
+	uint64_t sum = 0;
+
+	for (int j = 0; j < OBJ_DATA; j++)
+		sum += obj->data[j];
+
+	return sum;
+}
+
+static inline obj_t *get_obj(test_global_t *global, uint32_t i)
+{
+	return (obj_t *)(uintptr_t)odp_atomic_load_acq_u64(&global->obj_ptr[i]);
+}
+
+static int run_test(void *arg)
+{
+	uint64_t c1, c2;
+	odp_time_t t1, t2;
+	uint32_t rounds, i;
+	test_global_t *global = arg;
+	test_options_t *test_options = &global->options;
+	odp_qsbr_t qsbr = global->qsbr;
+	uint32_t num_round = test_options->num_round;
+	uint32_t burst = test_options->burst;
+	uint32_t num_obj = test_options->num_obj;
+	uint32_t mode = test_options->mode;
+	int thr = odp_thread_id();
+	test_stat_t *stat = &global->stat[thr];
+	uint32_t idx = thr % num_obj;
+	uint64_t sum = 0;
+
+	if (mode == MODE_QSBR && odp_qsbr_thread_online(qsbr)) {
+		ODPH_ERR("QSBR thread online failed\n");
+		return -1;
+	}
+
+	/* Start all workers at the same time */
+	odp_barrier_wait(&global->barrier);
+
+	t1 = odp_time_local();
+	c1 = odp_cpu_cycles();
+
+	for (rounds = 0; rounds < num_round; rounds++) {
+		if (mode == MODE_REFCOUNT) {
+			for (i = 0; i < burst; i++) {
+				obj_t *obj = get_obj(global, idx);
+
+				odp_atomic_inc_u32(&obj->refcount);
+				sum += read_obj(obj);
+
+				/* Table reference keeps the count above zero */
+				if (odp_unlikely(odp_atomic_fetch_dec_u32(&obj->refcount) == 1))
+					ODPH_ABORT("Bad reference count\n");
+
+				idx++;
+				if (idx == num_obj)
+					idx = 0;
+			}
+		} else {
+			for (i = 0; i < burst; i++) {
+				sum += read_obj(get_obj(global, idx));
+
+				idx++;
+				if (idx == num_obj)
+					idx = 0;
+			}
+
+			if (mode == MODE_QSBR)
+				odp_qsbr_quiescent(qsbr);
+		}
+	}
+
+	c2 = odp_cpu_cycles();
+	t2 = odp_time_local();
+
+	if (mode == MODE_QSBR)
+		odp_qsbr_thread_offline(qsbr);
+
+	stat->rounds = rounds;
+	stat->reads = (uint64_t)rounds * burst;
+	stat->sum = sum;
+	stat->nsec = odp_time_diff_ns(t2, t1);
+	stat->cycles = odp_cpu_cycles_diff(c2, c1);
+
+	return 0;
+}
+
+static int start_workers(test_global_t *global)
+{
+	odph_thread_common_param_t thr_common;
+	odph_thread_param_t thr_param;
+	odp_cpumask_t cpumask;
+	int ret;
+	test_options_t *test_options = &global->options;
+	int num_cpu = test_options->num_cpu;
+
+	ret = odp_cpumask_default_worker(&cpumask, num_cpu);
+
+	if (num_cpu && ret != num_cpu) {
+		ODPH_ERR("Error: Too many workers. Max supported %i\n.", ret);
+		return -1;
+	}
+
+	/* Zero: all available workers */
+	if (num_cpu == 0) {
+		num_cpu = ret;
+		test_options->num_cpu = num_cpu;
+	}
+
+	printf("  num workers          %u\n\n", num_cpu);
+
+	odp_barrier_init(&global->barrier, num_cpu);
+
+	odph_thread_common_param_init(&thr_common);
+	thr_common.instance = global->instance;
+	thr_common.cpumask = &cpumask;
+	thr_common.share_param = 1;
+
+	odph_thread_param_init(&thr_param);
+	thr_param.start = run_test;
+	thr_param.arg = global;
+	thr_param.thr_type = ODP_THREAD_WORKER;
+
+	if (odph_thread_create(global->thread_tbl, &thr_common, &thr_param,
+			       num_cpu) != num_cpu)
+		return -1;
+
+	return 0;
+}
+
+static int output_results(test_global_t *global)
+{
+	int i, num;
+	double nsec_ave, cycles_ave, reads_ave;
+	test_options_t *test_options = &global->options;
+	int num_cpu = test_options->num_cpu;
+	uint64_t rounds_sum = 0;
+	uint64_t read_sum = 0;
+	uint64_t nsec_sum = 0;
+	uint64_t cycles_sum = 0;
+
+	for (i = 0; i < ODP_THREAD_COUNT_MAX; i++) {
+		rounds_sum += global->stat[i].rounds;
+		read_sum += global->stat[i].reads;
+		nsec_sum += global->stat[i].nsec;
+		cycles_sum += global->stat[i].cycles;
+	}
+
+	if (rounds_sum == 0 || nsec_sum == 0) {
+		printf("No results.\n");
+		return 0;
+	}
+
+	nsec_ave = nsec_sum / num_cpu;
+	cycles_ave = cycles_sum / num_cpu;
+	reads_ave = read_sum / num_cpu;
+	num = 0;
+
+	printf("RESULTS - per thread (Million object reads per sec):\n");
+	printf("---------------------------------------------------\n");
+	printf("        1      2      3      4      5      6      7      8      9     10");
+
+	for (i = 0; i < ODP_THREAD_COUNT_MAX; i++) {
+		if (global->stat[i].rounds) {
+			if ((num % 10) == 0)
+				printf("\n   ");
+
+			printf("%6.1f ", (1000.0 * global->stat[i].reads) / global->stat[i].nsec);
+			num++;
+		}
+	}
+	printf("\n\n");
+
+	printf("RESULTS - per thread average (%i threads):\n", num_cpu);
+	printf("------------------------------------------\n");
+	printf("  duration:                 %.3f msec\n", nsec_ave / 1000000);
+	printf("  num cycles:               %.3f M\n", cycles_ave / 1000000);
+	printf("  cycles per read:          %.3f\n", cycles_ave / reads_ave);
+	printf("  reads per sec:            %.3f M\n\n", (1000.0 * reads_ave) / nsec_ave);
+
+	printf("TOTAL reads per sec:        %.3f M\n\n", (1000.0 * read_sum) / nsec_ave);
+
+	if (global->common_options.is_export) {
+		if (test_common_write("duration (msec),num cycles (M),cycles per read,"
+				      "reads per sec (M),total reads per sec (M)\n")) {
+			ODPH_ERR("Export failed\n");
+			test_common_write_term();
+			return -1;
+		}
+
+		if (test_common_write("%f,%f,%f,%f,%f\n",
+				      nsec_ave / 1000000, cycles_ave / 1000000,
+				      cycles_ave / reads_ave, (1000.0 * reads_ave) / nsec_ave,
+				      (1000.0 * read_sum) / nsec_ave)) {
+			ODPH_ERR("Export failed\n");
+			test_common_write_term();
+			return -1;
+		}
+
+		test_common_write_term();
+	}
+
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	odph_helper_options_t helper_options;
+	odp_instance_t instance;
+	odp_init_t init;
+	odp_shm_t shm;
+	test_global_t *global;
+	test_common_options_t common_options;
+	int ret = 0;
+
+	/* Let helper collect its own arguments (e.g. --odph_proc) */
+	argc = odph_parse_options(argc, argv);
+	if (odph_options(&helper_options)) {
+		ODPH_ERR("Error: Reading ODP helper options failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	argc = test_common_parse_options(argc, argv);
+	if (test_common_options(&common_options)) {
+		ODPH_ERR("Error: Reading test options failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	/* List features not to be used */
+	odp_init_param_init(&init);
+	init.not_used.feat.cls = 1;
+	init.not_used.feat.compress = 1;
+	init.not_used.feat.crypto = 1;
+	init.not_used.feat.ipsec = 1;
+	init.not_used.feat.schedule = 1;
+	init.not_used.feat.timer = 1;
+	init.not_used.feat.tm = 1;
+
+	init.mem_model = helper_options.mem_model;
+
+	/* Init ODP before calling anything else */
+	if (odp_init_global(&instance, &init, NULL)) {
+		ODPH_ERR("Error: Global init failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	/* Init this thread */
+	if (odp_init_local(instance, ODP_THREAD_CONTROL)) {
+		ODPH_ERR("Error: Local init failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	shm = odp_shm_reserve("qsbr_perf_global", sizeof(test_global_t),
+			      ODP_CACHE_LINE_SIZE, 0);
+	if (shm == ODP_SHM_INVALID) {
+		ODPH_ERR("Error: Shared mem reserve failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	global = odp_shm_addr(shm);
+	if (global == NULL) {
+		ODPH_ERR("Error: Shared mem alloc failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	memset(global, 0, sizeof(test_global_t));
+	global->qsbr = ODP_QSBR_INVALID;
+	global->common_options = common_options;
+
+	if (parse_options(argc, argv, &global->options))
+		exit(EXIT_FAILURE);
+
+	odp_sys_info_print();
+
+	global->instance = instance;
+
+	if (create_objects(global)) {
+		ODPH_ERR("Error: Create objects failed.\n");
+		ret = -1;
+		goto destroy;
+	}
+
+	if (start_workers(global)) {
+		ODPH_ERR("Error: Test start failed.\n");
+		ret = -1;
+		goto destroy;
+	}
+
+	/* Wait workers to exit */
+	odph_thread_join(global->thread_tbl, global->options.num_cpu);
+
+	if (output_results(global))
+		ret = -1;
+
+destroy:
+	if (global->qsbr != ODP_QSBR_INVALID && odp_qsbr_destroy(global->qsbr)) {
+		ODPH_ERR("Error: Destroy QSBR domain failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_shm_free(shm)) {
+		ODPH_ERR("Error: Shared mem free failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_term_local()) {
+		ODPH_ERR("Error: term local failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_term_global(instance)) {
+		ODPH_ERR("Error: term global failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	return ret;
+}
@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: BSD-3-Clause
- * Copyright (c) 2021-2024 Nokia
+ * Copyright (c) 2021-2026 Nokia
  */
 
 /**
@@ -23,6 +23,11 @@
 
 #define MB (1024ull * 1024ull)
 
+/* Request sizes of small request mode */
+static const uint32_t small_size[] = { 8, 16 };
+
+#define NUM_SMALL_SIZE ODPH_ARRAY_SIZE(small_size)
+
 typedef struct test_global_t test_global_t;
 
 typedef struct thread_arg_t {
@@ -79,6 +84,8 @@ static void print_usage(void)
 	       "  -m, --mode    Test mode select (default: 0):\n"
 	       "                  0: Data throughput\n"
 	       "                  1: Data generation latency (size: 8B by default)\n"
+	       "                  2: Small request throughput and latency. Runs latency test\n"
+	       "                     with 8B and 16B requests (e.g. IVs). Size option is ignored.\n"
 	       "  -c, --num_cpu Number of CPUs (worker threads). 0: all available CPUs. Default 1.\n"
 	       "  -s, --size    Size of buffer in bytes. Default %u.\n"
 	       "  -r, --rounds  Number of test rounds. Default %u.\n"
@@ -153,6 +160,11 @@ static int parse_options(int argc, char *argv[])
 		return -1;
 	}
 
+	if (options.mode < 0 || options.mode > 2) {
+		ODPH_ERR("Bad mode: %i\n", options.mode);
+		return -1;
+	}
+
 	if (options.size == 0) {
 		options.size = options_def.size;
 
@@ -160,11 +172,17 @@ static int parse_options(int argc, char *argv[])
 			options.size = 8;
 	}
 
+	if (options.mode == 2)
+		options.size = small_size[NUM_SMALL_SIZE - 1];
+
 	printf("\nOptions:\n");
 	printf("------------------------\n");
 	printf("  mode:      %i\n", options.mode);
 	printf("  num_cpu:   %i\n", options.num_threads);
-	printf("  size:      %u\n", options.size);
+	if (options.mode == 2)
+		printf("  size:      %u, %u\n", small_size[0], small_size[1]);
+	else
+		printf("  size:      %u\n", options.size);
 	printf("  rounds:    %u\n", options.rounds);
 	printf("  time:      %u\n", options.msec);
 	printf("  delay:     %" PRIu64 "\n", options.delay);
@@ -503,6 +521,21 @@ static void test_type(odp_instance_t instance, test_global_t *global, odp_random
 	printf("\n");
 }
 
+static void test_all_types(odp_instance_t instance, test_global_t *global)
+{
+	switch (odp_random_max_kind()) {
+	case ODP_RANDOM_TRUE:
+		test_type(instance, global, ODP_RANDOM_TRUE);
+		/* fall through */
+	case ODP_RANDOM_CRYPTO:
+		test_type(instance, global, ODP_RANDOM_CRYPTO);
+		/* fall through */
+	default:
+		test_type(instance, global, ODP_RANDOM_BASIC);
+		test_type(instance, global, PSEUDO_RANDOM);
+	}
+}
+
 int main(int argc, char **argv)
 {
 	odph_helper_options_t helper_options;
@@ -584,16 +617,13 @@ int main(int argc, char **argv)
 		global->thread_arg[i].data = addr + i * size;
 	}
 
-	switch (odp_random_max_kind()) {
-	case ODP_RANDOM_TRUE:
-		test_type(instance, global, ODP_RANDOM_TRUE);
-		/* fall through */
-	case ODP_RANDOM_CRYPTO:
-		test_type(instance, global, ODP_RANDOM_CRYPTO);
-		/* fall through */
-	default:
-		test_type(instance, global, ODP_RANDOM_BASIC);
-		test_type(instance, global, PSEUDO_RANDOM);
+	if (options.mode == 2) {
+		for (i = 0; i < (int)NUM_SMALL_SIZE; i++) {
+			options.size = small_size[i];
+			test_all_types(instance, global);
+		}
+	} else {
+		test_all_types(instance, global);
 	}
 
 	if (odp_shm_free(shm_data)) {
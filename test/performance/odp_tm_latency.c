@@ -0,0 +1,616 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+/**
+ * @example odp_tm_latency.c
+ *
+ * Traffic manager queuing latency test. A heavy flow overloads a shaped TM node, while a light
+ * flow sends packets at a low rate through the same tm_queue. Latency from enqueue to TM egress
+ * is measured per flow, with and without flow queuing (FQ-CoDel) in the tm_queue.
+ *
+ * @cond _ODP_HIDE_FROM_DOXYGEN_
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <getopt.h>
+
+#include <odp_api.h>
+#include <odp/helper/odph_api.h>
+
+#include <export_results.h>
+
+#define MODE_FIFO    0
+#define MODE_FQ      1
+#define MODE_BOTH    2
+
+#define FLOW_HEAVY   0
+#define FLOW_LIGHT   1
+#define NUM_FLOWS    2
+
+/* Time to wait for the TM system to become idle after the test */
+#define DRAIN_TMO_NS (10 * ODP_TIME_SEC_IN_NS)
+
+typedef struct test_options_t {
+	uint32_t mode;
+	uint32_t rate_mbps;
+	uint32_t load_pct;
+	uint32_t light_us;
+	uint32_t duration;
+	uint32_t pkt_len;
+	uint32_t max_pkts;
+
+} test_options_t;
+
+typedef struct flow_stat_t {
+	uint64_t sent;
+	odp_atomic_u64_t rcvd;
+	odp_atomic_u64_t lat_sum;
+	odp_atomic_u64_t lat_min;
+	odp_atomic_u64_t lat_max;
+
+} flow_stat_t;
+
+typedef struct test_global_t {
+	test_options_t options;
+	odp_tm_t tm;
+	odp_tm_node_t tm_node;
+	odp_tm_shaper_t shaper;
+	odp_tm_threshold_t threshold;
+	odp_pool_t pool;
+	flow_stat_t stat[NUM_FLOWS];
+	test_common_options_t common_options;
+
+} test_global_t;
+
+/* TM egress function has no argument for the test context */
+static test_global_t *test_global;
+
+static void print_usage(void)
+{
+	printf("\n"
+	       "Traffic manager queuing latency test\n"
+	       "\n"
+	       "Usage: odp_tm_latency [options]\n"
+	       "\n"
+	       "  -m, --mode <num>        tm_queue mode. Default: 2\n"
+	       "                          0: FIFO with packet count threshold\n"
+	       "                          1: Flow queuing (FQ-CoDel)\n"
+	       "                          2: Both, one after another\n"
+	       "  -r, --rate <mbps>       TM node shaper rate in Mbps. Default: 10\n"
+	       "  -l, --load <pct>        Heavy flow rate in percent of the shaper rate. Default: 200\n"
+	       "  -i, --interval <usec>   Light flow packet interval in usec. Default: 10000\n"
+	       "  -t, --time <sec>        Test duration per mode in seconds. Default: 2\n"
+	       "  -s, --pkt_len <bytes>   Packet length. Default: 1000\n"
+	       "  -p, --max_pkts <num>    Maximum number of packets in the tm_queue. Default: 1024\n"
+	       "  -h, --help              This help\n"
+	       "\n");
+}
+
+static int parse_options(int argc, char *argv[], test_options_t *test_options)
+{
+	int opt;
+	int ret = 0;
+
+	static const struct option longopts[] = {
+		{ "mode", required_argument, NULL, 'm' },
+		{ "rate", required_argument, NULL, 'r' },
+		{ "load", required_argument, NULL, 'l' },
+		{ "interval", required_argument, NULL, 'i' },
+		{ "time", required_argument, NULL, 't' },
+		{ "pkt_len", required_argument, NULL, 's' },
+		{ "max_pkts", required_argument, NULL, 'p' },
+		{ "help", no_argument, NULL, 'h' },
+		{ NULL, 0, NULL, 0 }
+	};
+
+	static const char *shortopts = "+m:r:l:i:t:s:p:h";
+
+	test_options->mode = MODE_BOTH;
+	test_options->rate_mbps = 10;
+	test_options->load_pct = 200;
+	test_options->light_us = 10000;
+	test_options->duration = 2;
+	test_options->pkt_len = 1000;
+	test_options->max_pkts = 1024;
+
+	while (1) {
+		opt = getopt_long(argc, argv, shortopts, longopts, NULL);
+
+		if (opt == -1)
+			break;
+
+		switch (opt) {
+		case 'm':
+			test_options->mode = atoi(optarg);
+			break;
+		case 'r':
+			test_options->rate_mbps = atoi(optarg);
+			break;
+		case 'l':
+			test_options->load_pct = atoi(optarg);
+			break;
+		case 'i':
+			test_options->light_us = atoi(optarg);
+			break;
+		case 't':
+			test_options->duration = atoi(optarg);
+			break;
+		case 's':
+			test_options->pkt_len = atoi(optarg);
+			break;
+		case 'p':
+			test_options->max_pkts = atoi(optarg);
+			break;
+		case 'h':
+			/* fall through */
+		default:
+			print_usage();
+			ret = -1;
+			break;
+		}
+	}
+
+	if (test_options->mode > MODE_BOTH) {
+		ODPH_ERR("Bad mode %u\n", test_options->mode);
+		return -1;
+	}
+
+	if (test_options->rate_mbps == 0 || test_options->load_pct == 0 ||
+	    test_options->light_us == 0 || test_options->duration == 0 ||
+	    test_options->max_pkts == 0) {
+		ODPH_ERR("Rate, load, interval, time and max_pkts must be non-zero\n");
+		return -1;
+	}
+
+	if (test_options->pkt_len < 64) {
+		ODPH_ERR("Too short packet length %u\n", test_options->pkt_len);
+		return -1;
+	}
+
+	return ret;
+}
+
+static void egress_fn(odp_packet_t pkt)
+{
+	flow_stat_t *stat = &test_global->stat[odp_packet_flow_hash(pkt) == FLOW_LIGHT];
+	uint64_t lat = odp_time_diff_ns(odp_time_global(), odp_packet_ts(pkt));
+
+	odp_atomic_inc_u64(&stat->rcvd);
+	odp_atomic_add_u64(&stat->lat_sum, lat);
+	odp_atomic_min_u64(&stat->lat_min, lat);
+	odp_atomic_max_u64(&stat->lat_max, lat);
+
+	odp_packet_free(pkt);
+}
+
+static int create_tm(test_global_t *global)
+{
+	test_options_t *test_options = &global->options;
+	odp_tm_capabilities_t capa;
+	odp_tm_requirements_t req;
+	odp_tm_egress_t egress;
+	odp_tm_shaper_params_t shaper_param;
+	odp_tm_threshold_params_t threshold_param;
+	odp_tm_node_params_t node_param;
+	odp_pool_capability_t pool_capa;
+	odp_pool_param_t pool_param;
+	uint32_t num_pkt;
+
+	odp_tm_egress_init(&egress);
+	egress.egress_kind = ODP_TM_EGRESS_FN;
+	egress.egress_fcn = egress_fn;
+
+	if (odp_tm_egress_capabilities(&capa, &egress)) {
+		ODPH_ERR("TM egress capabilities failed\n");
+		return -1;
+	}
+
+	if (test_options->mode != MODE_FIFO && !capa.tm_queue_fq.supported) {
+		ODPH_ERR("Flow queuing not supported\n");
+		return -1;
+	}
+
+	if (test_options->mode != MODE_FIFO &&
+	    (test_options->max_pkts > capa.tm_queue_fq.max_pkts ||
+	     capa.tm_queue_fq.max_flows < NUM_FLOWS)) {
+		ODPH_ERR("Flow queue too small. Max packets %u, max flows %u.\n",
+			 capa.tm_queue_fq.max_pkts, capa.tm_queue_fq.max_flows);
+		return -1;
+	}
+
+	odp_tm_requirements_init(&req);
+	req.max_tm_queues = 16;
+	req.num_levels = 1;
+	req.tm_queue_threshold_needed = true;
+	req.tm_queue_fq_needed = test_options->mode != MODE_FIFO;
+	req.per_level[0].max_num_tm_nodes = 1;
+	req.per_level[0].max_fanin_per_node = 1;
+	req.per_level[0].tm_node_shaper_needed = true;
+
+	global->tm = odp_tm_create("tm_latency", &req, &egress);
+	if (global->tm == ODP_TM_INVALID) {
+		ODPH_ERR("TM create failed\n");
+		return -1;
+	}
+
+	odp_tm_shaper_params_init(&shaper_param);
+	shaper_param.commit_rate = (uint64_t)test_options->rate_mbps * 1000000;
+	/* Burst of a few packets */
+	shaper_param.commit_burst = 4 * 8 * test_options->pkt_len;
+
+	global->shaper = odp_tm_shaper_create("tm_latency_shaper", &shaper_param);
+	if (global->shaper == ODP_TM_INVALID) {
+		ODPH_ERR("Shaper create failed\n");
+		return -1;
+	}
+
+	odp_tm_threshold_params_init(&threshold_param);
+	threshold_param.max_pkts = test_options->max_pkts;
+	threshold_param.enable_max_pkts = true;
+
+	global->threshold = odp_tm_threshold_create("tm_latency_threshold", &threshold_param);
+	if (global->threshold == ODP_TM_INVALID) {
+		ODPH_ERR("Threshold create failed\n");
+		return -1;
+	}
+
+	odp_tm_node_params_init(&node_param);
+	node_param.max_fanin = 1;
+	node_param.shaper_profile = global->shaper;
+	node_param.level = 0;
+
+	global->tm_node = odp_tm_node_create(global->tm, "tm_latency_node", &node_param);
+	if (global->tm_node == ODP_TM_INVALID) {
+		ODPH_ERR("TM node create failed\n");
+		return -1;
+	}
+
+	if (odp_tm_node_connect(global->tm_node, ODP_TM_ROOT)) {
+		ODPH_ERR("TM node connect failed\n");
+		return -1;
+	}
+
+	if (odp_pool_capability(&pool_capa)) {
+		ODPH_ERR("Pool capability failed\n");
+		return -1;
+	}
+
+	/* Packets in the queue plus those in flight inside the TM system */
+	num_pkt = 2 * test_options->max_pkts + 256;
+
+	if (pool_capa.pkt.max_num && num_pkt > pool_capa.pkt.max_num)
+		num_pkt = pool_capa.pkt.max_num;
+
+	odp_pool_param_init(&pool_param);
+	pool_param.type = ODP_POOL_PACKET;
+	pool_param.pkt.num = num_pkt;
+	pool_param.pkt.len = test_options->pkt_len;
+	pool_param.pkt.max_len = test_options->pkt_len;
+
+	global->pool = odp_pool_create("tm_latency_pool", &pool_param);
+	if (global->pool == ODP_POOL_INVALID) {
+		ODPH_ERR("Pool create failed\n");
+		return -1;
+	}
+
+	if (odp_tm_start(global->tm)) {
+		ODPH_ERR("TM start failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static odp_tm_queue_t create_queue(test_global_t *global, int fq)
+{
+	test_options_t *test_options = &global->options;
+	odp_tm_queue_params_t param;
+	odp_tm_queue_t tm_queue;
+
+	odp_tm_queue_params_init(&param);
+
+	if (fq) {
+		param.fq.enable = true;
+		param.fq.num_flows = NUM_FLOWS * 32;
+		param.fq.max_pkts = test_options->max_pkts;
+	} else {
+		param.threshold_profile = global->threshold;
+	}
+
+	tm_queue = odp_tm_queue_create(global->tm, &param);
+	if (tm_queue == ODP_TM_INVALID) {
+		ODPH_ERR("TM queue create failed\n");
+		return ODP_TM_INVALID;
+	}
+
+	if (odp_tm_queue_connect(tm_queue, global->tm_node)) {
+		ODPH_ERR("TM queue connect failed\n");
+		odp_tm_queue_destroy(tm_queue);
+		return ODP_TM_INVALID;
+	}
+
+	return tm_queue;
+}
+
+static int send_pkt(test_global_t *global, odp_tm_queue_t tm_queue, int flow)
+{
+	odp_packet_t pkt;
+
+	pkt = odp_packet_alloc(global->pool, global->options.pkt_len);
+	if (pkt == ODP_PACKET_INVALID)
+		return -1;
+
+	odp_packet_flow_hash_set(pkt, flow);
+	odp_packet_ts_set(pkt, odp_time_global());
+
+	/* Dropped packets are consumed */
+	if (odp_tm_enq_multi(tm_queue, &pkt, 1) != 1) {
+		odp_packet_free(pkt);
+		return -1;
+	}
+
+	return 0;
+}
+
+static int run_test(test_global_t *global, int fq)
+{
+	test_options_t *test_options = &global->options;
+	uint64_t heavy_pps = ((uint64_t)test_options->rate_mbps * 1000000 / 100) *
+			     test_options->load_pct / (8 * test_options->pkt_len);
+	uint64_t duration_ns = test_options->duration * ODP_TIME_SEC_IN_NS;
+	uint64_t light_ns = test_options->light_us * ODP_TIME_USEC_IN_NS;
+	uint64_t heavy_sent = 0, light_sent = 0, send_fails = 0;
+	uint64_t ns, heavy_due, light_due;
+	odp_tm_queue_t tm_queue;
+	odp_time_t start;
+
+	for (int i = 0; i < NUM_FLOWS; i++) {
+		global->stat[i].sent = 0;
+		odp_atomic_init_u64(&global->stat[i].rcvd, 0);
+		odp_atomic_init_u64(&global->stat[i].lat_sum, 0);
+		odp_atomic_init_u64(&global->stat[i].lat_min, UINT64_MAX);
+		odp_atomic_init_u64(&global->stat[i].lat_max, 0);
+	}
+
+	tm_queue = create_queue(global, fq);
+	if (tm_queue == ODP_TM_INVALID)
+		return -1;
+
+	start = odp_time_global();
+
+	/* Send both flows at constant rates. Enqueues that were not accepted are not counted
+	 * as sent. */
+	while ((ns = odp_time_diff_ns(odp_time_global(), start)) < duration_ns) {
+		heavy_due = (ns * heavy_pps) / ODP_TIME_SEC_IN_NS;
+		light_due = ns / light_ns;
+
+		while (heavy_sent + send_fails < heavy_due) {
+			if (send_pkt(global, tm_queue, FLOW_HEAVY))
+				send_fails++;
+			else
+				heavy_sent++;
+		}
+
+		if (light_sent < light_due) {
+			if (send_pkt(global, tm_queue, FLOW_LIGHT) == 0)
+				global->stat[FLOW_LIGHT].sent++;
+
+			light_sent++;
+		}
+	}
+
+	global->stat[FLOW_HEAVY].sent = heavy_sent;
+
+	start = odp_time_global();
+
+	while (!odp_tm_is_idle(global->tm) &&
+	       odp_time_diff_ns(odp_time_global(), start) < DRAIN_TMO_NS)
+		odp_time_wait_ns(ODP_TIME_MSEC_IN_NS);
+
+	if (odp_tm_queue_disconnect(tm_queue) || odp_tm_queue_destroy(tm_queue)) {
+		ODPH_ERR("TM queue destroy failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static int output_results(test_global_t *global, int fq)
+{
+	const char *name[NUM_FLOWS] = { "heavy", "light" };
+	double ave[NUM_FLOWS];
+	uint64_t rcvd, min;
+
+	printf("\nRESULTS - %s (latency in usec):\n", fq ? "flow queuing" : "FIFO");
+	printf("-----------------------------------------\n");
+	printf("  flow        sent       rcvd    dropped        min        ave        max\n");
+
+	for (int i = 0; i < NUM_FLOWS; i++) {
+		flow_stat_t *stat = &global->stat[i];
+
+		rcvd = odp_atomic_load_u64(&stat->rcvd);
+		min = rcvd ? odp_atomic_load_u64(&stat->lat_min) : 0;
+		ave[i] = rcvd ? (double)odp_atomic_load_u64(&stat->lat_sum) / rcvd : 0.0;
+
+		printf("  %-5s %10" PRIu64 " %10" PRIu64 " %10" PRIu64 " %10.1f %10.1f %10.1f\n",
+		       name[i], stat->sent, rcvd, stat->sent - rcvd, min / 1000.0, ave[i] / 1000,
+		       odp_atomic_load_u64(&stat->lat_max) / 1000.0);
+	}
+
+	printf("\n");
+
+	if (global->common_options.is_export) {
+		if (test_common_write("%s heavy ave latency (usec),%s light ave latency (usec)\n",
+				      fq ? "fq" : "fifo", fq ? "fq" : "fifo")) {
+			ODPH_ERR("Export failed\n");
+			return -1;
+		}
+
+		if (test_common_write("%f,%f\n", ave[FLOW_HEAVY] / 1000, ave[FLOW_LIGHT] / 1000)) {
+			ODPH_ERR("Export failed\n");
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static int destroy_tm(test_global_t *global)
+{
+	int ret = 0;
+
+	if (global->tm != ODP_TM_INVALID) {
+		if (odp_tm_stop(global->tm))
+			ret = -1;
+
+		if (global->tm_node != ODP_TM_INVALID &&
+		    (odp_tm_node_disconnect(global->tm_node) ||
+		     odp_tm_node_destroy(global->tm_node)))
+			ret = -1;
+
+		if (odp_tm_destroy(global->tm))
+			ret = -1;
+	}
+
+	if (global->shaper != ODP_TM_INVALID && odp_tm_shaper_destroy(global->shaper))
+		ret = -1;
+
+	if (global->threshold != ODP_TM_INVALID && odp_tm_threshold_destroy(global->threshold))
+		ret = -1;
+
+	if (global->pool != ODP_POOL_INVALID && odp_pool_destroy(global->pool))
+		ret = -1;
+
+	return ret;
+}
+
+int main(int argc, char **argv)
+{
+	odph_helper_options_t helper_options;
+	odp_instance_t instance;
+	odp_init_t init;
+	odp_shm_t shm;
+	test_global_t *global;
+	test_common_options_t common_options;
+	test_options_t *test_options;
+	int ret = 0;
+
+	/* Let helper collect its own arguments (e.g. --odph_proc) */
+	argc = odph_parse_options(argc, argv);
+	if (odph_options(&helper_options)) {
+		ODPH_ERR("Error: Reading ODP helper options failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	argc = test_common_parse_options(argc, argv);
+	if (test_common_options(&common_options)) {
+		ODPH_ERR("Error: Reading test options failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	/* List features not to be used */
+	odp_init_param_init(&init);
+	init.not_used.feat.cls = 1;
+	init.not_used.feat.compress = 1;
+	init.not_used.feat.crypto = 1;
+	init.not_used.feat.ipsec = 1;
+	init.not_used.feat.timer = 1;
+
+	init.mem_model = helper_options.mem_model;
+
+	/* Init ODP before calling anything else */
+	if (odp_init_global(&instance, &init, NULL)) {
+		ODPH_ERR("Error: Global init failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	/* Init this thread */
+	if (odp_init_local(instance, ODP_THREAD_CONTROL)) {
+		ODPH_ERR("Error: Local init failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	shm = odp_shm_reserve("tm_latency_global", sizeof(test_global_t),
+			      ODP_CACHE_LINE_SIZE, 0);
+	if (shm == ODP_SHM_INVALID) {
+		ODPH_ERR("Error: Shared mem reserve failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	global = odp_shm_addr(shm);
+	if (global == NULL) {
+		ODPH_ERR("Error: Shared mem alloc failed\n");
+		exit(EXIT_FAILURE);
+	}
+
+	memset(global, 0, sizeof(test_global_t));
+	global->tm = ODP_TM_INVALID;
+	global->tm_node = ODP_TM_INVALID;
+	global->shaper = ODP_TM_INVALID;
+	global->threshold = ODP_TM_INVALID;
+	global->pool = ODP_POOL_INVALID;
+	global->common_options = common_options;
+	test_global = global;
+	test_options = &global->options;
+
+	if (parse_options(argc, argv, test_options))
+		exit(EXIT_FAILURE);
+
+	odp_sys_info_print();
+
+	printf("\nTM latency test\n");
+	printf("  shaper rate          %u Mbps\n", test_options->rate_mbps);
+	printf("  heavy flow load      %u %%\n", test_options->load_pct);
+	printf("  light flow interval  %u usec\n", test_options->light_us);
+	printf("  duration             %u sec\n", test_options->duration);
+	printf("  packet length        %u bytes\n", test_options->pkt_len);
+	printf("  max packets          %u\n", test_options->max_pkts);
+
+	if (create_tm(global)) {
+		ODPH_ERR("Error: Create TM system failed.\n");
+		ret = -1;
+		goto destroy;
+	}
+
+	for (int fq = 0; fq < 2; fq++) {
+		if ((fq && test_options->mode == MODE_FIFO) ||
+		    (!fq && test_options->mode == MODE_FQ))
+			continue;
+
+		if (run_test(global, fq) || output_results(global, fq)) {
+			ret = -1;
+			break;
+		}
+	}
+
+	if (global->common_options.is_export)
+		test_common_write_term();
+
+destroy:
+	if (destroy_tm(global)) {
+		ODPH_ERR("Error: Destroy TM system failed.\n");
+		ret = -1;
+	}
+
+	if (odp_shm_free(shm)) {
+		ODPH_ERR("Error: Shared mem free failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_term_local()) {
+		ODPH_ERR("Error: term local failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (odp_term_global(instance)) {
+		ODPH_ERR("Error: term global failed.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	return ret;
+}
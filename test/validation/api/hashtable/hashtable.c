@@ -0,0 +1,420 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#include <odp_api.h>
+#include <odp/helper/odph_api.h>
+
+#include "odp_cunit_common.h"
+
+#include <string.h>
+
+#define NUM_ENTRIES  4096
+#define NUM_MULTI    16
+#define NUM_ROUNDS   2000
+#define MAX_WORKERS  32
+
+typedef struct test_key_t {
+	uint32_t ip;
+	uint16_t port;
+	uint8_t  proto;
+	uint8_t  pad;
+
+} test_key_t;
+
+typedef struct test_value_t {
+	uint64_t a;
+	uint64_t b;
+
+} test_value_t;
+
+typedef struct global_t {
+	odp_hashtable_capability_t capa;
+	odp_hashtable_t ht;
+	odp_atomic_u32_t stop;
+	odp_atomic_u32_t errors;
+
+} global_t;
+
+static global_t global;
+
+static int hashtable_suite_init(void)
+{
+	memset(&global, 0, sizeof(global));
+
+	if (odp_hashtable_capability(&global.capa)) {
+		ODPH_ERR("Hash table capability failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static void make_key(test_key_t *key, uint32_t i)
+{
+	memset(key, 0, sizeof(test_key_t));
+	key->ip    = 0x0a000000 + i;
+	key->port  = i & 0xffff;
+	key->proto = 17;
+}
+
+static void make_value(test_value_t *value, uint32_t i, uint32_t round)
+{
+	value->a = ((uint64_t)round << 32) | i;
+	value->b = ~value->a;
+}
+
+static odp_hashtable_t create_table(const char *name, uint32_t num, uint32_t value_size)
+{
+	odp_hashtable_param_t param;
+
+	odp_hashtable_param_init(&param);
+	param.num        = num;
+	param.key_size   = sizeof(test_key_t);
+	param.value_size = value_size;
+
+	return odp_hashtable_create(name, &param);
+}
+
+static void hashtable_capability(void)
+{
+	odp_hashtable_capability_t capa;
+
+	memset(&capa, 0, sizeof(capa));
+	CU_ASSERT_FATAL(odp_hashtable_capability(&capa) == 0);
+
+	CU_ASSERT(capa.max_tables > 0);
+	CU_ASSERT(capa.max_num > 0);
+	CU_ASSERT(capa.max_key_size > 0);
+	CU_ASSERT(capa.max_get_multi > 0);
+}
+
+static void hashtable_param_defaults(void)
+{
+	odp_hashtable_param_t param;
+
+	memset(&param, 0x55, sizeof(param));
+	odp_hashtable_param_init(&param);
+
+	CU_ASSERT(param.num == 0);
+	CU_ASSERT(param.key_size == 0);
+	CU_ASSERT(param.value_size == 0);
+	CU_ASSERT(param.seed == 0);
+}
+
+static void hashtable_create(void)
+{
+	odp_hashtable_t ht;
+	const char *name = "test_hashtable";
+
+	ht = create_table(name, 1, sizeof(test_value_t));
+	CU_ASSERT_FATAL(ht != ODP_HASHTABLE_INVALID);
+
+	printf("\n    Hash table handle: 0x%" PRIx64 "\n", odp_hashtable_to_u64(ht));
+
+	CU_ASSERT(odp_hashtable_lookup(name) == ht);
+	CU_ASSERT(odp_hashtable_count(ht) == 0);
+
+	odp_hashtable_print(ht);
+
+	CU_ASSERT_FATAL(odp_hashtable_destroy(ht) == 0);
+	CU_ASSERT(odp_hashtable_lookup(name) == ODP_HASHTABLE_INVALID);
+}
+
+static void hashtable_create_long_name(void)
+{
+	odp_hashtable_t ht;
+	char name[ODP_HASHTABLE_NAME_LEN];
+
+	memset(name, 'a', sizeof(name));
+	name[sizeof(name) - 1] = 0;
+
+	ht = create_table(name, 1, sizeof(test_value_t));
+	CU_ASSERT_FATAL(ht != ODP_HASHTABLE_INVALID);
+	CU_ASSERT(odp_hashtable_lookup(name) == ht);
+	CU_ASSERT_FATAL(odp_hashtable_destroy(ht) == 0);
+}
+
+static void hashtable_create_max(void)
+{
+	uint32_t num = ODPH_MIN(global.capa.max_tables, 256u);
+	odp_hashtable_t ht[num];
+	uint32_t i, num_created = 0;
+
+	for (i = 0; i < num; i++) {
+		ht[i] = create_table(NULL, 16, sizeof(test_value_t));
+		CU_ASSERT(ht[i] != ODP_HASHTABLE_INVALID);
+		if (ht[i] == ODP_HASHTABLE_INVALID)
+			break;
+		num_created++;
+	}
+
+	for (i = 0; i < num_created; i++)
+		CU_ASSERT(odp_hashtable_destroy(ht[i]) == 0);
+}
+
+static void hashtable_put_get_remove(void)
+{
+	odp_hashtable_t ht;
+	test_key_t key;
+	test_value_t value, out;
+	uint32_t num = ODPH_MIN(global.capa.max_num, (uint32_t)NUM_ENTRIES);
+	uint32_t i;
+
+	ht = create_table(NULL, num, sizeof(test_value_t));
+	CU_ASSERT_FATAL(ht != ODP_HASHTABLE_INVALID);
+
+	/* Fill the table */
+	for (i = 0; i < num; i++) {
+		make_key(&key, i);
+		make_value(&value, i, 0);
+		CU_ASSERT(odp_hashtable_put(ht, &key, &value) == 0);
+	}
+
+	CU_ASSERT(odp_hashtable_count(ht) == num);
+
+	/* Table is full */
+	make_key(&key, num);
+	CU_ASSERT(odp_hashtable_put(ht, &key, &value) < 0);
+	CU_ASSERT(odp_hashtable_get(ht, &key, &out) == 0);
+
+	for (i = 0; i < num; i++) {
+		make_key(&key, i);
+		make_value(&value, i, 0);
+		memset(&out, 0, sizeof(out));
+		CU_ASSERT(odp_hashtable_get(ht, &key, &out) == 1);
+		CU_ASSERT(memcmp(&out, &value, sizeof(test_value_t)) == 0);
+		CU_ASSERT(odp_hashtable_get(ht, &key, NULL) == 1);
+	}
+
+	/* Update values of existing keys */
+	for (i = 0; i < num; i++) {
+		make_key(&key, i);
+		make_value(&value, i, 1);
+		CU_ASSERT(odp_hashtable_put(ht, &key, &value) == 0);
+	}
+
+	CU_ASSERT(odp_hashtable_count(ht) == num);
+
+	for (i = 0; i < num; i++) {
+		make_key(&key, i);
+		make_value(&value, i, 1);
+		CU_ASSERT(odp_hashtable_get(ht, &key, &out) == 1);
+		CU_ASSERT(memcmp(&out, &value, sizeof(test_value_t)) == 0);
+	}
+
+	/* Remove every other key */
+	for (i = 0; i < num; i += 2) {
+		make_key(&key, i);
+		CU_ASSERT(odp_hashtable_remove(ht, &key) == 0);
+		CU_ASSERT(odp_hashtable_remove(ht, &key) < 0);
+	}
+
+	CU_ASSERT(odp_hashtable_count(ht) == num / 2);
+
+	for (i = 0; i < num; i++) {
+		make_key(&key, i);
+		CU_ASSERT(odp_hashtable_get(ht, &key, &out) == (int)(i & 1));
+	}
+
+	/* Freed entries are reused */
+	for (i = num; i < num + num / 2; i++) {
+		make_key(&key, i);
+		make_value(&value, i, 2);
+		CU_ASSERT(odp_hashtable_put(ht, &key, &value) == 0);
+	}
+
+	CU_ASSERT(odp_hashtable_count(ht) == num);
+
+	for (i = num; i < num + num / 2; i++) {
+		make_key(&key, i);
+		make_value(&value, i, 2);
+		CU_ASSERT(odp_hashtable_get(ht, &key, &out) == 1);
+		CU_ASSERT(memcmp(&out, &value, sizeof(test_value_t)) == 0);
+	}
+
+	CU_ASSERT(odp_hashtable_destroy(ht) == 0);
+}
+
+static void hashtable_no_value(void)
+{
+	odp_hashtable_t ht;
+	test_key_t key;
+	uint32_t i;
+
+	ht = create_table(NULL, 64, 0);
+	CU_ASSERT_FATAL(ht != ODP_HASHTABLE_INVALID);
+
+	for (i = 0; i < 64; i += 2) {
+		make_key(&key, i);
+		CU_ASSERT(odp_hashtable_put(ht, &key, NULL) == 0);
+	}
+
+	for (i = 0; i < 64; i++) {
+		make_key(&key, i);
+		CU_ASSERT(odp_hashtable_get(ht, &key, NULL) == !(i & 1));
+	}
+
+	CU_ASSERT(odp_hashtable_destroy(ht) == 0);
+}
+
+static void hashtable_get_multi(void)
+{
+	odp_hashtable_t ht;
+	uint32_t num = ODPH_MIN(global.capa.max_num, (uint32_t)NUM_ENTRIES);
+	uint32_t burst = ODPH_MIN(global.capa.max_get_multi, (uint32_t)NUM_MULTI);
+	test_key_t key[burst];
+	test_value_t value, out[burst];
+	const void *key_ptr[burst];
+	void *out_ptr[burst];
+	uint8_t found[burst];
+	uint32_t i, j, num_found;
+	int ret;
+
+	ht = create_table(NULL, num, sizeof(test_value_t));
+	CU_ASSERT_FATAL(ht != ODP_HASHTABLE_INVALID);
+
+	/* Only even keys are stored */
+	for (i = 0; i < num; i += 2) {
+		make_key(&key[0], i);
+		make_value(&value, i, 0);
+		CU_ASSERT(odp_hashtable_put(ht, &key[0], &value) == 0);
+	}
+
+	for (i = 0; i < burst; i++) {
+		key_ptr[i] = &key[i];
+		out_ptr[i] = &out[i];
+	}
+
+	for (i = 0; i < num; i += burst) {
+		num_found = 0;
+
+		for (j = 0; j < burst; j++) {
+			make_key(&key[j], i + j);
+			if (((i + j) & 1) == 0 && i + j < num)
+				num_found++;
+		}
+
+		memset(found, 0x55, sizeof(found));
+		ret = odp_hashtable_get_multi(ht, key_ptr, out_ptr, found, burst);
+		CU_ASSERT(ret == (int)num_found);
+
+		for (j = 0; j < burst; j++) {
+			if (((i + j) & 1) || i + j >= num) {
+				CU_ASSERT(found[j] == 0);
+				continue;
+			}
+
+			CU_ASSERT(found[j] == 1);
+			make_value(&value, i + j, 0);
+			CU_ASSERT(memcmp(&out[j], &value, sizeof(test_value_t)) == 0);
+		}
+
+		ret = odp_hashtable_get_multi(ht, key_ptr, NULL, found, burst);
+		CU_ASSERT(ret == (int)num_found);
+	}
+
+	CU_ASSERT(odp_hashtable_destroy(ht) == 0);
+}
+
+static int reader_thread(void *arg ODP_UNUSED)
+{
+	odp_hashtable_t ht = global.ht;
+	test_key_t key;
+	test_value_t out;
+	uint32_t i = 0;
+	int ret;
+
+	while (odp_atomic_load_u32(&global.stop) == 0) {
+		make_key(&key, i);
+		ret = odp_hashtable_get(ht, &key, &out);
+
+		/* Values must never be torn, and even keys are never removed */
+		if (ret < 0 || (ret == 1 && (out.b != ~out.a || (uint32_t)out.a != i)) ||
+		    (ret == 0 && (i & 1) == 0))
+			odp_atomic_inc_u32(&global.errors);
+
+		i = (i + 1) % NUM_ENTRIES;
+	}
+
+	return 0;
+}
+
+static void hashtable_concurrent(void)
+{
+	odp_cpumask_t mask;
+	test_key_t key;
+	test_value_t value;
+	uint32_t i, round;
+	int num_workers;
+
+	num_workers = odp_cpumask_default_worker(&mask, 0);
+	num_workers = ODPH_MIN(ODPH_MAX(num_workers - 1, 1), MAX_WORKERS);
+
+	global.ht = create_table(NULL, NUM_ENTRIES, sizeof(test_value_t));
+	CU_ASSERT_FATAL(global.ht != ODP_HASHTABLE_INVALID);
+	odp_atomic_init_u32(&global.stop, 0);
+	odp_atomic_init_u32(&global.errors, 0);
+
+	for (i = 0; i < NUM_ENTRIES; i += 2) {
+		make_key(&key, i);
+		make_value(&value, i, 0);
+		CU_ASSERT(odp_hashtable_put(global.ht, &key, &value) == 0);
+	}
+
+	CU_ASSERT_FATAL(odp_cunit_thread_create(num_workers, reader_thread, NULL, 0, 0) ==
+			num_workers);
+
+	/* Update values, add and remove odd keys while readers are running */
+	for (round = 1; round < NUM_ROUNDS; round++) {
+		i = (round * 7) % NUM_ENTRIES;
+
+		make_key(&key, i);
+		make_value(&value, i, round);
+		CU_ASSERT(odp_hashtable_put(global.ht, &key, &value) == 0);
+
+		if (i & 1)
+			CU_ASSERT(odp_hashtable_remove(global.ht, &key) == 0);
+	}
+
+	odp_atomic_store_u32(&global.stop, 1);
+	CU_ASSERT(odp_cunit_thread_join(num_workers) >= 0);
+
+	CU_ASSERT(odp_atomic_load_u32(&global.errors) == 0);
+	CU_ASSERT(odp_hashtable_count(global.ht) == NUM_ENTRIES / 2);
+	CU_ASSERT(odp_hashtable_destroy(global.ht) == 0);
+}
+
+odp_testinfo_t hashtable_suite[] = {
+	ODP_TEST_INFO(hashtable_capability),
+	ODP_TEST_INFO(hashtable_param_defaults),
+	ODP_TEST_INFO(hashtable_create),
+	ODP_TEST_INFO(hashtable_create_long_name),
+	ODP_TEST_INFO(hashtable_create_max),
+	ODP_TEST_INFO(hashtable_put_get_remove),
+	ODP_TEST_INFO(hashtable_no_value),
+	ODP_TEST_INFO(hashtable_get_multi),
+	ODP_TEST_INFO(hashtable_concurrent),
+	ODP_TEST_INFO_NULL,
+};
+
+odp_suiteinfo_t hashtable_suites[] = {
+	{"Hash table", hashtable_suite_init, NULL, hashtable_suite},
+	ODP_SUITE_INFO_NULL
+};
+
+int main(int argc, char *argv[])
+{
+	int ret;
+
+	/* parse common options: */
+	if (odp_cunit_parse_options(&argc, argv))
+		return -1;
+
+	ret = odp_cunit_register(hashtable_suites);
+
+	if (ret == 0)
+		ret = odp_cunit_run();
+
+	return ret;
+}
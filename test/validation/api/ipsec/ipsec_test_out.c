@@ -5,6 +5,7 @@
  */
 
 #include <stddef.h>
+#include <stdlib.h>
 
 #include <odp/helper/odph_api.h>
 
@@ -2134,6 +2135,138 @@ static void test_max_num_sa(void)
 		ipsec_sa_destroy(sa_odd);
 }
 
+#define SEQ_NUM_MAX_THREADS 8
+#define SEQ_NUM_PKTS_PER_THREAD 128
+
+typedef struct {
+	odp_ipsec_sa_t sa;
+	uint32_t num;
+	uint32_t seq_num[SEQ_NUM_PKTS_PER_THREAD];
+} seq_num_thread_arg_t;
+
+static seq_num_thread_arg_t seq_num_arg[SEQ_NUM_MAX_THREADS];
+
+static int out_seq_num_worker(void *arg)
+{
+	seq_num_thread_arg_t *thr_arg = arg;
+	const ipsec_test_packet *itp = &pkt_ipv4_icmp_0;
+	odp_ipsec_out_param_t param;
+	uint32_t i;
+
+	memset(&param, 0, sizeof(param));
+	param.num_sa = 1;
+	param.sa = &thr_arg->sa;
+
+	for (i = 0; i < SEQ_NUM_PKTS_PER_THREAD; i++) {
+		odp_packet_t pkt, pkt_out = ODP_PACKET_INVALID;
+		odph_ipv4hdr_t ip;
+		odph_esphdr_t esp;
+		uint32_t l3;
+		int num_out = 1;
+
+		pkt = odp_packet_alloc(suite_context.pool, itp->len);
+		if (pkt == ODP_PACKET_INVALID) {
+			CU_FAIL("Packet alloc failed");
+			break;
+		}
+
+		odp_packet_copy_from_mem(pkt, 0, itp->len, itp->data);
+		odp_packet_l2_offset_set(pkt, itp->l2_offset);
+		odp_packet_l3_offset_set(pkt, itp->l3_offset);
+		odp_packet_l4_offset_set(pkt, itp->l4_offset);
+
+		if (odp_ipsec_out(&pkt, 1, &pkt_out, &num_out, &param) != 1 || num_out != 1) {
+			CU_FAIL("odp_ipsec_out() failed");
+			odp_packet_free(pkt);
+			break;
+		}
+
+		l3 = odp_packet_l3_offset(pkt_out);
+		CU_ASSERT(odp_packet_copy_to_mem(pkt_out, l3, sizeof(ip), &ip) == 0);
+		CU_ASSERT(ip.proto == ODPH_IPPROTO_ESP);
+		CU_ASSERT(odp_packet_copy_to_mem(pkt_out, l3 + ODPH_IPV4HDR_IHL(ip.ver_ihl) * 4,
+						 sizeof(esp), &esp) == 0);
+		thr_arg->seq_num[thr_arg->num++] = odp_be_to_cpu_32(esp.seq_no);
+
+		odp_packet_free(pkt_out);
+	}
+
+	return 0;
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/*
+ * Multiple threads send through the same SA. Sequence numbers must be unique
+ * over all threads and increase within each thread.
+ */
+static void test_out_seq_num_multi_thread(void)
+{
+	odp_ipsec_sa_param_t param;
+	odp_ipsec_sa_t sa;
+	void *arg_ptr[SEQ_NUM_MAX_THREADS];
+	uint32_t all[SEQ_NUM_MAX_THREADS * SEQ_NUM_PKTS_PER_THREAD];
+	uint32_t num_all = 0;
+	int num_thr, i;
+	uint32_t j;
+
+	num_thr = odp_cpumask_default_worker(NULL, 0);
+	if (num_thr > SEQ_NUM_MAX_THREADS)
+		num_thr = SEQ_NUM_MAX_THREADS;
+	if (num_thr < 1)
+		num_thr = 1;
+
+	ipsec_sa_param_fill(&param,
+			    ODP_IPSEC_DIR_OUTBOUND, ODP_IPSEC_ESP, 123, NULL,
+			    ODP_CIPHER_ALG_NULL, NULL,
+			    ODP_AUTH_ALG_SHA256_HMAC, &key_5a_256,
+			    NULL, NULL);
+
+	sa = odp_ipsec_sa_create(&param);
+	CU_ASSERT_FATAL(ODP_IPSEC_SA_INVALID != sa);
+
+	for (i = 0; i < num_thr; i++) {
+		seq_num_arg[i].sa = sa;
+		seq_num_arg[i].num = 0;
+		arg_ptr[i] = &seq_num_arg[i];
+	}
+
+	CU_ASSERT_FATAL(odp_cunit_thread_create(num_thr, out_seq_num_worker, arg_ptr, 1, 1) ==
+			num_thr);
+	CU_ASSERT(odp_cunit_thread_join(num_thr) >= 0);
+
+	for (i = 0; i < num_thr; i++) {
+		CU_ASSERT(seq_num_arg[i].num == SEQ_NUM_PKTS_PER_THREAD);
+
+		for (j = 0; j < seq_num_arg[i].num; j++) {
+			CU_ASSERT(seq_num_arg[i].seq_num[j] != 0);
+			if (j > 0)
+				CU_ASSERT(seq_num_arg[i].seq_num[j] > seq_num_arg[i].seq_num[j - 1]);
+			all[num_all++] = seq_num_arg[i].seq_num[j];
+		}
+	}
+
+	qsort(all, num_all, sizeof(all[0]), cmp_u32);
+	for (j = 1; j < num_all; j++)
+		CU_ASSERT(all[j] != all[j - 1]);
+
+	ipsec_sa_destroy(sa);
+}
+
+static int ipsec_check_out_seq_num_multi_thread(void)
+{
+	if (suite_context.outbound_op_mode != ODP_IPSEC_OP_MODE_SYNC)
+		return ODP_TEST_INACTIVE;
+
+	return ipsec_check_esp_null_sha256();
+}
+
 odp_testinfo_t ipsec_out_suite[] = {
 	ODP_TEST_INFO(ipsec_test_capability),
 	ODP_TEST_INFO(ipsec_test_default_values),
@@ -2185,6 +2318,8 @@ odp_testinfo_t ipsec_out_suite[] = {
 				  ipsec_check_esp_aes_cbc_128_sha1),
 	ODP_TEST_INFO_CONDITIONAL(test_out_ipv4_esp_sa_byte_expiry,
 				  ipsec_check_esp_aes_cbc_128_sha1),
+	ODP_TEST_INFO_CONDITIONAL(test_out_seq_num_multi_thread,
+				  ipsec_check_out_seq_num_multi_thread),
 	ODP_TEST_INFO_NULL,
 };
 
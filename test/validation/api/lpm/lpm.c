@@ -0,0 +1,587 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#include <odp_api.h>
+#include <odp/helper/odph_api.h>
+
+#include "odp_cunit_common.h"
+
+#include <string.h>
+
+#define NUM_ROUTES  512
+#define NUM_ADDR    4096
+#define NUM_MULTI   48
+#define NUM_ROUNDS  2000
+#define MAX_WORKERS 32
+
+typedef struct route_t {
+	uint8_t  addr[16];
+	uint8_t  len;
+	uint8_t  used;
+	uint32_t next_hop;
+
+} route_t;
+
+typedef struct global_t {
+	odp_lpm_capability_t capa;
+	odp_lpm_t lpm;
+	odp_qsbr_t qsbr;
+	odp_atomic_u32_t stop;
+	odp_atomic_u32_t errors;
+	route_t route[NUM_ROUTES];
+	uint64_t seed;
+
+} global_t;
+
+static global_t global;
+
+static int lpm_suite_init(void)
+{
+	memset(&global, 0, sizeof(global));
+
+	if (odp_lpm_capability(&global.capa)) {
+		ODPH_ERR("LPM capability failed\n");
+		return -1;
+	}
+
+	global.seed = 0x123456789abcdefULL;
+
+	return 0;
+}
+
+static uint32_t rand_u32(void)
+{
+	/* xorshift64 */
+	global.seed ^= global.seed << 13;
+	global.seed ^= global.seed >> 7;
+	global.seed ^= global.seed << 17;
+
+	return global.seed >> 16;
+}
+
+static odp_qsbr_t create_qsbr(void)
+{
+	odp_qsbr_param_t param;
+
+	odp_qsbr_param_init(&param);
+
+	return odp_qsbr_create(NULL, &param);
+}
+
+static void ipv4(uint8_t *addr, uint32_t ip)
+{
+	addr[0] = ip >> 24;
+	addr[1] = ip >> 16;
+	addr[2] = ip >> 8;
+	addr[3] = ip;
+}
+
+static odp_lpm_t create_table(const char *name, odp_lpm_type_t type, uint32_t max_routes,
+			      uint32_t num_ext, odp_qsbr_t qsbr)
+{
+	odp_lpm_param_t param;
+
+	odp_lpm_param_init(&param);
+	param.type       = type;
+	param.max_routes = max_routes;
+	param.num_ext    = num_ext;
+	param.qsbr       = qsbr;
+
+	return odp_lpm_create(name, &param);
+}
+
+static int match_one(odp_lpm_t lpm, uint32_t ip, uint32_t *next_hop)
+{
+	uint8_t addr[4];
+
+	ipv4(addr, ip);
+
+	return odp_lpm_match(lpm, addr, next_hop);
+}
+
+static void lpm_capability(void)
+{
+	odp_lpm_capability_t capa;
+
+	memset(&capa, 0, sizeof(capa));
+	CU_ASSERT_FATAL(odp_lpm_capability(&capa) == 0);
+
+	CU_ASSERT(capa.max_tables > 0);
+	CU_ASSERT(capa.max_next_hop > 0);
+	CU_ASSERT(capa.ipv4.max_routes > 0);
+	CU_ASSERT(capa.ipv6.max_routes > 0);
+}
+
+static void lpm_param_defaults(void)
+{
+	odp_lpm_param_t param;
+
+	memset(&param, 0x55, sizeof(param));
+	odp_lpm_param_init(&param);
+
+	CU_ASSERT(param.type == ODP_LPM_IPV4);
+	CU_ASSERT(param.max_routes == 0);
+	CU_ASSERT(param.num_ext == 0);
+	CU_ASSERT(param.qsbr == ODP_QSBR_INVALID);
+}
+
+static void lpm_create(void)
+{
+	odp_lpm_t lpm;
+	const char *name = "test_lpm";
+
+	lpm = create_table(name, ODP_LPM_IPV4, 16, 0, ODP_QSBR_INVALID);
+	CU_ASSERT_FATAL(lpm != ODP_LPM_INVALID);
+
+	printf("\n    LPM table handle: 0x%" PRIx64 "\n", odp_lpm_to_u64(lpm));
+
+	CU_ASSERT(odp_lpm_lookup(name) == lpm);
+	CU_ASSERT(odp_lpm_route_count(lpm) == 0);
+
+	odp_lpm_print(lpm);
+
+	CU_ASSERT_FATAL(odp_lpm_destroy(lpm) == 0);
+	CU_ASSERT(odp_lpm_lookup(name) == ODP_LPM_INVALID);
+}
+
+static void lpm_create_long_name(void)
+{
+	odp_lpm_t lpm;
+	char name[ODP_LPM_NAME_LEN];
+
+	memset(name, 'a', sizeof(name));
+	name[sizeof(name) - 1] = 0;
+
+	lpm = create_table(name, ODP_LPM_IPV6, 16, 0, ODP_QSBR_INVALID);
+	CU_ASSERT_FATAL(lpm != ODP_LPM_INVALID);
+	CU_ASSERT(odp_lpm_lookup(name) == lpm);
+	CU_ASSERT_FATAL(odp_lpm_destroy(lpm) == 0);
+}
+
+static void lpm_ipv4_basic(void)
+{
+	odp_lpm_t lpm;
+	uint8_t addr[4];
+	uint32_t nh = 0;
+
+	lpm = create_table(NULL, ODP_LPM_IPV4, 16, 0, ODP_QSBR_INVALID);
+	CU_ASSERT_FATAL(lpm != ODP_LPM_INVALID);
+
+	CU_ASSERT(match_one(lpm, 0x0a000001, &nh) == 0);
+
+	/* 10.0.0.0/8 -> 1, 10.1.0.0/16 -> 2, 10.1.2.0/24 -> 3, 10.1.2.128/25 -> 4,
+	 * 10.1.2.200/32 -> 5 */
+	ipv4(addr, 0x0a000000);
+	CU_ASSERT(odp_lpm_route_add(lpm, addr, 8, 1) == 0);
+	ipv4(addr, 0x0a010000);
+	CU_ASSERT(odp_lpm_route_add(lpm, addr, 16, 2) == 0);
+	ipv4(addr, 0x0a010200);
+	CU_ASSERT(odp_lpm_route_add(lpm, addr, 24, 3) == 0);
+	ipv4(addr, 0x0a010280);
+	CU_ASSERT(odp_lpm_route_add(lpm, addr, 25, 4) == 0);
+	ipv4(addr, 0x0a0102c8);
+	CU_ASSERT(odp_lpm_route_add(lpm, addr, 32, 5) == 0);
+
+	CU_ASSERT(odp_lpm_route_count(lpm) == 5);
+
+	CU_ASSERT(match_one(lpm, 0x0a090909, &nh) == 1 && nh == 1);
+	CU_ASSERT(match_one(lpm, 0x0a01ff01, &nh) == 1 && nh == 2);
+	CU_ASSERT(match_one(lpm, 0x0a010201, &nh) == 1 && nh == 3);
+	CU_ASSERT(match_one(lpm, 0x0a010281, &nh) == 1 && nh == 4);
+	CU_ASSERT(match_one(lpm, 0x0a0102c8, &nh) == 1 && nh == 5);
+	CU_ASSERT(match_one(lpm, 0x0a0102c9, &nh) == 1 && nh == 4);
+	CU_ASSERT(match_one(lpm, 0x0b000000, &nh) == 0);
+
+	/* Adding a shorter prefix does not override longer ones */
+	ipv4(addr, 0x0a000000);
+	CU_ASSERT(odp_lpm_route_add(lpm, addr, 7, 6) == 0);
+	CU_ASSERT(match_one(lpm, 0x0b000000, &nh) == 1 && nh == 6);
+	CU_ASSERT(match_one(lpm, 0x0a0102c8, &nh) == 1 && nh == 5);
+
+	/* Replace next hop of an existing route */
+	ipv4(addr, 0x0a010280);
+	CU_ASSERT(odp_lpm_route_add(lpm, addr, 25, 7) == 0);
+	CU_ASSERT(odp_lpm_route_count(lpm) == 6);
+	CU_ASSERT(match_one(lpm, 0x0a010281, &nh) == 1 && nh == 7);
+
+	/* Deleted routes are replaced by the next longest prefix */
+	CU_ASSERT(odp_lpm_route_del(lpm, addr, 25) == 0);
+	CU_ASSERT(odp_lpm_route_del(lpm, addr, 25) < 0);
+	CU_ASSERT(match_one(lpm, 0x0a010281, &nh) == 1 && nh == 3);
+	CU_ASSERT(match_one(lpm, 0x0a0102c8, &nh) == 1 && nh == 5);
+
+	ipv4(addr, 0x0a010000);
+	CU_ASSERT(odp_lpm_route_del(lpm, addr, 16) == 0);
+	CU_ASSERT(match_one(lpm, 0x0a01ff01, &nh) == 1 && nh == 1);
+	CU_ASSERT(match_one(lpm, 0x0a010201, &nh) == 1 && nh == 3);
+
+	ipv4(addr, 0x0a0102c8);
+	CU_ASSERT(odp_lpm_route_del(lpm, addr, 32) == 0);
+	CU_ASSERT(match_one(lpm, 0x0a0102c8, &nh) == 1 && nh == 3);
+
+	/* Host bits of the prefix are ignored */
+	ipv4(addr, 0x0a0102ff);
+	CU_ASSERT(odp_lpm_route_del(lpm, addr, 24) == 0);
+	CU_ASSERT(match_one(lpm, 0x0a010201, &nh) == 1 && nh == 1);
+
+	/* Default route */
+	ipv4(addr, 0);
+	CU_ASSERT(odp_lpm_route_add(lpm, addr, 0, 8) == 0);
+	CU_ASSERT(match_one(lpm, 0xc0a80001, &nh) == 1 && nh == 8);
+	CU_ASSERT(match_one(lpm, 0x0a090909, &nh) == 1 && nh == 1);
+	CU_ASSERT(odp_lpm_route_del(lpm, addr, 0) == 0);
+	CU_ASSERT(match_one(lpm, 0xc0a80001, &nh) == 0);
+
+	CU_ASSERT(odp_lpm_route_count(lpm) == 2);
+
+	CU_ASSERT(odp_lpm_destroy(lpm) == 0);
+}
+
+static void lpm_ipv6_basic(void)
+{
+	odp_lpm_t lpm;
+	uint8_t prefix[16], addr[16];
+	uint32_t nh = 0;
+
+	lpm = create_table(NULL, ODP_LPM_IPV6, 16, 0, ODP_QSBR_INVALID);
+	CU_ASSERT_FATAL(lpm != ODP_LPM_INVALID);
+
+	/* 2001:db8::/32 -> 1, 2001:db8:1::/48 -> 2, 2001:db8:1::1/128 -> 3 */
+	memset(prefix, 0, sizeof(prefix));
+	prefix[0] = 0x20;
+	prefix[1] = 0x01;
+	prefix[2] = 0x0d;
+	prefix[3] = 0xb8;
+	CU_ASSERT(odp_lpm_route_add(lpm, prefix, 32, 1) == 0);
+	prefix[5] = 0x01;
+	CU_ASSERT(odp_lpm_route_add(lpm, prefix, 48, 2) == 0);
+	prefix[15] = 0x01;
+	CU_ASSERT(odp_lpm_route_add(lpm, prefix, 128, 3) == 0);
+
+	memcpy(addr, prefix, sizeof(addr));
+	CU_ASSERT(odp_lpm_match(lpm, addr, &nh) == 1 && nh == 3);
+	addr[15] = 0x02;
+	CU_ASSERT(odp_lpm_match(lpm, addr, &nh) == 1 && nh == 2);
+	addr[5] = 0x02;
+	CU_ASSERT(odp_lpm_match(lpm, addr, &nh) == 1 && nh == 1);
+	addr[3] = 0xb9;
+	CU_ASSERT(odp_lpm_match(lpm, addr, &nh) == 0);
+
+	CU_ASSERT(odp_lpm_route_del(lpm, prefix, 128) == 0);
+	addr[3] = 0xb8;
+	addr[5] = 0x01;
+	addr[15] = 0x01;
+	CU_ASSERT(odp_lpm_match(lpm, addr, &nh) == 1 && nh == 2);
+
+	CU_ASSERT(odp_lpm_route_count(lpm) == 2);
+	CU_ASSERT(odp_lpm_destroy(lpm) == 0);
+}
+
+/* Reference implementation: linear search of the longest matching prefix */
+static int ref_match(const uint8_t *addr, uint32_t addr_len, uint32_t *next_hop)
+{
+	int best = -1;
+
+	for (int i = 0; i < NUM_ROUTES; i++) {
+		route_t *r = &global.route[i];
+		uint32_t bits = r->len;
+		uint32_t j;
+
+		if (!r->used || (best >= 0 && r->len <= global.route[best].len))
+			continue;
+
+		for (j = 0; j < addr_len && bits; j++) {
+			uint8_t mask = bits >= 8 ? 0xff : (uint8_t)(0xff << (8 - bits));
+
+			if ((addr[j] & mask) != (r->addr[j] & mask))
+				break;
+
+			bits = bits >= 8 ? bits - 8 : 0;
+		}
+
+		if (bits == 0)
+			best = i;
+	}
+
+	if (best < 0)
+		return 0;
+
+	*next_hop = global.route[best].next_hop;
+	return 1;
+}
+
+static void random_addr(uint8_t *addr, uint32_t addr_len)
+{
+	/* Use a small address space, so that prefixes overlap often */
+	memset(addr, 0, addr_len);
+	addr[0] = 0x20 + (rand_u32() & 1);
+
+	for (uint32_t i = 1; i < addr_len; i++)
+		addr[i] = (rand_u32() & 0x3) ? (rand_u32() & 0x3) : rand_u32();
+}
+
+static void random_routes(odp_lpm_type_t type)
+{
+	uint32_t addr_len = type == ODP_LPM_IPV4 ? 4 : 16;
+	odp_lpm_t lpm;
+	odp_qsbr_t qsbr;
+	uint8_t addr[16];
+	const void *addr_ptr[NUM_MULTI];
+	uint8_t addr_tbl[NUM_MULTI][16];
+	uint32_t nh_tbl[NUM_MULTI];
+	uint8_t found[NUM_MULTI];
+	uint32_t nh, ref_nh, num = 0;
+	int ret, ref, num_found;
+
+	memset(global.route, 0, sizeof(global.route));
+
+	/* No thread is online in the domain, so freed extension tables are recycled
+	 * without delay */
+	qsbr = create_qsbr();
+	CU_ASSERT_FATAL(qsbr != ODP_QSBR_INVALID);
+
+	/* Each route may need an extension table per 8 bits beyond the first stride */
+	lpm = create_table(NULL, type, NUM_ROUTES,
+			   type == ODP_LPM_IPV4 ? NUM_ROUTES : 14 * NUM_ROUTES, qsbr);
+	CU_ASSERT_FATAL(lpm != ODP_LPM_INVALID);
+
+	for (int round = 0; round < 4; round++) {
+		/* Add random routes */
+		for (int i = 0; i < NUM_ROUTES; i++) {
+			route_t *r = &global.route[i];
+
+			if (r->used)
+				continue;
+
+			random_addr(r->addr, addr_len);
+			r->len = rand_u32() % (8 * addr_len + 1);
+			r->next_hop = rand_u32() % (global.capa.max_next_hop + 1);
+
+			/* Clear host bits to detect duplicates */
+			for (uint32_t j = 0; j < addr_len; j++) {
+				uint32_t bits = r->len > 8 * j ? r->len - 8 * j : 0;
+
+				if (bits < 8)
+					r->addr[j] &= bits ? (uint8_t)(0xff << (8 - bits)) : 0;
+			}
+
+			for (int j = 0; j < NUM_ROUTES; j++) {
+				if (j != i && global.route[j].used && global.route[j].len == r->len &&
+				    memcmp(global.route[j].addr, r->addr, addr_len) == 0) {
+					/* Replaces next hop of the duplicate */
+					global.route[j].used = 0;
+					num--;
+				}
+			}
+
+			ret = odp_lpm_route_add(lpm, r->addr, r->len, r->next_hop);
+			CU_ASSERT(ret == 0);
+			if (ret == 0) {
+				r->used = 1;
+				num++;
+			}
+		}
+
+		CU_ASSERT(odp_lpm_route_count(lpm) == num);
+
+		/* Compare against reference */
+		for (int i = 0; i < NUM_ADDR; i++) {
+			random_addr(addr, addr_len);
+			ref = ref_match(addr, addr_len, &ref_nh);
+			ret = odp_lpm_match(lpm, addr, &nh);
+
+			CU_ASSERT(ret == ref);
+			if (ret == 1 && ref == 1)
+				CU_ASSERT(nh == ref_nh);
+		}
+
+		/* Compare bulk lookup against reference */
+		for (int i = 0; i < NUM_MULTI; i++) {
+			random_addr(addr_tbl[i], addr_len);
+			addr_ptr[i] = addr_tbl[i];
+		}
+
+		num_found = odp_lpm_match_multi(lpm, addr_ptr, nh_tbl, found, NUM_MULTI);
+		ret = 0;
+
+		for (int i = 0; i < NUM_MULTI; i++) {
+			ref = ref_match(addr_tbl[i], addr_len, &ref_nh);
+			CU_ASSERT(found[i] == ref);
+			if (found[i] && ref)
+				CU_ASSERT(nh_tbl[i] == ref_nh);
+			ret += ref;
+		}
+
+		CU_ASSERT(num_found == ret);
+
+		/* Delete about half of the routes */
+		for (int i = 0; i < NUM_ROUTES; i++) {
+			route_t *r = &global.route[i];
+
+			if (!r->used || (rand_u32() & 1))
+				continue;
+
+			CU_ASSERT(odp_lpm_route_del(lpm, r->addr, r->len) == 0);
+			r->used = 0;
+			num--;
+		}
+
+		CU_ASSERT(odp_lpm_route_count(lpm) == num);
+
+		for (int i = 0; i < NUM_ADDR; i++) {
+			random_addr(addr, addr_len);
+			ref = ref_match(addr, addr_len, &ref_nh);
+			ret = odp_lpm_match(lpm, addr, &nh);
+
+			CU_ASSERT(ret == ref);
+			if (ret == 1 && ref == 1)
+				CU_ASSERT(nh == ref_nh);
+		}
+	}
+
+	/* Delete the rest */
+	for (int i = 0; i < NUM_ROUTES; i++) {
+		route_t *r = &global.route[i];
+
+		if (r->used)
+			CU_ASSERT(odp_lpm_route_del(lpm, r->addr, r->len) == 0);
+	}
+
+	CU_ASSERT(odp_lpm_route_count(lpm) == 0);
+
+	for (int i = 0; i < NUM_ADDR; i++) {
+		random_addr(addr, addr_len);
+		CU_ASSERT(odp_lpm_match(lpm, addr, &nh) == 0);
+	}
+
+	CU_ASSERT(odp_lpm_destroy(lpm) == 0);
+	CU_ASSERT(odp_qsbr_destroy(qsbr) == 0);
+}
+
+static void lpm_ipv4_random(void)
+{
+	random_routes(ODP_LPM_IPV4);
+}
+
+static void lpm_ipv6_random(void)
+{
+	random_routes(ODP_LPM_IPV6);
+}
+
+static int reader_thread(void *arg ODP_UNUSED)
+{
+	odp_lpm_t lpm = global.lpm;
+	odp_qsbr_t qsbr = global.qsbr;
+	uint32_t i = 0;
+	uint32_t nh;
+
+	if (odp_qsbr_thread_online(qsbr)) {
+		odp_atomic_inc_u32(&global.errors);
+		return -1;
+	}
+
+	while (odp_atomic_load_u32(&global.stop) == 0) {
+		/* 10.0.0.0/8 -> 1 is never deleted. Longer prefixes inside 10.1.0.0/16 map to
+		 * next hops 2 or 3. */
+		if (match_one(lpm, 0x0a000000 | (i & 0x1ffff), &nh) != 1 || nh < 1 || nh > 3)
+			odp_atomic_inc_u32(&global.errors);
+
+		odp_qsbr_quiescent(qsbr);
+		i++;
+	}
+
+	odp_qsbr_thread_offline(qsbr);
+
+	return 0;
+}
+
+static void lpm_concurrent(void)
+{
+	odp_cpumask_t mask;
+	uint8_t addr[4];
+	uint8_t prev[4];
+	uint32_t round, len, prev_len = 0;
+	int num_workers, ret;
+
+	num_workers = odp_cpumask_default_worker(&mask, 0);
+	num_workers = ODPH_MIN(ODPH_MAX(num_workers - 1, 1), MAX_WORKERS);
+
+	global.qsbr = create_qsbr();
+	CU_ASSERT_FATAL(global.qsbr != ODP_QSBR_INVALID);
+
+	global.lpm = create_table(NULL, ODP_LPM_IPV4, NUM_ROUTES, 0, global.qsbr);
+	CU_ASSERT_FATAL(global.lpm != ODP_LPM_INVALID);
+	odp_atomic_init_u32(&global.stop, 0);
+	odp_atomic_init_u32(&global.errors, 0);
+
+	ipv4(addr, 0x0a000000);
+	CU_ASSERT_FATAL(odp_lpm_route_add(global.lpm, addr, 8, 1) == 0);
+
+	CU_ASSERT_FATAL(odp_cunit_thread_create(num_workers, reader_thread, NULL, 0, 0) ==
+			num_workers);
+
+	/* Add and delete long prefixes, which allocate and free extension tables */
+	for (round = 0; round < NUM_ROUNDS; round++) {
+		ipv4(addr, 0x0a010000 | ((round * 37) & 0xffff));
+		len = 25 + (round % 8);
+
+		ret = odp_lpm_route_add(global.lpm, addr, len, 2 + (round & 1));
+
+		if (ret) {
+			/* Freed extension tables may still wait for readers to pass a quiescent
+			 * state */
+			odp_qsbr_synchronize(global.qsbr);
+			ret = odp_lpm_route_add(global.lpm, addr, len, 2 + (round & 1));
+		}
+
+		CU_ASSERT(ret == 0);
+
+		if (round)
+			CU_ASSERT(odp_lpm_route_del(global.lpm, prev, prev_len) == 0);
+
+		memcpy(prev, addr, sizeof(prev));
+		prev_len = len;
+	}
+
+	odp_atomic_store_u32(&global.stop, 1);
+	CU_ASSERT(odp_cunit_thread_join(num_workers) >= 0);
+
+	CU_ASSERT(odp_atomic_load_u32(&global.errors) == 0);
+	CU_ASSERT(odp_lpm_destroy(global.lpm) == 0);
+	CU_ASSERT(odp_qsbr_destroy(global.qsbr) == 0);
+}
+
+odp_testinfo_t lpm_suite[] = {
+	ODP_TEST_INFO(lpm_capability),
+	ODP_TEST_INFO(lpm_param_defaults),
+	ODP_TEST_INFO(lpm_create),
+	ODP_TEST_INFO(lpm_create_long_name),
+	ODP_TEST_INFO(lpm_ipv4_basic),
+	ODP_TEST_INFO(lpm_ipv6_basic),
+	ODP_TEST_INFO(lpm_ipv4_random),
+	ODP_TEST_INFO(lpm_ipv6_random),
+	ODP_TEST_INFO(lpm_concurrent),
+	ODP_TEST_INFO_NULL,
+};
+
+odp_suiteinfo_t lpm_suites[] = {
+	{"LPM", lpm_suite_init, NULL, lpm_suite},
+	ODP_SUITE_INFO_NULL
+};
+
+int main(int argc, char *argv[])
+{
+	int ret;
+
+	/* parse common options: */
+	if (odp_cunit_parse_options(&argc, argv))
+		return -1;
+
+	ret = odp_cunit_register(lpm_suites);
+
+	if (ret == 0)
+		ret = odp_cunit_run();
+
+	return ret;
+}
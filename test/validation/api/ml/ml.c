@@ -7,6 +7,8 @@
 #include <odp/helper/odph_api.h>
 #include "odp_cunit_common.h"
 
+#include <math.h>
+
 #define UAREA     0xaa
 #define NUM_COMPL 10u
 #define COMPL_POOL_NAME "ML compl pool"
@@ -638,6 +640,60 @@ test_ml_fp32_from_int16(void)
 		CU_ASSERT(fp32[i] == fp32_expected[i]);
 }
 
+/* Special values, repeated so that implementations may convert them in vectors */
+#define NUM_SPECIAL 32
+
+static void special_fp32(float fp32[])
+{
+	const float val[8] = {NAN, -NAN, INFINITY, -INFINITY, 1e30f, -1e30f, 3.4f, -3.4f};
+
+	for (uint32_t i = 0; i < NUM_SPECIAL; i++)
+		fp32[i] = val[(i + i / 8) % 8];
+}
+
+/* Converting an array must give the same results as converting each element alone.
+ * Infinities saturate. */
+static void test_ml_fp32_to_int_special(void)
+{
+	float fp32[NUM_SPECIAL];
+	uint8_t u8[NUM_SPECIAL], u8_one;
+	int8_t i8[NUM_SPECIAL], i8_one;
+	uint16_t u16[NUM_SPECIAL], u16_one;
+	int16_t i16[NUM_SPECIAL], i16_one;
+	const float scale = 0.0223f;
+
+	special_fp32(fp32);
+
+	odp_ml_fp32_to_uint8(u8, fp32, NUM_SPECIAL, scale, 43);
+	odp_ml_fp32_to_int8(i8, fp32, NUM_SPECIAL, scale, -56);
+	odp_ml_fp32_to_uint16(u16, fp32, NUM_SPECIAL, scale, 1834);
+	odp_ml_fp32_to_int16(i16, fp32, NUM_SPECIAL, scale, 683);
+
+	for (uint32_t i = 0; i < NUM_SPECIAL; i++) {
+		odp_ml_fp32_to_uint8(&u8_one, &fp32[i], 1, scale, 43);
+		odp_ml_fp32_to_int8(&i8_one, &fp32[i], 1, scale, -56);
+		odp_ml_fp32_to_uint16(&u16_one, &fp32[i], 1, scale, 1834);
+		odp_ml_fp32_to_int16(&i16_one, &fp32[i], 1, scale, 683);
+
+		CU_ASSERT(u8[i] == u8_one);
+		CU_ASSERT(i8[i] == i8_one);
+		CU_ASSERT(u16[i] == u16_one);
+		CU_ASSERT(i16[i] == i16_one);
+
+		if (isinf(fp32[i]) && fp32[i] > 0) {
+			CU_ASSERT(u8[i] == UINT8_MAX);
+			CU_ASSERT(i8[i] == 127);
+			CU_ASSERT(u16[i] == UINT16_MAX);
+			CU_ASSERT(i16[i] == 32767);
+		} else if (isinf(fp32[i])) {
+			CU_ASSERT(u8[i] == 0);
+			CU_ASSERT(i8[i] == -127);
+			CU_ASSERT(u16[i] == 0);
+			CU_ASSERT(i16[i] == -32767);
+		}
+	}
+}
+
 static int approx_equal(double a, double b)
 {
 	const double tolerance = .01;
@@ -718,6 +774,7 @@ odp_testinfo_t ml_suite[] = {
 	ODP_TEST_INFO_CONDITIONAL(test_ml_fp32_to_int16_positive_zp, check_ml_support),
 	ODP_TEST_INFO_CONDITIONAL(test_ml_fp32_to_int16_negative_zp, check_ml_support),
 	ODP_TEST_INFO_CONDITIONAL(test_ml_fp32_from_int16, check_ml_support),
+	ODP_TEST_INFO_CONDITIONAL(test_ml_fp32_to_int_special, check_ml_support),
 	ODP_TEST_INFO_CONDITIONAL(test_ml_fp32_fp16, check_ml_support),
 	ODP_TEST_INFO_NULL
 };
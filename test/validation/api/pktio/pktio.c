@@ -30,6 +30,7 @@
 #define TX_BATCH_LEN           4
 #define PKTV_TX_BATCH_LEN      32
 #define PKTV_DEFAULT_SIZE      8
+#define PKTV_TMO_NS            (10 * ODP_TIME_MSEC_IN_NS)
 #define EVV_DEFAULT_SIZE       8
 #define MAX_QUEUES             128
 
@@ -102,6 +103,8 @@ typedef enum {
 typedef enum vector_mode_t {
 	VECTOR_MODE_DISABLED = 0,
 	VECTOR_MODE_PACKET,
+	/* Packet vectors with a vector timeout */
+	VECTOR_MODE_PACKET_TMO,
 	VECTOR_MODE_EVENT
 } vector_mode_t;
 
@@ -611,7 +614,7 @@ static odp_pktio_t create_pktio(int iface_idx, odp_pktin_mode_t imode,
 
 static odp_pktio_t create_pktv_pktio(int iface_idx, odp_pktin_mode_t imode,
 				     odp_pktout_mode_t omode, odp_schedule_sync_t sync_mode,
-				     uint32_t test_flags)
+				     uint64_t max_tmo_ns, uint32_t test_flags)
 {
 	const char *iface = global.iface[iface_idx].name;
 	odp_pktout_queue_param_t pktout_param;
@@ -654,6 +657,9 @@ static odp_pktio_t create_pktv_pktio(int iface_idx, odp_pktin_mode_t imode,
 	pktin_param.vector.max_size = capa.vector.max_size < PKTV_DEFAULT_SIZE ?
 					capa.vector.max_size : PKTV_DEFAULT_SIZE;
 	pktin_param.vector.max_tmo_ns = capa.vector.min_tmo_ns;
+	if (max_tmo_ns > capa.vector.min_tmo_ns)
+		pktin_param.vector.max_tmo_ns = max_tmo_ns < capa.vector.max_tmo_ns ?
+						max_tmo_ns : capa.vector.max_tmo_ns;
 	CU_ASSERT(odp_pktin_queue_config(pktio, &pktin_param) == 0);
 
 	odp_pktout_queue_param_init(&pktout_param);
@@ -891,7 +897,8 @@ static int get_packets(pktio_info_t *pktio_rx, odp_packet_t pkt_tbl[],
 	for (i = 0; i < num_evts; ++i) {
 		if (odp_event_type(evt_tbl[i]) == ODP_EVENT_PACKET) {
 			pkt_tbl[num_pkts++] = odp_packet_from_event(evt_tbl[i]);
-		} else if (vector_mode == VECTOR_MODE_PACKET &&
+		} else if ((vector_mode == VECTOR_MODE_PACKET ||
+			    vector_mode == VECTOR_MODE_PACKET_TMO) &&
 			   odp_event_type(evt_tbl[i]) == ODP_EVENT_PACKET_VECTOR &&
 			   num_pkts < num) {
 			odp_packet_vector_t pktv;
@@ -1386,7 +1393,10 @@ static void do_test_txrx(odp_pktin_mode_t in_mode, int num_pkts,
 
 		io->name = global.iface[i].name;
 		if (vector_mode == VECTOR_MODE_PACKET)
-			io->id = create_pktv_pktio(i, in_mode, out_mode, sync_mode, test_flags);
+			io->id = create_pktv_pktio(i, in_mode, out_mode, sync_mode, 0, test_flags);
+		else if (vector_mode == VECTOR_MODE_PACKET_TMO)
+			io->id = create_pktv_pktio(i, in_mode, out_mode, sync_mode,
+						   PKTV_TMO_NS, test_flags);
 		else if (vector_mode == VECTOR_MODE_EVENT)
 			io->id = create_evv_pktio(i, in_mode, out_mode, sync_mode, &aggr_tmo);
 		else
@@ -4447,6 +4457,334 @@ static int pktio_check_pktout_dont_free(void)
 		ODP_TEST_ACTIVE : ODP_TEST_INACTIVE;
 }
 
+#define REASS_PAYLOAD_LEN  1000
+#define REASS_FRAG_LEN     400
+#define REASS_NUM_FRAGS    3
+#define REASS_IP_PROTO     253 /* Experimental protocol number */
+#define REASS_IPV4_FLAG_MF 0x2000
+#define REASS_WAIT_NS      (10 * ODP_TIME_MSEC_IN_NS)
+
+static odp_packet_t reass_frag_create(odp_pktio_t pktio_tx, odp_pktio_t pktio_rx,
+				      const uint8_t *payload, uint16_t ip_id, int idx)
+{
+	odp_packet_t pkt;
+	odph_ipv4hdr_t *ip;
+	const uint32_t offset = idx * REASS_FRAG_LEN;
+	const uint32_t len = ODPH_MIN((uint32_t)REASS_FRAG_LEN, REASS_PAYLOAD_LEN - offset);
+	uint16_t frag_offset = offset / 8;
+
+	pkt = odp_packet_alloc(global.default_pkt_pool, ODPH_ETHHDR_LEN + ODPH_IPV4HDR_LEN + len);
+	CU_ASSERT_FATAL(pkt != ODP_PACKET_INVALID);
+
+	pktio_init_packet_eth_ipv4(pkt, REASS_IP_PROTO);
+	pktio_pkt_set_macs(pkt, pktio_tx, pktio_rx, ETH_UNICAST);
+
+	if (idx < REASS_NUM_FRAGS - 1)
+		frag_offset |= REASS_IPV4_FLAG_MF;
+
+	ip = odp_packet_l3_ptr(pkt, NULL);
+	ip->id = odp_cpu_to_be_16(ip_id);
+	ip->frag_offset = odp_cpu_to_be_16(frag_offset);
+	odph_ipv4_csum_update(pkt);
+
+	CU_ASSERT(odp_packet_copy_from_mem(pkt, ODPH_ETHHDR_LEN + ODPH_IPV4HDR_LEN, len,
+					   payload + offset) == 0);
+
+	return pkt;
+}
+
+static void check_reass_complete(odp_packet_t pkt, const uint8_t *payload)
+{
+	odp_packet_reass_info_t info;
+	uint8_t data[REASS_PAYLOAD_LEN];
+	odph_ipv4hdr_t *ip;
+
+	CU_ASSERT(odp_packet_reass_status(pkt) == ODP_PACKET_REASS_COMPLETE);
+	CU_ASSERT(odp_packet_reass_info(pkt, &info) == 0);
+	CU_ASSERT(info.num_frags == REASS_NUM_FRAGS);
+	CU_ASSERT(odp_packet_len(pkt) == ODPH_ETHHDR_LEN + ODPH_IPV4HDR_LEN + REASS_PAYLOAD_LEN);
+	CU_ASSERT(odp_packet_has_ipv4(pkt));
+	CU_ASSERT(!odp_packet_has_ipfrag(pkt));
+	CU_ASSERT(odp_packet_l3_offset(pkt) == ODPH_ETHHDR_LEN);
+
+	ip = odp_packet_l3_ptr(pkt, NULL);
+	CU_ASSERT_FATAL(ip != NULL);
+	CU_ASSERT(odp_be_to_cpu_16(ip->tot_len) == ODPH_IPV4HDR_LEN + REASS_PAYLOAD_LEN);
+	CU_ASSERT(ip->frag_offset == 0);
+	CU_ASSERT(odph_ipv4_csum_valid(pkt));
+
+	CU_ASSERT(odp_packet_copy_to_mem(pkt, ODPH_ETHHDR_LEN + ODPH_IPV4HDR_LEN,
+					 REASS_PAYLOAD_LEN, data) == 0);
+	CU_ASSERT(memcmp(data, payload, REASS_PAYLOAD_LEN) == 0);
+
+	odp_packet_free(pkt);
+}
+
+static void check_reass_incomplete(odp_packet_t pkt, int num_sent)
+{
+	odp_packet_t frags[REASS_NUM_FRAGS];
+	odp_packet_reass_partial_state_t state;
+
+	CU_ASSERT(odp_packet_reass_status(pkt) == ODP_PACKET_REASS_INCOMPLETE);
+
+	if (odp_packet_reass_partial_state(pkt, frags, &state)) {
+		CU_FAIL("Partial state failed");
+		odp_packet_free(pkt);
+		return;
+	}
+
+	CU_ASSERT_FATAL(state.num_frags == num_sent);
+	CU_ASSERT(state.elapsed_time >= REASS_WAIT_NS);
+
+	/* Fragments are returned in offset order */
+	for (int i = 0; i < num_sent; i++) {
+		uint32_t offset = (REASS_NUM_FRAGS - num_sent + i) * REASS_FRAG_LEN;
+		uint32_t len = ODPH_MIN((uint32_t)REASS_FRAG_LEN, REASS_PAYLOAD_LEN - offset);
+
+		CU_ASSERT(odp_packet_reass_status(frags[i]) == ODP_PACKET_REASS_NONE);
+		CU_ASSERT(odp_packet_has_ipfrag(frags[i]));
+		CU_ASSERT(odp_packet_len(frags[i]) == ODPH_ETHHDR_LEN + ODPH_IPV4HDR_LEN + len);
+		odp_packet_free(frags[i]);
+	}
+}
+
+static void test_reass_ipv4(odp_bool_t complete)
+{
+	odp_pktio_t pktio[MAX_NUM_IFACES] = {ODP_PKTIO_INVALID};
+	odp_pktio_t pktio_tx, pktio_rx;
+	odp_pktout_queue_t pktout;
+	odp_pktin_queue_t pktin;
+	odp_pktio_config_t config;
+	odp_packet_t frag[REASS_NUM_FRAGS];
+	odp_packet_t pkt = ODP_PACKET_INVALID;
+	uint8_t payload[REASS_PAYLOAD_LEN];
+	odp_time_t end;
+	const int num_tx = complete ? REASS_NUM_FRAGS : REASS_NUM_FRAGS - 1;
+	uint16_t ip_id = odp_atomic_fetch_inc_u32(&global.ip_seq);
+	int i;
+
+	for (i = 0; i < REASS_PAYLOAD_LEN; i++)
+		payload[i] = i;
+
+	for (i = 0; i < global.num_ifaces; i++) {
+		pktio[i] = create_pktio(i, ODP_PKTIN_MODE_DIRECT, ODP_PKTOUT_MODE_DIRECT);
+		CU_ASSERT_FATAL(pktio[i] != ODP_PKTIO_INVALID);
+
+		odp_pktio_config_init(&config);
+		config.reassembly.en_ipv4 = true;
+		config.reassembly.max_num_frags = REASS_NUM_FRAGS;
+		config.reassembly.max_wait_time = complete ? 0 : REASS_WAIT_NS;
+		CU_ASSERT_FATAL(odp_pktio_config(pktio[i], &config) == 0);
+
+		CU_ASSERT_FATAL(odp_pktio_start(pktio[i]) == 0);
+	}
+
+	pktio_tx = pktio[0];
+	pktio_rx = (global.num_ifaces > 1) ? pktio[1] : pktio_tx;
+
+	for (i = 0; i < global.num_ifaces; i++)
+		_pktio_wait_linkup(pktio[i]);
+
+	CU_ASSERT_FATAL(odp_pktout_queue(pktio_tx, &pktout, 1) == 1);
+	CU_ASSERT_FATAL(odp_pktin_queue(pktio_rx, &pktin, 1) == 1);
+
+	/* Send fragments in reverse order. First fragment is left out in the incomplete case. */
+	for (i = 0; i < num_tx; i++)
+		frag[i] = reass_frag_create(pktio_tx, pktio_rx, payload, ip_id,
+					    REASS_NUM_FRAGS - 1 - i);
+
+	CU_ASSERT_FATAL(send_packets(pktout, frag, num_tx) == 0);
+
+	end = odp_time_add_ns(odp_time_local(), ODP_TIME_SEC_IN_NS);
+
+	while (odp_time_cmp(end, odp_time_local()) > 0) {
+		odp_packet_t rx_pkt;
+		int ret = odp_pktin_recv(pktin, &rx_pkt, 1);
+
+		CU_ASSERT(ret >= 0);
+		if (ret != 1)
+			continue;
+
+		if (odp_packet_reass_status(rx_pkt) != ODP_PACKET_REASS_NONE) {
+			pkt = rx_pkt;
+			break;
+		}
+
+		/* Unrelated packet */
+		odp_packet_free(rx_pkt);
+	}
+
+	CU_ASSERT(pkt != ODP_PACKET_INVALID);
+
+	if (pkt != ODP_PACKET_INVALID) {
+		if (complete)
+			check_reass_complete(pkt, payload);
+		else
+			check_reass_incomplete(pkt, num_tx);
+	}
+
+	for (i = 0; i < global.num_ifaces; i++) {
+		CU_ASSERT_FATAL(odp_pktio_stop(pktio[i]) == 0);
+		CU_ASSERT_FATAL(odp_pktio_close(pktio[i]) == 0);
+	}
+}
+
+static void pktio_test_reass_ipv4(void)
+{
+	test_reass_ipv4(true);
+}
+
+static void pktio_test_reass_ipv4_incomplete(void)
+{
+	test_reass_ipv4(false);
+}
+
+static int pktio_check_reass_ipv4(void)
+{
+	const odp_reass_capability_t *capa = &global.iface[0].capa.direct.reassembly;
+
+	if (!capa->ipv4 || capa->max_num_frags < REASS_NUM_FRAGS ||
+	    capa->max_wait_time < REASS_WAIT_NS)
+		return ODP_TEST_INACTIVE;
+
+	return ODP_TEST_ACTIVE;
+}
+
+#define TCP_STREAM_NUM_SEGS 8
+#define TCP_STREAM_SEG_LEN  201
+#define TCP_STREAM_LEN      (TCP_STREAM_NUM_SEGS * TCP_STREAM_SEG_LEN)
+#define TCP_STREAM_SRC_PORT 12051
+#define TCP_STREAM_DST_PORT 12052
+#define TCP_STREAM_SEQ      0xfffffe00
+#define TCP_STREAM_HDR_LEN  (ODPH_ETHHDR_LEN + ODPH_IPV4HDR_LEN + ODPH_TCPHDR_LEN)
+
+static odp_packet_t tcp_stream_seg_create(odp_pktio_t pktio_tx, odp_pktio_t pktio_rx,
+					  const uint8_t *payload, int idx)
+{
+	odp_packet_t pkt;
+	odph_tcphdr_t *tcp;
+
+	pkt = odp_packet_alloc(global.default_pkt_pool, TCP_STREAM_HDR_LEN + TCP_STREAM_SEG_LEN);
+	CU_ASSERT_FATAL(pkt != ODP_PACKET_INVALID);
+
+	pktio_init_packet_eth_ipv4(pkt, ODPH_IPPROTO_TCP);
+	pktio_pkt_set_macs(pkt, pktio_tx, pktio_rx, ETH_UNICAST);
+
+	odp_packet_has_ipv4_set(pkt, 1);
+	odp_packet_has_tcp_set(pkt, 1);
+	odp_packet_l4_offset_set(pkt, ODPH_ETHHDR_LEN + ODPH_IPV4HDR_LEN);
+	tcp = odp_packet_l4_ptr(pkt, NULL);
+	memset(tcp, 0, ODPH_TCPHDR_LEN);
+	tcp->src_port = odp_cpu_to_be_16(TCP_STREAM_SRC_PORT);
+	tcp->dst_port = odp_cpu_to_be_16(TCP_STREAM_DST_PORT);
+	tcp->seq_no = odp_cpu_to_be_32(TCP_STREAM_SEQ + idx * TCP_STREAM_SEG_LEN);
+	tcp->ack_no = odp_cpu_to_be_32(1);
+	tcp->hl = ODPH_TCPHDR_LEN / 4;
+	tcp->ack = 1;
+	tcp->window = odp_cpu_to_be_16(1000 + idx);
+
+	CU_ASSERT(odp_packet_copy_from_mem(pkt, TCP_STREAM_HDR_LEN, TCP_STREAM_SEG_LEN,
+					   payload + idx * TCP_STREAM_SEG_LEN) == 0);
+	CU_ASSERT(odph_tcp_chksum_set(pkt) == 0);
+
+	return pkt;
+}
+
+/* Received segments may have been coalesced by the implementation */
+static int tcp_stream_seg_check(odp_packet_t pkt, const uint8_t *payload, uint32_t *offset)
+{
+	uint8_t data[TCP_STREAM_LEN];
+	odph_ipv4hdr_t *ip;
+	odph_tcphdr_t *tcp;
+	uint32_t len;
+
+	if (!odp_packet_has_tcp(pkt))
+		return 0;
+
+	tcp = odp_packet_l4_ptr(pkt, NULL);
+	if (tcp == NULL || odp_be_to_cpu_16(tcp->dst_port) != TCP_STREAM_DST_PORT)
+		return 0;
+
+	ip = odp_packet_l3_ptr(pkt, NULL);
+	CU_ASSERT_FATAL(ip != NULL);
+	CU_ASSERT(odp_be_to_cpu_16(ip->tot_len) == odp_packet_len(pkt) - ODPH_ETHHDR_LEN);
+	CU_ASSERT(odph_ipv4_csum_valid(pkt));
+	CU_ASSERT(odph_udp_tcp_chksum(pkt, ODPH_CHKSUM_VERIFY, NULL) == 0);
+	CU_ASSERT(odp_be_to_cpu_32(tcp->seq_no) == TCP_STREAM_SEQ + *offset);
+	CU_ASSERT(odp_be_to_cpu_32(tcp->ack_no) == 1);
+
+	len = odp_packet_len(pkt) - TCP_STREAM_HDR_LEN;
+	CU_ASSERT(len % TCP_STREAM_SEG_LEN == 0);
+	CU_ASSERT_FATAL(*offset + len <= TCP_STREAM_LEN);
+	CU_ASSERT(odp_packet_copy_to_mem(pkt, TCP_STREAM_HDR_LEN, len, data) == 0);
+	CU_ASSERT(memcmp(data, payload + *offset, len) == 0);
+	*offset += len;
+
+	return 1;
+}
+
+static void pktio_test_recv_tcp_stream(void)
+{
+	odp_pktio_t pktio[MAX_NUM_IFACES] = {ODP_PKTIO_INVALID};
+	odp_pktio_t pktio_tx, pktio_rx;
+	odp_pktout_queue_t pktout;
+	odp_pktin_queue_t pktin;
+	odp_pktio_config_t config;
+	odp_packet_t pkt_tbl[TCP_STREAM_NUM_SEGS];
+	uint8_t payload[TCP_STREAM_LEN];
+	uint32_t offset = 0;
+	odp_time_t end;
+	int i;
+
+	for (i = 0; i < TCP_STREAM_LEN; i++)
+		payload[i] = i;
+
+	for (i = 0; i < global.num_ifaces; i++) {
+		pktio[i] = create_pktio(i, ODP_PKTIN_MODE_DIRECT, ODP_PKTOUT_MODE_DIRECT);
+		CU_ASSERT_FATAL(pktio[i] != ODP_PKTIO_INVALID);
+
+		odp_pktio_config_init(&config);
+		config.parser.layer = ODP_PROTO_LAYER_L4;
+		CU_ASSERT_FATAL(odp_pktio_config(pktio[i], &config) == 0);
+
+		CU_ASSERT_FATAL(odp_pktio_start(pktio[i]) == 0);
+	}
+
+	pktio_tx = pktio[0];
+	pktio_rx = (global.num_ifaces > 1) ? pktio[1] : pktio_tx;
+
+	for (i = 0; i < global.num_ifaces; i++)
+		_pktio_wait_linkup(pktio[i]);
+
+	CU_ASSERT_FATAL(odp_pktout_queue(pktio_tx, &pktout, 1) == 1);
+	CU_ASSERT_FATAL(odp_pktin_queue(pktio_rx, &pktin, 1) == 1);
+
+	for (i = 0; i < TCP_STREAM_NUM_SEGS; i++)
+		pkt_tbl[i] = tcp_stream_seg_create(pktio_tx, pktio_rx, payload, i);
+
+	CU_ASSERT_FATAL(send_packets(pktout, pkt_tbl, TCP_STREAM_NUM_SEGS) == 0);
+
+	end = odp_time_add_ns(odp_time_local(), ODP_TIME_SEC_IN_NS);
+
+	while (offset < TCP_STREAM_LEN && odp_time_cmp(end, odp_time_local()) > 0) {
+		int num = odp_pktin_recv(pktin, pkt_tbl, TCP_STREAM_NUM_SEGS);
+
+		CU_ASSERT(num >= 0);
+
+		for (i = 0; i < num; i++) {
+			tcp_stream_seg_check(pkt_tbl[i], payload, &offset);
+			odp_packet_free(pkt_tbl[i]);
+		}
+	}
+
+	CU_ASSERT(offset == TCP_STREAM_LEN);
+
+	for (i = 0; i < global.num_ifaces; i++) {
+		CU_ASSERT_FATAL(odp_pktio_stop(pktio[i]) == 0);
+		CU_ASSERT_FATAL(odp_pktio_close(pktio[i]) == 0);
+	}
+}
+
 static void test_chksum(void (*config_fn)(odp_pktio_t, odp_pktio_t),
 			void (*prep_fn)(odp_packet_t pkt),
 			void (*test_fn)(odp_packet_t pkt),
@@ -4899,6 +5237,110 @@ static void pktio_test_chksum_out_udp_pktio(void)
 			  pktio_test_chksum_out_udp_test);
 }
 
+static void pktio_test_chksum_out_udp_no_l4_prep(odp_packet_t pkt)
+{
+	/* L4 protocol is not known, implementation needs to parse the packet */
+	odp_packet_has_l4_set(pkt, 0);
+	odp_packet_has_udp_set(pkt, 0);
+}
+
+static void pktio_test_chksum_out_udp_no_l4(void)
+{
+	pktio_test_chksum(pktio_test_chksum_out_udp_pktio_config,
+			  pktio_test_chksum_out_udp_no_l4_prep,
+			  pktio_test_chksum_out_udp_test);
+}
+
+static void pktio_test_chksum_out_udp_pad(void)
+{
+	odp_pktio_t pktio_tx, pktio_rx;
+	odp_pktio_t pktio[MAX_NUM_IFACES] = {ODP_PKTIO_INVALID};
+	pktio_info_t pktio_rx_info;
+	odp_pktout_queue_t pktout_queue;
+	odp_packet_t pkt_tbl[TX_BATCH_LEN];
+	odp_packet_t pkt_tmp[TX_BATCH_LEN];
+	uint32_t pkt_seq[TX_BATCH_LEN];
+	const uint8_t pad[6] = {0};
+	const uint32_t pad_len = sizeof(pad);
+	const uint32_t pkt_len = global.packet_len + pad_len;
+	odp_time_t end;
+	int ret, i, num_rx = 0;
+
+	CU_ASSERT_FATAL(global.num_ifaces >= 1);
+
+	for (i = 0; i < global.num_ifaces; ++i) {
+		pktio[i] = create_pktio(i, ODP_PKTIN_MODE_DIRECT, ODP_PKTOUT_MODE_DIRECT);
+		CU_ASSERT_FATAL(pktio[i] != ODP_PKTIO_INVALID);
+	}
+
+	pktio_tx = pktio[0];
+	pktio_rx = (global.num_ifaces > 1) ? pktio[1] : pktio_tx;
+	pktio_rx_info.id   = pktio_rx;
+	pktio_rx_info.inq  = ODP_QUEUE_INVALID;
+	pktio_rx_info.in_mode = ODP_PKTIN_MODE_DIRECT;
+
+	pktio_test_chksum_out_udp_pktio_config(pktio_tx, pktio_rx);
+
+	for (i = 0; i < global.num_ifaces; ++i) {
+		CU_ASSERT_FATAL(odp_pktio_start(pktio[i]) == 0);
+		_pktio_wait_linkup(pktio[i]);
+	}
+
+	ret = create_packets_udp(pkt_tbl, pkt_seq, TX_BATCH_LEN, pktio_tx, pktio_rx, false,
+				 ETH_UNICAST);
+	CU_ASSERT_FATAL(ret == TX_BATCH_LEN);
+
+	/* Zero padding after IP payload must not be included in the UDP length of the
+	 * pseudo header */
+	for (i = 0; i < TX_BATCH_LEN; i++) {
+		CU_ASSERT_FATAL(odp_packet_extend_tail(&pkt_tbl[i], pad_len, NULL, NULL) >= 0);
+		CU_ASSERT_FATAL(odp_packet_copy_from_mem(pkt_tbl[i], global.packet_len, pad_len,
+							 pad) == 0);
+		odp_packet_has_ipv4_set(pkt_tbl[i], 1);
+		odp_packet_has_udp_set(pkt_tbl[i], 1);
+	}
+
+	ret = odp_pktout_queue(pktio_tx, &pktout_queue, 1);
+	CU_ASSERT_FATAL(ret > 0);
+
+	send_packets(pktout_queue, pkt_tbl, TX_BATCH_LEN);
+
+	end = odp_time_sum(odp_time_local(), odp_time_local_from_ns(ODP_TIME_SEC_IN_NS));
+
+	while (num_rx < TX_BATCH_LEN && odp_time_cmp(end, odp_time_local()) > 0) {
+		int n = get_packets(&pktio_rx_info, pkt_tmp, TX_BATCH_LEN - num_rx,
+				    TXRX_MODE_MULTI, VECTOR_MODE_DISABLED);
+
+		if (n < 0)
+			break;
+
+		for (i = 0; i < n; i++) {
+			odph_udphdr_t *udp = odp_packet_l4_ptr(pkt_tmp[i], NULL);
+			uint32_t off = odp_packet_l4_offset(pkt_tmp[i]) + ODPH_UDPHDR_LEN;
+			pkt_head_t head;
+
+			if (odp_packet_len(pkt_tmp[i]) != pkt_len || udp == NULL ||
+			    odp_packet_copy_to_mem(pkt_tmp[i], off, sizeof(head), &head) ||
+			    head.magic != TEST_SEQ_MAGIC || head.seq != pkt_seq[num_rx]) {
+				odp_packet_free(pkt_tmp[i]);
+				continue;
+			}
+
+			CU_ASSERT(udp->chksum != 0);
+			CU_ASSERT(!odph_udp_chksum_verify(pkt_tmp[i]));
+			odp_packet_free(pkt_tmp[i]);
+			num_rx++;
+		}
+	}
+
+	CU_ASSERT(num_rx == TX_BATCH_LEN);
+
+	for (i = 0; i < global.num_ifaces; i++) {
+		CU_ASSERT_FATAL(odp_pktio_stop(pktio[i]) == 0);
+		CU_ASSERT_FATAL(odp_pktio_close(pktio[i]) == 0);
+	}
+}
+
 static int pktio_check_chksum_out_sctp(void)
 {
 	odp_pktio_capability_t *capa = &global.iface[0].capa.direct;
@@ -5136,6 +5578,19 @@ static void pktio_test_pktv_recv_atomic(void)
 		  ODP_SCHED_SYNC_ATOMIC, VECTOR_MODE_PACKET);
 }
 
+/* Less packets than fits into a vector, so that vectors are formed on timeout */
+static void pktio_test_pktv_recv_tmo_plain(void)
+{
+	test_txrx(ODP_PKTIN_MODE_QUEUE, PKTV_DEFAULT_SIZE - 1, TXRX_MODE_MULTI_EVENT,
+		  0, VECTOR_MODE_PACKET_TMO);
+}
+
+static void pktio_test_pktv_recv_tmo_parallel(void)
+{
+	test_txrx(ODP_PKTIN_MODE_SCHED, PKTV_DEFAULT_SIZE - 1, TXRX_MODE_MULTI_EVENT,
+		  ODP_SCHED_SYNC_PARALLEL, VECTOR_MODE_PACKET_TMO);
+}
+
 static int pktio_check_evv(odp_pktin_mode_t in_mode)
 {
 	odp_event_aggr_capability_t aggr_capa;
@@ -5988,6 +6443,10 @@ odp_testinfo_t pktio_suite_unsegmented[] = {
 				  pktio_check_chksum_out_udp),
 	ODP_TEST_INFO_CONDITIONAL(pktio_test_chksum_out_udp_pktio,
 				  pktio_check_chksum_out_udp),
+	ODP_TEST_INFO_CONDITIONAL(pktio_test_chksum_out_udp_no_l4,
+				  pktio_check_chksum_out_udp),
+	ODP_TEST_INFO_CONDITIONAL(pktio_test_chksum_out_udp_pad,
+				  pktio_check_chksum_out_udp),
 	ODP_TEST_INFO_CONDITIONAL(pktio_test_chksum_out_udp_ovr,
 				  pktio_check_chksum_out_udp),
 	ODP_TEST_INFO_CONDITIONAL(pktio_test_chksum_out_sctp_no_ovr,
@@ -6006,6 +6465,9 @@ odp_testinfo_t pktio_suite_unsegmented[] = {
 				  pktio_check_pktout_compl_event_sched_queue),
 	ODP_TEST_INFO_CONDITIONAL(pktio_test_pktout_compl_poll, pktio_check_pktout_compl_poll),
 	ODP_TEST_INFO_CONDITIONAL(pktio_test_pktout_dont_free, pktio_check_pktout_dont_free),
+	ODP_TEST_INFO_CONDITIONAL(pktio_test_reass_ipv4, pktio_check_reass_ipv4),
+	ODP_TEST_INFO_CONDITIONAL(pktio_test_reass_ipv4_incomplete, pktio_check_reass_ipv4),
+	ODP_TEST_INFO(pktio_test_recv_tcp_stream),
 	ODP_TEST_INFO_CONDITIONAL(pktio_test_enable_pause_rx, pktio_check_pause_rx),
 	ODP_TEST_INFO_CONDITIONAL(pktio_test_enable_pause_tx, pktio_check_pause_tx),
 	ODP_TEST_INFO_CONDITIONAL(pktio_test_enable_pause_both, pktio_check_pause_both),
@@ -6035,6 +6497,8 @@ odp_testinfo_t pktv_suite[] = {
 	ODP_TEST_INFO_CONDITIONAL(pktio_test_pktv_recv_parallel, pktio_check_pktv_sched),
 	ODP_TEST_INFO_CONDITIONAL(pktio_test_pktv_recv_ordered, pktio_check_pktv_sched),
 	ODP_TEST_INFO_CONDITIONAL(pktio_test_pktv_recv_atomic, pktio_check_pktv_sched),
+	ODP_TEST_INFO_CONDITIONAL(pktio_test_pktv_recv_tmo_plain, pktio_check_pktv_queue),
+	ODP_TEST_INFO_CONDITIONAL(pktio_test_pktv_recv_tmo_parallel, pktio_check_pktv_sched),
 	ODP_TEST_INFO_NULL
 };
 
@@ -906,6 +906,120 @@ static void alloc_timeout(uint32_t cache_size)
 	CU_ASSERT(odp_pool_destroy(pool) == 0);
 }
 
+static int pool_check_packet_subparam_stats(void)
+{
+	if (global_pool_capa.pkt.max_num_subparam < 2 ||
+	    global_pool_capa.pkt.stats.bit.available == 0 ||
+	    global_pool_capa.pkt.stats.bit.cache_available == 0)
+		return ODP_TEST_INACTIVE;
+
+	return ODP_TEST_ACTIVE;
+}
+
+/* Number of free packets per subparameter */
+static void packet_subparam_free(odp_pool_t pool, uint32_t num_class, uint64_t num_free[])
+{
+	odp_pool_stats_selected_t stats;
+	odp_pool_stats_opt_t opt;
+
+	opt.all = 0;
+	opt.bit.available = 1;
+	opt.bit.cache_available = 1;
+
+	for (uint32_t i = 0; i < num_class; i++) {
+		CU_ASSERT_FATAL(odp_pool_stats_subparam(pool, i, &stats, &opt) == 0);
+		num_free[i] = stats.available + stats.cache_available;
+	}
+}
+
+static void pool_test_packet_subparam_stats(void)
+{
+	odp_pool_t pool;
+	odp_pool_param_t param;
+	odp_pool_stats_t stats;
+	odp_pool_stats_selected_t sub_stats;
+	odp_pool_stats_opt_t opt;
+	uint64_t num_free[3], prev_free[3];
+	uint64_t total;
+	uint32_t i, j;
+	const uint32_t num = 10;
+	const uint32_t num_class = 3;
+	const uint32_t len[] = {100, 1000, 5000};
+	odp_packet_t pkt[3];
+
+	CU_ASSERT_FATAL(global_pool_capa.pkt.max_len == 0 ||
+			global_pool_capa.pkt.max_len >= len[num_class - 1]);
+
+	odp_pool_param_init(&param);
+
+	param.type                      = ODP_POOL_PACKET;
+	param.pkt.num                   = num;
+	param.pkt.len                   = len[0];
+	param.pkt.num_subparam          = num_class - 1;
+	param.stats.bit.available       = 1;
+	param.stats.bit.cache_available = 1;
+
+	for (i = 1; i < num_class; i++) {
+		param.pkt.sub[i - 1].num = num;
+		param.pkt.sub[i - 1].len = len[i];
+	}
+
+	pool = odp_pool_create(NULL, &param);
+	CU_ASSERT_FATAL(pool != ODP_POOL_INVALID);
+
+	opt.all = 0;
+	opt.bit.available = 1;
+	CU_ASSERT(odp_pool_stats_subparam(pool, num_class, &sub_stats, &opt) < 0);
+
+	packet_subparam_free(pool, num_class, prev_free);
+
+	for (i = 0; i < num_class; i++)
+		CU_ASSERT(prev_free[i] >= num);
+
+	/* Each packet is allocated from the subparameter that fits its length */
+	for (i = 0; i < num_class; i++) {
+		pkt[i] = odp_packet_alloc(pool, len[i]);
+		CU_ASSERT_FATAL(pkt[i] != ODP_PACKET_INVALID);
+		CU_ASSERT(odp_packet_len(pkt[i]) == len[i]);
+		CU_ASSERT(odp_packet_pool(pkt[i]) == pool);
+		CU_ASSERT(odp_event_pool(odp_packet_to_event(pkt[i])) == pool);
+
+		packet_subparam_free(pool, num_class, num_free);
+
+		for (j = 0; j < num_class; j++) {
+			if (j == i)
+				CU_ASSERT(num_free[j] + 1 == prev_free[j]);
+			else
+				CU_ASSERT(num_free[j] == prev_free[j]);
+
+			prev_free[j] = num_free[j];
+		}
+	}
+
+	/* Pool level counters are sums over subparameters */
+	memset(&stats, 0xff, sizeof(stats));
+	stats.thread.first = 0;
+	stats.thread.last = 0;
+	CU_ASSERT_FATAL(odp_pool_stats(pool, &stats) == 0);
+
+	total = 0;
+
+	for (i = 0; i < num_class; i++)
+		total += num_free[i];
+
+	CU_ASSERT(stats.available + stats.cache_available == total);
+
+	/* Packets allocated from the same pool may be freed together */
+	odp_packet_free_sp(pkt, num_class);
+
+	packet_subparam_free(pool, num_class, num_free);
+
+	for (i = 0; i < num_class; i++)
+		CU_ASSERT(num_free[i] == prev_free[i] + 1);
+
+	CU_ASSERT(odp_pool_destroy(pool) == 0);
+}
+
 static void pool_test_alloc_timeout(void)
 {
 	alloc_timeout(default_pool_param.tmo.cache_size);
@@ -2627,6 +2741,8 @@ odp_testinfo_t pool_suite[] = {
 	ODP_TEST_INFO(pool_test_alloc_packet_min_cache),
 	ODP_TEST_INFO(pool_test_alloc_packet_max_cache),
 	ODP_TEST_INFO(pool_test_alloc_packet_subparam),
+	ODP_TEST_INFO_CONDITIONAL(pool_test_packet_subparam_stats,
+				  pool_check_packet_subparam_stats),
 	ODP_TEST_INFO(pool_test_alloc_timeout),
 	ODP_TEST_INFO(pool_test_alloc_timeout_min_cache),
 	ODP_TEST_INFO(pool_test_alloc_timeout_max_cache),
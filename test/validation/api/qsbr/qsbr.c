@@ -0,0 +1,376 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright (c) 2026 Nokia
+ */
+
+#include <odp_api.h>
+#include <odp/helper/odph_api.h>
+
+#include "odp_cunit_common.h"
+
+#include <string.h>
+
+#define NUM_DEFER   8
+#define NUM_OBJ     64
+#define NUM_ROUNDS  2000
+#define MAX_WORKERS 32
+#define OBJ_MAGIC   0x600dcafe
+
+typedef struct obj_t {
+	odp_atomic_u32_t magic;
+	struct obj_t *next;
+
+} obj_t;
+
+typedef struct global_t {
+	odp_qsbr_capability_t capa;
+	odp_qsbr_t qsbr;
+	odp_atomic_u32_t stop;
+	odp_atomic_u32_t ready;
+	odp_atomic_u32_t quiescent;
+	odp_atomic_u32_t errors;
+	odp_atomic_u64_t obj_ptr;
+	obj_t obj[NUM_OBJ];
+	obj_t *free_list;
+	uint32_t num_freed;
+
+} global_t;
+
+static global_t global;
+
+static int qsbr_suite_init(void)
+{
+	memset(&global, 0, sizeof(global));
+
+	if (odp_qsbr_capability(&global.capa)) {
+		ODPH_ERR("QSBR capability failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static odp_qsbr_t create_domain(const char *name, uint32_t num_defer, odp_bool_t sched)
+{
+	odp_qsbr_param_t param;
+
+	odp_qsbr_param_init(&param);
+	param.num_defer       = num_defer;
+	param.sched_quiescent = sched;
+
+	return odp_qsbr_create(name, &param);
+}
+
+static void count_free(void *ptr)
+{
+	CU_ASSERT(ptr == &global);
+	global.num_freed++;
+}
+
+static void qsbr_capability(void)
+{
+	odp_qsbr_capability_t capa;
+
+	memset(&capa, 0, sizeof(capa));
+	CU_ASSERT_FATAL(odp_qsbr_capability(&capa) == 0);
+
+	CU_ASSERT(capa.max_domains > 0);
+	CU_ASSERT(capa.max_defer >= NUM_DEFER);
+}
+
+static void qsbr_param_defaults(void)
+{
+	odp_qsbr_param_t param;
+
+	memset(&param, 0x55, sizeof(param));
+	odp_qsbr_param_init(&param);
+
+	CU_ASSERT(param.num_defer == 0);
+	CU_ASSERT(param.sched_quiescent == false);
+}
+
+static void qsbr_create(void)
+{
+	odp_qsbr_t qsbr;
+	const char *name = "test_qsbr";
+
+	qsbr = create_domain(name, NUM_DEFER, false);
+	CU_ASSERT_FATAL(qsbr != ODP_QSBR_INVALID);
+
+	printf("\n    QSBR domain handle: 0x%" PRIx64 "\n", odp_qsbr_to_u64(qsbr));
+
+	CU_ASSERT(odp_qsbr_lookup(name) == qsbr);
+
+	odp_qsbr_print(qsbr);
+
+	CU_ASSERT_FATAL(odp_qsbr_destroy(qsbr) == 0);
+	CU_ASSERT(odp_qsbr_lookup(name) == ODP_QSBR_INVALID);
+}
+
+static void qsbr_create_long_name(void)
+{
+	odp_qsbr_t qsbr;
+	char name[ODP_QSBR_NAME_LEN];
+
+	memset(name, 'a', sizeof(name));
+	name[sizeof(name) - 1] = 0;
+
+	qsbr = create_domain(name, 0, false);
+	CU_ASSERT_FATAL(qsbr != ODP_QSBR_INVALID);
+	CU_ASSERT(odp_qsbr_lookup(name) == qsbr);
+	CU_ASSERT(odp_qsbr_destroy(qsbr) == 0);
+}
+
+static void qsbr_create_max(void)
+{
+	uint32_t num = ODPH_MIN(global.capa.max_domains, 256u);
+	odp_qsbr_t qsbr[num];
+	uint32_t i, num_created = 0;
+
+	for (i = 0; i < num; i++) {
+		qsbr[i] = create_domain(NULL, NUM_DEFER, false);
+		CU_ASSERT(qsbr[i] != ODP_QSBR_INVALID);
+		if (qsbr[i] == ODP_QSBR_INVALID)
+			break;
+		num_created++;
+	}
+
+	for (i = 0; i < num_created; i++)
+		CU_ASSERT(odp_qsbr_destroy(qsbr[i]) == 0);
+}
+
+static void qsbr_online_offline(void)
+{
+	odp_qsbr_t qsbr;
+	uint64_t token;
+
+	qsbr = create_domain(NULL, 0, false);
+	CU_ASSERT_FATAL(qsbr != ODP_QSBR_INVALID);
+
+	/* No threads online */
+	token = odp_qsbr_start(qsbr);
+	CU_ASSERT(odp_qsbr_check(qsbr, token, false) == 1);
+
+	/* Calling thread is considered quiescent */
+	CU_ASSERT_FATAL(odp_qsbr_thread_online(qsbr) == 0);
+	odp_qsbr_quiescent(qsbr);
+	token = odp_qsbr_start(qsbr);
+	CU_ASSERT(odp_qsbr_check(qsbr, token, false) == 1);
+	odp_qsbr_synchronize(qsbr);
+
+	/* Online thread cannot be destroyed */
+	CU_ASSERT(odp_qsbr_destroy(qsbr) < 0);
+
+	odp_qsbr_thread_offline(qsbr);
+	CU_ASSERT(odp_qsbr_destroy(qsbr) == 0);
+}
+
+static int blocking_reader(void *arg)
+{
+	odp_qsbr_t qsbr = global.qsbr;
+	int sched = *(int *)arg;
+
+	odp_qsbr_thread_online(qsbr);
+	odp_atomic_store_rel_u32(&global.ready, 1);
+
+	while (odp_atomic_load_acq_u32(&global.quiescent) == 0)
+		odp_cpu_pause();
+
+	if (sched)
+		CU_ASSERT(odp_schedule(NULL, ODP_SCHED_NO_WAIT) == ODP_EVENT_INVALID);
+	else
+		odp_qsbr_quiescent(qsbr);
+
+	odp_atomic_store_rel_u32(&global.ready, 2);
+
+	while (odp_atomic_load_acq_u32(&global.stop) == 0)
+		odp_cpu_pause();
+
+	odp_qsbr_thread_offline(qsbr);
+
+	return 0;
+}
+
+static void defer_test(int sched)
+{
+	void *arg[1] = {&sched};
+	uint64_t token;
+	int i;
+
+	global.qsbr = create_domain(NULL, NUM_DEFER, sched);
+	CU_ASSERT_FATAL(global.qsbr != ODP_QSBR_INVALID);
+	global.num_freed = 0;
+	odp_atomic_init_u32(&global.ready, 0);
+	odp_atomic_init_u32(&global.quiescent, 0);
+	odp_atomic_init_u32(&global.stop, 0);
+
+	CU_ASSERT_FATAL(odp_cunit_thread_create(1, blocking_reader, arg, 0, 0) == 1);
+
+	while (odp_atomic_load_acq_u32(&global.ready) != 1)
+		odp_cpu_pause();
+
+	/* Reader is online and has not reported a quiescent state */
+	token = odp_qsbr_start(global.qsbr);
+	CU_ASSERT(odp_qsbr_check(global.qsbr, token, false) == 0);
+
+	for (i = 0; i < NUM_DEFER; i++)
+		CU_ASSERT(odp_qsbr_defer(global.qsbr, count_free, &global) == 0);
+
+	/* Queue is full */
+	CU_ASSERT(odp_qsbr_defer(global.qsbr, count_free, &global) < 0);
+	CU_ASSERT(odp_qsbr_reclaim(global.qsbr, NUM_DEFER) == 0);
+	CU_ASSERT(global.num_freed == 0);
+
+	odp_atomic_store_rel_u32(&global.quiescent, 1);
+
+	while (odp_atomic_load_acq_u32(&global.ready) != 2)
+		odp_cpu_pause();
+
+	CU_ASSERT(odp_qsbr_check(global.qsbr, token, false) == 1);
+	CU_ASSERT(odp_qsbr_reclaim(global.qsbr, 1) == 1);
+	CU_ASSERT(odp_qsbr_reclaim(global.qsbr, NUM_DEFER) == NUM_DEFER - 1);
+	CU_ASSERT(global.num_freed == NUM_DEFER);
+
+	/* Pending frees are executed on destroy */
+	CU_ASSERT(odp_qsbr_defer(global.qsbr, count_free, &global) == 0);
+
+	odp_atomic_store_rel_u32(&global.stop, 1);
+	CU_ASSERT(odp_cunit_thread_join(1) >= 0);
+
+	CU_ASSERT(odp_qsbr_destroy(global.qsbr) == 0);
+	CU_ASSERT(global.num_freed == NUM_DEFER + 1);
+}
+
+static void qsbr_defer(void)
+{
+	defer_test(0);
+}
+
+static void qsbr_defer_sched(void)
+{
+	defer_test(1);
+}
+
+static void obj_free(void *ptr)
+{
+	obj_t *obj = ptr;
+
+	/* Poison the object, so that readers would notice use after free */
+	odp_atomic_store_u32(&obj->magic, 0);
+	obj->next = global.free_list;
+	global.free_list = obj;
+	global.num_freed++;
+}
+
+static int reader_thread(void *arg ODP_UNUSED)
+{
+	odp_qsbr_t qsbr = global.qsbr;
+	uint32_t i = 0;
+
+	odp_qsbr_thread_online(qsbr);
+
+	while (odp_atomic_load_u32(&global.stop) == 0) {
+		obj_t *obj = (obj_t *)(uintptr_t)odp_atomic_load_acq_u64(&global.obj_ptr);
+
+		for (int j = 0; j < 8; j++) {
+			if (odp_atomic_load_u32(&obj->magic) != OBJ_MAGIC)
+				odp_atomic_inc_u32(&global.errors);
+		}
+
+		if ((i++ & 0x3) == 0)
+			odp_qsbr_quiescent(qsbr);
+	}
+
+	odp_qsbr_thread_offline(qsbr);
+
+	return 0;
+}
+
+static void qsbr_concurrent(void)
+{
+	odp_cpumask_t mask;
+	uint32_t round, num_defer = 0;
+	int num_workers, i;
+
+	num_workers = odp_cpumask_default_worker(&mask, 0);
+	num_workers = ODPH_MIN(ODPH_MAX(num_workers - 1, 1), MAX_WORKERS);
+
+	global.qsbr = create_domain(NULL, NUM_OBJ / 2, false);
+	CU_ASSERT_FATAL(global.qsbr != ODP_QSBR_INVALID);
+	odp_atomic_init_u32(&global.stop, 0);
+	odp_atomic_init_u32(&global.errors, 0);
+	global.num_freed = 0;
+	global.free_list = NULL;
+
+	for (i = NUM_OBJ - 1; i > 0; i--) {
+		odp_atomic_init_u32(&global.obj[i].magic, 0);
+		global.obj[i].next = global.free_list;
+		global.free_list = &global.obj[i];
+	}
+
+	odp_atomic_init_u32(&global.obj[0].magic, OBJ_MAGIC);
+	odp_atomic_init_u64(&global.obj_ptr, (uintptr_t)&global.obj[0]);
+
+	CU_ASSERT_FATAL(odp_cunit_thread_create(num_workers, reader_thread, NULL, 0, 0) ==
+			num_workers);
+
+	/* Replace the shared object and defer free of the old one */
+	for (round = 0; round < NUM_ROUNDS; round++) {
+		obj_t *old = (obj_t *)(uintptr_t)odp_atomic_load_u64(&global.obj_ptr);
+		obj_t *obj = global.free_list;
+
+		while (obj == NULL) {
+			odp_qsbr_reclaim(global.qsbr, NUM_OBJ);
+			obj = global.free_list;
+		}
+
+		global.free_list = obj->next;
+		odp_atomic_store_u32(&obj->magic, OBJ_MAGIC);
+		odp_atomic_store_rel_u64(&global.obj_ptr, (uintptr_t)obj);
+
+		while (odp_qsbr_defer(global.qsbr, obj_free, old))
+			odp_cpu_pause();
+
+		num_defer++;
+	}
+
+	odp_atomic_store_u32(&global.stop, 1);
+	CU_ASSERT(odp_cunit_thread_join(num_workers) >= 0);
+
+	CU_ASSERT(odp_atomic_load_u32(&global.errors) == 0);
+	CU_ASSERT(odp_qsbr_destroy(global.qsbr) == 0);
+	CU_ASSERT(global.num_freed == num_defer);
+}
+
+odp_testinfo_t qsbr_suite[] = {
+	ODP_TEST_INFO(qsbr_capability),
+	ODP_TEST_INFO(qsbr_param_defaults),
+	ODP_TEST_INFO(qsbr_create),
+	ODP_TEST_INFO(qsbr_create_long_name),
+	ODP_TEST_INFO(qsbr_create_max),
+	ODP_TEST_INFO(qsbr_online_offline),
+	ODP_TEST_INFO(qsbr_defer),
+	ODP_TEST_INFO(qsbr_defer_sched),
+	ODP_TEST_INFO(qsbr_concurrent),
+	ODP_TEST_INFO_NULL,
+};
+
+odp_suiteinfo_t qsbr_suites[] = {
+	{"QSBR", qsbr_suite_init, NULL, qsbr_suite},
+	ODP_SUITE_INFO_NULL
+};
+
+int main(int argc, char *argv[])
+{
+	int ret;
+
+	/* parse common options: */
+	if (odp_cunit_parse_options(&argc, argv))
+		return -1;
+
+	ret = odp_cunit_register(qsbr_suites);
+
+	if (ret == 0)
+		ret = odp_cunit_run();
+
+	return ret;
+}
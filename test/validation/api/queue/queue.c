@@ -1678,6 +1678,164 @@ static void queue_test_aggr_sched_queue(void)
 	aggr_queue_test(&capa.aggr, ODP_QUEUE_TYPE_SCHED);
 }
 
+/*
+ * Test that a partial event vector is output after aggregation timeout
+ */
+static void aggr_queue_tmo_test(const odp_event_aggr_capability_t *capa,
+				odp_queue_type_t queue_type)
+{
+	odp_pool_t buf_pool, evv_pool;
+	odp_pool_param_t pool_param;
+	odp_queue_param_t param;
+	odp_queue_t queue, aggr_queue;
+	odp_event_aggr_config_t aggr;
+	odp_time_t start;
+	uint32_t vector_size = 4;
+	uint32_t num_from_queue = 0, num_from_aggr = 0;
+	uint32_t num_events;
+	uint64_t timeout = 10 * ODP_TIME_MSEC_IN_NS;
+	odp_event_t event = ODP_EVENT_INVALID;
+
+	if (vector_size > capa->max_size)
+		vector_size = capa->max_size;
+
+	if (timeout > capa->max_tmo_ns)
+		timeout = capa->max_tmo_ns;
+
+	if (timeout < capa->min_tmo_ns)
+		timeout = capa->min_tmo_ns;
+
+	/* Less events than fits into a vector */
+	num_events = vector_size - 1;
+
+	odp_pool_param_init(&pool_param);
+	pool_param.buf.size = sizeof(aggr_test_event_t);
+	pool_param.buf.num = num_events;
+	pool_param.type = ODP_POOL_BUFFER;
+	buf_pool = odp_pool_create(NULL, &pool_param);
+	CU_ASSERT_FATAL(buf_pool != ODP_POOL_INVALID);
+
+	odp_pool_param_init(&pool_param);
+	pool_param.type = ODP_POOL_EVENT_VECTOR;
+	pool_param.event_vector.num = 1;
+	pool_param.event_vector.max_size = vector_size;
+	evv_pool = odp_pool_create(NULL, &pool_param);
+	CU_ASSERT_FATAL(evv_pool != ODP_POOL_INVALID);
+
+	memset(&aggr, 0, sizeof(aggr));
+	aggr.pool = evv_pool;
+	aggr.max_size = vector_size;
+	aggr.event_type = ODP_EVENT_BUFFER;
+	aggr.max_tmo_ns = timeout;
+
+	odp_queue_param_init(&param);
+	param.type = queue_type;
+	param.size = num_events;
+	param.num_aggr = 1;
+	param.aggr = &aggr;
+
+	queue = odp_queue_create("queue_test_aggr_tmo", &param);
+	CU_ASSERT_FATAL(queue != ODP_QUEUE_INVALID);
+
+	aggr_queue = odp_queue_aggr(queue, 0);
+	CU_ASSERT_FATAL(aggr_queue != ODP_QUEUE_INVALID);
+
+	for (uint32_t i = 0; i < num_events; i++) {
+		odp_buffer_t buf = odp_buffer_alloc(buf_pool);
+		aggr_test_event_t *test_event;
+
+		CU_ASSERT_FATAL(buf != ODP_BUFFER_INVALID);
+
+		test_event = odp_buffer_addr(buf);
+		test_event->from_aggr = true;
+		test_event->seq_num = i;
+
+		CU_ASSERT_FATAL(odp_queue_enq(aggr_queue, odp_buffer_to_event(buf)) == 0);
+	}
+
+	/* Vector is not full, so it is output only after the timeout */
+	start = odp_time_local();
+
+	while (odp_time_diff_ns(odp_time_local(), start) < 100 * timeout) {
+		odp_queue_t src_queue = queue;
+
+		if (queue_type == ODP_QUEUE_TYPE_PLAIN)
+			event = odp_queue_deq(queue);
+		else
+			event = odp_schedule(&src_queue, ODP_SCHED_NO_WAIT);
+
+		if (event != ODP_EVENT_INVALID) {
+			CU_ASSERT(src_queue == queue);
+			break;
+		}
+	}
+
+	CU_ASSERT_FATAL(event != ODP_EVENT_INVALID);
+	CU_ASSERT(odp_time_diff_ns(odp_time_local(), start) + ODP_TIME_MSEC_IN_NS >= timeout);
+
+	if (odp_event_type(event) == ODP_EVENT_VECTOR) {
+		odp_event_t *event_tbl;
+		odp_event_vector_t evv = odp_event_vector_from_event(event);
+		uint32_t num = odp_event_vector_tbl(evv, &event_tbl);
+
+		CU_ASSERT(num == num_events);
+		CU_ASSERT(odp_event_vector_type(evv) == ODP_EVENT_BUFFER);
+
+		for (uint32_t i = 0; i < num; i++)
+			verify_event_seq(event_tbl[i], true, &num_from_queue, &num_from_aggr);
+	} else {
+		CU_ASSERT(odp_event_type(event) == ODP_EVENT_BUFFER);
+		CU_ASSERT(num_events == 1);
+		verify_event_seq(event, false, &num_from_queue, &num_from_aggr);
+	}
+	odp_event_free(event);
+
+	CU_ASSERT(num_from_aggr == num_events);
+	CU_ASSERT(num_from_queue == 0);
+
+	CU_ASSERT(odp_queue_destroy(queue) == 0);
+	CU_ASSERT(odp_pool_destroy(evv_pool) == 0);
+	CU_ASSERT(odp_pool_destroy(buf_pool) == 0);
+}
+
+static void queue_test_aggr_tmo_plain_queue(void)
+{
+	odp_queue_capability_t capa;
+
+	CU_ASSERT_FATAL(odp_queue_capability(&capa) == 0);
+	aggr_queue_tmo_test(&capa.plain.aggr, ODP_QUEUE_TYPE_PLAIN);
+}
+
+static void queue_test_aggr_tmo_sched_queue(void)
+{
+	odp_schedule_capability_t capa;
+
+	CU_ASSERT_FATAL(odp_schedule_capability(&capa) == 0);
+	aggr_queue_tmo_test(&capa.aggr, ODP_QUEUE_TYPE_SCHED);
+}
+
+static int check_plain_queue_aggr_tmo(void)
+{
+	odp_queue_capability_t capa;
+
+	if (odp_queue_capability(&capa))
+		return ODP_TEST_INACTIVE;
+
+	return capa.plain.aggr.max_num > 0 && capa.plain.aggr.max_tmo_ns > 0 &&
+	       capa.plain.aggr.max_size >= 2 ? ODP_TEST_ACTIVE : ODP_TEST_INACTIVE;
+}
+
+static int check_sched_queue_aggr_tmo(void)
+{
+	odp_schedule_capability_t capa;
+
+	if (odp_schedule_capability(&capa))
+		return ODP_TEST_INACTIVE;
+
+	return capa.aggr.max_num > 0 && capa.aggr.max_tmo_ns > 0 &&
+	       capa.aggr.max_size >= 2 ? ODP_TEST_ACTIVE : ODP_TEST_INACTIVE;
+}
+
 odp_testinfo_t queue_suite[] = {
 	ODP_TEST_INFO(queue_test_capa),
 	ODP_TEST_INFO(queue_test_param_init),
@@ -1723,6 +1881,8 @@ odp_testinfo_t queue_suite[] = {
 	ODP_TEST_INFO_CONDITIONAL(queue_test_aggr_cfg_max_sched, check_sched_queue_aggr),
 	ODP_TEST_INFO_CONDITIONAL(queue_test_aggr_plain_queue, check_plain_queue_aggr),
 	ODP_TEST_INFO_CONDITIONAL(queue_test_aggr_sched_queue, check_sched_queue_aggr),
+	ODP_TEST_INFO_CONDITIONAL(queue_test_aggr_tmo_plain_queue, check_plain_queue_aggr_tmo),
+	ODP_TEST_INFO_CONDITIONAL(queue_test_aggr_tmo_sched_queue, check_sched_queue_aggr_tmo),
 	ODP_TEST_INFO_NULL,
 };
 
@@ -2685,6 +2685,66 @@ static void scheduler_test_order_wait_1_thread(void)
 	CU_ASSERT(odp_queue_destroy(queue) == 0);
 }
 
+static void scheduler_test_stats(void)
+{
+	odp_schedule_capability_t capa;
+	odp_schedule_stats_t stats;
+	odp_schedule_queue_stats_t queue_stats;
+	odp_queue_param_t queue_param;
+	odp_queue_t queue;
+	odp_event_t ev;
+	uint64_t num_hist;
+	const int num = 10;
+
+	CU_ASSERT_FATAL(odp_schedule_capability(&capa) == 0);
+
+	if (capa.stats == ODP_SUPPORT_NO) {
+		CU_ASSERT(odp_schedule_stats(&stats) < 0);
+		odp_schedule_stats_reset();
+		return;
+	}
+
+	sched_queue_param_init(&queue_param);
+	queue_param.sched.sync = ODP_SCHED_SYNC_PARALLEL;
+	queue = odp_queue_create("stats queue", &queue_param);
+	CU_ASSERT_FATAL(queue != ODP_QUEUE_INVALID);
+
+	odp_schedule_stats_reset();
+
+	for (int i = 0; i < num; i++)
+		enqueue_event(queue);
+
+	for (int i = 0; i < num; i++) {
+		ev = odp_schedule(NULL, ODP_SCHED_WAIT);
+		CU_ASSERT_FATAL(ev != ODP_EVENT_INVALID);
+		odp_event_free(ev);
+	}
+
+	/* Release the context */
+	ev = odp_schedule(NULL, ODP_SCHED_NO_WAIT);
+	CU_ASSERT(ev == ODP_EVENT_INVALID);
+
+	CU_ASSERT_FATAL(odp_schedule_queue_stats(queue, &queue_stats) == 0);
+	CU_ASSERT(queue_stats.num_events == (uint64_t)num);
+
+	num_hist = 0;
+	for (int i = 0; i < ODP_SCHEDULE_WAIT_HIST_BUCKETS; i++)
+		num_hist += queue_stats.wait_hist[i];
+
+	CU_ASSERT(num_hist == (uint64_t)num);
+
+	CU_ASSERT_FATAL(odp_schedule_thread_stats(odp_thread_id(), &stats) == 0);
+	CU_ASSERT(stats.num_events >= (uint64_t)num);
+	CU_ASSERT(stats.num_rounds > 0);
+	CU_ASSERT(stats.num_empty > 0);
+	CU_ASSERT(stats.num_empty <= stats.num_rounds);
+
+	CU_ASSERT_FATAL(odp_schedule_stats(&stats) == 0);
+	CU_ASSERT(stats.num_events >= (uint64_t)num);
+
+	CU_ASSERT(odp_queue_destroy(queue) == 0);
+}
+
 static int order_wait_helper(void *arg ODP_UNUSED)
 {
 	odp_event_t ev;
@@ -4014,6 +4074,7 @@ odp_testinfo_t scheduler_basic_suite[] = {
 	ODP_TEST_INFO(scheduler_test_ordered_lock),
 	ODP_TEST_INFO(scheduler_test_order_wait_1_thread),
 	ODP_TEST_INFO(scheduler_test_order_wait_2_threads),
+	ODP_TEST_INFO(scheduler_test_stats),
 	ODP_TEST_INFO_CONDITIONAL(scheduler_test_flow_aware,
 				  check_flow_aware_support),
 	ODP_TEST_INFO(scheduler_test_parallel),
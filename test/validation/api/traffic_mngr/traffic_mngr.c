@@ -54,6 +54,7 @@
 
 #define MIN_SHAPER_BW_RCV_GAP    80   /* Percent of expected_rcv_gap */
 #define MAX_SHAPER_BW_RCV_GAP    125  /* Percent of expected_rcv_gap */
+#define SHAPER_RATE_TOLERANCE    10   /* Percent of shaper rate */
 
 #define MIN_PKT_THRESHOLD        10
 #define MIN_BYTE_THRESHOLD       2048
@@ -1832,6 +1833,8 @@ set_reqs_based_on_capas(odp_tm_requirements_t *req)
 	    tm_capabilities.tm_queue_threshold.packet ||
 	    tm_capabilities.tm_queue_threshold.byte_and_packet)
 		req->tm_queue_threshold_needed = true;
+	if (tm_capabilities.tm_queue_fq.supported)
+		req->tm_queue_fq_needed = true;
 
 	for (j = 0; j < tm_capabilities.max_levels; j++) {
 		if (tm_capabilities.per_level[j].tm_node_threshold.byte ||
@@ -1877,7 +1880,8 @@ static int create_tm_system(void)
 	odp_tm_requirements_init(&requirements);
 	odp_tm_egress_init(&egress);
 
-	requirements.max_tm_queues              = NUM_TM_QUEUES;
+	/* One extra queue for the flow queuing test */
+	requirements.max_tm_queues              = NUM_TM_QUEUES + 1;
 	requirements.num_levels                 = NUM_LEVELS;
 
 	set_reqs_based_on_capas(&requirements);
@@ -3062,6 +3066,137 @@ static int test_shaper_bw(const char *shaper_name,
 	return ret_code;
 }
 
+static int test_shaper_rate(const char *node_name, uint8_t priority, uint64_t commit_bps)
+{
+	odp_tm_queue_t tm_queue;
+	pkt_info_t pkt_info;
+	xmt_pkt_desc_t *xmt_pkt_desc;
+	odp_time_t first_rcv_time = ODP_TIME_NULL, last_rcv_time = ODP_TIME_NULL;
+	uint64_t duration_ns, rate_bps, diff;
+	uint32_t pkt_idx, pkt_len, pkts_sent, pkts_rcvd;
+	const uint32_t num_pkts = 50;
+	const uint64_t pkt_bits = 10000;
+	int ret = 0;
+
+	/* Send a burst of packets through a node shaped to commit_bps. Each packet occupies
+	 * 10,000 bit times on the wire. After the first packet, which is passed with the
+	 * commit burst, the shaper releases the packets at commit_bps, so the output rate is
+	 * measured from the receive times of the first and the last packet. */
+	tm_queue = find_tm_queue(0, node_name, priority);
+	if (set_shaper(node_name, "shaper_rate", commit_bps, pkt_bits) != 0)
+		return -1;
+
+	init_xmt_pkts(&pkt_info);
+	pkt_len            = (pkt_bits / 8) - (ETHERNET_OVHD_LEN + CRC_LEN);
+	pkt_info.pkt_class = 1;
+	if (make_pkts(num_pkts, pkt_len, &pkt_info) != 0)
+		return -1;
+
+	pkts_sent = send_pkts(tm_queue, num_pkts);
+	num_rcv_pkts = receive_pkts(odp_tm_systems[0], rcv_pktin, pkts_sent, commit_bps);
+
+	pkts_rcvd = 0;
+	for (pkt_idx = 0; pkt_idx < num_pkts_sent; pkt_idx++) {
+		xmt_pkt_desc = &xmt_pkt_descs[pkt_idx];
+		if (!xmt_pkt_desc->was_rcvd || xmt_pkt_desc->pkt_class != pkt_info.pkt_class)
+			continue;
+
+		if (pkts_rcvd == 0 || odp_time_cmp(xmt_pkt_desc->rcv_time, first_rcv_time) < 0)
+			first_rcv_time = xmt_pkt_desc->rcv_time;
+		if (pkts_rcvd == 0 || odp_time_cmp(xmt_pkt_desc->rcv_time, last_rcv_time) > 0)
+			last_rcv_time = xmt_pkt_desc->rcv_time;
+		pkts_rcvd++;
+	}
+
+	if (pkts_rcvd < pkts_sent || pkts_rcvd < 2) {
+		ODPH_ERR("Sent %" PRIu32 " pkts but %" PRIu32 " came back\n", pkts_sent,
+			 pkts_rcvd);
+		ret = -1;
+		goto exit;
+	}
+
+	duration_ns = odp_time_diff_ns(last_rcv_time, first_rcv_time);
+	if (duration_ns == 0) {
+		ODPH_ERR("All pkts received at the same time\n");
+		ret = -1;
+		goto exit;
+	}
+
+	rate_bps = ((pkts_rcvd - 1) * pkt_bits * ODP_TIME_SEC_IN_NS) / duration_ns;
+	diff = rate_bps > commit_bps ? rate_bps - commit_bps : commit_bps - rate_bps;
+
+	if (diff * 100 > commit_bps * SHAPER_RATE_TOLERANCE) {
+		ODPH_ERR("Shaper rate %" PRIu64 " bps, measured output rate %" PRIu64 " bps\n",
+			 commit_bps, rate_bps);
+		ret = -1;
+	}
+
+exit:
+	/* Disable the shaper, so as to get the pkts out quicker. */
+	set_shaper(node_name, NULL, 0, 0);
+	flush_leftover_pkts(odp_tm_systems[0], rcv_pktin);
+	CU_ASSERT(odp_tm_is_idle(odp_tm_systems[0]));
+	return ret;
+}
+
+static void traffic_mngr_test_shaper_accuracy(void)
+{
+	odp_tm_shaper_params_t shaper_params, read_params;
+	odp_tm_shaper_t profile;
+	uint64_t rate, diff;
+	uint64_t test_rate[] = {1 * MBPS, 10 * MBPS, 100 * MBPS, 1 * GBPS,
+				10ULL * GBPS, 25ULL * GBPS, 40ULL * GBPS, 100ULL * GBPS};
+	uint64_t burst_test_rate[] = {1 * MBPS, 10 * MBPS, 100 * MBPS};
+	const uint32_t num_rates = ODPH_ARRAY_SIZE(test_rate);
+	char name[ODP_TM_NAME_LEN];
+	uint32_t i;
+
+	/* Check that the rate is stored with better than 0.1% accuracy
+	 * over the supported rate range. */
+	for (i = 0; i < num_rates; i++) {
+		rate = test_rate[i];
+
+		if (rate < tm_shaper_min_rate || rate > tm_shaper_max_rate)
+			continue;
+
+		odp_tm_shaper_params_init(&shaper_params);
+		shaper_params.commit_rate  = rate;
+		shaper_params.commit_burst = clamp_burst(MIN_COMMIT_BURST);
+		shaper_params.peak_rate    = rate;
+		shaper_params.peak_burst   = clamp_burst(MIN_PEAK_BURST);
+		shaper_params.dual_rate    = true;
+
+		snprintf(name, sizeof(name), "shaper_accuracy_%" PRIu32, i);
+		profile = odp_tm_shaper_create(name, &shaper_params);
+		CU_ASSERT_FATAL(profile != ODP_TM_INVALID);
+
+		CU_ASSERT(odp_tm_shaper_params_read(profile, &read_params) == 0);
+
+		diff = read_params.commit_rate > rate ? read_params.commit_rate - rate :
+							rate - read_params.commit_rate;
+		CU_ASSERT(diff * 1000 <= rate);
+
+		diff = read_params.peak_rate > rate ? read_params.peak_rate - rate :
+						      rate - read_params.peak_rate;
+		CU_ASSERT(diff * 1000 <= rate);
+
+		CU_ASSERT(odp_tm_shaper_destroy(profile) == 0);
+	}
+
+	/* Check the output rate of a shaped node with a timed burst of packets */
+	if (traffic_mngr_check_shaper() == ODP_TEST_INACTIVE)
+		return;
+
+	for (i = 0; i < ODPH_ARRAY_SIZE(burst_test_rate); i++) {
+		rate = burst_test_rate[i];
+
+		if (rate < tm_shaper_min_rate || rate > tm_shaper_max_rate)
+			continue;
+
+		CU_ASSERT(test_shaper_rate("node_1_1_1", 0, rate) == 0);
+	}
+}
+
 static int set_sched_fanin(const char         *node_name,
 			   const char         *sched_base_name,
 			   odp_tm_sched_mode_t sched_mode,
@@ -4466,6 +4601,7 @@ static void test_defaults(uint8_t fill)
 	CU_ASSERT(!req.tm_queue_wred_needed);
 	CU_ASSERT(!req.tm_queue_dual_slope_needed);
 	CU_ASSERT(!req.tm_queue_threshold_needed);
+	CU_ASSERT(!req.tm_queue_fq_needed);
 	CU_ASSERT(!req.vlan_marking_needed);
 	CU_ASSERT(!req.ecn_marking_needed);
 	CU_ASSERT(!req.drop_prec_marking_needed);
@@ -4520,6 +4656,10 @@ static void test_defaults(uint8_t fill)
 		CU_ASSERT(queue.wred_profile[n] == ODP_TM_INVALID);
 	CU_ASSERT(queue.priority == 0);
 	CU_ASSERT(queue.ordered_enqueue);
+	CU_ASSERT(!queue.fq.enable);
+	CU_ASSERT(queue.fq.num_flows > 0);
+	CU_ASSERT(queue.fq.max_pkts > 0);
+	CU_ASSERT(queue.fq.quantum > 0);
 }
 
 static void traffic_mngr_test_default_values(void)
@@ -5156,6 +5296,82 @@ static void traffic_mngr_test_wred_long_name(void)
 	CU_ASSERT(!odp_tm_wred_destroy(profile));
 }
 
+static int traffic_mngr_check_fq(void)
+{
+	if (!tm_capabilities.tm_queue_fq.supported)
+		return ODP_TEST_INACTIVE;
+
+	return ODP_TEST_ACTIVE;
+}
+
+static void traffic_mngr_test_fq(void)
+{
+	odp_tm_queue_params_t queue_params;
+	odp_tm_queue_stats_t stats;
+	odp_tm_queue_t tm_queue;
+	odp_tm_node_t tm_node;
+	pkt_info_t pkt_info;
+	const char *node_name = "node_1_4_1";
+	uint32_t num_heavy = ODPH_MIN(32u, MAX_PKTS / 2);
+	uint32_t num_light = 4;
+	uint32_t num_pkts = num_heavy + num_light;
+	uint32_t idx, pkts_sent, last_heavy = 0, last_light = 0;
+
+	tm_node = find_tm_node(0, node_name);
+	CU_ASSERT_FATAL(tm_node != ODP_TM_INVALID);
+
+	odp_tm_queue_params_init(&queue_params);
+	queue_params.fq.enable = true;
+	queue_params.fq.num_flows = ODPH_MIN(64u, tm_capabilities.tm_queue_fq.max_flows);
+	/* Long CoDel target and interval, so that no packets are dropped */
+	queue_params.fq.target_ns = 10 * ODP_TIME_SEC_IN_NS;
+	queue_params.fq.interval_ns = 10 * ODP_TIME_SEC_IN_NS;
+
+	tm_queue = odp_tm_queue_create(odp_tm_systems[0], &queue_params);
+	CU_ASSERT_FATAL(tm_queue != ODP_TM_INVALID);
+	CU_ASSERT_FATAL(odp_tm_queue_connect(tm_queue, tm_node) == 0);
+
+	init_xmt_pkts(&pkt_info);
+	pkt_info.drop_eligible = false;
+	pkt_info.pkt_class     = 1;
+	CU_ASSERT_FATAL(make_pkts(num_pkts, 128, &pkt_info) == 0);
+
+	/* A heavy flow is enqueued first and a light flow after it */
+	for (idx = 0; idx < num_pkts; idx++)
+		odp_packet_flow_hash_set(xmt_pkts[idx], idx < num_heavy ? 1 : 2);
+
+	/* Slow down the node, so that packets of both flows are queued at the same time */
+	CU_ASSERT_FATAL(set_shaper(node_name, "fq_shaper", 1 * MBPS, 2000) == 0);
+
+	pkts_sent = send_pkts(tm_queue, num_pkts);
+	CU_ASSERT(pkts_sent == num_pkts);
+
+	num_rcv_pkts = receive_pkts(odp_tm_systems[0], rcv_pktin, pkts_sent,
+				    1 * MBPS);
+	CU_ASSERT(num_rcv_pkts == pkts_sent);
+
+	/* Flow queuing serves the light flow before the tail of the heavy flow */
+	for (idx = 0; idx < num_rcv_pkts; idx++) {
+		if (rcv_pkt_descs[idx].xmt_pkt_desc == NULL)
+			continue;
+
+		if (rcv_pkt_descs[idx].xmt_idx < num_heavy)
+			last_heavy = idx;
+		else
+			last_light = idx;
+	}
+
+	CU_ASSERT(last_light < last_heavy);
+
+	CU_ASSERT(odp_tm_queue_stats(tm_queue, &stats) == 0);
+	CU_ASSERT(stats.discards == 0);
+
+	set_shaper(node_name, NULL, 0, 0);
+	flush_leftover_pkts(odp_tm_systems[0], rcv_pktin);
+	CU_ASSERT(destroy_tm_queue(tm_queue) == 0);
+	CU_ASSERT(odp_tm_is_idle(odp_tm_systems[0]));
+}
+
 static void traffic_mngr_test_destroy(void)
 {
 	CU_ASSERT(destroy_tm_systems() == 0);
@@ -5166,6 +5382,7 @@ odp_testinfo_t traffic_mngr_suite[] = {
 	ODP_TEST_INFO(traffic_mngr_test_capabilities),
 	ODP_TEST_INFO(traffic_mngr_test_tm_create),
 	ODP_TEST_INFO(traffic_mngr_test_shaper_profile),
+	ODP_TEST_INFO(traffic_mngr_test_shaper_accuracy),
 	ODP_TEST_INFO(traffic_mngr_test_sched_profile),
 	ODP_TEST_INFO_CONDITIONAL(traffic_mngr_test_threshold_profile_byte,
 				  traffic_mngr_check_thresholds_byte),
@@ -5218,6 +5435,7 @@ odp_testinfo_t traffic_mngr_suite[] = {
 				  traffic_mngr_check_thresholds_byte),
 	ODP_TEST_INFO_CONDITIONAL(traffic_mngr_test_wred_long_name,
 				  traffic_mngr_check_wred),
+	ODP_TEST_INFO_CONDITIONAL(traffic_mngr_test_fq, traffic_mngr_check_fq),
 	ODP_TEST_INFO(traffic_mngr_test_destroy),
 	ODP_TEST_INFO_NULL,
 };